@@ -0,0 +1,761 @@
+#include "gfxlib.h"
+
+#define BENCH_WIDTH     640     //benchmark screen size
+#define BENCH_HEIGHT    480
+#define BENCH_CURSOR    32      //mouse cursor size
+#define MAX_SEGMENTS    512     //maximum number of recorded segments
+#define MAX_FRAMES      4096    //maximum number of timed frames per segment
+#define RECT_ROWS       32      //height of rect, pattern, polygon and image primitives
+#define UNALIGNED_X     3       //unaligned start x (aligned start x is 0)
+#define MIN_MEASURE     2000    //minimum measure time of each case (microseconds)
+
+//blend mode masks of primitive benchmark
+#define MODE_BIT(m)     (1U << (m))
+#define MODE_SPANS      ((MODE_BIT(BLEND_MODE_COUNT) - 1) & ~MODE_BIT(BLEND_MODE_ANTIALIASED))
+#define MODE_LINES      (MODE_SPANS | MODE_BIT(BLEND_MODE_ANTIALIASED))
+#define MODE_AA         MODE_BIT(BLEND_MODE_ANTIALIASED)
+
+namespace kernelBench {
+    //benchmark kernel info
+    typedef struct {
+        const char*     name;                       //kernel name
+        int32_t         rounds;                     //number of calls per kernel level
+        void            (*reset)();                 //restore input before each call (can be NULL)
+        void            (*run)();                   //call the kernel
+        void*           data;                       //output data to compare with scalar version
+        uint32_t        size;                       //output data size in bytes
+    } BENCH_KERNEL;
+
+    GFX_IMAGE src1 = { 0 };
+    GFX_IMAGE src2 = { 0 };
+    GFX_IMAGE dst = { 0 };
+    GFX_IMAGE plasma = { 0 };
+    GFX_BITMAP bitmap = { 0 };
+    GFX_MOUSE mouse = { 0 };
+
+    uint8_t sint[256] = { 0 };
+    uint8_t cost[256] = { 0 };
+    uint8_t* buff1 = NULL;
+    uint8_t* buff2 = NULL;
+    uint8_t* scalar = NULL;
+    uint8_t dx = 0, dy = 0, ang = 0;
+
+    //high resolution timer in microseconds
+    double getMicroSeconds()
+    {
+        return double(SDL_GetPerformanceCounter()) * 1000000.0 / double(SDL_GetPerformanceFrequency());
+    }
+
+    void resetDest()
+    {
+        memset(dst.mData, 0, dst.mSize);
+    }
+
+    void resetBlur()
+    {
+        memcpy(dst.mData, src1.mData, dst.mSize);
+    }
+
+    void resetTunnel()
+    {
+        ang = 0;
+    }
+
+    void resetPlasma()
+    {
+        dx = dy = 0;
+    }
+
+    void resetScreen()
+    {
+        memcpy(getDrawBuffer(), src1.mData, src1.mSize);
+    }
+
+    void runBlendImage()
+    {
+        blendImage(&dst, &src1, &src2, 100);
+    }
+
+    void runBlendImageLinear()
+    {
+        blendImage(&dst, &src1, &src2, 100, BLEND_MODE_LINEAR);
+    }
+
+    void runBlurImageEx()
+    {
+        blurImageEx(&dst, &src1, 8);
+    }
+
+    void runBlurImage()
+    {
+        blurImage(&dst);
+    }
+
+    void runBumpImage()
+    {
+        bumpImage(&dst, &src1, &src2, getCenterX() + 20, getCenterY() - 10);
+    }
+
+    void runTunnel()
+    {
+        drawTunnel(&dst, &src2, buff1, buff2, &ang, 1);
+    }
+
+    void runPlasma()
+    {
+        createPlasma(&dx, &dy, sint, cost, &plasma);
+    }
+
+    void runMouseCursor()
+    {
+        drawMouseCursor(&mouse);
+    }
+
+    BENCH_KERNEL kernels[] = {
+        { "blendImage",       100,    NULL,           runBlendImage,        NULL, 0 },
+        { "blendImageLinear", 100,    NULL,           runBlendImageLinear,  NULL, 0 },
+        { "blurImageEx",      20,     NULL,           runBlurImageEx,       NULL, 0 },
+        { "blurImage",        50,     resetBlur,      runBlurImage,         NULL, 0 },
+        { "bumpImage",        50,     resetDest,      runBumpImage,         NULL, 0 },
+        { "drawTunnel",       100,    resetTunnel,    runTunnel,            NULL, 0 },
+        { "createPlasma",     200,    resetPlasma,    runPlasma,            NULL, 0 },
+        { "drawMouseCursor",  2000,   resetScreen,    runMouseCursor,       NULL, 0 }
+    };
+
+    int32_t init()
+    {
+        //fixed seed, all kernel levels get the same input
+        srand(2024);
+
+        if (!newImage(BENCH_WIDTH, BENCH_HEIGHT, &src1)) return 0;
+        if (!newImage(BENCH_WIDTH, BENCH_HEIGHT, &src2)) return 0;
+        if (!newImage(BENCH_WIDTH, BENCH_HEIGHT, &dst)) return 0;
+
+        uint32_t* pix1 = (uint32_t*)src1.mData;
+        uint32_t* pix2 = (uint32_t*)src2.mData;
+        for (uint32_t i = 0; i < (src1.mSize >> 2); i++)
+        {
+            pix1[i] = (random(256) << 24) | (random(256) << 16) | (random(256) << 8) | random(256);
+            pix2[i] = (random(256) << 24) | (random(256) << 16) | (random(256) << 8) | random(256);
+        }
+
+        //tunnel lookup buffers
+        buff1 = (uint8_t*)calloc(dst.mSize >> 2, 1);
+        buff2 = (uint8_t*)calloc(dst.mSize >> 2, 1);
+        if (!buff1 || !buff2) return 0;
+        prepareTunnel(&dst, buff1, buff2);
+
+        //plasma use 8 bits image
+        plasma.mWidth = IMAGE_WIDTH;
+        plasma.mHeight = IMAGE_HEIGHT;
+        plasma.mRowBytes = IMAGE_WIDTH;
+        plasma.mSize = IMAGE_SIZE;
+        plasma.mData = calloc(IMAGE_SIZE, 1);
+        if (!plasma.mData) return 0;
+
+        for (int32_t i = 0; i < 256; i++)
+        {
+            sint[i] = uint8_t(sin(i * M_PI / 128) * 127 + 128);
+            cost[i] = uint8_t(cos(i * M_PI / 128) * 127 + 128);
+        }
+
+        //cursor image with transparent (black) pixels
+        bitmap.mbData = (uint8_t*)calloc(BENCH_CURSOR * BENCH_CURSOR, 4);
+        mouse.msUnder = (uint8_t*)calloc(BENCH_CURSOR * BENCH_CURSOR, 4);
+        if (!bitmap.mbData || !mouse.msUnder) return 0;
+
+        uint32_t* pcursor = (uint32_t*)bitmap.mbData;
+        for (int32_t i = 0; i < BENCH_CURSOR * BENCH_CURSOR; i++) pcursor[i] = random(3) ? 0 : (0xff000000 | random(0x1000000));
+        mouse.msPosX = getCenterX();
+        mouse.msPosY = getCenterY();
+        mouse.msWidth = BENCH_CURSOR;
+        mouse.msHeight = BENCH_CURSOR;
+        mouse.msBitmap = &bitmap;
+
+        //output buffer of each kernel
+        kernels[0].data = dst.mData;        kernels[0].size = dst.mSize;
+        kernels[1].data = dst.mData;        kernels[1].size = dst.mSize;
+        kernels[2].data = dst.mData;        kernels[2].size = dst.mSize;
+        kernels[3].data = dst.mData;        kernels[3].size = dst.mSize;
+        kernels[4].data = dst.mData;        kernels[4].size = dst.mSize;
+        kernels[5].data = dst.mData;        kernels[5].size = dst.mSize;
+        kernels[6].data = plasma.mData;     kernels[6].size = plasma.mSize;
+        kernels[7].data = getDrawBuffer();  kernels[7].size = src1.mSize;
+
+        scalar = (uint8_t*)malloc(dst.mSize);
+        return scalar != NULL;
+    }
+
+    void release()
+    {
+        freeImage(&src1);
+        freeImage(&src2);
+        freeImage(&dst);
+        free(plasma.mData);
+        free(bitmap.mbData);
+        free(mouse.msUnder);
+        free(buff1);
+        free(buff2);
+        free(scalar);
+    }
+
+    //run kernel at current level, return average time of a call in microseconds
+    double measure(const BENCH_KERNEL* kernel)
+    {
+        double total = 0;
+        for (int32_t i = 0; i < kernel->rounds; i++)
+        {
+            if (kernel->reset) kernel->reset();
+            const double start = getMicroSeconds();
+            kernel->run();
+            total += getMicroSeconds() - start;
+        }
+        return total / kernel->rounds;
+    }
+
+    void run()
+    {
+        const int32_t count = sizeof(kernels) / sizeof(kernels[0]);
+
+        printf("%-18s %-8s %12s %9s %s\n", "kernel", "level", "us/call", "speedup", "result");
+        for (int32_t i = 0; i < count; i++)
+        {
+            double base = 0;
+            for (int32_t level = KERNEL_LEVEL_SCALAR; level <= KERNEL_LEVEL_AVX512; level++)
+            {
+                //stop at the best level of this CPU
+                if (setKernelLevel(level) != level) break;
+
+                const double elapsed = measure(&kernels[i]);
+                int32_t exact = 1;
+                if (level == KERNEL_LEVEL_SCALAR)
+                {
+                    base = elapsed;
+                    memcpy(scalar, kernels[i].data, kernels[i].size);
+                }
+                else exact = !memcmp(scalar, kernels[i].data, kernels[i].size);
+
+                printf("%-18s %-8s %12.2f %8.2fx %s\n", kernels[i].name, getKernelName(level), elapsed, elapsed > 0 ? base / elapsed : 0, exact ? "exact" : "MISMATCH");
+            }
+        }
+
+        //restore the best kernels
+        initKernels();
+    }
+}
+
+void gfxKernelBench()
+{
+    if (!initScreen(BENCH_WIDTH, BENCH_HEIGHT, 32, 0, "Kernel Benchmark", SCREEN_HEADLESS)) return;
+    if (kernelBench::init()) kernelBench::run();
+    else messageBox(GFX_ERROR, "Cannot initialize benchmark data!");
+    kernelBench::release();
+    cleanup();
+}
+
+namespace frameBench {
+    //recorded segment info
+    typedef struct {
+        char            title[64];                  //segment title
+        int32_t         frames;                     //number of timed frames
+        double          minTime;                    //frame time in milliseconds
+        double          medTime;
+        double          p99Time;
+        double          avgTime;
+        uint64_t        hash;                       //hash of the final frame
+    } SEGMENT_INFO;
+
+    SEGMENT_INFO segments[MAX_SEGMENTS] = { 0 };
+    int32_t numSegments = 0;
+
+    double times[MAX_FRAMES] = { 0 };
+    int32_t numFrames = 0;
+    int32_t warmup = 1;
+    double lastTime = 0;
+    uint64_t lastHash = 0;
+
+    //FNV-1a on 64 bits words, fast enough to hash every committed frame
+    uint64_t hashFrame(const void* pixels, int32_t width, int32_t height, int32_t pitch)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        const int32_t rowBytes = width << 2;
+
+        for (int32_t y = 0; y < height; y++)
+        {
+            const uint8_t* row = (const uint8_t*)pixels + intptr_t(y) * pitch;
+            int32_t x = 0;
+            for (; x + 8 <= rowBytes; x += 8)
+            {
+                uint64_t val = 0;
+                memcpy(&val, &row[x], 8);
+                hash = (hash ^ val) * 0x100000001b3ULL;
+            }
+            for (; x < rowBytes; x++) hash = (hash ^ row[x]) * 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    int compareTime(const void* a, const void* b)
+    {
+        const double da = *(const double*)a;
+        const double db = *(const double*)b;
+        return (da > db) - (da < db);
+    }
+
+    //frame-commit hook, time between two commits is the frame time
+    void onFrame(const void* pixels, int32_t width, int32_t height, int32_t pitch)
+    {
+        const double now = kernelBench::getMicroSeconds();
+
+        //first frame of segment include loading time, skip it
+        if (warmup) warmup = 0;
+        else if (numFrames < MAX_FRAMES) times[numFrames++] = (now - lastTime) / 1000.0;
+
+        //hashing time is not counted in the next frame time
+        lastHash = hashFrame(pixels, width, height, pitch);
+        lastTime = kernelBench::getMicroSeconds();
+    }
+
+    //segment done hook, save statistic of current segment
+    void onSegment(const char* title)
+    {
+        if (numSegments < MAX_SEGMENTS)
+        {
+            SEGMENT_INFO* info = &segments[numSegments++];
+            memset(info, 0, sizeof(SEGMENT_INFO));
+            SDL_strlcpy(info->title, title, sizeof(info->title));
+            info->frames = numFrames;
+            info->hash = lastHash;
+
+            if (numFrames > 0)
+            {
+                double total = 0;
+                qsort(times, numFrames, sizeof(times[0]), compareTime);
+                for (int32_t i = 0; i < numFrames; i++) total += times[i];
+                info->minTime = times[0];
+                info->medTime = times[numFrames >> 1];
+                info->p99Time = times[min(numFrames - 1, numFrames * 99 / 100)];
+                info->avgTime = total / numFrames;
+            }
+        }
+
+        numFrames = 0;
+        warmup = 1;
+        lastHash = 0;
+    }
+
+    //compare hashes with golden file (index by segment order), create golden file if not exist
+    void checkGolden(const char* fname)
+    {
+        FILE* fp = fopen(fname, "rt");
+        if (!fp)
+        {
+            fp = fopen(fname, "wt");
+            if (!fp)
+            {
+                messageBox(GFX_ERROR, "Cannot create golden file: %s", fname);
+                return;
+            }
+
+            for (int32_t i = 0; i < numSegments; i++) fprintf(fp, "%016llx %s\n", (unsigned long long)segments[i].hash, segments[i].title);
+            fclose(fp);
+            printf("golden file %s created with %d segments\n", fname, numSegments);
+            return;
+        }
+
+        int32_t i = 0, mismatch = 0;
+        unsigned long long hash = 0;
+        char line[256] = { 0 };
+
+        while (fgets(line, sizeof(line), fp) && i < numSegments)
+        {
+            if (sscanf(line, "%llx", &hash) != 1) continue;
+            if (hash != segments[i].hash)
+            {
+                printf("MISMATCH #%d %s: %016llx != %016llx\n", i, segments[i].title, (unsigned long long)segments[i].hash, hash);
+                mismatch++;
+            }
+            i++;
+        }
+
+        fclose(fp);
+        if (i != numSegments) printf("golden file has %d segments, current run has %d segments\n", i, numSegments);
+        printf("golden check: %d mismatch(es) in %d segments\n", mismatch, i);
+    }
+
+    void run(int32_t frames, uint32_t seed)
+    {
+        numSegments = 0;
+        numFrames = 0;
+        warmup = 1;
+
+        setFrameCallback(onFrame);
+        beginSimulation(frames, seed, onSegment);
+        gfxEffectsMix();
+        gfxEffects();
+        gfxDemo();
+        gfxDemoMix();
+        endSimulation();
+        setFrameCallback(NULL);
+
+        printf("%-4s %-40s %6s %9s %9s %9s %9s %s\n", "#", "segment", "frames", "min", "median", "p99", "avg(ms)", "hash");
+        for (int32_t i = 0; i < numSegments; i++)
+        {
+            const SEGMENT_INFO* info = &segments[i];
+            printf("%-4d %-40.40s %6d %9.3f %9.3f %9.3f %9.3f %016llx\n", i, info->title, info->frames, info->minTime, info->medTime, info->p99Time, info->avgTime, (unsigned long long)info->hash);
+        }
+    }
+}
+
+void gfxFrameBench(int32_t frames, uint32_t seed, const char* golden)
+{
+    frameBench::run(frames, seed);
+    if (golden) frameBench::checkGolden(golden);
+}
+
+namespace primitiveBench {
+    //benchmark primitive info
+    typedef struct {
+        const char*     name;                       //primitive name
+        uint32_t        modes;                      //supported blend modes at 32 bpp (bit mask of 1 << mode)
+        uint32_t        alignModes;                 //blend modes required 32-bytes aligned x at 32 bpp
+        uint32_t        align8;                     //8 bpp version required 32-bytes aligned x
+        int32_t         (*run)(int32_t x, int32_t y, int32_t size, int32_t mode); //draw once, return number of touched pixels
+    } BENCH_PRIMITIVE;
+
+    const char* const modeNames[BLEND_MODE_COUNT] = { "NORMAL", "ADD", "SUB", "AND", "XOR", "ALPHA", "ANTIALIASED",
+                                                      "SRC_OVER", "DST_IN", "DST_OUT", "MULTIPLY", "SCREEN", "OVERLAY", "DARKEN", "LIGHTEN", "DIFFERENCE", "LINEAR" };
+    const int32_t numModes = BLEND_MODE_COUNT;
+
+    //span length classes, last one is full screen width
+    const int32_t sizes[] = { 1, 3, 8, 15, 32, 61, 128, 255, 512, BENCH_WIDTH };
+    const int32_t numSizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    const uint8_t pattern[8] = { 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55 };
+    const uint32_t color = 0x80c06030;
+
+    //batch inputs of putPixels and drawSpans
+    int32_t pointX[BENCH_WIDTH] = { 0 };
+    int32_t pointY[BENCH_WIDTH] = { 0 };
+    int32_t widths[RECT_ROWS] = { 0 };
+    uint32_t colors[BENCH_WIDTH] = { 0 };
+    POINT2D polyPoints[BENCH_WIDTH + 2] = { 0 };
+    int32_t lineSegs[BENCH_WIDTH * 4] = { 0 };
+
+    GFX_IMAGE images[numSizes] = { 0 };
+    GFX_SPRITE sprites[numSizes] = { 0 };
+    FILE* fp = NULL;
+    int32_t numResults = 0;
+
+    //image of given size class (image width is rounded up to 32-bytes as newImage required)
+    const GFX_IMAGE* getImage(int32_t size)
+    {
+        for (int32_t i = 0; i < numSizes; i++)
+        {
+            if (sizes[i] == size) return &images[i];
+        }
+        return &images[numSizes - 1];
+    }
+
+    //compiled sprite of given size class (key color runs removed)
+    const GFX_SPRITE* getSprite(int32_t size)
+    {
+        for (int32_t i = 0; i < numSizes; i++)
+        {
+            if (sizes[i] == size) return &sprites[i];
+        }
+        return &sprites[numSizes - 1];
+    }
+
+    int32_t runPutPixel(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        for (int32_t i = 0; i < size; i++) putPixel(x + i, y, color, mode);
+        return size;
+    }
+
+    int32_t runPutPixels(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        for (int32_t i = 0; i < size; i++)
+        {
+            pointX[i] = x + i;
+            pointY[i] = y;
+        }
+        putPixels(pointX, pointY, colors, size, mode);
+        return size;
+    }
+
+    int32_t runHorizLine(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        horizLine(x, y, size, color, mode);
+        return size;
+    }
+
+    int32_t runVertLine(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const int32_t len = min(size, BENCH_HEIGHT - y);
+        vertLine(x, y, len, color, mode);
+        return len;
+    }
+
+    int32_t runFillRect(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        fillRect(x, y, size, RECT_ROWS, color, mode);
+        return size * RECT_ROWS;
+    }
+
+    int32_t runDrawSpans(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        for (int32_t i = 0; i < RECT_ROWS; i++)
+        {
+            pointX[i] = x;
+            pointY[i] = y + i;
+            widths[i] = size;
+        }
+        drawSpans(pointX, pointY, widths, colors, RECT_ROWS, mode);
+        return size * RECT_ROWS;
+    }
+
+    int32_t runFillRectPattern(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        fillRectPattern(x, y, size, RECT_ROWS, color, pattern, mode);
+        return size * RECT_ROWS;
+    }
+
+    int32_t runDrawLine(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        drawLine(x, y, x + size - 1, y + (size >> 2), color, mode);
+        return size;
+    }
+
+    //short wireframe segments of 8 pixels, one batch per run
+    int32_t runDrawLines(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const int32_t num = max(size >> 3, 1);
+        for (int32_t i = 0; i < num; i++)
+        {
+            lineSegs[(i << 2)    ] = x + (i << 3);
+            lineSegs[(i << 2) + 1] = y + (i & 7);
+            lineSegs[(i << 2) + 2] = x + (i << 3) + 7;
+            lineSegs[(i << 2) + 3] = y + 7 - (i & 7);
+        }
+        drawLines(lineSegs, num, color, mode);
+        return num << 3;
+    }
+
+    //zig-zag trace of 3 pixels width, one vertex every 4 pixels
+    int32_t runDrawPolyline(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const int32_t num = max(size >> 2, 1) + 1;
+        for (int32_t i = 0; i < num; i++) polyPoints[i] = { double(x + (i * (size - 1)) / (num - 1)), double(y + 4 + (i & 1) * (RECT_ROWS - 8)) };
+        drawPolyline(polyPoints, num, 3, STROKE_JOIN_ROUND, STROKE_CAP_BUTT, color, mode);
+        return size * 3;
+    }
+
+    int32_t runDrawCircle(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const int32_t rad = max(size >> 1, 1);
+        drawCircle(x + rad, y + rad, rad, color, mode);
+        return int32_t(2 * M_PI * rad);
+    }
+
+    int32_t runFillCircle(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const int32_t rad = max(size >> 1, 1);
+        fillCircle(x + rad, y + rad, rad, color, mode);
+        return int32_t(M_PI * rad * rad);
+    }
+
+    int32_t runFillPolygon(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const POINT2D points[4] = { { double(x), double(y) }, { double(x + size - 1), double(y + 4) }, { double(x + size - 1), double(y + RECT_ROWS - 1) }, { double(x), double(y + RECT_ROWS - 5) } };
+        fillPolygon(points, 4, color, mode);
+        return size * (RECT_ROWS - 4);
+    }
+
+    //same quad as fillPolygon, blended with area coverage (mode is ignored)
+    int32_t runFillPolygonAA(int32_t x, int32_t y, int32_t size, int32_t /*mode*/)
+    {
+        const POINT2D points[4] = { { double(x), double(y) }, { double(x + size - 1), double(y + 4) }, { double(x + size - 1), double(y + RECT_ROWS - 1) }, { double(x), double(y + RECT_ROWS - 5) } };
+        fillPolygonAA(points, 4, color);
+        return size * (RECT_ROWS - 4);
+    }
+
+    //saw-tooth top edge with one vertex per pixel (more than old 200 corners limit at wide sizes)
+    int32_t runFillPolygonSaw(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        for (int32_t i = 0; i < size; i++) polyPoints[i] = { double(x + i), double(y + (i & 1) * 4) };
+        polyPoints[size] = { double(x + size), double(y + RECT_ROWS) };
+        polyPoints[size + 1] = { double(x), double(y + RECT_ROWS) };
+        fillPolygon(polyPoints, size + 2, color, mode, FILL_RULE_NON_ZERO);
+        return size * (RECT_ROWS - 2);
+    }
+
+    int32_t runPutImage(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const GFX_IMAGE* img = getImage(size);
+        putImage(x, y, img, mode);
+        return img->mWidth * img->mHeight;
+    }
+
+    int32_t runPutSprite(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const GFX_IMAGE* img = getImage(size);
+        putSprite(x, y, 0, img, mode);
+        return img->mWidth * img->mHeight;
+    }
+
+    int32_t runPutSpriteRLE(int32_t x, int32_t y, int32_t size, int32_t mode)
+    {
+        const GFX_SPRITE* spr = getSprite(size);
+        putSprite(x, y, spr, mode);
+        return spr->mWidth * spr->mHeight;
+    }
+
+    //32 bpp primitives use blend mode kernels (any x), 8 bpp putImage still streams to aligned memory
+    const BENCH_PRIMITIVE primitives[] = {
+        { "putPixel",           MODE_LINES, 0,  0,  runPutPixel         },
+        { "putPixels",          MODE_LINES, 0,  0,  runPutPixels        },
+        { "horizLine",          MODE_SPANS, 0,  0,  runHorizLine        },
+        { "drawSpans",          MODE_SPANS, 0,  0,  runDrawSpans        },
+        { "vertLine",           MODE_SPANS, 0,  0,  runVertLine         },
+        { "fillRect",           MODE_SPANS, 0,  0,  runFillRect         },
+        { "fillRectPattern",    MODE_SPANS, 0,  0,  runFillRectPattern  },
+        { "drawLine",           MODE_LINES, 0,  0,  runDrawLine         },
+        { "drawLines",          MODE_LINES, 0,  0,  runDrawLines        },
+        { "drawPolyline",       MODE_LINES, 0,  0,  runDrawPolyline     },
+        { "drawCircle",         MODE_LINES, 0,  0,  runDrawCircle       },
+        { "fillCircle",         MODE_SPANS, 0,  0,  runFillCircle       },
+        { "fillPolygon",        MODE_SPANS, 0,  0,  runFillPolygon      },
+        { "fillPolygonSaw",     MODE_SPANS, 0,  0,  runFillPolygonSaw   },
+        { "fillPolygonAA",      MODE_AA,    0,  0,  runFillPolygonAA    },
+        { "putImage",           MODE_SPANS, 0,  1,  runPutImage         },
+        { "putSprite",          MODE_SPANS, 0,  0,  runPutSprite        },
+        { "putSpriteRLE",       MODE_SPANS, 0,  0,  runPutSpriteRLE     }
+    };
+
+    //random image for each size class, about a quarter of pixels is key color (0)
+    int32_t init()
+    {
+        const int32_t bytesPerPixel = getBytesPerPixel();
+        for (int32_t i = 0; i < BENCH_WIDTH; i++) colors[i] = color;
+
+        for (int32_t i = 0; i < numSizes; i++)
+        {
+            if (!newImage(alignedSize(sizes[i]), RECT_ROWS, &images[i])) return 0;
+            uint8_t* pixels = (uint8_t*)images[i].mData;
+            for (uint32_t j = 0; j < images[i].mSize; j += bytesPerPixel)
+            {
+                if (!random(4)) memset(&pixels[j], 0, bytesPerPixel);
+                else for (int32_t k = 0; k < bytesPerPixel; k++) pixels[j + k] = uint8_t(random(255) + 1);
+            }
+            if (!compileSprite(&images[i], 0, &sprites[i])) return 0;
+        }
+        return 1;
+    }
+
+    void release()
+    {
+        for (int32_t i = 0; i < numSizes; i++)
+        {
+            freeImage(&images[i]);
+            freeSprite(&sprites[i]);
+        }
+    }
+
+    //call primitive until measure time is long enough, return time of a call in nanoseconds
+    double measure(const BENCH_PRIMITIVE* prim, int32_t x, int32_t y, int32_t size, int32_t mode, int32_t* pixels, int32_t* calls)
+    {
+        int32_t rounds = 1;
+        double elapsed = 0;
+
+        //warm up caches
+        *pixels = prim->run(x, y, size, mode);
+
+        do {
+            const double start = kernelBench::getMicroSeconds();
+            for (int32_t i = 0; i < rounds; i++) prim->run(x, y, size, mode);
+            elapsed = kernelBench::getMicroSeconds() - start;
+            if (elapsed >= MIN_MEASURE) break;
+            rounds <<= 1;
+        } while (rounds < (1 << 24));
+
+        *calls = rounds;
+        return elapsed * 1000.0 / rounds;
+    }
+
+    void writeResult(const BENCH_PRIMITIVE* prim, int32_t bpp, int32_t mode, int32_t x, int32_t size, const char* status, int32_t pixels, int32_t calls, double nsec)
+    {
+        fprintf(fp, "%s\n    {\"primitive\": \"%s\", \"bpp\": %d, \"mode\": \"%s\", \"x\": %d, \"aligned\": %s, \"size\": %d, \"status\": \"%s\"",
+            numResults ? "," : "", prim->name, bpp, modeNames[mode], x, x ? "false" : "true", size, status);
+        if (calls > 0) fprintf(fp, ", \"pixels\": %d, \"calls\": %d, \"ns_per_call\": %.3f, \"mpixels_per_sec\": %.3f", pixels, calls, nsec, nsec > 0 ? pixels * 1000.0 / nsec : 0);
+        fprintf(fp, "}");
+        numResults++;
+    }
+
+    //run all primitives at current screen depth (8 bpp ignore blend mode, so only NORMAL is measured)
+    void run(int32_t bpp)
+    {
+        const int32_t numPrimitives = sizeof(primitives) / sizeof(primitives[0]);
+        const int32_t y = 16;
+
+        for (int32_t i = 0; i < numPrimitives; i++)
+        {
+            const BENCH_PRIMITIVE* prim = &primitives[i];
+            const uint32_t modes = (bpp == 8) ? MODE_BIT(BLEND_MODE_NORMAL) : prim->modes;
+            const uint32_t alignModes = (bpp == 8) ? (prim->align8 ? MODE_BIT(BLEND_MODE_NORMAL) : 0) : prim->alignModes;
+
+            for (int32_t mode = 0; mode < numModes; mode++)
+            {
+                if (!(modes & MODE_BIT(mode))) continue;
+                for (int32_t k = 0; k < 2; k++)
+                {
+                    const int32_t x = k ? UNALIGNED_X : 0;
+                    for (int32_t j = 0; j < numSizes; j++)
+                    {
+                        int32_t pixels = 0, calls = 0;
+                        if (x && (alignModes & MODE_BIT(mode)))
+                        {
+                            writeResult(prim, bpp, mode, x, sizes[j], "skipped: required 32-bytes aligned x", 0, 0, 0);
+                            continue;
+                        }
+
+                        const double nsec = measure(prim, x, y, sizes[j], mode, &pixels, &calls);
+                        writeResult(prim, bpp, mode, x, sizes[j], "ok", pixels, calls, nsec);
+                        printf("%-16s %2d %-12s x=%d %4d: %12.1f ns/call\n", prim->name, bpp, modeNames[mode], x, sizes[j], nsec);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//time drawing primitives for each blend mode, color depth, alignment and span length, write result to JSON file
+void gfxPrimitiveBench(const char* fname)
+{
+    const int32_t depths[] = { 8, 32 };
+
+    primitiveBench::fp = fopen(fname, "wt");
+    if (!primitiveBench::fp)
+    {
+        messageBox(GFX_ERROR, "Cannot create result file: %s", fname);
+        return;
+    }
+
+    fprintf(primitiveBench::fp, "{\n  \"benchmark\": \"primitives\",\n  \"width\": %d,\n  \"height\": %d,\n  \"rows\": %d,\n", BENCH_WIDTH, BENCH_HEIGHT, RECT_ROWS);
+    fprintf(primitiveBench::fp, "  \"kernel\": \"%s\",\n  \"results\": [", getKernelName(getKernelLevel()));
+    primitiveBench::numResults = 0;
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        if (!initScreen(BENCH_WIDTH, BENCH_HEIGHT, depths[i], 0, "Primitive Benchmark", SCREEN_HEADLESS)) break;
+        srand(2024);
+        if (primitiveBench::init()) primitiveBench::run(depths[i]);
+        else messageBox(GFX_ERROR, "Cannot initialize benchmark data!");
+        primitiveBench::release();
+        cleanup();
+    }
+
+    fprintf(primitiveBench::fp, "\n  ]\n}\n");
+    fclose(primitiveBench::fp);
+    primitiveBench::fp = NULL;
+}
@@ -1,12759 +1,16400 @@
-/*===============================================================*/
-/*                 GFXLIB Graphics Library                       */
-/*               Use SDL3 for backend render                     */
-/*               SDL3_image for backend image                    */
-/*            Target OS: cross-platform (win32, macos)           */
-/*               Author: Nguyen Ngoc Van                         */
-/*               Create: 22/10/2018                              */
-/*              Version: 1.4.5                                   */
-/*          Last Update: 2024-09-27                              */
-/*              Website: http://codedemo.net                     */
-/*                Email: pherosiden@gmail.com                    */
-/*           References: https://lodev.org                       */
-/*                       https://permadi.com                     */
-/*                       https://sources.ru                      */
-/*                       http://eyecandyarchive.com              */
-/*                       https://crossfire-designs.de            */
-/*              License: GNU GPL                                 */
-/*===============================================================*/
-
-#include <map>
-#include "gfxlib.h"
-#ifdef SDL_PLATFORM_APPLE
-#include <cpuid.h>
-#include <sys/sysctl.h>
-#else
-#include <dxgi.h>
-#include <tchar.h>
-#pragma comment (lib, "DXGI")
-#pragma comment (lib, "SDL3")
-#pragma comment (lib, "SDL3_image")
-#endif
-
-//drawing buffer
-void*           drawBuff = NULL;                    //current render buffer
-int32_t         texWidth = 0, texHeight = 0;        //current draw buffer height
-
-//save current buffer
-void*           oldBuffer = NULL;                   //saved render buffer
-int32_t         oldWidth = 0, oldHeight = 0;        //saved buffer height
-
-//pixels attributes
-int32_t         bitsPerPixel = 0;                   //bits per pixel (8/15/16/24/32)
-int32_t         bytesPerPixel = 0;                  //bytes per pixel (1/2/3/4)
-int32_t         bytesPerScanline = 0;               //bytes per scan line
-
-//mid-screen coordinate
-int32_t         centerX = 0, centerY = 0;           //x, y center of screen
-
-//current screen view-port
-int32_t         cminX = 0, cminY = 0;               //current left-top
-int32_t         cmaxX = 0, cmaxY = 0;               //current right-bottom
-
-//saved screen view-port
-int32_t         oldMinX = 0, oldMinY = 0;           //saved left-top
-int32_t         oldMaxX = 0, oldMaxY = 0;           //saved right-bottom
-
-//current draw cursor (2D)
-int32_t         currX = 0, currY = 0;               //current cursor x, y
-
-//3D projection
-double          DE = 0.0;                           //deplane end for projection
-
-//trigonometric angle
-double          RHO = 0.0;                          //RHO perspective projection
-
-//saved transform values
-double          sinth = 0.0, sinph = 0.0;           //sin(theta), sin(phi)
-double          costh = 0.0, cosph = 0.0;           //cos(theta), cos(phi)
-double          sincosx = 0.0, sinsinx = 0.0;       //sinsin(theta, phi)
-double          coscosx = 0.0, sincosy = 0.0;       //coscos(theta, phi)
-
-//current draw cursor (3D)
-int32_t         cranX = 0, cranY = 0;               //current x, y cursor (3d mode)
-
-//3D projection type
-uint8_t         projectionType = 0;                 //current projection type
-
-//GFX font data
-GFX_FONT        gfxFonts[GFX_MAX_FONT] = { 0 };     //GFX font loadable at the same time
-uint8_t*        fontPalette[GFX_MAX_FONT] = { 0 };  //GFX font palette data (BMP8 type)
-uint8_t*        gfxBuff = NULL;                     //GFX buffer
-uint32_t        subFonts = 0;                       //GFX sub-fonts
-uint32_t        fontType = 0;                       //current selected font (use for multiple loaded font)
-uint32_t        randSeed = 0;                       //global random seed
-uint32_t        factor = 0x8088405;                 //global factor
-
-//pattern filled styles
-uint8_t         ptnLine[]           = { 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 };
-uint8_t         ptnLiteSlash[]      = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
-uint8_t         ptnSlash[]          = { 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC1, 0x83 };
-uint8_t         ptnBackSlash[]      = { 0x07, 0x83, 0xC1, 0xE0, 0x70, 0x38, 0x1C, 0x0E };
-uint8_t         ptnLiteBackSlash[]  = { 0x5A, 0x2D, 0x96, 0x4B, 0xA5, 0xD2, 0x69, 0xB4 };
-uint8_t         ptnHatch[]          = { 0xff, 0x88, 0x88, 0x88, 0xff, 0x88, 0x88, 0x88 };
-uint8_t         ptnHatchX[]         = { 0x18, 0x24, 0x42, 0x81, 0x81, 0x42, 0x24, 0x18 };
-uint8_t         ptnInterLeave[]     = { 0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33 };
-uint8_t         ptnWideDot[]        = { 0x80, 0x00, 0x08, 0x00, 0x80, 0x00, 0x08, 0x00 };
-uint8_t         ptnCloseDot[]       = { 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00 };
-
-//CPU and video card parameters
-char            cpuName[50] = { 0 };                //full CPU name string
-char            cpuType[16] = { 0 };                //CPU type (GenuineIntel, AuthenticAMD, ...)
-char            cpuFeatures[50] = { 0 };            //CPU features (MMX, 3DNow!, 3DNowExt!, SSE, SSE2, SSE3, ...)
-char            videoName[128] = { 0 };             //full name of graphic card
-char            driverVersion[32] = { 0 };          //graphic driver version string
-char            renderVersion[32] = { 0 };          //SDL2 version string
-char            imageVersion[32] = { 0 };           //SDL2_image version string
-char            modeInfo[32] = { 0 };               //current display mode info string
-
-//system memory profiles
-uint32_t        cpuSpeed = 0;                       //CPU speed in MHz
-uint32_t        totalMemory = 0;                    //total physical memory in MB
-uint32_t        availableMemory = 0;                //available physical memory in MB
-uint32_t        videoMemory = 0;                    //total video memory in MB
-
-//global SDL objects
-SDL_Window*     sdlWindow = NULL;                   //display windows
-SDL_Surface*    sdlSurface = NULL;                  //display windows surface
-SDL_Surface*    sdlScreen = NULL;                   //convert screen surface
-SDL_Texture*    sdlTexture = NULL;                  //texture steaming
-SDL_Renderer*   sdlRenderer = NULL;                 //render object
-SDL_Event		sdlEvent = { 0 };                   //store key input event
-
-//keyboard status
-uint8_t*        keyStates = 0;                      //key input states
-
-//the "keyPressed" status map
-std::map<int32_t, int32_t> keyStatus;               //key input status
-
-//default 8-bits palette entries for mixed mode, SDL3 initialized with black palette
-SDL_Color basePalette[256] = {
-    { 0,  0,  0, 0}, { 0,  0, 42, 0}, { 0, 42,  0, 0}, { 0, 42, 42, 0}, {42,  0,  0, 0}, {42,  0, 42, 0}, {42, 21,  0, 0}, {42, 42, 42, 0}, {21, 21, 21, 0}, {21, 21, 63, 0}, {21, 63, 21, 0}, {21, 63, 63, 0}, {63, 21, 21, 0}, {63, 21, 63, 0}, {63, 63, 21, 0}, {63, 63, 63, 0},
-    { 0,  0,  0, 0}, { 5,  5,  5, 0}, { 8,  8,  8, 0}, {11, 11, 11, 0}, {14, 14, 14, 0}, {17, 17, 17, 0}, {20, 20, 20, 0}, {24, 24, 24, 0}, {28, 28, 28, 0}, {32, 32, 32, 0}, {36, 36, 36, 0}, {40, 40, 40, 0}, {45, 45, 45, 0}, {50, 50, 50, 0}, {56, 56, 56, 0}, {63, 63, 63, 0},
-    { 0,  0, 63, 0}, {16,  0, 63, 0}, {31,  0, 63, 0}, {47,  0, 63, 0}, {63,  0, 63, 0}, {63,  0, 47, 0}, {63,  0, 31, 0}, {63,  0, 16, 0}, {63,  0,  0, 0}, {63, 16,  0, 0}, {63, 31,  0, 0}, {63, 47,  0, 0}, {63, 63,  0, 0}, {47, 63,  0, 0}, {31, 63,  0, 0}, {16, 63,  0, 0},
-    { 0, 63,  0, 0}, { 0, 63, 16, 0}, { 0, 63, 31, 0}, { 0, 63, 47, 0}, { 0, 63, 63, 0}, { 0, 47, 63, 0}, { 0, 31, 63, 0}, { 0, 16, 63, 0}, {31, 31, 63, 0}, {39, 31, 63, 0}, {47, 31, 63, 0}, {55, 31, 63, 0}, {63, 31, 63, 0}, {63, 31, 55, 0}, {63, 31, 47, 0}, {63, 31, 39, 0},
-    {63, 31, 31, 0}, {63, 39, 31, 0}, {63, 47, 31, 0}, {63, 55, 31, 0}, {63, 63, 31, 0}, {55, 63, 31, 0}, {47, 63, 31, 0}, {39, 63, 31, 0}, {31, 63, 31, 0}, {31, 63, 39, 0}, {31, 63, 47, 0}, {31, 63, 55, 0}, {31, 63, 63, 0}, {31, 55, 63, 0}, {31, 47, 63, 0}, {31, 39, 63, 0},
-    {45, 45, 63, 0}, {49, 45, 63, 0}, {54, 45, 63, 0}, {58, 45, 63, 0}, {63, 45, 63, 0}, {63, 45, 58, 0}, {63, 45, 54, 0}, {63, 45, 49, 0}, {63, 45, 45, 0}, {63, 49, 45, 0}, {63, 54, 45, 0}, {63, 58, 45, 0}, {63, 63, 45, 0}, {58, 63, 45, 0}, {54, 63, 45, 0}, {49, 63, 45, 0},
-    {45, 63, 45, 0}, {45, 63, 49, 0}, {45, 63, 54, 0}, {45, 63, 58, 0}, {45, 63, 63, 0}, {45, 58, 63, 0}, {45, 54, 63, 0}, {45, 49, 63, 0}, { 0,  0, 28, 0}, { 7,  0, 28, 0}, {14,  0, 28, 0}, {21,  0, 28, 0}, {28,  0, 28, 0}, {28,  0, 21, 0}, {28,  0, 14, 0}, {28,  0,  7, 0},
-    {28,  0,  0, 0}, {28,  7,  0, 0}, {28, 14,  0, 0}, {28, 21,  0, 0}, {28, 28,  0, 0}, {21, 28,  0, 0}, {14, 28,  0, 0}, { 7, 28,  0, 0}, { 0, 28,  0, 0}, { 0, 28,  7, 0}, { 0, 28, 14, 0}, { 0, 28, 21, 0}, { 0, 28, 28, 0}, { 0, 21, 28, 0}, { 0, 14, 28, 0}, { 0,  7, 28, 0},
-    {14, 14, 28, 0}, {17, 14, 28, 0}, {21, 14, 28, 0}, {24, 14, 28, 0}, {28, 14, 28, 0}, {28, 14, 24, 0}, {28, 14, 21, 0}, {28, 14, 17, 0}, {28, 14, 14, 0}, {28, 17, 14, 0}, {28, 21, 14, 0}, {28, 24, 14, 0}, {28, 28, 14, 0}, {24, 28, 14, 0}, {21, 28, 14, 0}, {17, 28, 14, 0},
-    {14, 28, 14, 0}, {14, 28, 17, 0}, {14, 28, 21, 0}, {14, 28, 24, 0}, {14, 28, 28, 0}, {14, 24, 28, 0}, {14, 21, 28, 0}, {14, 17, 28, 0}, {20, 20, 28, 0}, {22, 20, 28, 0}, {24, 20, 28, 0}, {26, 20, 28, 0}, {28, 20, 28, 0}, {28, 20, 26, 0}, {28, 20, 24, 0}, {28, 20, 22, 0},
-    {28, 20, 20, 0}, {28, 22, 20, 0}, {28, 24, 20, 0}, {28, 26, 20, 0}, {28, 28, 20, 0}, {26, 28, 20, 0}, {24, 28, 20, 0}, {22, 28, 20, 0}, {20, 28, 20, 0}, {20, 28, 22, 0}, {20, 28, 24, 0}, {20, 28, 26, 0}, {20, 28, 28, 0}, {20, 26, 28, 0}, {20, 24, 28, 0}, {20, 22, 28, 0},
-    { 0,  0, 16, 0}, { 4,  0, 16, 0}, { 8,  0, 16, 0}, {12,  0, 16, 0}, {16,  0, 16, 0}, {16,  0, 12, 0}, {16,  0,  8, 0}, {16,  0,  4, 0}, {16,  0,  0, 0}, {16,  4,  0, 0}, {16,  8,  0, 0}, {16, 12,  0, 0}, {16, 16,  0, 0}, {12, 16,  0, 0}, { 8, 16,  0, 0}, { 4, 16,  0, 0},
-    { 0, 16,  0, 0}, { 0, 16,  4, 0}, { 0, 16,  8, 0}, { 0, 16, 12, 0}, { 0, 16, 16, 0}, { 0, 12, 16, 0}, { 0,  8, 16, 0}, { 0,  4, 16, 0}, { 8,  8, 16, 0}, {10,  8, 16, 0}, {12,  8, 16, 0}, {14,  8, 16, 0}, {16,  8, 16, 0}, {16,  8, 14, 0}, {16,  8, 12, 0}, {16,  8, 10, 0},
-    {16,  8,  8, 0}, {16, 10,  8, 0}, {16, 12,  8, 0}, {16, 14,  8, 0}, {16, 16,  8, 0}, {14, 16,  8, 0}, {12, 16,  8, 0}, {10, 16,  8, 0}, { 8, 16,  8, 0}, { 8, 16, 10, 0}, { 8, 16, 12, 0}, { 8, 16, 14, 0}, { 8, 16, 16, 0}, { 8, 14, 16, 0}, { 8, 12, 16, 0}, { 8, 10, 16, 0},
-    {11, 11, 16, 0}, {12, 11, 16, 0}, {13, 11, 16, 0}, {15, 11, 16, 0}, {16, 11, 16, 0}, {16, 11, 15, 0}, {16, 11, 13, 0}, {16, 11, 12, 0}, {16, 11, 11, 0}, {16, 12, 11, 0}, {16, 13, 11, 0}, {16, 15, 11, 0}, {16, 16, 11, 0}, {15, 16, 11, 0}, {13, 16, 11, 0}, {12, 16, 11, 0},
-    {11, 16, 11, 0}, {11, 16, 12, 0}, {11, 16, 13, 0}, {11, 16, 15, 0}, {11, 16, 16, 0}, {11, 15, 16, 0}, {11, 13, 16, 0}, {11, 12, 16, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0},
-};
-
-//current position input data
-int32_t dataX = 0, dataY = 0;
-
-//get current position x
-int32_t getDataX()
-{
-    return dataX;
-}
-
-//get current position y
-int32_t getDataY()
-{
-    return dataY;
-}
-
-//read current keyboard state
-void readKeys()
-{
-    SDL_PumpEvents();
-    keyStates = (uint8_t*)SDL_GetKeyboardState(NULL);
-}
-
-//this checks if the key is held down, returns true all the time until the key is up
-int32_t keyDown(int32_t key)
-{
-    if (!keyStates) return 0;
-    return (keyStates[key] != 0);
-}
-
-//this checks if the key is *just* pressed, returns true only once until the key is up again
-int32_t keyPressed(int32_t key)
-{
-    if (!keyStates) return 0;
-
-    if (keyStatus.find(key) == keyStatus.end()) keyStatus[key] = 0;
-
-    if (keyStates[key])
-    {
-        if (keyStatus[key] == 0)
-        {
-            keyStatus[key] = 1;
-            return 1;
-        }
-    }
-    else
-    {
-        keyStatus[key] = 0;
-    }
-
-    return 0;
-}
-
-//read input from user
-int32_t waitUserInput(int32_t inputMask /* = INPUT_KEY_PRESSED */)
-{
-    SDL_Event event = { 0 };
-
-    while (1)
-    {
-        if (SDL_WaitEvent(&event))
-        {
-            switch (event.type)
-            {
-            case SDL_EVENT_QUIT:
-                quit();
-                break;
-
-            case SDL_EVENT_KEY_DOWN:
-                if (inputMask & INPUT_KEY_PRESSED)
-                {
-                    return event.key.scancode;
-                }
-                break;
-
-            case SDL_EVENT_MOUSE_BUTTON_DOWN:
-                if (inputMask & INPUT_MOUSE_CLICK)
-                {
-                    float px = 0, py = 0;
-                    SDL_GetMouseState(&px, &py);
-                    dataX = int32_t(px);
-                    dataY = int32_t(py);
-                    return SDL_EVENT_MOUSE_BUTTON_DOWN;
-                }
-                break;
-
-            case SDL_EVENT_MOUSE_BUTTON_UP:
-                if (inputMask & INPUT_MOUSE_CLICK)
-                {
-                    float px = 0, py = 0;
-                    SDL_GetMouseState(&px, &py);
-                    dataX = int32_t(px);
-                    dataY = int32_t(py);
-                    return SDL_EVENT_MOUSE_BUTTON_UP;
-                }
-                break;
-
-            case SDL_EVENT_MOUSE_MOTION:
-                if (inputMask & INPUT_MOUSE_MOTION)
-                {
-                    float px = 0, py = 0;
-                    SDL_GetMouseState(&px, &py);
-                    dataX = int32_t(px);
-                    dataY = int32_t(py);
-                    return SDL_EVENT_MOUSE_MOTION;
-                }
-                break;
-
-            case SDL_EVENT_MOUSE_WHEEL:
-                if (inputMask & INPUT_MOUSE_WHEEL)
-                {
-                    dataX = int32_t(event.wheel.x);
-                    dataY = int32_t(event.wheel.y);
-                    return SDL_EVENT_MOUSE_WHEEL;
-                }
-                break;
-
-            case SDL_EVENT_WINDOW_RESIZED:
-                if ((inputMask & INPUT_WIN_RESIZED) && (event.window.type == SDL_EVENT_WINDOW_RESIZED))
-                {
-                    dataX = event.window.data1;
-                    dataY = event.window.data2;
-                    return SDL_EVENT_WINDOW_RESIZED;
-                }
-                break;
-
-            default:
-                break;
-            }
-        }
-    }
-}
-
-//returns the time in milliseconds since the program started
-uint64_t getTime()
-{
-    return SDL_GetTicks();
-}
-
-//return passing time from start time
-uint64_t getElapsedTime(uint64_t tmstart)
-{
-    return getTime() - tmstart;
-}
-
-//sleep CPU execution
-void delay(uint32_t miliseconds)
-{
-    SDL_Delay(miliseconds);
-}
-
-//only return 1 when exit key scanCode (not escape) is given, ESCAPE key to exit program
-bool finished(int32_t scanCode)
-{
-    //what the user input key?
-    readKeys();
-    if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-    if (keyStates[scanCode])
-    {
-        //clear buffer
-        keyStates[scanCode] = 0;
-        return true;
-    }
-
-    return false;
-}
-
-//wait for key with scancode is pressed
-void waitKeyPressed(int32_t scanCode)
-{
-    while (!finished(scanCode)) SDL_Delay(1);
-}
-
-//wait until time wait is passed, program exit when ESCAPE key pressed
-void waitFor(uint64_t tmstart, uint64_t tmwait)
-{
-    while (getElapsedTime(tmstart) < tmwait)
-    {
-        SDL_PollEvent(&sdlEvent);
-        if (sdlEvent.type == SDL_EVENT_QUIT) quit();
-        keyStates = (uint8_t*)SDL_GetKeyboardState(NULL);
-        if (keyStates[SDL_SCANCODE_ESCAPE]) quit();
-        SDL_Delay(1);
-    }
-}
-
-//sleep until time wait is passed or enter key, program exit when ESCAPE key pressed
-void sleepFor(uint64_t tmwait)
-{
-    int32_t done = 0;
-    const uint64_t tmstart = getTime();
-
-    while (!done && getElapsedTime(tmstart) < tmwait)
-    {
-        SDL_PollEvent(&sdlEvent);
-        if (sdlEvent.type == SDL_EVENT_QUIT) quit();
-        keyStates = (uint8_t*)SDL_GetKeyboardState(NULL);
-        if (keyStates[SDL_SCANCODE_ESCAPE]) quit();
-        if (keyStates[SDL_SCANCODE_RETURN])
-        {
-            done = 1;
-            keyStates[SDL_SCANCODE_RETURN] = 0;
-        }
-        SDL_Delay(1);
-    }
-}
-
-//exit program
-void quit()
-{
-    cleanup();
-    exit(1);
-}
-
-//show the mouse cursor
-void showMouseCursor()
-{
-    SDL_ShowCursor();
-}
-
-//hide the mouse cursor
-void hideMouseCursor()
-{
-    SDL_HideCursor();
-}
-
-//get current mouse state
-void getMouseState(int32_t* mx, int32_t* my, int32_t* lmb, int32_t* rmb)
-{
-    float px = 0, py = 0;
-    const SDL_MouseButtonFlags mstate = SDL_GetMouseState(&px, &py);
-    if (lmb) *lmb = (mstate == SDL_BUTTON_LEFT);
-    if (rmb) *rmb = (mstate == SDL_BUTTON_RIGHT);
-    if (mx) *mx = int32_t(px);
-    if (my) *my = int32_t(py);
-}
-
-//set mouse position
-void setMousePosition(int32_t px, int32_t py)
-{
-    SDL_SetWindowMouseGrab(sdlWindow, SDL_TRUE);
-    SDL_WarpMouseInWindow(sdlWindow, float(px), float(py));
-}
-
-//initialize graphic video system
-int32_t initScreen(int32_t width, int32_t height, int32_t bpp, int32_t scaled, const char* title, int32_t resizeable)
-{
-    //initialize SDL video mode only
-    if (SDL_Init(SDL_INIT_VIDEO) < 0)
-    {
-        messageBox(GFX_ERROR, "Failed to initialize SDL3: %s", SDL_GetError());
-        return 0;
-    }
-    
-    //initialize SDL2 image lib
-    if ((IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG) != IMG_INIT_PNG)
-    {
-        messageBox(GFX_ERROR, "Failed to initialize SDL3 image: %s", IMG_GetError());
-        return 0;
-    }
-
-    //create screen to display contents
-    sdlWindow = SDL_CreateWindow(title, scaled ? SCREEN_WIDTH : width, scaled ? SCREEN_HEIGHT : height, resizeable ? SDL_WINDOW_RESIZABLE : 0);
-    if (!sdlWindow)
-    {
-        messageBox(GFX_ERROR, "Failed to create window: %s", SDL_GetError());
-        return 0;
-    }
-
-    //set windows icon
-    SDL_Surface* icon = IMG_Load("assets/gfxicon-128x.png");
-    if (icon)
-    {
-        SDL_SetSurfaceColorKey(icon, SDL_TRUE, SDL_MapRGB(SDL_GetPixelFormatDetails(icon->format), NULL, 0, 0, 0));
-        SDL_SetWindowIcon(sdlWindow, icon);
-        SDL_DestroySurface(icon);
-    }
-
-    //create render windows
-    sdlRenderer = SDL_CreateRenderer(sdlWindow, NULL);
-    if (!sdlRenderer)
-    {
-        messageBox(GFX_ERROR, "Failed to create renderer: %s", SDL_GetError());
-        return 0;
-    }
-
-    //create 32bits texture for render
-    sdlTexture = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
-    if (!sdlTexture)
-    {
-        messageBox(GFX_ERROR, "Failed to create texture: %s", SDL_GetError());
-        return 0;
-    }
-
-    //initialize bits per pixel
-    bitsPerPixel = bpp;
-
-    //initialize bytes per pixel
-    bytesPerPixel = (bitsPerPixel + 7) / 8;
-
-    //initialize bytes per scan line (should be 32-bytes alignment)
-    bytesPerScanline = width * bytesPerPixel;
-
-    //check for 32-bytes alignment
-    if (bytesPerScanline % 32)
-    {
-        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
-        return 0;
-    }
-
-    //use palette color for 8 bits?
-    if (bpp == 8)
-    {
-        //create 32bits surface and use this to convert to texture before render to screen
-        sdlScreen = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
-        if (!sdlScreen)
-        {
-            messageBox(GFX_ERROR, "Failed to create 32 bits surface: %s", SDL_GetError());
-            return 0;
-        }
-
-        //create 8bits surface with palette
-        sdlSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_INDEX8);
-        if (!sdlSurface)
-        {
-            messageBox(GFX_ERROR, "Failed to create 8 bits surface: %s", SDL_GetError());
-            return 0;
-        }
-
-        //make default palette and retrive the surface palette
-        shiftPalette(basePalette);
-        SDL_Palette* palette = SDL_CreateSurfacePalette(sdlSurface);
-
-        //set default palette to surface
-        if (palette && SDL_SetPaletteColors(palette, basePalette, 0, 256))
-        {
-            messageBox(GFX_ERROR, "Failed to initialize palette colors!");
-            return 0;
-        }
-
-        //initialize drawing buffer (use current surface pixel buffer)
-        drawBuff = sdlSurface->pixels;
-    }
-    else
-    {
-        //initialize drawing buffer for 32 bits RGBA (32-bytes alignment for AVX2 use)
-        const uint32_t msize = height * bytesPerScanline;
-        drawBuff = SDL_aligned_alloc(32, msize);
-    }
-    
-    //validate drawing buffer
-    if (!drawBuff)
-    {
-        messageBox(GFX_ERROR, "Failed to create render buffer!");
-        return 0;
-    }
-
-    //initialize random number generation
-    randSeed = uint32_t(time(NULL));
-    srand(randSeed);
-
-    //initialize GFXLIB buffer
-    gfxBuff = (uint8_t*)SDL_calloc(GFX_BUFF_SIZE, 1);
-    if (!gfxBuff)
-    {
-        messageBox(GFX_ERROR, "Error initialize GFXLIB memory!");
-        return 0;
-    }
-
-    //initialize screen buffer size
-    texWidth    = width;
-    texHeight   = height;
-    centerX     = (texWidth >> 1) - 1;
-    centerY     = (texHeight >> 1) - 1;
-
-    //initialize view port size
-    cminX       = 0;
-    cminY       = 0;
-    cmaxX       = texWidth - 1;
-    cmaxY       = texHeight - 1;
-    
-    //OK, I'm fine!
-    return 1;
-}
-
-//cleanup function must call after graphics operations ended
-void cleanup()
-{
-    if (bitsPerPixel == 8)
-    {
-        if (sdlScreen)
-        {
-            SDL_DestroySurface(sdlScreen);
-            sdlScreen = NULL;
-        }
-
-        if (sdlSurface)
-        {
-            SDL_DestroySurface(sdlSurface);
-            sdlSurface = NULL;
-        }
-    }
-    else
-    {
-        if (drawBuff)
-        {
-            SDL_aligned_free(drawBuff);
-            drawBuff = NULL;
-        }
-    }
-
-    if (gfxBuff)
-    {
-        SDL_free(gfxBuff);
-        gfxBuff = NULL;
-    }
-
-    if (sdlTexture)
-    {
-        SDL_DestroyTexture(sdlTexture);
-        sdlTexture = NULL;
-    }
-
-    if (sdlRenderer)
-    {
-        SDL_DestroyRenderer(sdlRenderer);
-        sdlRenderer = NULL;
-    }
-
-    if (sdlWindow)
-    {
-        SDL_DestroyWindow(sdlWindow);
-        sdlWindow = NULL;
-    }
-
-    SDL_Quit();
-    IMG_Quit();
-}
-
-//render function, use this to render draw buffer to video memory
-void render()
-{
-    if (bitsPerPixel == 8)
-    {
-        //256 colors palette, we must convert 8 bits surface to 32 bits surface
-        SDL_BlitSurface(sdlSurface, NULL, sdlScreen, NULL);
-        SDL_UpdateTexture(sdlTexture, NULL, sdlScreen->pixels, sdlScreen->pitch);
-    }
-    else
-    {
-        //rgb mode, just render texture to video memory without any conversation
-        SDL_UpdateTexture(sdlTexture, NULL, drawBuff, bytesPerScanline);
-    }
-    
-    //clear screen and render texture to screen
-    SDL_RenderClear(sdlRenderer);
-    SDL_RenderTexture(sdlRenderer, sdlTexture, NULL, NULL);
-    SDL_RenderPresent(sdlRenderer);
-}
-
-//render from user-defined buffer
-void renderBuffer(const void* buffer, int32_t width, int32_t height)
-{
-    //calculate amount of bytes transfer (should be 32-bytes alignment)
-    const uint32_t rowBytes = width * bytesPerPixel;
-    const uint32_t bytesCopy = height * rowBytes;
-
-    //check for 32-bytes alignment
-    if (rowBytes % 32)
-    {
-        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
-        return;
-    }
-
-    //detect texture size has changed?
-    if (texWidth != width || texHeight != height)
-    {
-        //create new texture with new size
-        if (sdlTexture) SDL_DestroyTexture(sdlTexture);
-        sdlTexture = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
-        if (!sdlTexture)
-        {
-            messageBox(GFX_ERROR, "Failed to create new texture: %s", SDL_GetError());
-            return;
-        }
-
-        //8 bits
-        if (bytesPerPixel == 1)
-        {
-            //save current palette
-            RGBA pal[256] = { 0 };
-            getPalette(pal);
-
-            //create new 32bits surface
-            if (sdlScreen) SDL_DestroySurface(sdlScreen);
-            sdlScreen = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_ARGB8888);
-            if (!sdlScreen)
-            {
-                messageBox(GFX_ERROR, "Failed to create new 32bits surface: %s", SDL_GetError());
-                return;
-            }
-
-            //create new 8bits surface
-            if (sdlSurface) SDL_DestroySurface(sdlSurface);
-            sdlSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_INDEX8);
-            if (!sdlSurface)
-            {
-                messageBox(GFX_ERROR, "Failed to create new 8bits surface: %s", SDL_GetError());
-                return;
-            }
-
-            //initialize new drawing buffer
-            if (!sdlSurface->pixels)
-            {
-                messageBox(GFX_ERROR, "Failed to create render buffer!");
-                return;
-            }
-
-            //make the draw buffer
-            drawBuff = sdlSurface->pixels;
-
-            //restore palette on new surface
-            SDL_Palette* palette = SDL_GetSurfacePalette(sdlSurface);
-            if (palette) SDL_SetPaletteColors(palette, pal, 0, 256);
-        }
-        else
-        {
-            //adjust render buffer (32-bytes alignment)
-            if (drawBuff) SDL_aligned_free(drawBuff);
-            drawBuff = SDL_aligned_alloc(32, bytesCopy);
-            if (!drawBuff)
-            {
-                messageBox(GFX_INFO, "Error create new render buffer:%u!", bytesCopy);
-                return;
-            }
-        }
-
-        //update new screen buffer size
-        texWidth = width;
-        texHeight = height;
-        centerX = (texWidth >> 1) - 1;
-        centerY = (texHeight >> 1) - 1;
-
-        //update new view port size
-        cminX = 0;
-        cminY = 0;
-        cmaxX = texWidth - 1;
-        cmaxY = texHeight - 1;
-
-        //update bytes per scan line
-        bytesPerScanline = rowBytes;
-    }
-
-    //done adjustment render buffer
-    memcpy(drawBuff, buffer, bytesCopy);
-    render();
-}
-
-//raise a message box
-void messageBox(int32_t type, const char* fmt, ...)
-{
-    char buffer[1024] = { 0 };
-    va_list args;
-    va_start(args, fmt);
-    vsnprintf(buffer, sizeof(buffer), fmt, args);
-    va_end(args);
-
-    switch (type)
-    {
-    case GFX_ERROR:
-        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, "GFX Error!", buffer, NULL);
-        break;
-
-    case GFX_WARNING:
-        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_WARNING, "GFX Warning!", buffer, NULL);
-        break;
-
-    default:
-        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "GFX Info", buffer, NULL);
-        break;
-    }
-}
-
-//get current bits per pixel
-must_inline int32_t getBitsPerPixel()
-{
-    return bitsPerPixel;
-}
-
-//get current bytes per pixel
-must_inline int32_t getBytesPerPixel()
-{
-    return bytesPerPixel;
-}
-
-//get current bytes per line
-must_inline int32_t getBytesPerScanline()
-{
-    return bytesPerScanline;
-}
-
-//get current draw buffer width
-int32_t getDrawBufferWidth()
-{
-    return texWidth;
-}
-
-//get current draw buffer height
-int32_t getDrawBufferHeight()
-{
-    return texHeight;
-}
-
-//retrieve raw pixels data buffer
-void* getDrawBuffer(int32_t *width, int32_t *height)
-{
-    if (width) *width = texWidth;
-    if (height) *height = texHeight;
-    return drawBuff;
-}
-
-//set the draw buffer
-//!!!changeDrawBuffer and restoreDrawBuffer must be a pair functions!!!
-void changeDrawBuffer(void* newBuff, int32_t newWidth, int32_t newHeight)
-{
-    oldBuffer = drawBuff;
-    drawBuff = newBuff;
-    changeViewPort(0, 0, newWidth - 1, newHeight - 1);
-}
-
-//must call after setDrawBuffer call
-//!!!changeDrawBuffer and restoreDrawBuffer must be a pair functions!!!
-void restoreDrawBuffer()
-{
-    drawBuff = oldBuffer;
-    restoreViewPort();
-}
-
-//set current screen view port for clipping
-//!!!changeViewPort and restoreViewPort must be a pair functions!!!
-void changeViewPort(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
-{
-    //save current view port
-    oldMinX     = cminX;
-    oldMinY     = cminY;
-    oldMaxX     = cmaxX;
-    oldMaxY     = cmaxY;
-    oldWidth    = texWidth;
-    oldHeight   = texHeight;
-
-    //update new clip view port
-    cminX = x1;
-    cminY = y1;
-    cmaxX = x2;
-    cmaxY = y2;
-
-    //update buffer width and height
-    texWidth    = cmaxX - cminX + 1;
-    texHeight   = cmaxY - cminY + 1;
-
-    //update center x,y
-    centerX = (texWidth >> 1) - 1;
-    centerY = (texHeight >> 1) - 1;
-
-    //update row bytes
-    bytesPerScanline = texWidth * bytesPerPixel;
-}
-
-//must call after changeViewPort call
-//!!!changeViewPort and restoreViewPort must be a pair functions!!!
-void restoreViewPort()
-{
-    cminX       = oldMinX;
-    cminY       = oldMinY;
-    cmaxX       = oldMaxX;
-    cmaxY       = oldMaxY;
-    texWidth    = oldWidth;
-    texHeight   = oldHeight;
-    centerX     = (texWidth >> 1) - 1;
-    centerY     = (texHeight >> 1) - 1;
-    bytesPerScanline = texWidth * bytesPerPixel;
-}
-
-//get current view port
-void getViewPort(int32_t* x1, int32_t* y1, int32_t* x2, int32_t* y2)
-{
-    *x1 = cminX;
-    *y1 = cminY;
-    *x2 = cmaxX;
-    *y2 = cmaxY;
-}
-
-//get current x center
-int32_t getCenterX()
-{
-    return centerX;
-}
-
-//get current y center
-int32_t getCenterY()
-{
-    return centerY;
-}
-
-//get current max x
-int32_t getMaxX()
-{
-    return cmaxX;
-}
-
-//get current max y
-int32_t getMaxY()
-{
-    return cmaxY;
-}
-
-//get current min x
-int32_t getMinX()
-{
-    return cminX;
-}
-
-//get current min y
-int32_t getMinY()
-{
-    return cminY;
-}
-
-//clear screen with color
-void clearScreenMix(uint32_t color)
-{
-    const uint32_t msize = texHeight * texWidth;
-#ifdef _USE_ASM
-    __asm {
-        mov     edi, drawBuff
-        mov     ecx, msize
-        shr     ecx, 2
-        mov     ebx, msize
-        and     ebx, 3
-        mov     al, byte ptr color
-        mov     ah, al
-        mov     dx, ax
-        shl     eax, 16
-        mov     ax, dx
-        rep     stosd
-        mov     ecx, ebx
-        rep     stosb
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = msize >> 5;
-    const __m256i ymm0 = _mm256_set1_epi8(color);
-    uint8_t* pixels = (uint8_t*)drawBuff;
-
-    //loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        _mm256_stream_si256((__m256i*)pixels, ymm0);
-        pixels += 32;
-    }
-
-    //have unaligned bytes?
-    int32_t remainder = msize % 32;
-    while (remainder--) *pixels++ = color;
-#endif
-    render();
-}
-
-//clear screen with color
-void clearScreen(uint32_t color)
-{
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        clearScreenMix(color);
-        return;
-    }
-
-    //height color mode
-    const uint32_t msize = texHeight * texWidth;
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        movd        mm0, color
-        mov         ecx, msize
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm0, mm0
-    again:
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         again
-    once:
-        test        msize, 1
-        jz          end
-        movd        [edi], mm0
-    end:
-        emms        
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = msize >> 3;
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-    uint32_t* pixels = (uint32_t*)drawBuff;
-    
-    //loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        _mm256_stream_si256((__m256i*)pixels, ymm0);
-        pixels += 8;
-    }
-
-    //have unaligned bytes?
-    int32_t remainder = msize % 8;
-    while (remainder--) *pixels++ = color;
-#endif
-    render();
-}
-
-//plot a pixel at (x,y) with color
-must_inline void putPixelMix(int32_t x, int32_t y, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     eax, color
-        stosb
-    }
-#else
-    uint8_t* pixels = (uint8_t*)drawBuff + (texWidth * y + x);
-    *pixels = color;
-#endif
-}
-
-//plot a pixel at (x,y) with color
-must_inline void putPixelNormal(int32_t x, int32_t y, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     eax, color
-        stosd
-    }
-#else
-    uint32_t* pixel = (uint32_t*)drawBuff + (texWidth * y + x);
-    *pixel = color;
-#endif
-}
-
-//plot a pixel at (x,y) with alpha-blending
-//correct formular: (SC*SA+DC*(256-SA))>>8
-//don't use (SC*SA+DC*(255-SA))>>8, you'll always get 254 as your maximum value.
-//ie: (255*128+255*(255-128))>>8=254 --> WRONG!!!
-//with: (255*128+255*(256-128))>>8=255 --> ACCEPTED!!!
-must_inline void putPixelAlpha(int32_t x, int32_t y, uint32_t src)
-{
-#if defined (_USE_ASM)
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff   
-        add         edi, eax
-        mov         eax, src
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-        movd        mm0, [edi]
-        movd        mm1, src
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-        emms
-    }
-#elif defined (_USE_SIMD)
-    const uint8_t cover = src >> 24;
-    const uint8_t rcover = 255 - cover;
-
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-    const uint32_t dst = *pixels;
-   
-    const __m128i vsrc = _mm_cvtsi32_si128(src);
-    const __m128i vdst = _mm_cvtsi32_si128(dst);
-
-    // Extract RGB and Alpha
-    const __m128i vcover = _mm_set1_epi16(cover);
-    const __m128i vrcover = _mm_set1_epi16(rcover);
-
-    // make constants
-    const __m128i vmask = _mm_set1_epi32(0x00FF00FF);
-    const __m128i vsrb = _mm_and_si128(vsrc, vmask);
-    const __m128i vdrb = _mm_and_si128(vdst, vmask);
-
-    const __m128i vsag = _mm_and_si128(_mm_srli_epi32(vsrc, 8), vmask);
-    const __m128i vdag = _mm_and_si128(_mm_srli_epi32(vdst, 8), vmask);
-
-    // Blend RB channels
-    __m128i vblendrb = _mm_add_epi16(_mm_mullo_epi16(vdrb, vrcover), _mm_mullo_epi16(vsrb, vcover));
-    vblendrb = _mm_srli_epi16(vblendrb, 8);
-    vblendrb = _mm_and_si128(vblendrb, vmask);
-
-    // Blend AG channels
-    __m128i vblendag = _mm_add_epi16(_mm_mullo_epi16(vdag, vrcover), _mm_mullo_epi16(vsag, vcover));
-    vblendag = _mm_and_si128(vblendag, _mm_set1_epi32(0xFF00FF00));
-
-    // Combine final pixel
-    *pixels = _mm_cvtsi128_si32(_mm_or_si128(vblendrb, vblendag));
-#else
-    const uint8_t cover = src >> 24;
-    const uint8_t rcover = 255 - cover;
-    
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-    const uint32_t dst = *pixels;
-
-    const uint32_t rb = ((dst & 0x00FF00FF) * rcover + (src & 0x00FF00FF) * cover) >> 8;
-    const uint32_t ag = (((dst >> 8) & 0x00FF00FF) * rcover + ((src >> 8) & 0x00FF00FF) * cover) & 0xFF00FF00;
-    
-    *pixels = (rb & 0x00FF00FF) | ag;
-#endif
-}
-
-//plot a pixel at (x,y) with anti-aliased
-must_inline void putPixelAA(int32_t x, int32_t y, uint32_t argb)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff
-        add         edi, eax
-        mov         eax, argb
-        shr         eax, 24
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-        neg         eax
-        add         eax, 256
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        pxor        mm5, mm5
-        movd        mm0, [edi]
-        movd        mm1, argb
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-        emms
-    }
-#else
-    uint32_t* pdata = (uint32_t*)drawBuff;
-    uint32_t* pixels = &pdata[texWidth * y + x];
-    const uint32_t dst = *pixels;
-    const uint8_t cover = argb >> 24;
-    const uint8_t rcover = 255 - cover;
-    const uint32_t rb = ((argb & 0x00ff00ff) * rcover + (dst & 0x00ff00ff) * cover);
-    const uint32_t ag = (((argb & 0xff00ff00) >> 8) * rcover + ((dst & 0xff00ff00) >> 8) * cover);
-    *pixels = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-#endif
-}
-
-//plot a pixel at (x,y) with background color
-must_inline void putPixelBob(int32_t x, int32_t y)
-{
-    if (bitsPerPixel != 8) return;
-    if (x < cminX || y < cminY || x > cmaxX || y > cmaxY) return;
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        mov     esi, drawBuff
-        add     esi, eax
-        mov     ebx, eax
-        lodsb
-        mov     edi, drawBuff
-        add     edi, ebx
-        inc     al
-        jnc     plot
-        mov     al, 255
-    plot:
-        stosb
-    }
-#else
-    const uint8_t col = min(getPixel(x, y) + 1, 255);
-    putPixel(x, y, col);
-#endif
-}
-
-//plot a pixel at (x,y) with add color
-must_inline void putPixelAdd(int32_t x, int32_t y, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        movd    mm0, [edi]
-        paddusb mm0, color
-        movd    [edi], mm0
-        emms
-    }
-#else
-    const ARGB* rgb = (ARGB*)&color;
-    ARGB* pdata = (ARGB*)drawBuff;
-    ARGB* pixels = &pdata[texWidth * y + x];
-    pixels->r = min(pixels->r + rgb->r, 255);
-    pixels->g = min(pixels->g + rgb->g, 255);
-    pixels->b = min(pixels->b + rgb->b, 255);
-#endif
-}
-
-//plot a pixel at (x,y) with sub color
-must_inline void putPixelSub(int32_t x, int32_t y, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        movd    mm0, [edi]
-        psubusb mm0, color
-        movd    [edi], mm0
-        emms
-    }
-#else
-    const ARGB* rgb = (ARGB*)&color;
-    ARGB* pdata = (ARGB*)drawBuff;
-    ARGB* pixels = &pdata[texWidth * y + x];
-    pixels->r = max(pixels->r - rgb->r, 0);
-    pixels->g = max(pixels->g - rgb->g, 0);
-    pixels->b = max(pixels->b - rgb->b, 0);
-#endif
-}
-
-//put pixel at (x,y) with color and mode
-void putPixel(int32_t x, int32_t y, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //range checking
-    if (x < cminX || y < cminY || x > cmaxX || y > cmaxY) return;
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        putPixelMix(x, y, color);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        putPixelNormal(x, y, color);
-        break;
-
-    case BLEND_MODE_ADD:
-        putPixelAdd(x, y, color);
-        break;
-
-    case BLEND_MODE_SUB:
-        putPixelSub(x, y, color);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        putPixelAlpha(x, y, color);
-        break;
-
-    case BLEND_MODE_ANTIALIASED:
-        putPixelAA(x, y, color);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//peek a pixel at (x,y)
-must_inline uint32_t getPixelMix(int32_t x, int32_t y)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        mov     esi, drawBuff
-        add     esi, eax
-        xor     eax, eax
-        lodsb
-    }
-    //eax will auto returned
-#else
-    const uint8_t* pixels = (uint8_t*)drawBuff;
-    return pixels[y * texWidth + x];
-#endif
-}
-
-//peek a pixel at (x,y)
-uint32_t getPixel(int32_t x, int32_t y)
-{
-    //range checking
-    if (x < cminX || y < cminY || x > cmaxX || y > cmaxY) return 0;
-
-    //mixed mode?
-    if (bitsPerPixel == 8) return getPixelMix(x, y);
-        
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     esi, drawBuff
-        add     esi, eax
-        xor     eax, eax
-        lodsd
-    }
-    //eax will auto returned
-#else
-    const uint32_t* pixel = (uint32_t*)drawBuff;
-    return pixel[y * texWidth + x];
-#endif
-}
-
-//fast horizontal line from (x,y) with sx length, and color
-must_inline void horizLineMix(int32_t x, int32_t y, int32_t sx, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     al, byte ptr [color]
-        mov     ah, al
-        mov     dx, ax
-        shl     eax, 16
-        mov     ax, dx
-        mov     edx, sx
-        shr     edx, 2
-        mov     ebx, sx
-        and     ebx, 3
-        mov     ecx, edx
-        rep     stosd
-        mov     ecx, ebx
-        rep     stosb
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = sx >> 5;
-    const __m256i ymm0 = _mm256_set1_epi8(color);
-    uint8_t* pdata = (uint8_t*)drawBuff;
-    uint8_t* pixels = &pdata[texWidth * y + x];
-    
-    //loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        //_mm256_storeu_si256 is slower than _mm256_stream_si256
-        //but _mm256_stream_si256 required memory is aligned by 32-bytes
-        _mm256_storeu_si256((__m256i*)pixels, ymm0);
-        pixels += 32;
-    }
-
-    //have unaligned bytes?
-    const int32_t remainder = sx % 32;
-    if (remainder > 0)
-    {
-        for (int32_t i = 0; i < remainder; i++) *pixels++ = color;
-    }
-#endif
-}
-
-//fast horizontal line from (x,y) with sx length, and color
-must_inline void horizLineNormal(int32_t x, int32_t y, int32_t sx, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff
-        add         edi, eax
-        movd        mm0, color
-        mov         ecx, sx
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm0, mm0
-    plot:
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        sx, 1
-        jz          end
-        movd        [edi], mm0
-    end:
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = sx >> 3;
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-    uint32_t* pdata = (uint32_t*)drawBuff;
-    uint32_t* pixels = &pdata[texWidth * y + x];
-
-    //loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        _mm256_storeu_si256((__m256i*)pixels, ymm0);
-        pixels += 8;
-    }
-
-    //have unaligned bytes?
-    const int32_t remainder = sx % 8;
-    if (remainder > 0)
-    {
-        for (int32_t i = 0; i < remainder; i++) *pixels++ = color;
-    }
-#endif
-}
-
-//fast horizontal line from (x,y) with sx length, and add color
-must_inline void horizLineAdd(int32_t x, int32_t y, int32_t sx, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff
-        add         edi, eax
-        movd        mm1, color
-        mov         ecx, sx
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    next:
-        movq        mm0, [edi]
-        paddusb     mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         next
-    once:
-        test        sx, 1
-        jz          end
-        movd        mm0, [edi]
-        paddusb     mm0, mm1
-        movd        [edi], mm0
-    end:
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = sx >> 3;
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-    ARGB* pdata = (ARGB*)drawBuff;
-    ARGB* pixels = &pdata[texWidth * y + x];
-    
-    //loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)pixels);
-        ymm1 = _mm256_adds_epu8(ymm1, ymm0);
-        _mm256_stream_si256((__m256i*)pixels, ymm1);
-        pixels += 8;
-    }
-
-    //have unaligned bytes?
-    const int32_t remainder = sx % 8;
-    if (remainder > 0)
-    {
-        const ARGB* rgb = (const ARGB*)&color;
-        for (int32_t i = 0; i < remainder; i++)
-        {
-            pixels->r = min(pixels->r + rgb->r, 255);
-            pixels->g = min(pixels->g + rgb->g, 255);
-            pixels->b = min(pixels->b + rgb->b, 255);
-            pixels++;
-        }
-    }
-#endif
-}
-
-//fast horizontal line from (x,y) with sx length, and sub color
-must_inline void horizLineSub(int32_t x, int32_t y, int32_t sx, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff
-        add         edi, eax
-        movd        mm1, color
-        mov         ecx, sx
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    next:
-        movq        mm0, [edi]
-        psubusb     mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         next
-    once:
-        test        sx, 1
-        jz          end
-        movd        mm0, [edi]
-        psubusb     mm0, mm1
-        movd        [edi], mm0
-    end:
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = sx >> 3;
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-    ARGB* pdata = (ARGB*)drawBuff;
-    ARGB* pixels = &pdata[texWidth * y + x];
-
-    //loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)pixels);
-        ymm1 = _mm256_subs_epu8(ymm1, ymm0);
-        _mm256_stream_si256((__m256i*)pixels, ymm1);
-        pixels += 8;
-    }
-
-    //have unaligned bytes?
-    const int32_t remainder = sx % 8;
-    if (remainder > 0)
-    {
-        const ARGB* rgb = (const ARGB*)&color;
-        for (int32_t i = 0; i < remainder; i++)
-        {
-            pixels->r = max(pixels->r - rgb->r, 0);
-            pixels->g = max(pixels->g - rgb->g, 0);
-            pixels->b = max(pixels->b - rgb->b, 0);
-            pixels++;
-        }
-    }
-#endif
-}
-
-//fast horizontal line from (x,y) with sx length, and blending pixel
-must_inline void horizLineAlpha(int32_t x, int32_t y, int32_t sx, uint32_t argb)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff
-        add         edi, eax
-        mov         eax, argb
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-    next:
-        movd        mm0, [edi]
-        movd        mm1, argb
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-        add         edi, 4
-        dec         sx
-        jnz         next
-        emms
-    }
-#else
-    //calculate starting address
-    const uint8_t cover = argb >> 24;
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-
-    //zero all
-    const __m256i ymm0 = _mm256_setzero_si256();
-
-    //alpha and inverted alpha, 8 x 32 bits
-    const __m256i alpha = _mm256_set1_epi16(cover);
-    const __m256i invert = _mm256_set1_epi16(256 - cover);
-
-    //set 4 pixels source color (8 x 32 bits data)
-    __m256i losrc = _mm256_set1_epi32(argb);
-    __m256i hisrc = losrc;
-
-    //unpack to low & hi (S * A) (8 x 32 bits data)
-    losrc = _mm256_unpacklo_epi8(losrc, ymm0);
-    losrc = _mm256_mullo_epi16(losrc, alpha);
-    hisrc = _mm256_unpackhi_epi8(hisrc, ymm0);
-    hisrc = _mm256_mullo_epi16(hisrc, alpha);
-
-    //process 32-bytes aligned
-    const int32_t aligned = sx >> 3;
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        //load 8 pixes width from dest (8 x 32 bits data)
-        __m256i lodst = _mm256_stream_load_si256((const __m256i*)pixels);
-        __m256i hidst = lodst;
-
-        //unpack to low & high (D * (256 - A)) (8 x 32 bits data)
-        lodst = _mm256_unpacklo_epi8(lodst, ymm0);
-        lodst = _mm256_mullo_epi16(lodst, invert);
-        hidst = _mm256_unpackhi_epi8(hidst, ymm0);
-        hidst = _mm256_mullo_epi16(hidst, invert);
-
-        //blending low, high (S * A + D * (256 - A)) >> 8 (8 x 32 bits data)
-        __m256i loret = _mm256_adds_epu16(losrc, lodst);
-        loret = _mm256_srli_epi16(loret, 8);
-        __m256i hiret = _mm256_adds_epu16(hisrc, hidst);
-        hiret = _mm256_srli_epi16(hiret, 8);
-
-        //destination = PACKED(low,hi) 32 x 8 bits
-        const __m256i result = _mm256_packus_epi16(loret, hiret);
-        _mm256_stream_si256((__m256i*)pixels, result);
-
-        //next 8 pixels
-        pixels += 8;
-    }
-
-    //have unaligned bytes
-    const int32_t remainder = sx % 8;
-    if (remainder > 0)
-    {
-        const uint8_t rcover = 255 - cover;
-        for (int32_t i = 0; i < remainder; i++)
-        {
-            const uint32_t dst = *pixels;
-            const uint32_t rb = ((dst & 0x00ff00ff) * rcover + (argb & 0x00ff00ff) * cover);
-            const uint32_t ag = (((dst & 0xff00ff00) >> 8) * rcover + ((argb & 0xff00ff00) >> 8) * cover);
-            *pixels++ = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-        }
-    }
-#endif
-}
-
-//fast horizon line from (x, y) with sx length
-void horizLine(int32_t x, int32_t y, int32_t sx, uint32_t color, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    //check for clip-y
-    if (y > cmaxY || y < cminY) return;
-    if (x > cmaxX || sx <= 0) return;
-
-    //check clip boundary
-    if (x < cminX)
-    {
-        //re-calculate sx
-        sx -= (cminX - x) + 1;
-        x = cminX;
-    }
-
-    //inbound check
-    if (sx > cmaxX - x) sx = (cmaxX - x) + 1;
-    if (sx <= 0) return;
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        horizLineMix(x, y, sx, color);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        horizLineNormal(x, y, sx, color);
-        break;
-
-    case BLEND_MODE_ADD:
-        horizLineAdd(x, y, sx, color);
-        break;
-
-    case BLEND_MODE_SUB:
-        horizLineSub(x, y, sx, color);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        horizLineAlpha(x, y, sx, color);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//fast vertical line from (x,y) with sy length, and palette color
-must_inline void vertLineMix(int32_t x, int32_t y, int32_t sy, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     ecx, sy
-        mov     ebx, texWidth
-        sub     ebx, 1
-        mov     al, byte ptr[color]
-    next:
-        stosb
-        add     edi, ebx
-        dec     ecx
-        jnz     next
-    }
-#else
-    //calculate starting address
-    uint8_t* pixels = (uint8_t*)drawBuff + (texWidth * y + x);
-    for (int32_t i = 0; i < sy; i++)
-    {
-        *pixels = color;
-        pixels += texWidth;
-    }
-#endif
-}
-
-//fast vertical line from (x,y) with sy length, and rgb color
-must_inline void vertLineNormal(int32_t x, int32_t y, int32_t sy, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     ecx, sy
-        mov     ebx, texWidth
-        sub     ebx, 1
-        shl     ebx, 2
-        mov     eax, color
-    next:
-        stosd
-        add     edi, ebx
-        dec     ecx
-        jnz     next
-    }
-#else
-    //calculate starting address
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-    for (int32_t i = 0; i < sy; i++)
-    {
-        *pixels = color;
-        pixels += texWidth;
-    }
-#endif
-}
-
-//fast vertical line from (x,y) with sy length, and add color
-must_inline void vertLineAdd(int32_t x, int32_t y, int32_t sy, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     ecx, sy
-        mov     ebx, texWidth
-        shl     ebx, 2
-    next:
-        movd    mm0, [edi]
-        paddusb mm0, color
-        movd    [edi], mm0
-        add     edi, ebx 
-        dec     ecx
-        jnz     next
-        emms
-    }
-#else
-    //calculate starting address
-    const ARGB* rgb = (ARGB*)&color;
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-    for (int32_t i = 0; i < sy; i++)
-    {
-        pixels->r = min(pixels->r + rgb->r, 255);
-        pixels->g = min(pixels->g + rgb->g, 255);
-        pixels->b = min(pixels->b + rgb->b, 255);
-        pixels += texWidth;
-    }
-#endif
-}
-
-//fast vertical line from (x,y) with sy length, and sub color
-must_inline void vertLineSub(int32_t x, int32_t y, int32_t sy, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     ecx, sy
-        mov     ebx, texWidth
-        shl     ebx, 2
-    next:
-        movd    mm0, [edi]
-        psubusb mm0, color
-        movd    [edi], mm0
-        add     edi, ebx
-        dec     ecx
-        jnz     next
-        emms
-    }
-#else
-    //calculate starting address
-    const ARGB* rgb = (ARGB*)&color;
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-    for (int32_t i = 0; i < sy; i++)
-    {
-        pixels->r = max(pixels->r - rgb->r, 0);
-        pixels->g = max(pixels->g - rgb->g, 0);
-        pixels->b = max(pixels->b - rgb->b, 0);
-        pixels += texWidth;
-    }
-#endif
-}
-
-//fast vertical line from (x,y) with sy length, and blending pixels
-must_inline void vertLineAlpha(int32_t x, int32_t y, int32_t sy, uint32_t argb)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        mov         edi, drawBuff
-        add         edi, eax
-        xor         eax, eax
-        mov         edx, texWidth
-        shl         edx, 2
-        mov         eax, argb
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-    next:
-        movd        mm0, [edi]
-        movd        mm1, argb
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-        add         edi, edx
-        dec         sy
-        jnz         next
-        emms
-    }
-#else
-    //calculate starting address
-    const uint8_t cover = argb >> 24;
-    const uint8_t rcover = 255 - cover;
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-    for (int32_t i = 0; i < sy; i++)
-    {
-        const uint32_t dst = *pixels;
-        const uint32_t rb = ((dst & 0x00ff00ff) * rcover + (argb & 0x00ff00ff) * cover);
-        const uint32_t ag = (((dst & 0xff00ff00) >> 8) * rcover + ((argb & 0xff00ff00) >> 8) * cover);
-        *pixels = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-        pixels += texWidth;
-    }
-#endif
-}
-
-//fast vertical line from (x,y) with sy length, and color
-void vertLine(int32_t x, int32_t y, int32_t sy, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //check for clip-x
-    if (x > cmaxX || x < cminX) return;
-    if (y > cmaxY || sy <= 0) return;
-
-    if (y < cminY)
-    {
-        //re-calculate sy
-        sy -= (cminY - y) + 1;
-        y = cminY;
-    }
-
-    //inbound check
-    if (sy > cmaxY - y) sy = (cmaxY - y) + 1;
-    if (sy <= 0) return;
-
-    if (bitsPerPixel == 8)
-    {
-        vertLineMix(x, y, sy, color);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        vertLineNormal(x, y, sy, color);
-        break;
-
-    case BLEND_MODE_ADD:
-        vertLineAdd(x, y, sy, color);
-        break;
-
-    case BLEND_MODE_SUB:
-        vertLineSub(x, y, sy, color);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        vertLineAlpha(x, y, sy, color);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectMix(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        add     edi, eax
-        mov     edx, texWidth
-        sub     edx, width
-        push    edx
-        mov     ebx, width
-        shr     ebx, 2
-        mov     edx, width
-        and     edx, 3
-        mov     eax, color
-        shl     eax, 8
-        or      eax, color
-        shl     eax, 8
-        or      eax, color
-        shl     eax, 8
-        or      eax, color
-    next:
-        mov     ecx, ebx
-        rep     stosd
-        mov     ecx, edx
-        rep     stosb
-        add     edi, [esp]
-        dec     height
-        jnz     next
-        pop     edx
-    }
-#else
-    //align 32-bytes
-    const int32_t aligned = width >> 5;
-    const int32_t remainder = width % 32;
-    const int32_t addOffset = texWidth - width;
-    
-    //calculate starting address
-    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * y + x);
-    
-    //initialize vector color
-    const __m256i ymm0 = _mm256_set1_epi8(color);
-
-    //lines-by-lines
-    for (int32_t i = 0; i < height; i++)
-    {
-        //loop for 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            _mm256_stream_si256((__m256i*)dstPixels, ymm0);
-            dstPixels += 32;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            for (int32_t j = 0; j < remainder; j++) *dstPixels++ = color;
-        }
-
-        //next lines
-        if (addOffset > 0) dstPixels += addOffset;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectNormal(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         edx, texWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm0, color
-    again:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm0, mm0
-    next:
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         next
-    once:
-        test        width, 1
-        jz          end
-        movd        [edi], mm0
-        add         edi, 4
-    end:
-        add         edi, edx
-        dec         height
-        jnz         again
-        emms
-    }
-#else
-    //align 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-    const int32_t addOffset = texWidth - width;
-
-    //calculate starting address
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * y + x);
-
-    //initialize vector color
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-
-    //lines-by-lines
-    for (int32_t i = 0; i < height; i++)
-    {
-        //loop for 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            _mm256_stream_si256((__m256i*)dstPixels, ymm0);
-            dstPixels += 8;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            for (int32_t j = 0; j < remainder; j++) *dstPixels++ = color;
-        }
-
-        //next lines
-        if (addOffset > 0) dstPixels += addOffset;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectAdd(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        movd        mm1, color
-    again:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    plot:
-        movq        mm0, [edi]
-        paddusb     mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          end
-        movd        mm0, [edi]
-        paddusb     mm0, mm1
-        movd        [edi], mm0
-        add         edi, 4
-    end:
-        add         edi, ebx
-        dec         height
-        jnz         again
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-    const int32_t addOfs = texWidth - width;
-    
-    //calculate starting address
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-    
-    //initialize vector color
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-
-    //lines-by-lines
-    for (int32_t i = 0; i < height; i++)
-    {
-        //loop for 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)pixels);
-            ymm1 = _mm256_adds_epu8(ymm1, ymm0);
-            _mm256_stream_si256((__m256i*)pixels, ymm1);
-            pixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            const ARGB* pcol = (const ARGB*)&color;
-            for (int32_t j = 0; j < remainder; j++)
-            {
-                pixels->b = min(pixels->b + pcol->b, 255);
-                pixels->g = min(pixels->g + pcol->g, 255);
-                pixels->r = min(pixels->r + pcol->r, 255);
-                pixels++;
-            }
-        }
-
-        //next line
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectSub(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        movd        mm1, color
-    again:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    plot:
-        movq        mm0, [edi]
-        psubusb     mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          end
-        movd        mm0, [edi]
-        psubusb     mm0, mm1
-        movd        [edi], mm0
-        add         edi, 4
-    end:
-        add         edi, ebx
-        dec         height
-        jnz         again
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-    const int32_t addOfs = texWidth - width;
-
-    //calculate starting address
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-
-    //initialize vector color
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-
-    //lines-by-lines
-    for (int32_t i = 0; i < height; i++)
-    {
-        //loop for 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)pixels);
-            ymm1 = _mm256_subs_epu8(ymm1, ymm0);
-            _mm256_stream_si256((__m256i*)pixels, ymm1);
-            pixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            const ARGB* pcol = (const ARGB*)&color;
-            for (int32_t j = 0; j < remainder; j++)
-            {
-                pixels->b = max(pixels->b - pcol->b, 0);
-                pixels->g = max(pixels->g - pcol->g, 0);
-                pixels->r = max(pixels->r - pcol->r, 0);
-                pixels++;
-            }
-        }
-
-        //next line
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectAnd(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        movd        mm1, color
-    again:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    plot:
-        movq        mm0, [edi]
-        pand        mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          end
-        movd        mm0, [edi]
-        pand        mm0, mm1
-        movd        [edi], mm0
-        add         edi, 4
-    end:
-        add         edi, ebx
-        dec         height
-        jnz         again
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-    const int32_t addOfs = texWidth - width;
-
-    //calculate starting address
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-
-    //initialize vector color
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-
-    //lines-by-lines
-    for (int32_t i = 0; i < height; i++)
-    {
-        //loop for 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)pixels);
-            ymm1 = _mm256_and_si256(ymm1, ymm0);
-            _mm256_stream_si256((__m256i*)pixels, ymm1);
-            pixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            const ARGB* pcol = (const ARGB*)&color;
-            for (int32_t j = 0; j < remainder; j++)
-            {
-                pixels->b = pixels->b & pcol->b;
-                pixels->g = pixels->g & pcol->g;
-                pixels->r = pixels->r & pcol->r;
-                pixels++;
-            }
-        }
-
-        //next line
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectXor(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        movd        mm1, color
-    again:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    plot:
-        movq        mm0, [edi]
-        pxor        mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          end
-        movd        mm0, [edi]
-        pxor        mm0, mm1
-        movd        [edi], mm0
-        add         edi, 4
-    end:
-        add         edi, ebx
-        dec         height
-        jnz         again
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-    const int32_t addOfs = texWidth - width;
-
-    //calculate starting address
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-
-    //initialize vector color
-    const __m256i ymm0 = _mm256_set1_epi32(color);
-
-    //lines-by-lines
-    for (int32_t i = 0; i < height; i++)
-    {
-        //loop for 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)pixels);
-            ymm1 = _mm256_xor_si256(ymm1, ymm0);
-            _mm256_stream_si256((__m256i*)pixels, ymm1);
-            pixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            const ARGB* pcol = (const ARGB*)&color;
-            for (int32_t j = 0; j < remainder; j++)
-            {
-                pixels->b = pixels->b ^ pcol->b;
-                pixels->g = pixels->g ^ pcol->g;
-                pixels->r = pixels->r ^ pcol->r;
-                pixels++;
-            }
-        }
-
-        //next line
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and blending pixel
-void fillRectAlpha(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t argb)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         edx, texWidth
-        sub         edx, width
-        shl         edx, 2
-        mov         eax, argb
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-    next:
-        mov         ecx, width
-    plot:
-        movd        mm0, [edi]
-        movd        mm1, argb
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-        add         edi, 4
-        dec         ecx
-        jnz         plot
-        add         edi, edx
-        dec         height
-        jnz         next
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-    const int32_t addOfs = texWidth - width;
-    const uint8_t cover = argb >> 24;
-
-    //calculate starting address
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-
-    //zero all
-    const __m256i ymm0 = _mm256_setzero_si256();
-
-    //alpha and inverted alpha, 8 x 32 bits
-    const __m256i alpha = _mm256_set1_epi16(cover);
-    const __m256i invert = _mm256_set1_epi16(256 - cover);
-
-    //set 8 pixels source color (8 x 32 bits data)
-    __m256i losrc = _mm256_set1_epi32(argb);
-    __m256i hisrc = losrc;
-
-    //unpack to low & hi (S * A) (8 x 32 bits data)
-    losrc = _mm256_unpacklo_epi8(losrc, ymm0);
-    losrc = _mm256_mullo_epi16(losrc, alpha);
-    hisrc = _mm256_unpackhi_epi8(hisrc, ymm0);
-    hisrc = _mm256_mullo_epi16(hisrc, alpha);
-
-    //process 32-bytes aligned
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load 8 pixes width from dest (8 x 32 bits data)
-            __m256i lodst = _mm256_stream_load_si256((const __m256i*)pixels);
-            __m256i hidst = lodst;
-
-            //unpack to low & high (D * (256 - A)) (8 x 32 bits data)
-            lodst = _mm256_unpacklo_epi8(lodst, ymm0);
-            lodst = _mm256_mullo_epi16(lodst, invert);
-            hidst = _mm256_unpackhi_epi8(hidst, ymm0);
-            hidst = _mm256_mullo_epi16(hidst, invert);
-
-            //blending low, high (S * A + D * (256 - A)) >> 8 (8 x 32 bits data)
-            __m256i loret = _mm256_adds_epu16(losrc, lodst);
-            loret = _mm256_srli_epi16(loret, 8);
-            __m256i hiret = _mm256_adds_epu16(hisrc, hidst);
-            hiret = _mm256_srli_epi16(hiret, 8);
-
-            //destination = PACKED(low,hi) 32 x 8 bits
-            const __m256i result = _mm256_packus_epi16(loret, hiret);
-            _mm256_stream_si256((__m256i*)pixels, result);
-
-            //next 8 pixels
-            pixels += 8;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            const uint8_t rcover = 255 - cover;
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                const uint32_t dst = *pixels;
-                const uint32_t rb = ((dst & 0x00ff00ff) * rcover + (argb & 0x00ff00ff) * cover);
-                const uint32_t ag = (((dst & 0xff00ff00) >> 8) * rcover + ((argb & 0xff00ff00) >> 8) * cover);
-                *pixels++ = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-            }
-        }
-
-        //next line
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRect(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //calculate new position
-    const int32_t x1 = x + (width - 1);
-    const int32_t y1 = y + (height - 1);
-
-    //clip image to context boundaries
-    const int32_t lx = max(x, cminX);
-    const int32_t ly = max(y, cminY);
-    const int32_t lx1 = min(x1, cmaxX);
-    const int32_t ly1 = min(y1, cmaxY);
-
-    //initialize loop variables
-    const int32_t lwidth = (lx1 - lx) + 1;
-    const int32_t lheight = (ly1 - ly) + 1;
-
-    //check for loop
-    if (lwidth <= 0 || lheight <= 0) return;
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        fillRectMix(lx, ly, lwidth, lheight, color);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        fillRectNormal(lx, ly, lwidth, lheight, color);
-        break;
-
-    case BLEND_MODE_ADD:
-        fillRectAdd(lx, ly, lwidth, lheight, color);
-        break;
-
-    case BLEND_MODE_SUB:
-        fillRectSub(lx, ly, lwidth, lheight, color);
-        break;
-
-    case BLEND_MODE_AND:
-        fillRectAnd(lx, ly, lwidth, lheight, color);
-        break;
-
-    case BLEND_MODE_XOR:
-        fillRectXor(lx, ly, lwidth, lheight, color);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        fillRectAlpha(lx, ly, lwidth, lheight, color);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectPatternMix(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        add     edi, eax
-        mov     edx, texWidth
-        sub     edx, width
-        mov     esi, pattern
-    plot:
-        mov     ecx, x
-        and     ecx, 7
-        mov     ebx, height
-        and     ebx, 7
-        mov     al, [esi + ebx]
-        rol     al, cl
-        mov     ebx, col
-        mov     ecx, width
-    next:
-        test    al, 1
-        jz      step
-        mov     [edi], bl
-    step: 
-        inc     edi
-        rol     al, 1
-        dec     ecx
-        jnz     next
-        add     edi, edx
-        dec     height
-        jnz     plot
-    }
-#else
-    //calculate starting address
-    const int32_t addDstOffs = texWidth - width;
-    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * y + x);
-
-    for (int32_t i = 0; i < height; i++)
-    {
-        uint8_t pat = pattern[i & 7];
-        pat = _rotl8(pat, 7);
-        for (int32_t j = 0; j < width; j++)
-        {
-            if (pat & 1) *dstPixels = pat;
-            pat = _rotl8(pat, 1);
-            dstPixels++;
-        }
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectPatternNormal(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         esi, pattern
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         edx, texWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm0, col
-    plot:
-        mov         ecx, x
-        and         ecx, 7
-        mov         ebx, height
-        and         ebx, 7
-        mov         al, [esi + ebx]
-        rol         al, cl
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm0, mm0
-    next:
-        test        al, 1
-        jz          skip1
-        test        al, 2
-        jz          skip2
-        movq        [edi], mm0
-        jmp         skip0
-    skip2:
-        movd        [edi + 4], mm0
-        jmp         skip0
-    skip1:
-        test        al, 2
-        jz          skip0
-        movd        [edi], mm0
-    skip0:
-        add         edi, 8
-        rol         al, 2
-        dec         ecx
-        jnz         next
-    once:
-        test        width, 1
-        jz          end1
-        test        al, 2
-        jz          end0
-        movd        [edi], mm0
-    end0:
-        add         edi, 4
-    end1:
-        add         edi, edx
-        dec         height
-        jnz         plot
-        emms
-    }
-#else
-    //calculate starting address
-    const int32_t addDstOffs = texWidth - width;
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * y + x);
-
-    for (int32_t i = 0; i < height; i++)
-    {
-        uint8_t pat = pattern[i & 7];
-        pat = _rotl8(pat, 7);
-        for (int32_t j = 0; j < width; j++)
-        {
-            if (pat & 1) *dstPixels = pat;
-            pat = _rotl8(pat, 1);
-            dstPixels++;
-        }
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectPatternAdd(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         esi, pattern
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         edx, texWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm1, col
-    plot:
-        mov         ecx, x
-        and         ecx, 7
-        mov         ebx, height
-        and         ebx, 7
-        mov         al, [esi + ebx]
-        rol         al, cl
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    next:
-        test        al, 1
-        jz          skip1
-        test        al, 2
-        jz          skip2
-        movq        mm0, [edi]
-        paddusb     mm0, mm1
-        movq        [edi], mm0
-        jmp         skip0
-    skip2:
-        movd        mm0, [edi + 4]
-        paddusb     mm0, mm1
-        movd        [edi + 4], mm0
-        jmp         skip0
-    skip1:
-        test        al, 2
-        jz          skip0
-        movd        mm0, [edi]
-        paddusb     mm0, mm1
-        movd        [edi], mm0
-    skip0:
-        add         edi, 8
-        rol         al, 2
-        dec         ecx
-        jnz         next
-    once:
-        test        width, 1
-        jz          end1
-        test        al, 2
-        jz          end0
-        movd        mm0, [edi]
-        paddusb     mm0, mm1
-        movd        [edi], mm0
-    end0:
-        add         edi, 4
-    end1:
-        add         edi, edx
-        dec         height
-        jnz         plot
-        emms
-    }
-#else
-    //convert to byte color
-    const ARGB* pcol = (const ARGB*)&col;
-    const int32_t addOfs = texWidth - width;
-
-    //calculate starting address
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-    
-    //start scan line
-    for (int32_t i = 0; i < height; i++)
-    {
-        uint8_t pat = pattern[i & 7];
-        pat = _rotl8(pat, 7);
-        for (int32_t j = 0; j < width; j++)
-        {
-            if (pat & 1)
-            {
-                pixels->r = min(pixels->r + pcol->r, 255);
-                pixels->g = min(pixels->g + pcol->g, 255);
-                pixels->b = min(pixels->b + pcol->b, 255);
-            }
-            pat = _rotl8(pat, 1);
-            pixels++;
-        }
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectPatternSub(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         esi, pattern
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         edx, texWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm1, col
-    plot:
-        mov         ecx, x
-        and         ecx, 7
-        mov         ebx, height
-        and         ebx, 7
-        mov         al, [esi + ebx]
-        rol         al, cl
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    next:
-        test        al, 1
-        jz          skip1
-        test        al, 2
-        jz          skip2
-        movq        mm0, [edi]
-        psubusb     mm0, mm1
-        movq        [edi], mm0
-        jmp         skip0
-    skip2:
-        movd        mm0, [edi + 4]
-        psubusb     mm0, mm1
-        movd        [edi + 4], mm0
-        jmp         skip0
-    skip1:
-        test        al, 2
-        jz          skip0
-        movd        mm0, [edi]
-        psubusb     mm0, mm1
-        movd        [edi], mm0
-    skip0:
-        add         edi, 8
-        rol         al, 2
-        dec         ecx
-        jnz         next
-    once:
-        test        width, 1
-        jz          end1
-        test        al, 2
-        jz          end0
-        movd        mm0, [edi]
-        psubusb     mm0, mm1
-        movd        [edi], mm0
-    end0:
-        add         edi, 4
-    end1:
-        add         edi, edx
-        dec         height
-        jnz         plot
-        emms
-    }
-#else
-    //convert to byte color
-    const ARGB* pcol = (const ARGB*)&col;
-    const int32_t addOfs = texWidth - width;
-
-    //calculate starting address
-    ARGB* pixels = (ARGB*)drawBuff + (texWidth * y + x);
-
-    //start scan line
-    for (int32_t i = 0; i < height; i++)
-    {
-        uint8_t pat = pattern[i & 7];
-        pat = _rotl8(pat, 7);
-        for (int32_t j = 0; j < width; j++)
-        {
-            if (pat & 1)
-            {
-                pixels->r = max(pixels->r - pcol->r, 0);
-                pixels->g = max(pixels->g - pcol->g, 0);
-                pixels->b = max(pixels->b - pcol->b, 0);
-            }
-            pat = _rotl8(pat, 1);
-            pixels++;
-        }
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and blending pixel
-void fillRectPatternAlpha(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t argb, const uint8_t* pattern)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, y
-        mul         texWidth
-        add         eax, x
-        shl         eax, 2
-        add         edi, eax
-        mov         edx, texWidth
-        sub         edx, width
-        shl         edx, 2
-        mov         esi, pattern
-        mov         eax, argb
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-    plot:
-        push        edx
-        mov         ecx, x
-        and         ecx, 7
-        mov         ebx, height
-        and         ebx, 7
-        mov         dl, [esi + ebx]
-        rol         dl, cl
-        mov         ecx, width
-    next:
-        test        dl, 1
-        jz          step
-        movd        mm0, [edi]
-        movd        mm1, argb
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-    step:
-        add         edi, 4
-        rol         dl, 1
-        dec         ecx
-        jnz         next
-        pop         edx
-        add         edi, edx
-        dec         height
-        jnz         plot
-        emms
-    }
-#else
-    //calculate alpha and adding offset for the next line
-    const uint8_t cover = argb >> 24;
-    const uint8_t rcover = 255 - cover;
-    const int32_t addOfs = texWidth - width;
-
-    //calculate starting address
-    uint32_t* pixels = (uint32_t*)drawBuff + (texWidth * y + x);
-
-    for (int32_t i = 0; i < height; i++)
-    {
-        uint8_t pat = pattern[i & 7];
-        pat = _rotl8(pat, 7);
-        for (int32_t j = 0; j < width; j++)
-        {
-            if (pat & 1)
-            {
-                const uint32_t dst = *pixels;
-                const uint32_t rb = ((dst & 0x00ff00ff) * rcover + (argb & 0x00ff00ff) * cover);
-                const uint32_t ag = (((dst & 0xff00ff00) >> 8) * rcover + ((argb & 0xff00ff00) >> 8) * cover);
-                *pixels = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-            }
-            pat = _rotl8(pat, 1);
-            pixels++;
-        }
-        if (addOfs > 0) pixels += addOfs;
-    }
-#endif
-}
-
-//fill rectangle with corners (x1,y1) and (width,height) and color
-void fillRectPattern(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //calculate new position
-    const int32_t x1 = x + (width - 1);
-    const int32_t y1 = y + (height - 1);
-
-    //clip image to context boundaries
-    const int32_t lx = max(x, cminX);
-    const int32_t ly = max(y, cminY);
-    const int32_t lx1 = min(x1, cmaxX);
-    const int32_t ly1 = min(y1, cmaxY);
-
-    //initialize loop variables
-    const int32_t lwidth = (lx1 - lx) + 1;
-    const int32_t lheight = (ly1 - ly) + 1;
-
-    //check for loop
-    if (lwidth <= 0 || lheight <= 0) return;
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        fillRectPatternMix(lx, ly, lwidth, lheight, col, pattern);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        fillRectPatternNormal(lx, ly, lwidth, lheight, col, pattern);
-        break;
-
-    case BLEND_MODE_ADD:
-        fillRectPatternAdd(lx, ly, lwidth, lheight, col, pattern);
-        break;
-
-    case BLEND_MODE_SUB:
-        fillRectPatternSub(lx, ly, lwidth, lheight, col, pattern);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        fillRectPatternAlpha(lx, ly, lwidth, lheight, col, pattern);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//get current pattern type
-uint8_t* getPattern(int32_t type)
-{
-    switch (type)
-    {
-    case PATTERN_TYPE_LINE:
-        return ptnLine;
-
-    case PATTERN_TYPE_LITE_SLASH:
-        return ptnLiteSlash;
-
-    case PATTERN_TYPE_SLASH:
-        return ptnSlash;
-
-    case PATTERN_TYPE_BACK_SLASH:
-        return ptnBackSlash;
-
-    case PATTERN_TYPE_LITE_BACK_SLASH:
-        return ptnLiteBackSlash;
-
-    case PATTERN_TYPE_HATCH:
-        return ptnHatch;
-
-    case PATTERN_TYPE_HATCH_X:
-        return ptnHatchX;
-
-    case PATTERN_TYPE_INTER_LEAVE:
-        return ptnInterLeave;
-
-    case PATTERN_TYPE_WIDE_DOT:
-        return ptnWideDot;
-
-    case PATTERN_TYPE_CLOSE_DOT:
-        return ptnCloseDot;
-
-    default:
-        messageBox(GFX_ERROR, "Unknown pattern type:%d", type);
-        return NULL;
-        break;
-    }
-}
-
-//Cohen-Sutherland clipping algorithm
-int32_t getCode(int32_t x, int32_t y)
-{
-    int32_t code = 0;
-    if (y >= texHeight)	code |= 1; //top
-    else if (y < 0)		code |= 2; //bottom
-    if (x >= texWidth)	code |= 4; //right
-    else if (x < 0)		code |= 8; //left
-    return code;
-}
-
-//Cohen-Sutherland clipping line (xs,ys)-(xe, ye)
-void clipLine(int32_t* xs, int32_t* ys, int32_t* xe, int32_t* ye)
-{
-    int32_t accept = 0, done = 0;
-    int32_t x1 = *xs, x2 = *xe, y1 = *ys, y2 = *ye;
-
-    //the region out codes for the endpoints
-    int32_t code1 = getCode(x1, y1);
-    int32_t code2 = getCode(x2, y2);
-
-    //in theory, this can never end up in an infinite loop, it'll always come in one of the trivial cases eventually
-    do {
-        //accept because both endpoints are in screen or on the border, trivial accept
-        if (!(code1 | code2)) accept = done = 1;
-
-        //the line isn't visible on screen, trivial reject
-        else if (code1 & code2) done = 1;
-
-        //if no trivial reject or accept, continue the loop
-        else
-        {
-            int32_t x = 0, y = 0;
-            const int32_t codeout = code1 ? code1 : code2;
-
-            if (codeout & 1)
-            {
-                //top
-                x = x1 + (x2 - x1) * (texHeight - y1) / (y2 - y1);
-                y = texHeight - 1;
-            }
-            else if (codeout & 2)
-            {
-                //bottom
-                x = x1 + (x2 - x1) * -y1 / (y2 - y1);
-                y = 0;
-            }
-            else if (codeout & 4)
-            {
-                //right
-                y = y1 + (y2 - y1) * (texWidth - x1) / (x2 - x1);
-                x = texWidth - 1;
-            }
-            else
-            {
-                //left
-                y = y1 + (y2 - y1) * -x1 / (x2 - x1);
-                x = 0;
-            }
-
-            if (codeout == code1)
-            {
-                //first endpoint was clipped
-                x1 = x;
-                y1 = y;
-                code1 = getCode(x1, y1);
-            }
-            else
-            {
-                //second endpoint was clipped
-                x2 = x;
-                y2 = y;
-                code2 = getCode(x2, y2);
-            }
-        }
-    } while (!done);
-
-    if (accept)
-    {
-        *xs = x1;
-        *xe = x2;
-        *ys = y1;
-        *ye = y2;
-    }
-    else
-    {
-        *xs = 0;
-        *xe = 0;
-        *ys = 0;
-        *ye = 0;
-    }
-}
-
-//Wu's line from (x1,y1) to (x2,y2) with anti-aliased
-void drawLineAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t argb)
-{
-    const int32_t dx = abs(x1 - x0);
-    const int32_t sx = x0 < x1 ? 1 : -1;
-    const int32_t dy = abs(y1 - y0);
-    const int32_t sy = y0 < y1 ? 1 : -1;
-    const int32_t ed = ((dx + dy) == 0) ? 1 : int32_t(sqrt(sqr(double(dx)) + sqr(double(dy))));
-
-    int32_t err = dx - dy;
-
-    while (1)
-    {
-        putPixel(x0, y0, rgba(argb, 255 * abs(err - dx + dy) / ed), BLEND_MODE_ANTIALIASED);
-        const int32_t e2 = err;
-        const int32_t x2 = x0;
-
-        if (2 * e2 >= -dx)
-        {
-            if (x0 == x1) break;
-            if (e2 + dy < ed) putPixel(x0, y0 + sy, rgba(argb, 255 * (e2 + dy) / ed), BLEND_MODE_ANTIALIASED);
-            err -= dy;
-            x0 += sx;
-        }
-
-        if (2 * e2 <= dy)
-        {
-            if (y0 == y1) break;
-            if (dx - e2 < ed) putPixel(x2 + sx, y0, rgba(argb, 255 * (dx - e2) / ed), BLEND_MODE_ANTIALIASED);
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
-//Bresenham line from (x1,y1) to (x2,y2) with color and mode
-void drawLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //alpha mode
-    if (mode == BLEND_MODE_ANTIALIASED)
-    {
-        drawLineAA(x1, y1, x2, y2, color);
-        return;
-    }
-
-    const int32_t step = abs(y2 - y1) > abs(x2 - x1);
-
-    if (step)
-    {
-        swap(x1, y1);
-        swap(x2, y2);
-    }
-
-    if (x1 > x2)
-    {
-        swap(x1, x2);
-        swap(y1, y2);
-    }
-
-    const int32_t dx = x2 - x1;
-    const int32_t dy = abs(y2 - y1);
-    const int32_t ystep = (y1 < y2) ? 1 : -1;
-
-    int32_t y = y1;
-    int32_t error = dx >> 1;
-
-    for (int32_t x = x1; x <= x2; x++)
-    {
-        putPixel(step ? y : x, step ? x : y, color, mode);
-        error -= dy;
-        if (error < 0)
-        {
-            y += ystep;
-            error += dx;
-        }
-    }
-}
-
-//Bresenham diagonal line from(x1, y1) to (x2, y2) with added background color
-void drawLineBob(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
-{
-    //this function only support mixed mode
-    if (bitsPerPixel != 8) return;
-
-    //range check
-    if (x1 < 0 || x1 > cmaxX || x2 < 0 || x2 > cmaxX || y1 < 0 || y1 > cmaxY || y2 < 0 || y2 > cmaxY) return;
-
-#ifdef _USE_ASM    
-    int32_t dst = 0, sc = 0, dc = 0;
-    int32_t adddx = 0, adddy = 0;
-    int32_t addsx = 0, addsy = 0;
-    void* plotpixel = putPixelBob;
-
-    __asm {
-        mov     ecx, 1
-        mov     edx, 1
-        mov     edi, y2
-        sub     edi, y1
-        jge     keepy
-        neg     edx
-        neg     edi
-    keepy:
-        mov     adddy, edx
-        mov     esi, x2
-        sub     esi, x1
-        jge     keepx
-        neg     ecx
-        neg     esi
-    keepx:
-        mov     adddx, ecx
-        cmp     esi, edi
-        jge     horiz
-        xor     ecx, ecx
-        xchg    esi, edi
-        jmp     saves
-    horiz:
-        xor     edx, edx
-    saves:
-        mov     dst, edi
-        mov     addsx, ecx
-        mov     addsy, edx
-        mov     eax, dst
-        shl     eax, 1
-        mov     sc, eax
-        sub     eax, esi
-        mov     ebx, eax
-        sub     eax, esi
-        mov     dc, eax
-        mov     ecx, x1
-        mov     edx, y1
-    again:
-        dec     esi
-        jz      done
-        push    edx
-        push    ecx
-        call    plotpixel
-        pop     ecx
-        pop     edx
-        cmp     ebx, 0
-        jge     dline
-        add     ecx, addsx
-        add     edx, addsy
-        add     ebx, sc
-        jmp     again
-    dline:
-        add     ecx, adddx
-        add     edx, adddy
-        add     ebx, dc
-        jmp     again
-    done:
-    }
-#else
-    const int32_t dx = abs(x2 - x1);
-    const int32_t dy = abs(y2 - y1);
-
-    int32_t x = x1;
-    int32_t y = y1;
-    int32_t addx1 = 0, addx2 = 0;
-    int32_t addy1 = 0, addy2 = 0;
-    int32_t numpixels = 0, curpixel = 0;
-    int32_t den = 0, num = 0, numadd = 0;
-
-    if (x2 >= x1)
-    {
-        addx1 = 1;
-        addx2 = 1;
-    }
-    else
-    {
-        addx1 = -1;
-        addx2 = -1;
-    }
-
-    if (y2 >= y1)
-    {
-        addy1 = 1;
-        addy2 = 1;
-    }
-    else
-    {
-        addy1 = -1;
-        addy2 = -1;
-    }
-
-    if (dx >= dy)
-    {
-        addx1 = 0;
-        addy2 = 0;
-        den = dx;
-        num = dx >> 1;
-        numadd = dy;
-        numpixels = dx;
-    }
-    else
-    {
-        addx2 = 0;
-        addy1 = 0;
-        den = dy;
-        num = dy >> 1;
-        numadd = dx;
-        numpixels = dy;
-    }
-
-    for (curpixel = 0; curpixel < numpixels; curpixel++)
-    {
-        putPixelBob(x, y);
-        num += numadd;
-        if (num >= den)
-        {
-            num -= den;
-            x += addx1;
-            y += addy1;
-        }
-        x += addx2;
-        y += addy2;
-    }
-#endif
-}
-
-//pre-calculate lookup table for filled-circle
-void calcCircle(int32_t rd, int32_t* points)
-{
-    //validate radius
-    if (rd <= 0) return;
-
-#ifdef _USE_ASM
-    __asm {
-        mov     ebx, 1
-        sub     ebx, rd
-        mov     edi, points
-        mov     esi, edi
-        mov     eax, rd
-        shl     eax, 2
-        add     esi, eax
-        mov     eax, rd
-        xor     ecx, ecx
-    start:
-        or      ebx, ebx
-        jns     next
-        mov     edx, ecx
-        shl     edx, 1
-        add     edx, 3
-        add     ebx, edx
-        inc     ecx
-        sub     esi, 4
-        jmp     stop
-    next:
-        mov     edx, ecx
-        sub     edx, eax
-        shl     edx, 1
-        add     edx, 3
-        add     ebx, edx
-        inc     ecx
-        dec     eax
-        sub     esi, 4
-        add     edi, 4
-    stop:
-        mov     [edi], ecx
-        mov     [esi], eax
-        cmp     eax, ecx
-        jg      start
-    }
-#else
-    int32_t eax = rd;
-    int32_t ebx = 1 - rd;
-    int32_t edi = 0, esi = rd;
-    int32_t ecx = 0, edx = 0;
-
-    while (ecx < eax)
-    {
-        if (ebx < 0)
-        {
-            edx = (ecx++ << 1) + 3;
-            ebx += edx;
-            esi--;
-        }
-        else
-        {
-            edx = ((ecx++ - eax--) << 1) + 3;
-            ebx += edx;
-            esi--;
-            edi++;
-        }
-        points[edi] = ecx;
-        points[esi] = eax;
-    }
-#endif
-}
-
-//pre-calculate lookup table for filled-ellipse
-void calcEllipse(int32_t rx, int32_t ry, int32_t* points)
-{
-    int32_t ra = 0, aa = 0, bb = 0;
-    int32_t xa = 0, mx = 0, my = 0;
-    int32_t aq = 0, bq = 0, xd = 0, yd = 0;
-
-    //validate radius
-    if (rx <= 0 || ry <= 0) return;
-
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, rx
-        mov     xa, eax
-        neg     eax
-        mov     mx, eax
-        xor     edx, edx
-        mov     eax, rx
-        mul     eax
-        mov     aq, eax
-        shl     eax, 1
-        mov     xd, eax
-        mov     eax, ry
-        mul     eax
-        mov     bq, eax
-        shl     eax, 1
-        mov     yd, eax
-        mov     eax, rx
-        mul     bq
-        mov     ra, eax
-        shl     eax, 1
-        mov     aa, eax
-    next:
-        cmp     ra, 0
-        jle     skip
-        inc     my
-        mov     eax, bb
-        add     eax, xd
-        mov     bb, eax
-        sub     ra, eax
-    skip:
-        cmp     ra, 0
-        jg      done
-        dec     xa
-        inc     mx
-        mov     eax, aa
-        sub     eax, yd
-        mov     aa, eax
-        add     ra, eax
-    done:
-        mov     edi, points
-        mov     ebx, ry
-        sub     ebx, my
-        shl     ebx, 2
-        add     edi, ebx
-        mov     eax, mx
-        neg     eax
-        stosd
-        cmp     xa, 0
-        jg      next
-    }
-#else
-    xa = rx;
-    mx = -rx;
-    aq = rx * rx;
-    xd = aq << 1;
-
-    bq = ry * ry;
-    yd = bq << 1;
-    ra = bq * rx;
-    aa = ra << 1;
-
-    while (xa > 0)
-    {
-        if (ra > 0)
-        {
-            my++;
-            ra -= (bb + xd);
-            bb += xd;
-        }
-        if (ra <= 0)
-        {
-            xa--;
-            mx++;
-            ra += (aa - yd);
-            aa -= yd;
-        }
-        points[ry - my] = -mx;
-    }
-#endif
-}
-
-//Wu's circle with anti-aliased
-void drawCircleAA(int32_t xm, int32_t ym, int32_t rad, uint32_t argb)
-{
-    int32_t y = 0;
-    int32_t x = -rad;
-    int32_t err = (1 - rad) << 1;
-
-    if (rad <= 0) return;
-
-    rad = 1 - err;
-
-    do {
-        int32_t alpha = 255 * abs(err - 2 * (x + y) - 2) / rad;
-        uint32_t col = rgba(argb, alpha);
-        putPixel(xm - x, ym + y, col, BLEND_MODE_ANTIALIASED);
-        putPixel(xm - y, ym - x, col, BLEND_MODE_ANTIALIASED);
-        putPixel(xm + x, ym - y, col, BLEND_MODE_ANTIALIASED);
-        putPixel(xm + y, ym + x, col, BLEND_MODE_ANTIALIASED);
-
-        const int32_t x2 = x;
-        const int32_t e2 = err;
-        
-        if (err + y > 0)
-        {
-            alpha = 255 * (err - 2 * x - 1) / rad;
-            if (alpha < 256)
-            {
-                col = rgba(argb, alpha);
-                putPixel(xm - x, ym + y + 1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(xm - y - 1, ym - x, col, BLEND_MODE_ANTIALIASED);
-                putPixel(xm + x, ym - y - 1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(xm + y + 1, ym + x, col, BLEND_MODE_ANTIALIASED);
-            }
-
-            err += ++x * 2 + 1;
-        }
-
-        if (e2 + x2 <= 0)
-        {
-            alpha = 255 * (2 * y + 3 - e2) / rad;
-            if (alpha < 256)
-            {
-                col = rgba(argb, alpha);
-                putPixel(xm - x2 - 1, ym + y, col, BLEND_MODE_ANTIALIASED);
-                putPixel(xm - y, ym - x2 - 1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(xm + x2 + 1, ym - y, col, BLEND_MODE_ANTIALIASED);
-                putPixel(xm + y, ym + x2 + 1, col, BLEND_MODE_ANTIALIASED);
-            }
-            err += ++y * 2 + 1;
-        }
-    } while (x < 0);
-}
-
-//Bresenham circle at (xc,yc) with radius and color
-void drawCircle(int32_t xc, int32_t yc, int32_t rad, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //range checking
-    if (rad <= 0) return;
-
-    //alpha mode
-    if (mode == BLEND_MODE_ANTIALIASED)
-    {
-        drawCircleAA(xc, yc, rad, color);
-        return;
-    }
-
-    int32_t x = 0, y = rad;
-    int32_t p = 1 - rad;
-
-    while (x <= y)
-    {
-        putPixel(xc + x, yc + y, color, mode);
-        putPixel(xc - x, yc + y, color, mode);
-        putPixel(xc + x, yc - y, color, mode);
-        putPixel(xc - x, yc - y, color, mode);
-        putPixel(xc + y, yc + x, color, mode);
-        putPixel(xc - y, yc + x, color, mode);
-        putPixel(xc + y, yc - x, color, mode);
-        putPixel(xc - y, yc - x, color, mode);
-        if (p < 0) p += (x++ << 1) + 3;
-        else p += ((x++ - y--) << 1) + 5;
-    }
-}
-
-//Wu's ellipse with anti-aliased
-void drawEllipseAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t argb)
-{
-    int32_t f = 0;
-    uint32_t col = 0;
-    double alpha = 0;
-
-    //only 32bit support alpha-blend mode
-    if (bitsPerPixel <= 8) return;
-    if (x0 <= 0 || y0 <= 0 || x1 <= 0 || y1 <= 0) return;
-
-    int32_t a = abs(x1 - x0);
-    const int32_t b = abs(y1 - y0);
-    
-    //check for line
-    if (a <= 0 || b <= 0) return;
-
-    int32_t b1 = b & 1;
-    double dx = 4.0 * (a - 1.0) * b * b;
-    double dy = 4.0 * (b1 + 1.0) * a * a;
-    double err = double(b1) * a * a - dx + dy;
-
-    if (x0 > x1)
-    {
-        x0 = x1;
-        x1 += a;
-    }
-
-    if (y0 > y1) y0 = y1;
-
-    y0 += ((b + 1) >> 1);
-    y1 = y0 - b1;
-    a = 8 * a * a;
-    b1 = 8 * b * b;
-
-    while (1)
-    {
-        double ed = max(dx, dy);
-        alpha = min(dx, dy);
-
-        if (y0 == y1 + 1 && err > dy && a > b1) ed = 255.0 * 4 / a;
-        else ed = 255 / (ed + 2 * ed * alpha * alpha / (4 * ed * ed + alpha * alpha));
-
-        alpha = ed * fabs(err + dx - dy);
-        col = rgba(argb, uint8_t(alpha));
-        putPixel(x0, y0, col, BLEND_MODE_ANTIALIASED);
-        putPixel(x0, y1, col, BLEND_MODE_ANTIALIASED);
-        putPixel(x1, y0, col, BLEND_MODE_ANTIALIASED);
-        putPixel(x1, y1, col, BLEND_MODE_ANTIALIASED);
-
-        if ((f = (2 * err + dy) >= 0))
-        {
-            if (x0 >= x1) break;
-            alpha = ed * (err + dx);
-            if (alpha < 255)
-            {
-                col = rgba(argb, uint8_t(alpha));
-                putPixel(x0, y0 + 1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(x0, y1 - 1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(x1, y0 + 1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(x1, y1 - 1, col, BLEND_MODE_ANTIALIASED);
-            }
-        }
-
-        if (2 * err <= dx)
-        {
-            alpha = ed * (dy - err);
-            if (alpha < 255)
-            {
-                col = rgba(argb, uint8_t(alpha));
-                putPixel(x0 + 1, y0, col, BLEND_MODE_ANTIALIASED);
-                putPixel(x1 - 1, y0, col, BLEND_MODE_ANTIALIASED);
-                putPixel(x0 + 1, y1, col, BLEND_MODE_ANTIALIASED);
-                putPixel(x1 - 1, y1, col, BLEND_MODE_ANTIALIASED);
-            }
-
-            y0++;
-            y1--;
-            err += dy += a;
-        }
-
-        if (f)
-        {
-            x0++;
-            x1--;
-            err -= dx -= b1;
-        }
-    }
-
-    if (--x0 == x1++)
-    {
-        while (y0 - y1 < b)
-        {
-            alpha = 255.0 * 4 * fabs(err + dx) / b1;
-            col = rgba(argb, uint8_t(alpha));
-            putPixel(x0, ++y0, col, BLEND_MODE_ANTIALIASED);
-            putPixel(x1, y0, col, BLEND_MODE_ANTIALIASED);
-            putPixel(x0, --y1, col, BLEND_MODE_ANTIALIASED);
-            putPixel(x1, y1, col, BLEND_MODE_ANTIALIASED);
-            err += dy += a;
-        }
-    }
-}
-
-//Bresenham drawing an ellipses with sub color
-void drawEllipse(int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //range checking
-    if (ra <= 0 || rb <= 0) return;
-
-    //alpha mode?
-    if (mode == BLEND_MODE_ANTIALIASED)
-    {
-        drawEllipseAA(xc, yc, ra, rb, color);
-        return;
-    }
-
-    int32_t mx1 = xc - ra;
-    int32_t mx2 = xc + ra;
-    int32_t my1 = yc;
-    int32_t my2 = yc;
-
-    putPixel(mx2, yc, color, mode);
-    putPixel(mx1, yc, color, mode);
-
-    const int32_t aq = ra * ra;
-    const int32_t bq = rb * rb;
-    const int32_t dx = aq << 1;
-    const int32_t dy = bq << 1;
-
-    int32_t rd = ra * bq;
-    int32_t rx = rd << 1;
-    int32_t ry = 0;
-    int32_t ax = ra;
-
-    while (ax > 0)
-    {
-        if (rd > 0)
-        {
-            my1++;
-            my2--;
-            ry += dx;
-            rd -= ry;
-        }
-
-        if (rd <= 0)
-        {
-            ax--;
-            mx1++;
-            mx2--;
-            rx -= dy;
-            rd += rx;
-        }
-
-        putPixel(mx1, my1, color, mode);
-        putPixel(mx1, my2, color, mode);
-        putPixel(mx2, my1, color, mode);
-        putPixel(mx2, my2, color, mode);
-    }
-}
-
-//rectangle with corners (x1,y1) and (width,height) and color
-void drawRect(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    horizLine(x, y, width, color, mode);
-    vertLine(x, y, height, color, mode);
-    horizLine(x, y + height - 1, width, color, mode);
-    vertLine(x + width - 1, y, height, color, mode);
-}
-
-//draw rectangle with rounded border and color
-void drawRoundRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t rad, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    int32_t i = 0, j = 0;
-    int32_t points[500] = { 0 };
-
-    const int32_t x1 = x + width - 1;
-    const int32_t y1 = y + height - 1;
-    const int32_t mid = height >> 1;
-
-    if (rad >= mid - 1) rad = mid - 1;
-
-    calcCircle(rad, points);
-
-    horizLine(x + rad - points[0], y + 1, width - ((rad - points[0]) << 1), col, mode);
-    vertLine(x, y + rad, height - (rad << 1), col, mode);
-    horizLine(x + rad - points[0], y1 - 1, width - ((rad - points[0]) << 1), col, mode);
-    vertLine(x1, y + rad, height - (rad << 1), col, mode);
-
-    for (i = 1; i <= rad; i++)
-    {
-        for (j = rad - points[i]; j <= rad - points[i - 1]; j++)
-        {
-            putPixel(x + j, y + i, col, mode);
-            putPixel(x1 - j, y + i, col, mode);
-        }
-    }
-
-    for (i = 1; i <= rad; i++)
-    {
-        for (j = rad - points[i]; j <= rad - points[i - 1]; j++)
-        {
-            putPixel(x + j, y1 - i, col, mode);
-            putPixel(x1 - j, y1 - i, col, mode);
-        }
-    }
-}
-
-//draw boxed with color
-void drawBox(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    const int32_t x1 = x + width - 1;
-    const int32_t y1 = y + height - 1;
-    const int32_t x0 = x + dx;
-    const int32_t y0 = y - dy;
-    const int32_t x2 = x1 + dx;
-    const int32_t y2 = y1 - dy;
-
-    drawRect(x, y, width, height, col, mode);
-    drawRect(x0, y0, width, height, col, mode);
-    drawLine(x, y, x0, y0, col, mode);
-    drawLine(x1, y, x2, y0, col, mode);
-    drawLine(x1, y1, x2, y2, col, mode);
-    drawLine(x, y1, x0, y2, col, mode);
-}
-
-//draw anti-aliased line with width
-void drawLineWidthAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, double wd, uint32_t col)
-{
-    const int32_t dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
-    const int32_t dy = abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
-    int32_t err = dx - dy, e2 = 0, x2 = 0, y2 = 0;
-
-    const double ed = (dx + dy == 0) ? 1 : sqrt(sqr(double(dx)) + sqr(double(dy)));
-
-    wd = (wd + 1) / 2;
-
-    while (true)
-    {
-        putPixel(x0, y0, rgba(col, uint8_t(max(0, 255 * (abs(err - dx + dy) / ed - wd + 1)))), BLEND_MODE_ALPHA);
-
-        e2 = err;
-        x2 = x0;
-
-        if (2 * e2 >= -dx)
-        {
-            for (e2 += dy, y2 = y0; e2 < ed * wd && (y1 != y2 || dx > dy); e2 += dx) putPixel(x0, y2 += sy, rgba(col, uint8_t(max(0, 255 * (abs(e2) / ed - wd + 1)))), BLEND_MODE_ALPHA);
-            if (x0 == x1) break;
-            e2 = err;
-            err -= dy;
-            x0 += sx;
-        }
-
-        if (2 * e2 <= dy)
-        {
-            for (e2 = dx - e2; e2 < ed * wd && (x1 != x2 || dx < dy); e2 += dy) putPixel(x2 += sx, y0, rgba(col, uint8_t(max(0, 255 * (abs(e2) / ed - wd + 1)))), BLEND_MODE_ALPHA);
-            if (y0 == y1) break;
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
-//draw anti-aliased full quad bezier segment
-void drawQuadBezierSegAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col)
-{
-    int32_t sx = x2 - x1, sy = y2 - y1;
-    int32_t xx = x0 - x1, yy = y0 - y1, xy = 0;
-    double dx = 0.0, dy = 0.0, err = 0.0, ed = 0.0;
-    double cur = double(xx) * sy - double(yy) * sx;
-
-    if (sqr(sx) + sqr(sy) > sqr(xx) + sqr(yy))
-    {
-        x2 = x0;
-        x0 = sx + x1;
-        y2 = y0;
-        y0 = sy + y1;
-        cur = -cur;
-    }
-
-    if (cur != 0)
-    {
-        xx += sx;
-        xx *= sx = x0 < x2 ? 1 : -1;
-        yy += sy;
-        yy *= sy = y0 < y2 ? 1 : -1;
-        xy = 2 * xx * yy;
-        xx *= xx;
-        yy *= yy;
-
-        if (cur * sx * sy < 0)
-        {
-            xx = -xx;
-            yy = -yy;
-            xy = -xy;
-            cur = -cur;
-        }
-
-        dx = 4.0 * sy * (intmax_t(x1) - x0) * cur + xx - xy;
-        dy = 4.0 * sx * (intmax_t(y0) - y1) * cur + yy - xy;
-        xx += xx;
-        yy += yy;
-        err = dx + dy + xy;
-
-        do {
-            cur = min(dx + xy, -xy - dy);
-            ed = max(dx + xy, -xy - dy);
-            ed += 2 * ed * sqr(cur) / (4 * sqr(ed) + sqr(cur));
-            putPixel(x0, y0, rgba(col, uint8_t(255 * fabs(err - dx - dy - xy) / ed)), BLEND_MODE_ANTIALIASED);
-
-            if (x0 == x2 || y0 == y2) break;
-
-            x1 = x0;
-            cur = dx - err;
-            y1 = 2 * err + dy < 0;
-
-            if (2 * err + dx > 0)
-            {
-                if (err - dy < ed) putPixel(x0, y0 + sy, rgba(col, uint8_t(255 * fabs(err - dy) / ed)), BLEND_MODE_ANTIALIASED);
-                x0 += sx;
-                dx -= xy;
-                err += dy += yy;
-            }
-
-            if (y1)
-            {
-                if (cur < ed) putPixel(x1 + sx, y0, rgba(col, uint8_t(255 * fabs(cur) / ed)), BLEND_MODE_ANTIALIASED);
-                y0 += sy;
-                dy -= xy;
-                err += dx += xx;
-            }
-        } while (dy < dx);
-    }
-
-    drawLine(x0, y0, x2, y2, col, BLEND_MODE_ANTIALIASED);
-}
-
-//draw a quad bezier segment
-void drawQuadBezierSeg(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    //anti-aliased mode?
-    if (mode == BLEND_MODE_ANTIALIASED)
-    {
-        drawQuadBezierSegAA(x0, y0, x1, y1, x2, y2, col);
-        return;
-    }
-
-    int32_t sx = x2 - x1, sy = y2 - y1;
-    int32_t xx = x0 - x1, yy = y0 - y1, xy = 0;
-    double dx = 0.0, dy = 0.0, err = 0.0;
-    double cur = double(xx) * sy - double(yy) * sx;
-
-    if (sqr(sx) + sqr(sy) > sqr(xx) + sqr(yy))
-    {
-        x2 = x0;
-        x0 = sx + x1;
-        y2 = y0;
-        y0 = sy + y1;
-        cur = -cur;
-    }
-
-    if (cur != 0)
-    {
-        xx += sx;
-        xx *= sx = x0 < x2 ? 1 : -1;
-        yy += sy;
-        yy *= sy = y0 < y2 ? 1 : -1;
-        xy = 2 * xx * yy;
-        xx *= xx;
-        yy *= yy;
-
-        if (cur * sx * sy < 0)
-        {
-            xx = -xx;
-            yy = -yy;
-            xy = -xy;
-            cur = -cur;
-        }
-
-        dx = 4.0 * sy * cur * (intmax_t(x1) - x0) + xx - xy;
-        dy = 4.0 * sx * cur * (intmax_t(y0) - y1) + yy - xy;
-        xx += xx;
-        yy += yy;
-        err = dx + dy + xy;
-
-        do {
-            putPixel(x0, y0, col, mode);
-
-            if (x0 == x2 && y0 == y2) return;
-            
-            y1 = 2 * err < dx;
-            
-            if (2 * err > dy)
-            {
-                x0 += sx;
-                dx -= xy;
-                err += dy += yy;
-            }
-            
-            if (y1)
-            {
-                y0 += sy;
-                dy -= xy;
-                err += dx += xx;
-            }
-        } while (dy < 0 && dx > 0);
-    }
-
-    drawLine(x0, y0, x2, y2, col, mode);
-}
-
-//draw anti-aliased cubic bezier segment
-void drawCubicBezierSegAA(int32_t x0, int32_t y0, double x1, double y1, double x2, double y2, int32_t x3, int32_t y3, uint32_t col)
-{
-    int32_t f = 0, fx = 0, fy = 0, leg = 1;
-    int32_t sx = x0 < x3 ? 1 : -1, sy = y0 < y3 ? 1 : -1;
-
-    const double EP = 0.01;
-    const double xc = -fabs(x0 + x1 - x2 - x3);
-    const double xa = xc - 4.0 * sx * (x1 - x2);
-    const double yc = -fabs(y0 + y1 - y2 - y3);
-    const double ya = yc - 4.0 * sy * (y1 - y2);
-
-    double xb = sx * (x0 - x1 - x2 + x3);
-    double yb = sy * (y0 - y1 - y2 + y3);
-
-    double ip = 0.0;
-    double ab = 0.0, ac = 0.0, bc = 0.0, ba = 0.0;
-    double xx = 0.0, xy = 0.0, yy = 0.0;
-    double dx = 0.0, dy = 0.0, ex = 0.0;
-    double px = 0.0, py = 0.0, ed = 0.0;
-
-    if (xa == 0 && ya == 0)
-    {
-        sx = int32_t(floor((3 * x1 - x0 + 1) / 2));
-        sy = int32_t(floor((3 * y1 - y0 + 1) / 2));
-        drawQuadBezierSeg(x0, y0, sx, sy, x3, y3, col, BLEND_MODE_ANTIALIASED);
-        return;
-    }
-
-    x1 = (x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0) + 1;
-    x2 = (x2 - x3) * (x2 - x3) + (y2 - y3) * (y2 - y3) + 1;
-
-    do {
-        ab = xa * yb - xb * ya;
-        ac = xa * yc - xc * ya;
-        bc = xb * yc - xc * yb;
-        ip = 4 * ab * bc - sqr(ac);
-        ex = ab * (ab + ac - 3 * bc) + sqr(ac);
-        f = (ex > 0) ? 1 : int32_t(sqrt(1 + 1024 / x1));
-        ab *= f;
-        ac *= f;
-        bc *= f;
-        ex *= sqr(intmax_t(f));
-        xy = 9 * (ab + ac + bc) / 8;
-        ba = 8 * (xa - ya);
-        dx = 27 * (8 * ab * (yb * yb - ya * yc) + ex * (ya + 2 * yb + yc)) / 64 - ya * ya * (xy - ya);
-        dy = 27 * (8 * ab * (xb * xb - xa * xc) - ex * (xa + 2 * xb + xc)) / 64 - xa * xa * (xy + xa);
-
-        xx = 3 * (3 * ab * (3 * yb * yb - ya * ya - 2 * ya * yc) - ya * (3 * ac * (ya + yb) + ya * ba)) / 4;
-        yy = 3 * (3 * ab * (3 * xb * xb - xa * xa - 2 * xa * xc) - xa * (3 * ac * (xa + xb) + xa * ba)) / 4;
-        xy = xa * ya * (6 * ab + 6 * ac - 3 * bc + ba);
-        ac = ya * ya;
-        ba = xa * xa;
-        xy = 3 * (xy + 9.0 * f * (ba * yb * yc - xb * xc * ac) - 18 * xb * yb * ab) / 8;
-
-        if (ex < 0)
-        {
-            dx = -dx;
-            dy = -dy;
-            xx = -xx;
-            yy = -yy;
-            xy = -xy;
-            ac = -ac;
-            ba = -ba;
-        }
-
-        ab = 6 * ya * ac;
-        ac = -6 * xa * ac;
-        bc = 6 * ya * ba;
-        ba = -6 * xa * ba;
-        
-        dx += xy;
-        ex = dx + dy;
-        dy += xy;
-
-        for (fx = fy = f; x0 != x3 && y0 != y3;)
-        {
-            y1 = min(fabs(xy - dx), fabs(dy - xy));
-            ed = max(fabs(xy - dx), fabs(dy - xy));
-            ed = f * (ed + 2 * ed * y1 * y1 / (4 * ed * ed + y1 * y1));
-
-            y1 = 255 * fabs(ex - (intmax_t(f) - fx + 1) * dx - (intmax_t(f) - fy + 1) * dy + f * xy) / ed;
-            if (y1 < 256) putPixel(x0, y0, rgba(col, uint8_t(y1)), BLEND_MODE_ANTIALIASED);
-
-            px = fabs(ex - (intmax_t(f) - fx + 1) * dx + (intmax_t(fy) - 1) * dy);
-            py = fabs(ex + (intmax_t(fx) - 1) * dx - (intmax_t(f) - fy + 1) * dy);
-            y2 = y0;
-
-            do {
-                if ((ip >= -EP) && (dx + xx > xy || dy + yy < xy)) goto exit;
-                y1 = 2 * ex + dx;
-                if (2 * ex + dy > 0)
-                {
-                    fx--;
-                    ex += dx += xx;
-                    dy += xy += ac;
-                    yy += bc;
-                    xx += ab;
-                }
-                else if (y1 > 0) goto exit;
-
-                if (y1 <= 0)
-                {
-                    fy--;
-                    ex += dy += yy;
-                    dx += xy += bc;
-                    xx += ac;
-                    yy += ba;
-                }
-            } while (fx > 0 && fy > 0);
-
-            if (2 * fy <= f)
-            {
-                if (py < ed) putPixel(x0 + sx, y0, rgba(col, uint8_t(255 * py / ed)), BLEND_MODE_ANTIALIASED);
-                
-                y0 += sy;
-                fy += f;
-            }
-
-            if (2 * fx <= f)
-            {
-                if (px < ed) putPixel(x0, int32_t(y2) + sy, rgba(col, uint8_t(255 * px / ed)), BLEND_MODE_ANTIALIASED);
-                
-                x0 += sx;
-                fx += f;
-            }
-        }
-
-    exit:
-        if (2 * ex < dy && 2 * fy <= f + 2)
-        {
-            if (py < ed) putPixel(x0 + sx, y0, rgba(col, uint8_t(255 * py / ed)), BLEND_MODE_ANTIALIASED);
-            y0 += sy;
-        }
-
-        if (2 * ex > dx && 2 * fx <= f + 2)
-        {
-            if (px < ed) putPixel(x0, int32_t(y2) + sy, rgba(col, uint8_t(255 * px / ed)), BLEND_MODE_ANTIALIASED);
-            x0 += sx;
-        }
-
-        xx = x0;
-        x0 = x3;
-        x3 = int32_t(xx);
-        
-        sx = -sx;
-        xb = -xb;
-     
-        yy = y0;
-        y0 = y3;
-        y3 = int32_t(yy);
-
-        sy = -sy;
-        yb = -yb;
-        x1 = x2;
-    } while (leg--);
-
-    drawLine(x0, y0, x3, y3, col, BLEND_MODE_ANTIALIASED);
-}
-
-//draw full quad bezier (export function)
-void drawQuadBezier(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    int32_t x = x0 - x1, y = y0 - y1;
-    double t = x0 - 2.0 * x1 + x2, r = 0.0;
-
-    if (x * (x2 - x1) > 0)
-    {
-        if ((y * (y2 - y1) > 0) && fabs((y0 - 2.0 * y1 + y2) / t * x) > abs(y))
-        {
-            x0 = x2;
-            x2 = x + x1;
-            y0 = y2;
-            y2 = y + y1;
-        }
-
-        t = (intmax_t(x0) - x1) / t;
-        r = (1 - t) * ((1 - t) * y0 + 2.0 * t * y1) + t * t * y2;
-        t = (intmax_t(x0) * x2 - intmax_t(x1) * x1) * t / (intmax_t(x0) - x1);
-        x = int32_t(floor(t + 0.5));
-        y = int32_t(floor(r + 0.5));
-        r = (intmax_t(y1) - y0) * (t - x0) / (intmax_t(x1) - x0) + y0;
-        
-        drawQuadBezierSeg(x0, y0, x, int32_t(floor(r + 0.5)), x, y, col, mode);
-        
-        r = (intmax_t(y1) - y2) * (t - x2) / (intmax_t(x1) - x2) + y2;
-        x0 = x1 = x;
-        y0 = y;
-        y1 = int32_t(floor(r + 0.5));
-    }
-
-    if ((y0 - y1) * (y2 - y1) > 0)
-    {
-        t = y0 - 2.0 * y1 + y2;
-        t = (intmax_t(y0) - y1) / t;
-        r = (1 - t) * ((1 - t) * x0 + 2.0 * t * x1) + t * t * x2;
-        t = (intmax_t(y0) * y2 - intmax_t(y1) * y1) * t / (intmax_t(y0) - y1);
-        x = int32_t(floor(r + 0.5));
-        y = int32_t(floor(t + 0.5));
-        r = (intmax_t(x1) - x0) * (t - y0) / (intmax_t(y1) - y0) + x0;
-
-        drawQuadBezierSeg(x0, y0, int32_t(floor(r + 0.5)), y, x, y, col, mode);
-        
-        r = (intmax_t(x1) - x2) * (t - y2) / (intmax_t(y1) - y2) + x2;
-        x0 = x;
-        x1 = int32_t(floor(r + 0.5));
-        y0 = y1 = y;
-    }
-
-    drawQuadBezierSeg(x0, y0, x1, y1, x2, y2, col, mode);
-}
-
-//draw anti-aliased rotation quad bezier segment
-void drawQuadRationalBezierSegAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, double w, uint32_t col)
-{
-    int32_t f = 0;
-    int32_t sx = x2 - x1, sy = y2 - y1;
-
-    double err = 0.0, ed = 0.0;
-    double dx = double(x0) - x2, dy = double(y0) - y2;
-    double xx = double(x0) - x1, yy = double(y0) - y1;
-    double xy = xx * sy + yy * sx, cur = xx * sy - yy * sx;
-    
-    if (cur != 0.0 && w > 0.0)
-    {
-        if (sqr(double(sx)) + sqr(double(sy)) > sqr(xx) + sqr(yy))
-        {
-            x2 = x0;
-            x0 -= int32_t(dx);
-            y2 = y0;
-            y0 -= int32_t(dy);
-            cur = -cur;
-        }
-
-        xx = 2.0 * (4.0 * w * sx * xx + sqr(dx));
-        yy = 2.0 * (4.0 * w * sy * yy + sqr(dy));
-        sx = x0 < x2 ? 1 : -1;
-        sy = y0 < y2 ? 1 : -1;
-        xy = -2.0 * sx * sy * (2.0 * w * xy + dx * dy);
-
-        if (cur * sx * sy < 0)
-        {
-            xx = -xx;
-            yy = -yy;
-            cur = -cur;
-            xy = -xy;
-        }
-
-        dx = 4.0 * w * (intmax_t(x1) - x0) * sy * cur + xx / 2.0 + xy;
-        dy = 4.0 * w * (intmax_t(y0) - y1) * sx * cur + yy / 2.0 + xy;
-
-        if (w < 0.5 && dy > dx)
-        {
-            cur = (w + 1.0) / 2.0;
-            w = sqrt(w);
-            xy = 1.0 / (w + 1.0);
-            
-            sx = int32_t(floor((x0 + 2.0 * w * x1 + x2) * xy / 2.0 + 0.5));
-            sy = int32_t(floor((y0 + 2.0 * w * y1 + y2) * xy / 2.0 + 0.5));
-            
-            dx = floor((w * x1 + x0) * xy + 0.5);
-            dy = floor((y1 * w + y0) * xy + 0.5);
-            drawQuadRationalBezierSegAA(x0, y0, int32_t(dx), int32_t(dy), sx, sy, cur, col);
-            
-            dx = floor((w * x1 + x2) * xy + 0.5);
-            dy = floor((y1 * w + y2) * xy + 0.5);
-            drawQuadRationalBezierSegAA(sx, sy, int32_t(dx), int32_t(dy), x2, y2, cur, col);
-            
-            return;
-        }
-
-        err = dx + dy - xy;
-
-        do {
-            cur = min(dx - xy, xy - dy);
-            ed = max(dx - xy, xy - dy);
-            ed += 2 * ed * sqr(cur) / (4.0 * sqr(ed) + sqr(cur));
-
-            x1 = int32_t(255 * fabs(err - dx - dy + xy) / ed);
-            if (x1 < 256) putPixel(x0, y0, rgba(col, x1), BLEND_MODE_ANTIALIASED);
-
-            if ((f = 2 * err + dy < 0))
-            {
-                if (y0 == y2) return;
-                if (dx - err < ed) putPixel(x0 + sx, y0, rgba(col, uint8_t(255 * fabs(dx - err) / ed)), BLEND_MODE_ANTIALIASED);
-            }
-
-            if (2 * err + dx > 0)
-            {
-                if (x0 == x2) return;
-                if (err - dy < ed) putPixel(x0, y0 + sy, rgba(col, uint8_t(255 * fabs(err - dy) / ed)), BLEND_MODE_ANTIALIASED);
-                
-                x0 += sx;
-                dx += xy;
-                err += dy += yy;
-            }
-
-            if (f)
-            {
-                y0 += sy;
-                dy += xy;
-                err += dx += xx;
-            }
-        } while (dy < dx);
-    }
-
-    drawLine(x0, y0, x2, y2, col, BLEND_MODE_ANTIALIASED);
-}
-
-//draw rotation quad bezier segment
-void drawQuadRationalBezierSeg(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, double w, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    //anti-aliased mode
-    if (mode == BLEND_MODE_ANTIALIASED)
-    {
-        drawQuadRationalBezierSegAA(x0, y0, x1, y1, x2, y2, w, col);
-        return;
-    }
-
-    int32_t sx = x2 - x1, sy = y2 - y1;
-
-    double dx = double(x0) - x2, dy = double(y0) - y2;
-    double xx = double(x0) - x1, yy = double(y0) - y1;
-
-    double err = 0.0;
-    double xy = xx * sy + yy * sx, cur = xx * sy - yy * sx;
-
-    if (cur != 0.0 && w > 0.0)
-    {
-        if (sqr(double(sx)) + sqr(double(sy)) > sqr(xx) + sqr(yy))
-        {
-            x2 = x0;
-            x0 -= int32_t(dx);
-            y2 = y0;
-            y0 -= int32_t(dy);
-            cur = -cur;
-        }
-
-        xx = 2.0 * (4.0 * w * sx * xx + sqr(dx));
-        yy = 2.0 * (4.0 * w * sy * yy + sqr(dy));
-        sx = x0 < x2 ? 1 : -1;
-        sy = y0 < y2 ? 1 : -1;
-        xy = -2.0 * sx * sy * (2.0 * w * xy + dx * dy);
-
-        if (cur * sx * sy < 0.0)
-        {
-            xx = -xx;
-            yy = -yy;
-            xy = -xy;
-            cur = -cur;
-        }
-
-        dx = 4.0 * w * (intmax_t(x1) - x0) * sy * cur + xx / 2.0 + xy;
-        dy = 4.0 * w * (intmax_t(y0) - y1) * sx * cur + yy / 2.0 + xy;
-
-        if (w < 0.5 && (dy > xy || dx < xy))
-        {
-            cur = (w + 1.0) / 2.0;
-            w = sqrt(w);
-            xy = 1.0 / (w + 1.0);
-            
-            sx = int32_t(floor((x0 + 2.0 * w * x1 + x2) * xy / 2.0 + 0.5));
-            sy = int32_t(floor((y0 + 2.0 * w * y1 + y2) * xy / 2.0 + 0.5));
-            
-            dx = floor((w * x1 + x0) * xy + 0.5);
-            dy = floor((y1 * w + y0) * xy + 0.5);
-            drawQuadRationalBezierSeg(x0, y0, int32_t(dx), int32_t(dy), sx, sy, cur, col, mode);
-            
-            dx = floor((w * x1 + x2) * xy + 0.5);
-            dy = floor((y1 * w + y2) * xy + 0.5);
-            drawQuadRationalBezierSeg(sx, sy, int32_t(dx), int32_t(dy), x2, y2, cur, col, mode);
-            
-            return;
-        }
-
-        err = dx + dy - xy;
-
-        do {
-            putPixel(x0, y0, col, mode);
-
-            if (x0 == x2 && y0 == y2) return;
-
-            x1 = 2 * err > dy;
-            y1 = 2 * (err + yy) < -dy;
-            
-            if (2 * err < dx || y1)
-            {
-                y0 += sy;
-                dy += xy;
-                err += dx += xx;
-            }
-
-            if (2 * err > dx || x1)
-            {
-                x0 += sx;
-                dx += xy;
-                err += dy += yy;
-            }
-        } while (dy <= xy && dx >= xy);
-    }
-
-    drawLine(x0, y0, x2, y2, col, mode);
-}
-
-//draw rotation full quad bezier segment (export function)
-void drawQuadRationalBezier(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, double w, int32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    int32_t x = x0 - 2 * x1 + x2;
-    int32_t y = y0 - 2 * y1 + y2;
-
-    double xx = double(x0) - x1;
-    double yy = double(y0) - y1;
-    double ww = 0.0, t = 0.0, q = 0.0;
-
-    if (xx * (intmax_t(x2) - x1) > 0)
-    {
-        if (yy * (intmax_t(y2) - y1) > 0 && fabs(xx * y) > fabs(yy * x))
-        {
-            x0 = x2;
-            x2 = int32_t(xx) + x1;
-            y0 = y2;
-            y2 = int32_t(yy) + y1;
-        }
-
-        if (x0 == x2 || w == 1.0) t = (intmax_t(x0) - x1) / double(x);
-        else
-        {
-            q = sqrt(4.0 * w * w * (intmax_t(x0) - x1) * (intmax_t(x2) - x1) + (intmax_t(x2) - x0) * (intmax_t(x2) - x0));
-            if (x1 < x0) q = -q;
-            t = (2.0 * w * (intmax_t(x0) - x1) - x0 + x2 + q) / (2.0 * (1.0 - w) * (intmax_t(x2) - x0));
-        }
-
-        q = 1.0 / (2.0 * t * (1.0 - t) * (w - 1.0) + 1.0);
-        xx = (t * t * (x0 - 2.0 * w * x1 + x2) + 2.0 * t * (w * x1 - x0) + x0) * q;
-        yy = (t * t * (y0 - 2.0 * w * y1 + y2) + 2.0 * t * (w * y1 - y0) + y0) * q;
-        ww = t * (w - 1.0) + 1.0;
-        ww *= ww * q;
-        w = ((1.0 - t) * (w - 1.0) + 1.0) * sqrt(q);
-        x = int32_t(floor(xx + 0.5));
-        y = int32_t(floor(yy + 0.5));
-        yy = (xx - x0) * (intmax_t(y1) - y0) / (intmax_t(x1) - x0) + y0;
-        
-        drawQuadRationalBezierSeg(x0, y0, x, int32_t(floor(yy + 0.5)), x, y, ww, col, mode);
-        
-        yy = (xx - x2) * (intmax_t(y1) - y2) / (intmax_t(x1) - x2) + y2;
-        y1 = int32_t(floor(yy + 0.5));
-        x0 = x1 = x;
-        y0 = y;
-    }
-
-    if ((y0 - y1) * (y2 - y1) > 0)
-    {
-        if (y0 == y2 || w == 1.0) t = (intmax_t(y0) - y1) / (y0 - 2.0 * y1 + y2);
-        else
-        {
-            q = sqrt(4.0 * w * w * (intmax_t(y0) - y1) * (intmax_t(y2) - y1) + (intmax_t(y2) - y0) * (intmax_t(y2) - y0));
-            if (y1 < y0) q = -q;
-            t = (2.0 * w * (intmax_t(y0) - y1) - y0 + y2 + q) / (2.0 * (1.0 - w) * (intmax_t(y2) - y0));
-        }
-
-        q = 1.0 / (2.0 * t * (1.0 - t) * (w - 1.0) + 1.0);
-        xx = (t * t * (x0 - 2.0 * w * x1 + x2) + 2.0 * t * (w * x1 - x0) + x0) * q;
-        yy = (t * t * (y0 - 2.0 * w * y1 + y2) + 2.0 * t * (w * y1 - y0) + y0) * q;
-        ww = t * (w - 1.0) + 1.0;
-        ww *= ww * q;
-        w = ((1.0 - t) * (w - 1.0) + 1.0) * sqrt(q);
-        x = int32_t(floor(xx + 0.5));
-        y = int32_t(floor(yy + 0.5));
-        xx = (intmax_t(x1) - x0) * (yy - y0) / (intmax_t(y1) - y0) + x0;
-        
-        drawQuadRationalBezierSeg(x0, y0, int32_t(floor(xx + 0.5)), y, x, y, ww, col, mode);
-        
-        xx = (intmax_t(x1) - x2) * (yy - y2) / (intmax_t(y1) - y2) + x2;
-        x1 = int32_t(floor(xx + 0.5));
-        x0 = x;
-        y0 = y1 = y;
-    }
-
-    drawQuadRationalBezierSeg(x0, y0, x1, y1, x2, y2, w * w, col, mode);
-}
-
-//draw rotation of ellipse with rect
-void drawRotatedEllipseRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t zd, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    int32_t xd = x1 - x0, yd = y1 - y0;
-    double w = double(xd) * yd;
-
-    if (zd == 0)
-    {
-        drawEllipse(x0, y0, xd + 1, yd + 1, col, mode);
-        return;
-    }
-
-    if (w != 0.0) w = (w - zd) / (w + w);
-
-    xd = int32_t(floor(xd * w + 0.5));
-    yd = int32_t(floor(yd * w + 0.5));
-
-    drawQuadRationalBezierSeg(x0, y0 + yd, x0, y0, x0 + xd, y0, 1.0 - w, col, mode);
-    drawQuadRationalBezierSeg(x0, y0 + yd, x0, y1, x1 - xd, y1, w, col, mode);
-    drawQuadRationalBezierSeg(x1, y1 - yd, x1, y1, x1 - xd, y1, 1.0 - w, col, mode);
-    drawQuadRationalBezierSeg(x1, y1 - yd, x1, y0, x0 + xd, y0, w, col, mode);
-}
-
-//draw rotation of ellipse (export function)
-void drawRotatedEllipse(int32_t x, int32_t y, int32_t ra, int32_t rb, double angle, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    const double s = sin(angle);
-    double xd = sqr(double(ra));
-    double yd = sqr(double(rb));
-    double zd = (xd - yd) * s;
-
-    xd = sqrt(xd - zd * s);
-    yd = sqrt(yd + zd * s);
-    ra = int32_t(xd + 0.5);
-    rb = int32_t(yd + 0.5);
-    zd = zd * ra * rb / (xd * yd);
-
-    drawRotatedEllipseRect(x - ra, y - rb, x + ra, y + rb, int32_t(4 * zd * cos(angle)), col, mode);
-}
-
-//draw cubic bezier segment
-void drawCubicBezierSeg(int32_t x0, int32_t y0, double x1, double y1, double x2, double y2, int32_t x3, int32_t y3, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    //anti-aliased mode?
-    if (mode == BLEND_MODE_ANTIALIASED)
-    {
-        drawCubicBezierSegAA(x0, y0, x1, y1, x2, y2, x3, y3, col);
-        return;
-    }
-
-    int32_t leg = 1;
-    int32_t f = 0, fx = 0, fy = 0;
-    int32_t sx = x0 < x3 ? 1 : -1;
-    int32_t sy = y0 < y3 ? 1 : -1;
-    
-    const double xc = -fabs(x0 + x1 - x2 - x3), xa = xc - 4.0 * sx * (x1 - x2);
-    const double yc = -fabs(y0 + y1 - y2 - y3), ya = yc - 4.0 * sy * (y1 - y2);
-    
-    double* pxy = NULL, EP = 0.01;
-    double xb = sx * (x0 - x1 - x2 + x3);
-    double yb = sy * (y0 - y1 - y2 + y3);
-    double ab = 0.0, ac = 0.0, bc = 0.0, cb = 0.0;
-    double xx = 0.0, xy = 0.0, yy = 0.0;
-    double dx = 0.0, dy = 0.0, ex = 0.0;
-        
-    if (xa == 0 && ya == 0)
-    {
-        sx = int32_t(floor((3 * x1 - x0 + 1) / 2));
-        sy = int32_t(floor((3 * y1 - y0 + 1) / 2));
-        drawQuadBezierSeg(x0, y0, sx, sy, x3, y3, col, mode);
-        return;
-    }
-
-    x1 = (x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0) + 1;
-    x2 = (x2 - x3) * (x2 - x3) + (y2 - y3) * (y2 - y3) + 1;
-
-    do {
-        ab = xa * yb - xb * ya;
-        ac = xa * yc - xc * ya;
-        bc = xb * yc - xc * yb;
-        ex = ab * (ab + ac - 3 * bc) + sqr(ac);
-        f = (ex > 0) ? 1 : int32_t(sqrt(1 + 1024 / x1));
-
-        ab *= f;
-        ac *= f;
-        bc *= f;
-        ex *= intmax_t(f) * f;
-
-        xy = 9 * (ab + ac + bc) / 8;
-        cb = 8 * (xa - ya);
-        dx = 27 * (8 * ab * (yb * yb - ya * yc) + ex * (ya + 2 * yb + yc)) / 64 - ya * ya * (xy - ya);
-        dy = 27 * (8 * ab * (xb * xb - xa * xc) - ex * (xa + 2 * xb + xc)) / 64 - xa * xa * (xy + xa);
-
-        xx = 3 * (3 * ab * (3 * yb * yb - ya * ya - 2 * ya * yc) - ya * (3 * ac * (ya + yb) + ya * cb)) / 4;
-        yy = 3 * (3 * ab * (3 * xb * xb - xa * xa - 2 * xa * xc) - xa * (3 * ac * (xa + xb) + xa * cb)) / 4;
-        xy = xa * ya * (6 * ab + 6 * ac - 3 * bc + cb);
-        
-        ac = ya * ya;
-        cb = xa * xa;
-        xy = 3 * (xy + 9.0 * f * (cb * yb * yc - xb * xc * ac) - 18 * xb * yb * ab) / 8;
-
-        if (ex < 0)
-        {
-            dx = -dx;
-            dy = -dy;
-            xx = -xx;
-            yy = -yy;
-            xy = -xy;
-            ac = -ac;
-            cb = -cb;
-        }
-
-        ab = 6 * ya * ac;
-        ac = -6 * xa * ac;
-        bc = 6 * ya * cb;
-        cb = -6 * xa * cb;
-
-        dx += xy;
-        ex = dx + dy;
-        dy += xy;
-
-        for (pxy = &xy, fx = fy = f; x0 != x3 && y0 != y3; )
-        {
-            putPixel(x0, y0, col, mode);
-
-            do {
-                if (dx > *pxy || dy < *pxy) goto exit;
-
-                y1 = 2 * ex - dy;
-                if (2 * ex >= dx)
-                {
-                    fx--;
-                    ex += dx += xx;
-                    dy += xy += ac;
-                    yy += bc;
-                    xx += ab;
-                }
-
-                if (y1 <= 0)
-                {
-                    fy--;
-                    ex += dy += yy;
-                    dx += xy += bc;
-                    xx += ac;
-                    yy += cb;
-                }
-            } while (fx > 0 && fy > 0);
-
-            if (2 * fx <= f)
-            {
-                x0 += sx;
-                fx += f;
-            }
-
-            if (2 * fy <= f)
-            {
-                y0 += sy;
-                fy += f;
-            }
-
-            if (pxy == &xy && dx < 0 && dy > 0) pxy = &EP;
-        }
-
-    exit:
-        xx = x0;
-        x0 = x3;
-        x3 = int32_t(xx);
-
-        sx = -sx;
-        xb = -xb;
-        yy = y0;
-        y0 = y3;
-        y3 = int32_t(yy);
-        sy = -sy;
-        yb = -yb;
-        x1 = x2;
-    } while (leg--);
-
-    drawLine(x0, y0, x3, y3, col, mode);
-}
-
-//draw cubic bezier (export function)
-void drawCubicBezier(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
-{
-    int32_t n = 0, i = 0;
-    const int32_t xc = x0 + x1 - x2 - x3, xa = xc - 4 * (x1 - x2);
-    const int32_t xb = x0 - x1 - x2 + x3, xd = xb + 4 * (x1 + x2);
-    const int32_t yc = y0 + y1 - y2 - y3, ya = yc - 4 * (y1 - y2);
-    const int32_t yb = y0 - y1 - y2 + y3, yd = yb + 4 * (y1 + y2);
-
-    double t2 = 0, t[10] = { 0 };
-    double fx0 = x0, fx1 = 0.0, fx2 = 0.0, fx3 = 0.0;
-    double fy0 = y0, fy1 = 0.0, fy2 = 0.0, fy3 = 0.0;
-    double t1 = double(xb) * xb - double(xa) * xc;
-    
-    if (xa == 0)
-    {
-        if (abs(xc) < 2 * abs(xb)) t[n++] = xc / (2.0 * xb);
-    }
-    else if (t1 > 0.0)
-    {
-        t2 = sqrt(t1);
-        
-        t1 = (xb - t2) / xa;
-        if (fabs(t1) < 1.0) t[n++] = t1;
-
-        t1 = (xb + t2) / xa;
-        if (fabs(t1) < 1.0) t[n++] = t1;
-    }
-
-    t1 = sqr(double(yb)) - double(ya) * yc;
-
-    if (ya == 0)
-    {
-        if (abs(yc) < 2 * abs(yb)) t[n++] = yc / (2.0 * yb);
-    }
-    else if (t1 > 0.0)
-    {
-        t2 = sqrt(t1);
-        t1 = (yb - t2) / ya; if (fabs(t1) < 1.0) t[n++] = t1;
-        t1 = (yb + t2) / ya; if (fabs(t1) < 1.0) t[n++] = t1;
-    }
-
-    for (i = 1; i != n; i++)
-    {
-        if ((t1 = t[i - 1]) > t[i])
-        {
-            t[i - 1] = t[i];
-            t[i] = t1;
-            i = 0;
-        }
-    }
-
-    t1 = -1.0;
-    t[n] = 1.0;
-
-    for (i = 0; i <= n; i++)
-    {
-        t2 = t[i];
-        fx1 = (t1 * (t1 * xb - 2.0 * xc) - t2 * (t1 * (t1 * xa - 2.0 * xb) + xc) + xd) / 8 - fx0;
-        fy1 = (t1 * (t1 * yb - 2.0 * yc) - t2 * (t1 * (t1 * ya - 2.0 * yb) + yc) + yd) / 8 - fy0;
-        fx2 = (t2 * (t2 * xb - 2.0 * xc) - t1 * (t2 * (t2 * xa - 2.0 * xb) + xc) + xd) / 8 - fx0;
-        fy2 = (t2 * (t2 * yb - 2.0 * yc) - t1 * (t2 * (t2 * ya - 2.0 * yb) + yc) + yd) / 8 - fy0;
-        fx0 -= fx3 = (t2 * (t2 * (3.0 * xb - t2 * xa) - 3.0 * xc) + xd) / 8;
-        fy0 -= fy3 = (t2 * (t2 * (3.0 * yb - t2 * ya) - 3.0 * yc) + yd) / 8;
-        x3 = int32_t(floor(fx3 + 0.5));
-        y3 = int32_t(floor(fy3 + 0.5));
-        
-        if (fx0 != 0.0)
-        {
-            fx1 *= fx0 = (intmax_t(x0) - x3) / fx0;
-            fx2 *= fx0;
-        }
-
-        if (fy0 != 0.0)
-        {
-            fy1 *= fy0 = (intmax_t(y0) - y3) / fy0;
-            fy2 *= fy0;
-        }
-        
-        if (x0 != x3 || y0 != y3) drawCubicBezierSeg(x0, y0, x0 + fx1, y0 + fy1, x0 + fx2, y0 + fy2, x3, y3, col, mode);
-        
-        x0 = x3;
-        y0 = y3;
-        fx0 = fx3;
-        fy0 = fy3;
-        t1 = t2;
-    }
-}
-
-//draw boxed with rounded border
-void drawRoundBox(int32_t x, int32_t y, int32_t width, int32_t height, int32_t rad, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    int32_t i = 0, j = 0;
-    int32_t a = 0, b = 0;
-    int32_t points[500] = { 0 };
-
-    const int32_t x1 = x + width - 1;
-    const int32_t y1 = y + height - 1;
-    const int32_t mid = height >> 1;
-
-    if (rad >= mid - 1) rad = mid - 1;
-
-    calcCircle(rad, points);
-
-    horizLine(x + rad - points[0], y + 1, width - ((rad - points[0]) << 1), col, mode);
-    vertLine(x, y + rad, height - (rad << 1), col, mode);
-    horizLine(x + rad - points[0], y1 - 1, width - ((rad - points[0]) << 1), col, mode);
-    vertLine(x1, y + rad, height - (rad << 1), col, mode);
-
-    for (i = 1; i <= rad; i++)
-    {
-        a = rad - points[i];
-        b = rad - points[i - 1];
-        for (j = a; j <= b; j++)
-        {
-            putPixel(x + j, y + i, col, mode);
-            putPixel(x1 - j, y + i, col, mode);
-        }
-    }
-
-    for (i = 1; i <= rad; i++)
-    {
-        a = rad - points[i];
-        b = rad - points[i - 1];
-        for (j = a; j <= b; j++)
-        {
-            putPixel(x + j, y1 - i, col, mode);
-            putPixel(x1 - j, y1 - i, col, mode);
-        }
-    }
-
-    for (i = 1; i <= rad; i++) horizLine(x + rad - points[i - 1] + 1, y + i, width - ((rad << 1) - (points[i - 1] << 1)) - 1, col, mode);
-    fillRect(x + 1, y + rad + 1, width - 2, height - (rad << 1) - 2, col, mode);
-    for (i = rad; i >= 1; i--) horizLine(x + rad - points[i - 1] + 1, y1 - i, width - ((rad << 1) - (points[i - 1] << 1)) - 1, col, mode);
-}
-
-//draw polygon
-void drawPolygon(const POINT2D* points, int32_t num, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    if (num < 3) return;
-    for (int32_t i = 0; i < num - 1; i++) drawLine(int32_t(points[i].x), int32_t(points[i].y), int32_t(points[i + 1].x), int32_t(points[i + 1].y), col, mode);
-    drawLine(int32_t(points[num - 1].x), int32_t(points[num - 1].y), int32_t(points[0].x), int32_t(points[0].y), col, mode);
-}
-
-//fast filled Bresenham circle at (xc,yc) with radius and color
-void fillCircle(int32_t xc, int32_t yc, int32_t radius, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    int32_t i = 0;
-    int32_t points[500] = { 0 };
-
-    //range limited
-    if (radius <= 0) return;
-
-    //out of range
-    if (radius > 499)
-    {
-        messageBox(GFX_ERROR, "fillCircle: radius must be in [0-499] pixels");
-        return;
-    }
-
-    int32_t mc = yc - radius;
-    calcCircle(radius, points);
-
-    for (i = 0; i <= radius - 1; i++, mc++) horizLine(xc - points[i], mc, (points[i] << 1), color, mode);
-    for (i = radius - 1; i >= 0; i--, mc++) horizLine(xc - points[i], mc, (points[i] << 1), color, mode);
-}
-
-//filled ellipse with color
-void fillEllipse(int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    int32_t i = 0;
-    int32_t points[500] = { 0 };
-
-    //range limited
-    if (ra <= 0 || rb <= 0) return;
-
-    //out of range
-    if (ra > 499 || rb > 499)
-    {
-        messageBox(GFX_ERROR, "fillEllipse: ra, rb must be in [0-499] pixels");
-        return;
-    }
-
-    int32_t mc = yc - rb;
-
-    if (ra != rb) calcEllipse(ra, rb, points);
-    else calcCircle(ra, points);
-
-    for (i = 0; i <= rb - 1; i++, mc++) horizLine(xc - points[i], mc, points[i] << 1, color, mode);
-    for (i = rb - 1; i >= 0; i--, mc++) horizLine(xc - points[i], mc, points[i] << 1, color, mode);
-}
-
-//fill polygon using Darel Rex Finley algorithm https://alienryderflex.com/polygon_fill/
-//optimize version here https://gist.github.com/ideasman42/983738130f754ef58ffa66bcdbbab892
-//test vectors (screen resolution: 800x600)
-//pt1[] = {{300, 100}, {192, 209}, {407, 323}, {320, 380}, {214, 350}, {375, 209}};
-//pt2[] = {{169, 164}, {169, 264}, {223, 300}, {296, 209}, {214, 255}, {223, 200}, {386, 192}, {341, 273}, {404, 300}, {431, 146}};
-//pt3[] = {{97, 56}, {115, 236}, {205, 146}, {276, 146}, {151, 325}, {259, 433}, {510, 344}, {510, 218}, {242, 271}, {384, 110}};
-//pt4[] = {{256, 150}, {148, 347}, {327, 329}, {311, 204}, {401, 204}, {418, 240}, {257, 222}, {293, 365}, {436, 383}, {455, 150}};
-//pt5[] = {{287, 76}, {129, 110}, {42, 301}, {78, 353}, {146, 337}, {199, 162}, {391, 180}, {322, 353}, {321, 198}, {219, 370}, {391, 405}, {444, 232}, {496, 440}, {565, 214}};
-//pt6[] = {{659, 336}, {452, 374}, {602, 128}, {509, 90}, {433, 164}, {300, 71}, {113, 166}, {205, 185}, {113, 279}, {169, 278}, {206, 334}, {263, 279}, {355, 129}, {301, 335}, {432, 204}, {433, 297}, {245, 467}, {414, 392}, {547, 523}};
-void fillPolygon(const POINT2D* points, int32_t num, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL*/)
-{
-    int32_t nodex[MAX_POLY_CORNERS] = { 0 };
-    int32_t nodes = 0, y = 0, i = 0, j = 0, swap = 0;
-    int32_t left = 0, right = 0, top = 0, bottom = 0;
-
-    //initialize clipping
-    left = right = int32_t(points[0].x);
-    top = bottom = int32_t(points[0].y);
-
-    //clipping points
-    for (i = 1; i < num; i++)
-    {
-        if (points[i].x < left)      left = int32_t(points[i].x);
-        if (points[i].x > right)     right = int32_t(points[i].x);
-        if (points[i].y < top)       top = int32_t(points[i].y);
-        if (points[i].y > bottom)    bottom = int32_t(points[i].y);
-    }
-
-    //loop through the rows of the image
-    for (y = top; y < bottom; y++)
-    {
-        //build a list of polygon intercepts on the current line
-        nodes = 0;
-        j = num - 1;
-
-        for (i = 0; i < num; i++)
-        {
-            //intercept found, record it
-            if ((points[i].y < y && points[j].y >= y) || (points[j].y < y && points[i].y >= y)) nodex[nodes++] = int32_t(points[i].x + (y - points[i].y) / (points[j].y - points[i].y) * (points[j].x - points[i].x));
-            if (nodes >= MAX_POLY_CORNERS) return;
-            j = i;
-        }
-
-        //sort the nodes, via a simple "Bubble" sort
-        i = 0;
-        while (i < nodes - 1)
-        {
-            if (nodex[i] > nodex[i + 1])
-            {
-                swap = nodex[i];
-                nodex[i] = nodex[i + 1];
-                nodex[i + 1] = swap;
-                if (i) i--;
-            }
-            else i++;
-        }
-
-        //fill the pixels between node pairs
-        for (i = 0; i < nodes; i += 2)
-        {
-            if (nodex[i] >= right) break;
-            if (nodex[i + 1] > left)
-            {
-                if (nodex[i] < left) nodex[i] = left;
-                if (nodex[i + 1] > right) nodex[i + 1] = right;
-                horizLine(nodex[i], y, nodex[i + 1] - nodex[i], col, mode);
-            }
-        }
-    }
-}
-
-//generate random polygon
-void randomPolygon(const int32_t cx, const int32_t cy, const int32_t avgRadius, double irregularity, double spikeyness, const int32_t numVerts, POINT2D* points)
-{
-    //valid params
-    spikeyness = clamp(spikeyness, 0, 1) * avgRadius;
-    irregularity = clamp(irregularity, 0, 1) * 2 * M_PI / numVerts;
-    
-    //generate n angle steps
-    double angleSteps[1024] = { 0 };
-    const double lower = (2 * M_PI / numVerts) - irregularity;
-    const double upper = (2 * M_PI / numVerts) + irregularity;
-    double sum = 0;
-
-    for (int32_t i = 0; i < numVerts; i++)
-    {
-        const double tmp = uniformRand(lower, upper);
-        angleSteps[i] = tmp;
-        sum += tmp;
-    }
-
-    //normalize the steps so that points 0 and points n+1 are the same
-    const double koef = sum / (2 * M_PI);
-    for (int32_t i = 0; i < numVerts; i++) angleSteps[i] /= koef;
-
-    //now generate the points
-    double angle = uniformRand(0, 2 * M_PI);
-    const double radius = 2.0 * avgRadius;
-
-    for (int32_t i = 0; i < numVerts; i++)
-    {
-        const double gaussValue = gaussianRand(avgRadius, spikeyness);
-        const double rad = clamp(gaussValue, 0, radius);
-        points[i].x = cx + rad * cos(angle);
-        points[i].y = cy + rad * sin(angle);
-        angle += angleSteps[i];
-    }
-}
-
-//FX-effect: fade circle
-void fadeCircle(int32_t dir, uint32_t col, uint32_t mswait)
-{
-    int32_t i = 0, x = 0, y = 0;
-
-    switch (dir)
-    {
-    case 0:
-        for (i = 0; i < 29; i++)
-        {
-            for (y = 0; y <= cmaxY / 40; y++)
-            {
-                for (x = 0; x <= cmaxX / 40; x++) fillCircle(x * 40 + 20, y * 40 + 20, i, col);
-            }
-            render();
-            delay(mswait);
-        }
-        break;
-
-    case 1:
-        for (i = -cmaxY / 40; i < 29; i++)
-        {
-            for (y = 0; y <= cmaxY / 40; y++)
-            {
-                for (x = 0; x <= cmaxX / 40; x++)
-                {
-                    if (cmaxY / 40 - y + i < 29) fillCircle(x * 40 + 20, y * 40 + 20, cmaxY / 40 - y + i, col);
-                }
-            }
-            render();
-            delay(mswait);
-        }
-        break;
-
-    case 2:
-        for (i = -cmaxX / 40; i < 29; i++)
-        {
-            for (y = 0; y <= cmaxY / 40; y++)
-            {
-                for (x = 0; x <= cmaxX / 40; x++)
-                {
-                    if (cmaxX / 40 - x + i < 29) fillCircle(x * 40 + 20, y * 40 + 20, cmaxX / 40 - x + i, col);
-                }
-            }
-            render();
-            delay(mswait);
-        }
-        break;
-
-    case 3:
-        for (i = -cmaxX / 40; i < 60; i++)
-        {
-            for (y = 0; y <= cmaxY / 40; y++)
-            {
-                for (x = 0; x <= cmaxX / 40; x++)
-                {
-                    if (cmaxX / 40 - x - y + i < 29) fillCircle(x * 40 + 20, y * 40 + 20, cmaxX / 40 - x - y + i, col);
-                }
-            }
-            render();
-            delay(mswait);
-        }
-        break;
-
-    default:
-        break;
-    }
-}
-
-//FX-effect: fade Rollo
-void fadeRollo(int32_t dir, uint32_t col, uint32_t mswait)
-{
-    int32_t i = 0, j = 0;
-
-    switch (dir)
-    {
-    case 0:
-        for (i = 0; i < 20; i++)
-        {
-            for (j = 0; j <= cmaxY / 10; j++) horizLine(0, j * 20 + i, cmaxX, col);
-            render();
-            delay(mswait);
-        }
-        break;
-
-    case 1:
-        for (i = 0; i < 20; i++)
-        {
-            for (j = 0; j <= cmaxX / 10; j++) vertLine(j * 20 + i, 0, cmaxY, col);
-            render();
-            delay(mswait);
-        }
-        break;
-
-    case 2:
-        for (i = 0; i < 20; i++)
-        {
-            for (j = 0; j <= cmaxX / 10; j++)
-            {
-                vertLine(j * 20 + i, 0, cmaxY, col);
-                if (j * 10 < cmaxY) horizLine(0, j * 20 + i, cmaxX, col);
-            }
-            render();
-            delay(mswait);
-        }
-        break;
-
-    default:
-        break;
-    }
-}
-
-//simulation visual page in VGA mode for compatible code
-//setActivePage and setVisualPage must be a paired function
-void setActivePage(GFX_IMAGE* page)
-{
-    changeDrawBuffer(page->mData, page->mWidth, page->mHeight);
-}
-
-//set render page to current page
-//setActivePage and setVisualPage must be a paired function
-void setVisualPage(GFX_IMAGE* page)
-{
-    changeDrawBuffer(page->mData, page->mWidth, page->mHeight);
-    render();
-    restoreDrawBuffer();
-}
-
-//create a new GFX image
-int32_t newImage(int32_t width, int32_t height, GFX_IMAGE* img)
-{
-    //calculate buffer size (should be 32-bytes alignment)
-    const uint32_t rowBytes = width * bytesPerPixel;
-    
-    //check for 32-bytes alignment
-    if (rowBytes % 32)
-    {
-        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
-        return 0;
-    }
-
-    //check size
-    const uint32_t memSize = height * rowBytes;
-    if (!memSize)
-    {
-        messageBox(GFX_ERROR, "Error create image, size = 0!");
-        return 0;
-    }
-
-    //32-bytes alignment for SIMD optimize
-    img->mData = SDL_aligned_alloc(32, memSize);
-    if (!img->mData)
-    {
-        messageBox(GFX_ERROR, "Error alloc memory, size:%lu", memSize);
-        return 0;
-    }
-
-    //store image info
-    img->mWidth    = width;
-    img->mHeight   = height;
-    img->mSize     = memSize;
-    img->mRowBytes = rowBytes;
-    memset(img->mData, 0, memSize);
-    return 1;
-}
-
-//update GFX image with new width, new height
-int32_t updateImage(int32_t width, int32_t height, GFX_IMAGE* img)
-{
-    //no need update
-    if (img->mWidth == width && img->mHeight == height) return 1;
-
-    //calculate new buffer size (should be 32-bytes alignment)
-    const uint32_t rowBytes = width * bytesPerPixel;
-
-    //check for 32-bytes alignment
-    if (rowBytes % 32)
-    {
-        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
-        return 0;
-    }
-
-    //check size
-    const uint32_t msize = height * rowBytes;
-    if (!msize)
-    {
-        messageBox(GFX_ERROR, "Error update image size = 0!");
-        return 0;
-    }
-
-    //reallocate new memory with new size (32-bytes alignment)
-    if (img->mData) SDL_aligned_free(img->mData);
-    img->mData = SDL_aligned_alloc(32, msize);
-    if (!img->mData)
-    {
-        messageBox(GFX_ERROR, "Error alloc memory with size: %lu", msize);
-        return 0;
-    }
-
-    //store image width and height
-    img->mWidth    = width;
-    img->mHeight   = height;
-    img->mSize     = msize;
-    img->mRowBytes = rowBytes;
-    memset(img->mData, 0, msize);
-    return 1;
-}
-
-//cleanup image buffer
-void freeImage(GFX_IMAGE* img)
-{
-    if (img && img->mData)
-    {
-        SDL_aligned_free(img->mData);
-        img->mData     = NULL;
-        img->mWidth    = 0;
-        img->mHeight   = 0;
-        img->mSize     = 0;
-        img->mRowBytes = 0;
-    }
-}
-
-//clear image data buffer
-void clearImage(GFX_IMAGE* img)
-{
-    if (img && img->mData) memset(img->mData, 0, img->mSize);
-}
-
-//get GFX image buffer functions
-void getImageMix(int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void *imgData = img->mData;
-    __asm {
-        mov     edi, imgData
-        mov     esi, drawBuff
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        add     esi, eax
-        mov     edx, texWidth
-        sub     edx, width
-        mov     eax, width
-        shr     eax, 2
-        mov     ebx, width
-        and     ebx, 3
-    next:
-        mov     ecx, eax
-        rep     movsd
-        mov     ecx, ebx
-        rep     movsb
-        add     esi, edx
-        dec     height
-        jnz     next
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 5;
-    const int32_t remainder = width % 32;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint8_t* srcPixels = (uint8_t*)img->mData;
-    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * y + x);
-
-    //use AVX2 for faster copy alignment memory
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            const __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)dstPixels);
-            _mm256_stream_si256((__m256i*)srcPixels, ymm0);
-            srcPixels += 32;
-            dstPixels += 32;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++) *srcPixels++ = *dstPixels++;
-        }
-
-        //next offsets
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//get GFX image buffer functions
-void getImageNormal(int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void *imgData = img->mData;
-    __asm {
-        mov     edi, imgData
-        mov     esi, drawBuff
-        mov     eax, y
-        mul     texWidth
-        add     eax, x
-        shl     eax, 2
-        add     esi, eax
-        mov     edx, texWidth
-        sub     edx, width
-        shl     edx, 2
-    next:
-        mov     ecx, width
-        shr     ecx, 1
-        jz      once
-    plot:
-        movq    mm0, [esi]
-        movq    [edi], mm0
-        add     edi, 8
-        add     esi, 8
-        dec     ecx
-        jnz     plot
-    once:
-        test    width, 1
-        jz      end
-        movd    mm0, [esi]
-        movd    [edi], mm0
-        add     edi, 4
-        add     esi, 4
-    end:
-        add     esi, edx
-        dec     height
-        jnz     next
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint32_t* srcPixels = (uint32_t*)img->mData;
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * y + x);
-    
-    //use AVX2 for faster copy alignment memory
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            const __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)dstPixels);
-            _mm256_stream_si256((__m256i*)srcPixels, ymm0);
-            srcPixels += 8;
-            dstPixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++) *srcPixels++ = *dstPixels++;
-        }
-
-        //next offsets
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//get GFX image buffer (export function)
-void getImage(int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
-{
-    //calculate new position
-    const int32_t x1 = x + (width - 1);
-    const int32_t y1 = y + (height - 1);
-
-    //clip image to context boundaries
-    const int32_t lx = max(x, cminX);
-    const int32_t ly = max(y, cminY);
-    const int32_t lx1 = min(x1, cmaxX);
-    const int32_t ly1 = min(y1, cmaxY);
-
-    //initialize loop variables
-    const int32_t lwidth = (lx1 - lx) + 1;
-    const int32_t lheight = (ly1 - ly) + 1;
-
-    //check for loop
-    if (lwidth <= 0|| lheight <= 0) return;
-
-    //none image pointer?
-    if (!img->mData)
-    {
-        //create new image
-        if (!newImage(lwidth, lheight, img)) return;
-    }
-    else
-    {
-        //update an existing image
-        if (!updateImage(lwidth, lheight, img)) return;
-    }
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        getImageMix(lx, ly, lwidth, lheight, img);
-        return;
-    }
-
-    //height color mode
-    getImageNormal(lx, ly, lwidth, lheight, img);
-}
-
-//put GFX image to points (x1, y1)
-void putImageMix(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        push    ebx
-        mov     edx, imgWidth
-        sub     edx, width
-        mov     eax, width
-        shr     eax, 2
-        mov     ebx, width
-        and     ebx, 3
-    next:
-        mov     ecx, eax
-        rep     movsd
-        mov     ecx, ebx
-        rep     movsb
-        add     edi, [esp]
-        add     esi, edx
-        dec     height
-        jnz     next
-        pop     ebx
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 5;
-    const int32_t remainder = width % 32;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * ly + lx);
-    uint8_t* srcPixels = (uint8_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //use AVX2 for faster copy alignment memory
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            const __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            _mm256_stream_si256((__m256i*)dstPixels, ymm0);
-            dstPixels += 32;
-            srcPixels += 32;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++) *dstPixels++ = *srcPixels++;
-        }
-
-        //next offsets
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image to points (x1, y1)
-void putImageNormal(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        shl     eax, 2
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        shl     eax, 2
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        shl     ebx, 2
-        mov     edx, imgWidth
-        sub     edx, width
-        shl     edx, 2
-    next:
-        mov     ecx, width
-        shr     ecx, 1
-        jz      once
-    plot:
-        movq    mm0, [esi]
-        movq    [edi], mm0
-        add     edi, 8
-        add     esi, 8
-        dec     ecx
-        jnz     plot
-    once:
-        test    width, 1
-        jz      end
-        movd    mm0, [esi]
-        movd    [edi], mm0
-        add     edi, 4
-        add     esi, 4
-    end:
-        add     edi, ebx
-        add     esi, edx
-        dec     height
-        jnz     next
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * ly + lx);
-    uint32_t* srcPixels = (uint32_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //use AVX2 for faster copy alignment memory
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            const __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            _mm256_stream_si256((__m256i*)dstPixels, ymm0);
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++) *dstPixels++ = *srcPixels++;
-        }
-
-        //next offsets
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image with add background color
-void putImageAdd(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        shl     eax, 2
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        shl     eax, 2
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        shl     ebx, 2
-        mov     edx, imgWidth
-        sub     edx, width
-        shl     edx, 2
-    again:
-        mov     ecx, width
-        shr     ecx, 1
-        jz      once
-    plot:
-        movq    mm0, [esi]
-        paddusb mm0, [edi]
-        movq    [edi], mm0
-        add     esi, 8
-        add     edi, 8
-        dec     ecx
-        jnz     plot
-    once:
-        test    width, 1
-        jz      end
-        movd    mm0, [esi]
-        paddusb mm0, [edi]
-        movd    [edi], mm0
-        add     esi, 4
-        add     edi, 4
-    end:
-        add     edi, ebx
-        add     esi, edx
-        dec     height
-        jnz     again
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    ARGB* dstPixels = (ARGB*)drawBuff + (texWidth * ly + lx);
-    ARGB* srcPixels = (ARGB*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load source and destination
-            const __m256i src = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            const __m256i dst = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //add 32-bytes data with saturation and store
-            const __m256i res = _mm256_adds_epu8(src, dst);
-            _mm256_stream_si256((__m256i*)dstPixels, res);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-        
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                dstPixels->r = min(srcPixels->r + dstPixels->r, 255);
-                dstPixels->g = min(srcPixels->g + dstPixels->g, 255);
-                dstPixels->b = min(srcPixels->b + dstPixels->b, 255);
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-        
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image with sub background color
-void putImageSub(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        shl     eax, 2
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        shl     eax, 2
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        shl     ebx, 2
-        mov     edx, imgWidth
-        sub     edx, width
-        shl     edx, 2
-    again:
-        mov     ecx, width
-        shr     ecx, 1
-        jz      once
-    plot:
-        movq    mm0, [esi]
-        psubusb mm0, [edi]
-        movq    [edi], mm0
-        add     esi, 8
-        add     edi, 8
-        dec     ecx
-        jnz     plot
-    once:
-        test    width, 1
-        jz      end
-        movd    mm0, [esi]
-        psubusb mm0, [edi]
-        movd    [edi], mm0
-        add     esi, 4
-        add     edi, 4
-    end:
-        add     edi, ebx
-        add     esi, edx
-        dec     height
-        jnz     again
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    ARGB* dstPixels = (ARGB*)drawBuff + (texWidth * ly + lx);
-    ARGB* srcPixels = (ARGB*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load source and destination
-            const __m256i src = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            const __m256i dst = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //sub 32-bytes data with saturation and store
-            const __m256i res = _mm256_subs_epu8(src, dst);
-            _mm256_stream_si256((__m256i*)dstPixels, res);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                dstPixels->r = max(srcPixels->r - dstPixels->r, 0);
-                dstPixels->g = max(srcPixels->g - dstPixels->g, 0);
-                dstPixels->b = max(srcPixels->b - dstPixels->b, 0);
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image with logical and background color
-void putImageAnd(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        shl     eax, 2
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        shl     eax, 2
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        shl     ebx, 2
-        mov     edx, imgWidth
-        sub     edx, width
-        shl     edx, 2
-    again:
-        mov     ecx, width
-        shr     ecx, 1
-        jz      once
-    plot:
-        movq    mm0, [esi]
-        pand    mm0, [edi]
-        movq    [edi], mm0
-        add     esi, 8
-        add     edi, 8
-        dec     ecx
-        jnz     plot
-    once:
-        test    width, 1
-        jz      end
-        movd    mm0, [esi]
-        pand    mm0, [edi]
-        movd    [edi], mm0
-        add     esi, 4
-        add     edi, 4
-    end:
-        add     edi, ebx
-        add     esi, edx
-        dec     height
-        jnz     again
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    ARGB* dstPixels = (ARGB*)drawBuff + (texWidth * ly + lx);
-    ARGB* srcPixels = (ARGB*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load source and destination
-            const __m256i src = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            const __m256i dst = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //sub 32-bytes data with saturation and store
-            const __m256i res = _mm256_and_si256(src, dst);
-            _mm256_stream_si256((__m256i*)dstPixels, res);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                dstPixels->r = srcPixels->r & dstPixels->r;
-                dstPixels->g = srcPixels->g & dstPixels->g;
-                dstPixels->b = srcPixels->b & dstPixels->b;
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image with logical x-or background color
-void putImageXor(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        shl     eax, 2
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        shl     eax, 2
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        shl     ebx, 2
-        mov     edx, imgWidth
-        sub     edx, width
-        shl     edx, 2
-    again:
-        mov     ecx, width
-        shr     ecx, 1
-        jz      once
-    plot:
-        movq    mm0, [esi]
-        pxor    mm0, [edi]
-        movq    [edi], mm0
-        add     esi, 8
-        add     edi, 8
-        dec     ecx
-        jnz     plot
-    once:
-        test    width, 1
-        jz      end
-        movd    mm0, [esi]
-        pxor    mm0, [edi]
-        movd    [edi], mm0
-        add     esi, 4
-        add     edi, 4
-    end:
-        add     edi, ebx
-        add     esi, edx
-        dec     height
-        jnz     again
-        emms
-    }
-#else
-    //32-bytes alignment
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    //calculate next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    ARGB* dstPixels = (ARGB*)drawBuff + (texWidth * ly + lx);
-    ARGB* srcPixels = (ARGB*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load source and destination
-            const __m256i src = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            const __m256i dst = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //sub 32-bytes data with saturation and store
-            const __m256i res = _mm256_xor_si256(src, dst);
-            _mm256_stream_si256((__m256i*)dstPixels, res);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                dstPixels->r = srcPixels->r ^ dstPixels->r;
-                dstPixels->g = srcPixels->g ^ dstPixels->g;
-                dstPixels->b = srcPixels->b ^ dstPixels->b;
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image with transparent color (must be RGBA format)
-void putImageAlpha(const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, ly
-        mul         texWidth
-        add         eax, lx
-        shl         eax, 2
-        add         edi, eax
-        mov         esi, imgData
-        mov         eax, ly
-        sub         eax, y
-        mul         imgWidth
-        mov         ebx, lx
-        sub         ebx, x
-        add         eax, ebx
-        shl         eax, 2
-        add         esi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        mov         edx, imgWidth
-        sub         edx, width
-        shl         edx, 2
-    again:
-        mov         ecx, width
-    plot:
-        mov         eax, [esi]
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-        movd        mm0, [edi]
-        movd        mm1, [esi]
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-        add         edi, 4
-        add         esi, 4
-        dec         ecx
-        jnz         plot
-        add         edi, ebx
-        add         esi, edx
-        dec         height
-        jnz         again
-        emms
-    }
-#else
-    //align 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    const __m256i zero = _mm256_setzero_si256();
-    const __m256i unity = _mm256_set1_epi16(256);
-
-    //next offset
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * ly + lx);
-    uint32_t* srcPixels = (uint32_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //scan height
-    for (int32_t i = 0; i < height; i++)
-    {
-        //process 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load source and destination
-            const __m256i src = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            const __m256i dst = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //high source (S * A)
-            __m256i src16 = _mm256_unpackhi_epi8(src, zero);
-            __m256i alpha = src16;
-            alpha = _mm256_shufflehi_epi16(alpha, 0xff);
-            alpha = _mm256_shufflelo_epi16(alpha, 0xff);
-            src16 = _mm256_mullo_epi16(src16, alpha);
-
-            //high dest (D * (256 - A))
-            __m256i dst16 = _mm256_unpackhi_epi8(dst, zero);
-            alpha = _mm256_sub_epi16(unity, alpha);
-            dst16 = _mm256_mullo_epi16(dst16, alpha);
-
-            //high result (S * A + D * (256 - A)) >> 8
-            __m256i rlt16h = _mm256_add_epi16(src16, dst16);
-            rlt16h = _mm256_srli_epi16(rlt16h, 8);
-
-            //low (S * A)
-            src16 = _mm256_unpacklo_epi8(src, zero);
-            alpha = src16;
-            alpha = _mm256_shufflehi_epi16(alpha, 0xff);
-            alpha = _mm256_shufflelo_epi16(alpha, 0xff);
-            src16 = _mm256_mullo_epi16(src16, alpha);
-
-            //low (D * (256 - A))
-            dst16 = _mm256_unpacklo_epi8(dst, zero);
-            alpha = _mm256_sub_epi16(unity, alpha);
-            dst16 = _mm256_mullo_epi16(dst16, alpha);
-
-            //low result (S * A + D * (256 - A)) >> 8
-            __m256i rlt16l = _mm256_add_epi16(src16, dst16);
-            rlt16l = _mm256_srli_epi16(rlt16l, 8);
-
-            //final merge result (hi,low) and store
-            const __m256i result = _mm256_packus_epi16(rlt16l, rlt16h);
-            _mm256_stream_si256((__m256i*)dstPixels, result);
-
-            //next 8 pixels width (32 bytes)
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                const uint32_t dstCol = *dstPixels;
-                const uint32_t srcCol = *srcPixels;
-                const uint8_t cover = srcCol >> 24;
-                const uint8_t rcover = 255 - cover;
-                const uint32_t rb = ((dstCol & 0x00ff00ff) * rcover + (srcCol & 0x00ff00ff) * cover);
-                const uint32_t ag = (((dstCol & 0xff00ff00) >> 8) * rcover + ((srcCol & 0xff00ff00) >> 8) * cover);
-                *dstPixels++ = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put GFX image to draw buffer (export function)
-void putImage(int32_t x, int32_t y, const GFX_IMAGE* img, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //calculate new position
-    const int32_t x1 = x + (img->mWidth - 1);
-    const int32_t y1 = y + (img->mHeight - 1);
-
-    //clip image to context boundaries
-    const int32_t lx = max(x, cminX);
-    const int32_t ly = max(y, cminY);
-    const int32_t lx1 = min(x1, cmaxX);
-    const int32_t ly1 = min(y1, cmaxY);
-
-    //initialize loop variables
-    const int32_t width = (lx1 - lx) + 1;
-    const int32_t height = (ly1 - ly) + 1;
-
-    //check for loop
-    if (width <= 0 || height <= 0) return;
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        putImageMix(x, y, lx, ly, width, height, img);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        putImageNormal(x, y, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_ADD:
-        putImageAdd(x, y, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_SUB:
-        putImageSub(x, y, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_AND:
-        putImageAnd(x, y, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_XOR:
-        putImageXor(x, y, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        putImageAlpha(x, y, lx, ly, width, height, img);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//put a sprite at points(x1, y1) with key color (don't render key color)
-void putSpriteMix(const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth  = img->mWidth;
-
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly
-        mul     texWidth
-        add     eax, lx
-        add     edi, eax
-        mov     esi, imgData
-        mov     eax, ly
-        sub     eax, y
-        mul     imgWidth
-        mov     ebx, lx
-        sub     ebx, x
-        add     eax, ebx
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, width
-        mov     edx, imgWidth
-        sub     edx, width
-    next:
-        mov     ecx, width
-    plot:
-        lodsb
-        cmp     al, byte ptr[keyColor]
-        je      skip
-        mov     [edi], al
-    skip:
-        inc     edi
-        dec     ecx
-        jnz     plot
-        add     edi, ebx
-        add     esi, edx
-        dec     height
-        jnz     next
-    }
-#else
-    //calculate next offsets
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * ly + lx);
-    uint8_t* srcPixels = (uint8_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    for (int32_t i = 0; i < height; i++)
-    {
-        for (int32_t j = 0; j < width; j++)
-        {
-            //source color diff with key color, plot it
-            const uint32_t col = *srcPixels++;
-            if (!(col ^ keyColor)) *dstPixels++ = col;
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put a sprite at points(x1, y1) with key color (don't render key color)
-void putSpriteNormal(const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, ly
-        mul         texWidth
-        add         eax, lx
-        shl         eax, 2
-        add         edi, eax
-        mov         esi, imgData
-        mov         eax, ly
-        sub         eax, y
-        mul         imgWidth
-        mov         ebx, lx
-        sub         ebx, x
-        add         eax, ebx
-        shl         eax, 2
-        add         esi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        mov         edx, imgWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm4, keyColor
-        punpckldq   mm4, mm4
-        mov         eax, 0ffffffffh
-        movd        mm5, eax
-        punpckldq   mm5, mm5
-        mov         eax, 0ffffffh
-        movd        mm6, eax
-        punpckldq   mm6, mm6
-    next:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-    plot:
-        movq        mm0, [esi]
-        movq        mm2, mm4
-        pand        mm0, mm6
-        pcmpeqd     mm2, mm0
-        movq        mm1, [edi]
-        pand        mm1, mm2
-        pxor        mm2, mm5
-        pand        mm0, mm2
-        por         mm1, mm0
-        movq        [edi], mm1
-        add         esi, 8
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          skip
-        add         esi, 4
-        add         edi, 4
-        mov         eax, [esi]
-        cmp         eax, keyColor
-        je          skip
-        mov         [edi - 4], eax
-    skip:
-        add         edi, ebx
-        add         esi, edx
-        dec         height
-        jnz         next
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    const __m256i ymm4 = _mm256_set1_epi32(keyColor);
-    const __m256i ymm5 = _mm256_set1_epi32(0xffffffff);
-    const __m256i ymm6 = _mm256_set1_epi32(0x00ffffff);
-
-    //calculate next offsets
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * ly + lx);
-    uint32_t* srcPixels = (uint32_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        //process 32-bytes align
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //off alpha channel from source pixels
-            __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            ymm0 = _mm256_and_si256(ymm0, ymm6);
-
-            //get mask with key color
-            __m256i ymm2 = _mm256_cmpeq_epi32(ymm0, ymm4);
-            
-            //replace background color by key color
-            __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)dstPixels);
-            ymm1 = _mm256_and_si256(ymm1, ymm2);
-            
-            //inverted mask
-            ymm2 = _mm256_xor_si256(ymm2, ymm5);
-            
-            //turn off key color channel from source
-            ymm0 = _mm256_and_si256(ymm0, ymm2);
-
-            //add with background
-            ymm1 = _mm256_or_si256(ymm1, ymm0);
-            
-            //store color
-            _mm256_stream_si256((__m256i*)dstPixels, ymm1);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                //turn of alpha channel of source color
-                const uint32_t col = *srcPixels & 0x00ffffffl;
-                if (!(col ^ keyColor)) *dstPixels = *srcPixels;
-
-                //next pixels
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put a sprite at points(x1, y1) with key color (don't render key color), add with background color
-void putSpriteAdd(const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, ly
-        mul         texWidth
-        add         eax, lx
-        shl         eax, 2
-        add         edi, eax
-        mov         esi, imgData
-        mov         eax, ly
-        sub         eax, y
-        mul         imgWidth
-        mov         ebx, lx
-        sub         ebx, x
-        add         eax, ebx
-        shl         eax, 2
-        add         esi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        mov         edx, imgWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm4, keyColor
-        punpckldq   mm4, mm4
-        mov         eax, 0ffffffffh
-        movd        mm5, eax
-        punpckldq   mm5, mm5
-        mov         eax, 0ffffffh
-        movd        mm6, eax
-        punpckldq   mm6, mm6
-    next:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-    plot:
-        movq        mm0, [esi]
-        movq        mm2, mm4
-        pand        mm0, mm6
-        pcmpeqd     mm2, mm0
-        pxor        mm2, mm5
-        pand        mm0, mm2
-        paddusb     mm0, [edi]
-        movq        [edi], mm0
-        add         esi, 8
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          skip
-        add         esi, 4
-        add         edi, 4
-        mov         eax, [esi]
-        cmp         eax, keyColor
-        je          skip
-        movd        mm3, eax
-        paddusb     mm3, [edi - 4]
-        movd        [edi - 4], mm3
-    skip:
-        add         edi, ebx
-        add         esi, edx
-        dec         height
-        jnz         next
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    const __m256i ymm4 = _mm256_set1_epi32(keyColor);
-    const __m256i ymm5 = _mm256_set1_epi32(0xffffffff);
-    const __m256i ymm6 = _mm256_set1_epi32(0x00ffffff);
-
-    //calculate next offsets
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    ARGB* dstPixels = (ARGB*)drawBuff + (texWidth * ly + lx);
-    ARGB* srcPixels = (ARGB*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        //process 32-bytes align
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //off alpha channel from 8 source pixels (ARGB -> 0RGB)
-            __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            ymm0 = _mm256_and_si256(ymm0, ymm6);
-
-            //load 8 pixels from background color
-            __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //get mask with key color (key color is 0xff and render is 0x00)
-            __m256i ymm2 = _mm256_cmpeq_epi32(ymm0, ymm4);
-
-            //inverted mask (key color is 0x00 and render is 0xff)
-            ymm2 = _mm256_xor_si256(ymm2, ymm5);
-
-            //make source with off key color (0x00XX)
-            ymm0 = _mm256_and_si256(ymm0, ymm2);
-
-            //add with background color (only add render color)
-            ymm1 = _mm256_adds_epu8(ymm0, ymm1);
-
-            //store back to background
-            _mm256_stream_si256((__m256i*)dstPixels, ymm1);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                //turn off alpha channel of source color
-                const uint32_t col = (*(uint32_t*)srcPixels) & 0x00ffffff;
-                if (!(col ^ keyColor))
-                {
-                    dstPixels->r = min(srcPixels->r + dstPixels->r, 255);
-                    dstPixels->g = min(srcPixels->g + dstPixels->g, 255);
-                    dstPixels->b = min(srcPixels->b + dstPixels->b, 255);
-                }
-
-                //next pixels
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put a sprite at points(x1, y1) with key color (don't render key color), sub with background color
-void putSpriteSub(const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, ly
-        mul         texWidth
-        add         eax, lx
-        shl         eax, 2
-        add         edi, eax
-        mov         esi, imgData
-        mov         eax, ly
-        sub         eax, y
-        mul         imgWidth
-        mov         ebx, lx
-        sub         ebx, x
-        add         eax, ebx
-        shl         eax, 2
-        add         esi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        mov         edx, imgWidth
-        sub         edx, width
-        shl         edx, 2
-        movd        mm4, keyColor
-        punpckldq   mm4, mm4
-        mov         eax, 0ffffffffh
-        movd        mm5, eax
-        punpckldq   mm5, mm5
-        mov         eax, 0ffffffh
-        movd        mm6, eax
-        punpckldq   mm6, mm6
-    next:
-        mov         ecx, width
-        shr         ecx, 1
-        jz          once
-    plot:
-        movq        mm0, [esi]
-        movq        mm2, mm4
-        pand        mm0, mm6
-        pcmpeqd     mm2, mm0
-        movq        mm1, [edi]
-        pand        mm1, mm2
-        pxor        mm2, mm5
-        pand        mm0, mm2
-        psubusb     mm0, [edi]
-        por         mm0, mm1
-        movq        [edi], mm0
-        add         esi, 8
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        width, 1
-        jz          skip
-        add         esi, 4
-        add         edi, 4
-        mov         eax, [esi]
-        cmp         eax, keyColor
-        je          skip
-        movd        mm3, eax
-        psubusb     mm3, [edi - 4]
-        movd        [edi - 4], mm3
-    skip:
-        add         edi, ebx
-        add         esi, edx
-        dec         height
-        jnz         next
-        emms
-    }
-#else
-    //aligned 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    const __m256i ymm4 = _mm256_set1_epi32(keyColor);
-    const __m256i ymm5 = _mm256_set1_epi32(0xffffffff);
-    const __m256i ymm6 = _mm256_set1_epi32(0x00ffffff);
-
-    //calculate next offsets
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    ARGB* dstPixels = (ARGB*)drawBuff + (texWidth * ly + lx);
-    ARGB* srcPixels = (ARGB*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        //process 32-bytes align
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //off alpha channel from 8 source pixels (ARGB -> 0RGB)
-            __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            ymm0 = _mm256_and_si256(ymm0, ymm6);
-
-            //load 8 pixels from background color
-            const __m256i ymm1 = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //get mask with key color (key color is 0xff and render is 0x00)
-            __m256i ymm2 = _mm256_cmpeq_epi32(ymm0, ymm4);
-
-            //save revert background
-            __m256i ymm3 = _mm256_and_si256(ymm1, ymm2);
-
-            //inverted mask (key color is 0x00 and render is 0xff)
-            ymm2 = _mm256_xor_si256(ymm2, ymm5);
-
-            //make source with off key color (0x00XX)
-            ymm0 = _mm256_and_si256(ymm0, ymm2);
-
-            //sub source to background color (only sub render color)
-            ymm0 = _mm256_subs_epu8(ymm0, ymm1);
-
-            //replace key color with background color
-            ymm3 = _mm256_or_si256(ymm0, ymm3);
-
-            //store back to background
-            _mm256_stream_si256((__m256i*)dstPixels, ymm3);
-
-            //next 8 pixels
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                //turn off alpha channel of source color
-                const uint32_t col = (*(uint32_t*)srcPixels) & 0x00ffffff;
-                if (!(col ^ keyColor))
-                {
-                    dstPixels->r = max(srcPixels->r - dstPixels->r, 0);
-                    dstPixels->g = max(srcPixels->g - dstPixels->g, 0);
-                    dstPixels->b = max(srcPixels->b - dstPixels->b, 0);
-                }
-
-                //next pixels
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put a sprite at points(x1, y1) with key color (don't render key color) and blending color
-void putSpriteAlpha(const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    void* imgData = img->mData;
-    const int32_t imgWidth = img->mWidth;
-
-    __asm {
-        mov         edi, drawBuff
-        mov         eax, ly
-        mul         texWidth
-        add         eax, lx
-        shl         eax, 2
-        add         edi, eax
-        mov         esi, imgData
-        mov         eax, ly
-        sub         eax, y
-        mul         imgWidth
-        mov         ebx, lx
-        sub         ebx, x
-        add         eax, ebx
-        shl         eax, 2
-        add         esi, eax
-        mov         ebx, texWidth
-        sub         ebx, width
-        shl         ebx, 2
-        mov         edx, imgWidth
-        sub         edx, width
-        shl         edx, 2
-    next:
-        mov         ecx, width
-    plot:
-        mov         eax, [esi]
-        and         eax, 00ffffffh
-        cmp         eax, keyColor
-        je          skip
-        mov         eax, [esi]
-        shr         eax, 24
-        pxor        mm5, mm5
-        movd        mm7, eax
-        pshufw	    mm7, mm7, 0
-        neg	        eax
-        add	        eax, 256
-        movd	    mm6, eax
-        pshufw	    mm6, mm6, 0
-        movd        mm0, [edi]
-        movd        mm1, [esi]
-        punpcklbw   mm0, mm5
-        punpcklbw   mm1, mm5
-        pmullw      mm0, mm6
-        pmullw      mm1, mm7
-        paddusw     mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm0
-        movd        [edi], mm0
-    skip:
-        add         edi, 4
-        add         esi, 4
-        dec         ecx
-        jnz         plot
-        add         edi, ebx
-        add         esi, edx
-        dec         height
-        jnz         next
-        emms
-    }
-#else
-    //align 32-bytes
-    const int32_t aligned = width >> 3;
-    const int32_t remainder = width % 8;
-
-    const __m256i zero = _mm256_setzero_si256();
-    const __m256i unity = _mm256_set1_epi16(256);
-
-    const __m256i amask = _mm256_set1_epi32(keyColor);
-    const __m256i bmask = _mm256_set1_epi32(0xffffffff);
-
-    //calculate adding offsets for next line
-    const int32_t addDstOffs = texWidth - width;
-    const int32_t addImgOffs = img->mWidth - width;
-
-    //calculate starting address
-    uint32_t* dstPixels = (uint32_t*)drawBuff + (texWidth * ly + lx);
-    uint32_t* srcPixels = (uint32_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
-
-    //line-by-line
-    for (int32_t i = 0; i < height; i++)
-    {
-        //process 32-bytes aligned
-        for (int32_t j = 0; j < aligned; j++)
-        {
-            //load 8 pixels from source and dest
-            __m256i src = _mm256_stream_load_si256((const __m256i*)srcPixels);
-            const __m256i dst = _mm256_stream_load_si256((const __m256i*)dstPixels);
-
-            //get mask with key color (key color is 0xff and render is 0x00)
-            __m256i mask = _mm256_cmpeq_epi32(src, amask);
-
-            //inverted mask (key color is 0x00 and render is 0xff)
-            mask = _mm256_xor_si256(mask, bmask);
-
-            //make source with off key color (0x00XX)
-            src = _mm256_and_si256(src, mask);
-
-            //high source (S * A)
-            __m256i src16 = _mm256_unpackhi_epi8(src, zero);
-            __m256i alpha = src16;
-            alpha = _mm256_shufflehi_epi16(alpha, 0xff);
-            alpha = _mm256_shufflelo_epi16(alpha, 0xff);
-            src16 = _mm256_mullo_epi16(src16, alpha);
-
-            //high dest (D * (256 - A))
-            __m256i dst16 = _mm256_unpackhi_epi8(dst, zero);
-            alpha = _mm256_sub_epi16(unity, alpha);
-            dst16 = _mm256_mullo_epi16(dst16, alpha);
-
-            //high result (S * A + D * (256 - A)) >> 8
-            __m256i rlt16h = _mm256_add_epi16(src16, dst16);
-            rlt16h = _mm256_srli_epi16(rlt16h, 8);
-
-            //low (S * A)
-            src16 = _mm256_unpacklo_epi8(src, zero);
-            alpha = src16;
-            alpha = _mm256_shufflehi_epi16(alpha, 0xff);
-            alpha = _mm256_shufflelo_epi16(alpha, 0xff);
-            src16 = _mm256_mullo_epi16(src16, alpha);
-
-            //low (D * (256 - A))
-            dst16 = _mm256_unpacklo_epi8(dst, zero);
-            alpha = _mm256_sub_epi16(unity, alpha);
-            dst16 = _mm256_mullo_epi16(dst16, alpha);
-
-            //low result (S * A + D * (256 - A)) >> 8
-            __m256i rlt16l = _mm256_add_epi16(src16, dst16);
-            rlt16l = _mm256_srli_epi16(rlt16l, 8);
-
-            //final merge result (hi,low) and store
-            const __m256i result = _mm256_packus_epi16(rlt16l, rlt16h);
-            _mm256_stream_si256((__m256i*)dstPixels, result);
-
-            //next 8 pixels width
-            dstPixels += 8;
-            srcPixels += 8;
-        }
-
-        //have unaligned bytes?
-        if (remainder > 0)
-        {
-            for (int32_t k = 0; k < remainder; k++)
-            {
-                //we accepted RGB color only
-                const uint32_t col = (*srcPixels) & 0x00ffffff;
-                if (!(col ^ keyColor))
-                {
-                    const uint32_t dstCol = *dstPixels;
-                    const uint32_t srcCol = *srcPixels;
-                    const uint8_t cover = srcCol >> 24;
-                    const uint8_t rcover = 255 - cover;
-                    const uint32_t rb = ((dstCol & 0x00ff00ff) * rcover + (srcCol & 0x00ff00ff) * cover);
-                    const uint32_t ag = (((dstCol & 0xff00ff00) >> 8) * rcover + ((srcCol & 0xff00ff00) >> 8) * cover);
-                    *dstPixels = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-                }
-
-                //next pixels
-                dstPixels++;
-                srcPixels++;
-            }
-        }
-
-        //next line
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//put a sprite at points(x1, y1) with key color (don't render key color), sub with background color
-void putSprite(int32_t x, int32_t y, uint32_t keyColor, const GFX_IMAGE* img, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    //calculate new position
-    const int32_t x1 = x + (img->mWidth - 1);
-    const int32_t y1 = y + (img->mHeight - 1);
-
-    //clip image to context boundaries
-    const int32_t lx = max(x, cminX);
-    const int32_t ly = max(y, cminY);
-    const int32_t lx1 = min(x1, cmaxX);
-    const int32_t ly1 = min(y1, cmaxY);
-
-    //initialize loop variables
-    const int32_t width = (lx1 - lx) + 1;
-    const int32_t height = (ly1 - ly) + 1;
-
-    //check for loop
-    if (width <= 0 || height <= 0) return;
-
-    //mixed mode?
-    if (bitsPerPixel == 8)
-    {
-        putSpriteMix(x, y, keyColor, lx, ly, width, height, img);
-        return;
-    }
-
-    //height color mode
-    switch (mode)
-    {
-    case BLEND_MODE_NORMAL:
-        putSpriteNormal(x, y, keyColor, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_ADD:
-        putSpriteAdd(x, y, keyColor, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_SUB:
-        putSpriteSub(x, y, keyColor, lx, ly, width, height, img);
-        break;
-
-    case BLEND_MODE_ALPHA:
-        putSpriteAlpha(x, y, keyColor, lx, ly, width, height, img);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
-        break;
-    }
-}
-
-//boundary clip points at (x,y)
-must_inline int32_t clampPoint(const int32_t width, const int32_t height, int32_t* x, int32_t* y)
-{
-    int32_t ret = 1;
-
-    if (*x < 0)
-    { 
-        *x = 0;
-        ret = 0;
-    }
-    else if (*x >= width)
-    { 
-        *x = width - 1;
-        ret = 0;
-    }
-
-    if (*y < 0)
-    {
-        *y = 0;
-        ret = 0;
-    }
-    else if (*y >= height)
-    {
-        *y = height - 1;
-        ret = 0;
-    }
-
-    return ret;
-}
-
-//get source pixel
-must_inline uint32_t clampOffset(const int32_t width, const int32_t height, const int32_t x, const int32_t y)
-{
-    //x-range check
-    const int32_t xx = clamp(x, 0, width - 1);
-    const int32_t yy = clamp(y, 0, height - 1);
-
-    //return offset at (x,y)
-    return yy * width + xx;
-}
-
-//clamp pixels at offset (x,y)
-must_inline uint32_t clampPixels(const GFX_IMAGE* img, int32_t x, int32_t y)
-{
-    const uint32_t* psrc = (const uint32_t*)img->mData;
-    const int32_t insrc = clampPoint(img->mWidth, img->mHeight, &x, &y);
-    uint32_t result = psrc[y * img->mWidth + x];
-    if (!insrc)
-    {
-        ARGB* pcol = (ARGB*)&result;
-        pcol->a = 0;
-    }
-    return result;
-}
-
-//alpha-blending pixel
-must_inline uint32_t alphaBlend(const uint32_t dstCol, const uint32_t srcCol)
-{
-#ifdef _USE_ASM
-    __asm {
-        pxor        mm7, mm7
-        movd        mm0, srcCol
-        movd        mm2, dstCol
-        punpcklbw   mm0, mm7
-        punpcklbw   mm2, mm7
-        movq        mm1, mm0
-        punpckhwd   mm1, mm1
-        psubw       mm0, mm2
-        punpckhdq   mm1, mm1
-        psllw       mm2, 8
-        pmullw      mm0, mm1
-        paddw       mm2, mm0
-        psrlw       mm2, 8
-        packuswb    mm2, mm7
-        movd        eax, mm2
-        emms
-    }
-#else
-    const uint8_t cover = srcCol >> 24;
-    const uint8_t rcover = 255 - cover;
-    const uint32_t rb = ((dstCol & 0x00ff00ff) * rcover + (srcCol & 0x00ff00ff) * cover);
-    const uint32_t ag = (((dstCol & 0xff00ff00) >> 8) * rcover + ((srcCol & 0xff00ff00) >> 8) * cover);
-    return ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-#endif
-}
-
-//smooth get pixel (average pixel calculation)
-must_inline uint32_t smoothGetPixel(const GFX_IMAGE* img, const int32_t sx, const int32_t sy)
-{
-    const int32_t lx = sx >> 16;
-    const int32_t ly = sy >> 16;
-    const ARGB* psrc = (const ARGB*)img->mData;
-    const ARGB* p0 = (const ARGB*)&psrc[clampOffset(img->mWidth, img->mHeight, lx, ly)];
-    const ARGB* p1 = (const ARGB*)&psrc[clampOffset(img->mWidth, img->mHeight, lx + 1, ly)];
-
-    uint32_t col = 0;
-    ARGB* pcol = (ARGB*)&col;
-    pcol->a = (p0->a + p1->a) >> 1;
-    pcol->r = (p0->r + p1->r) >> 1;
-    pcol->g = (p0->g + p1->g) >> 1;
-    pcol->b = (p0->b + p1->b) >> 1;
-    return col;
-}
-
-//bilinear get pixel with FIXED-POINT (signed 16.16)
-must_inline uint32_t bilinearGetPixelCenter(const GFX_IMAGE* psrc, const int32_t sx, const int32_t sy)
-{
-    const int32_t width = psrc->mWidth;
-    const uint32_t* pixels = (const uint32_t*)psrc->mData;
-
-#ifdef _USE_ASM
-    __asm {
-        mov         eax, sx
-        mov         edx, sy
-        pxor        mm7, mm7
-        shl         edx, 16
-        shl         eax, 16
-        shr         edx, 24
-        shr         eax, 24
-        movd        mm6, edx
-        movd        mm5, eax
-        mov         edx, sy
-        mov         eax, width
-        shl         eax, 2
-        sar         edx, 16
-        imul        edx, eax
-        add         edx, pixels
-        add         eax, edx
-        mov         ecx, sx
-        sar         ecx, 16
-        movd        mm2, dword ptr[eax + ecx * 4]
-        movd        mm0, dword ptr[eax + ecx * 4 + 4]
-        punpcklwd   mm5, mm5
-        punpcklwd   mm6, mm6
-        movd        mm3, dword ptr[edx + ecx * 4]
-        movd        mm1, dword ptr[edx + ecx * 4 + 4]
-        punpckldq   mm5, mm5
-        punpcklbw   mm0, mm7
-        punpcklbw   mm1, mm7
-        punpcklbw   mm2, mm7
-        punpcklbw   mm3, mm7
-        psubw       mm0, mm2
-        psubw       mm1, mm3
-        psllw       mm2, 8
-        psllw       mm3, 8
-        pmullw      mm0, mm5
-        pmullw      mm1, mm5
-        punpckldq   mm6, mm6
-        paddw       mm0, mm2
-        paddw       mm1, mm3
-        psrlw       mm0, 8
-        psrlw       mm1, 8
-        psubw       mm0, mm1
-        psllw       mm1, 8
-        pmullw      mm0, mm6
-        paddw       mm0, mm1
-        psrlw       mm0, 8
-        packuswb    mm0, mm7
-        movd        eax, mm0
-        emms
-    }
-#else
-    const uint32_t* pixel0 = &pixels[(sy >> 16) * width + (sx >> 16)];
-    const uint32_t* pixel1 = &pixel0[width];
-
-    const uint32_t pu = uint8_t(sx >> 8);
-    const uint32_t pv = uint8_t(sy >> 8);
-    const uint32_t w3 = (pu * pv) >> 8;
-    const uint32_t w2 = pu - w3;
-    const uint32_t w1 = pv - w3;
-    const uint32_t w0 = 256 - w1 - w2 - w3;
-
-    //zero all
-    const __m128i zero = _mm_setzero_si128();
-
-    //load 4 pixels [(x, y),(x + 1, y),(x, y + 1),(x + 1, y + 1)]
-    __m128i p12 = _mm_loadl_epi64((const __m128i*)pixel0);
-    __m128i p34 = _mm_loadl_epi64((const __m128i*)pixel1);
-
-    //convert RGBA RGBA RGBA RGAB to RRRR GGGG BBBB AAAA
-    p12 = _mm_unpacklo_epi8(p12, p34);
-    p34 = _mm_unpackhi_epi64(p12, zero);
-    p12 = _mm_unpacklo_epi8(p12, p34);
-
-    //extend to 16bits
-    __m128i rg = _mm_unpacklo_epi8(p12, zero);
-    __m128i ba = _mm_unpackhi_epi8(p12, zero);
-
-    //initialize pixel weights to 16bits integer w4 w3 w2 w1
-    __m128i weight = _mm_set_epi32(w3, w1, w2, w0);
-
-    //make 32bit -> 2 x 16bits
-    weight = _mm_packs_epi32(weight, weight);
-
-    //rg = [w1*r1 + w2*r2 | w3*r3 + w4*r4 | w1*g1 + w2*g2 | w3*g3 + w4*g4]
-    rg = _mm_madd_epi16(rg, weight);
-
-    //ba = [w1*b1 + w2*b2 | w3*b3 + w4*b4 | w1*a1 + w2*a2 | w3*a3 + w4*a4]
-    ba = _mm_madd_epi16(ba, weight);
-
-    //horizontal add that will produce the output values (in 32bit)
-    weight = _mm_hadd_epi32(rg, ba);
-    weight = _mm_srli_epi32(weight, 8);
-
-    //convert 32bit->8bit
-    weight = _mm_packus_epi32(weight, zero);
-    weight = _mm_packus_epi16(weight, zero);
-    return _mm_cvtsi128_si32(weight);
-#endif
-}
-
-//bilinear get pixel with FIXED-POINT (signed 16.16)
-must_inline uint32_t bilinearGetPixelBorder(const GFX_IMAGE* psrc, const int32_t sx, const int32_t sy)
-{
-    //convert to fixed points
-    const int32_t lx = sx >> 16;
-    const int32_t ly = sy >> 16;
-
-    //load the 4 neighboring pixels
-    uint32_t pixels[4] = { 0 };
-    pixels[0] = clampPixels(psrc, lx    , ly    );
-    pixels[1] = clampPixels(psrc, lx + 1, ly    );
-    pixels[2] = clampPixels(psrc, lx    , ly + 1);
-    pixels[3] = clampPixels(psrc, lx + 1, ly + 1);
-
-    GFX_IMAGE img = { 0 };
-    img.mData = pixels;
-    img.mWidth = 2;
-    img.mHeight = 2;
-    img.mRowBytes = 8;
-    return bilinearGetPixelCenter(&img, sx & 0xffff, sy & 0xffff);
-}
-
-//bilinear get pixel with FIXED-POINT (signed 16.16)
-//general optimize version, fast speed
-must_inline uint32_t bilinearGetPixelFixed(const GFX_IMAGE* psrc, const int32_t sx, const int32_t sy)
-{
-    //convert to fixed points
-    const int32_t lx = sx >> 16;
-    const int32_t ly = sy >> 16;
-    const uint32_t u = uint8_t((sx & 0xffff) >> 8);
-    const uint32_t v = uint8_t((sy & 0xffff) >> 8);
-
-    //load the 4 neighboring pixels
-    const uint32_t p0 = clampPixels(psrc, lx    , ly    );
-    const uint32_t p1 = clampPixels(psrc, lx + 1, ly    );
-    const uint32_t p2 = clampPixels(psrc, lx    , ly + 1);
-    const uint32_t p3 = clampPixels(psrc, lx + 1, ly + 1);
-
-    //calculate the weights for each pixel
-    const uint32_t w3 = (u * v) >> 8;
-    const uint32_t w2 = u - w3;
-    const uint32_t w1 = v - w3;
-    const uint32_t w0 = 256 - w1 - w2 - w3;
-
-    uint32_t rb = ( p0 & 0x00ff00ff) * w0;
-    uint32_t ag = ((p0 & 0xff00ff00) >> 8) * w0;
-    rb += ( p1 & 0x00ff00ff) * w2;
-    ag += ((p1 & 0xff00ff00) >> 8) * w2;
-    rb += ( p2 & 0x00ff00ff) * w1;
-    ag += ((p2 & 0xff00ff00) >> 8) * w1;
-    rb += ( p3 & 0x00ff00ff) * w3;
-    ag += ((p3 & 0xff00ff00) >> 8) * w3;
-    return (ag & 0xff00ff00) | ((rb & 0xff00ff00) >> 8);
-}
-
-//constant values that will be needed
-static const __m256d CONST_1 = _mm256_set1_pd(1);
-static const __m256d CONST_256 = _mm256_set1_pd(256);
-
-//AVX2 calculate the weights of pixel
-must_inline __m256d calcWeights(const double x, const double y)
-{
-    __m256d ymm0 = _mm256_set1_pd(x);
-    __m256d ymm1 = _mm256_set1_pd(y);
-    __m256d ymm2 = _mm256_unpacklo_pd(ymm0, ymm1);
-
-    ymm0 = _mm256_floor_pd(ymm2);
-    ymm1 = _mm256_sub_pd(ymm2, ymm0);
-    ymm2 = _mm256_sub_pd(CONST_1, ymm1);
-
-    __m256d ymm3 = _mm256_unpacklo_pd(ymm2, ymm1);
-    ymm3 = _mm256_permute4x64_pd(ymm3, _MM_SHUFFLE(1, 0, 1, 0));
-
-    __m256d ymm4 = _mm256_permute2f128_pd(ymm2, ymm1, _MM_SHUFFLE2(16, 1));
-    ymm4 = _mm256_mul_pd(ymm3, ymm4);
-
-    return _mm256_mul_pd(ymm4, CONST_256);
-}
-
-//get pixels bilinear with AVX2
-must_inline uint32_t bilinearGetPixelAVX2(const GFX_IMAGE* psrc, const double x, const double y)
-{
-    //calculate offset at (x,y)
-    const int32_t lx = int32_t(x);
-    const int32_t ly = int32_t(y);
-
-    //clamp 4 neighboring pixels
-    uint32_t pixels[4] = { 0 };
-    pixels[0] = clampPixels(psrc, lx    , ly    );
-    pixels[1] = clampPixels(psrc, lx + 1, ly    );
-    pixels[2] = clampPixels(psrc, lx    , ly + 1);
-    pixels[3] = clampPixels(psrc, lx + 1, ly + 1);
-
-    //load 4 pixels [(x, y),(x + 1, y),(x, y + 1),(x + 1, y + 1)]
-    __m128i p12 = _mm_loadl_epi64((const __m128i*)&pixels[0]);
-    __m128i p34 = _mm_loadl_epi64((const __m128i*)&pixels[2]);
-
-    //convert RGBA RGBA RGBA RGBA to RRRR GGGG BBBB AAAA
-    p12 = _mm_unpacklo_epi8(p12, p34);
-    p34 = _mm_unpackhi_epi64(p12, _mm_setzero_si128());
-    p12 = _mm_unpacklo_epi8(p12, p34);
-
-    //extend to 16bits
-    __m128i rg = _mm_unpacklo_epi8(p12, _mm_setzero_si128());
-    __m128i ba = _mm_unpackhi_epi8(p12, _mm_setzero_si128());
-
-    //convert floating points weights to 16bits integer w4 w3 w2 w1
-    __m128i weight = _mm256_cvtpd_epi32(calcWeights(x, y));
-
-    //make 32bit -> 2 x 16bits
-    weight = _mm_packs_epi32(weight, weight);
-
-    //rg = [w1*r1 + w2*r2 | w3*r3 + w4*r4 | w1*g1 + w2*g2 | w3*g3 + w4*g4]
-    rg = _mm_madd_epi16(rg, weight);
-
-    //ba = [w1*b1 + w2*b2 | w3*b3 + w4*b4 | w1*a1 + w2*a2 | w3*a3 + w4*a4]
-    ba = _mm_madd_epi16(ba, weight);
-
-    //horizontal add that will produce the output values (in 32bit)
-    weight = _mm_hadd_epi32(rg, ba);
-    weight = _mm_srli_epi32(weight, 8);
-
-    //convert 32bit->8bit
-    weight = _mm_packus_epi32(weight, _mm_setzero_si128());
-    weight = _mm_packus_epi16(weight, _mm_setzero_si128());
-    return _mm_cvtsi128_si32(weight);
-}
-
-//calculate sin-cos of an angle (merge sin/cos functions)
-must_inline void sincos(const double angle, double* sina, double* cosa)
-{
-#ifdef _USE_ASM
-    __asm {
-        fld     angle
-        mov     eax, sina
-        mov     edx, cosa
-        fsincos
-        fstp    qword ptr[edx]
-        fstp    qword ptr[eax]
-    }
-#else
-    *sina = sin(angle);
-    *cosa = cos(angle);
-#endif
-}
-
-//bi-cubic helper (this function will be replaced by sin(x)/x for optimize
-must_inline double cubicHermite(const double a, const double b, const double c, const double d, const double fract)
-{
-    const double aa = -a / 2.0 + 1.5 * b - 1.5 * c + d / 2.0;
-    const double bb = a - 2.5 * b + 2.0 * c - d / 2.0;
-    const double cc = -a / 2.0 + c / 2.0;
-    return aa * fract * fract * fract + bb * fract * fract + cc * fract + b;
-}
-
-//calculate function sin(x)/x replacement for cubicHermite
-//so this will add to lookup table for speedup improvement
-must_inline double sinXDivX(const double b)
-{
-    //control constant, i.e: -2,-1,-0.75,-0.5
-    const double ctl = -1;
-    const double x = (b < 0) ? -b : b;
-    const double x2 = x * x, x3 = x2 * x;
-
-    if (x <= 1) return (ctl + 2) * x3 - (ctl + 3) * x2 + 1;
-    else if (x <= 2) return ctl * x3 - (5 * ctl) * x2 + (8 * ctl) * x - (4 * ctl);
-    return 0;
-}
-
-//4 signed 32bits sum of bits of data (simulation for _mm_madd_epi32)
-must_inline int32_t _mm_hsum_epi32(const __m128i val)
-{
-    //_mm_extract_epi32 is slower
-    __m128i result = _mm_add_epi32(val, _mm_srli_si128(val, 8));
-    result = _mm_add_epi32(result, _mm_srli_si128(result, 4));
-    return _mm_cvtsi128_si32(result);
-}
-
-//calculate pixel by bi-cubic interpolation (original version)
-//this is show how to bi-cubic interpolation works, don't use for production
-must_inline uint32_t bicubicGetPixel(const GFX_IMAGE* img, const double sx, const double sy)
-{
-    const int32_t px = int32_t(sx);
-    const double fx = sx - int32_t(sx);
-
-    const int32_t py = int32_t(sy);
-    const double fy = sy - int32_t(sy);
-
-    const uint32_t width = img->mWidth;
-    const uint32_t height = img->mHeight;
-    const uint32_t* psrc = (const uint32_t*)img->mData;
-
-    //clamp 16 pixels at center and border
-    const uint8_t* p00 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py - 1)];
-    const uint8_t* p10 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py - 1)];
-    const uint8_t* p20 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py - 1)];
-    const uint8_t* p30 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py - 1)];
-    const uint8_t* p01 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py    )];
-    const uint8_t* p11 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py    )];
-    const uint8_t* p21 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py    )];
-    const uint8_t* p31 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py    )];
-    const uint8_t* p02 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 1)];
-    const uint8_t* p12 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 1)];
-    const uint8_t* p22 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 1)];
-    const uint8_t* p32 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 1)];
-    const uint8_t* p03 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 2)];
-    const uint8_t* p13 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 2)];
-    const uint8_t* p23 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 2)];
-    const uint8_t* p33 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 2)];
-
-    //mapping destination pointer
-    uint32_t dst = 0;
-    uint8_t* pdst = (uint8_t*)&dst;
-
-    //start interpolate bi-cubically for each pixel channel
-    for (int32_t i = 0; i < 4; i++)
-    {
-        const double col0 = cubicHermite(p00[i], p10[i], p20[i], p30[i], fx);
-        const double col1 = cubicHermite(p01[i], p11[i], p21[i], p31[i], fx);
-        const double col2 = cubicHermite(p02[i], p12[i], p22[i], p32[i], fx);
-        const double col3 = cubicHermite(p03[i], p13[i], p23[i], p33[i], fx);
-        const double pcol = cubicHermite(col0, col1, col2, col3, fy);
-
-        //saturation check
-        pdst[i] = uint8_t(clamp(pcol, 0.0, 255.0));
-    }
-
-    return dst;
-}
-
-//this calculate pixel with boundary so quite slowly (using fixed points)
-must_inline uint32_t bicubicGetPixelFixed(const GFX_IMAGE* img, const int16_t *sintab, const int32_t sx, const int32_t sy)
-{
-    //peek offset at (px,py)
-    const int32_t px = sx >> 16, py = sy >> 16;
-
-    const uint32_t width = img->mWidth;
-    const uint32_t height = img->mHeight;
-    const uint32_t* psrc = (const uint32_t*)img->mData;
-
-    //calculate 16 around pixels
-    const uint8_t *p00 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py - 1)];
-    const uint8_t *p01 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py - 1)];
-    const uint8_t *p02 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py - 1)];
-    const uint8_t *p03 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py - 1)];
-    const uint8_t *p10 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py    )];
-    const uint8_t *p11 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py    )];
-    const uint8_t *p12 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py    )];
-    const uint8_t *p13 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py    )];
-    const uint8_t *p20 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 1)];
-    const uint8_t *p21 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 1)];
-    const uint8_t *p22 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 1)];
-    const uint8_t *p23 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 1)];
-    const uint8_t *p30 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 2)];
-    const uint8_t *p31 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 2)];
-    const uint8_t *p32 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 2)];
-    const uint8_t *p33 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 2)];
-
-    //4 pixels weights
-    const int32_t u = uint8_t(sx >> 8), v = uint8_t(sy >> 8);
-    const int32_t u0 = sintab[256 + u], u1 = sintab[u];
-    const int32_t u2 = sintab[256 - u], u3 = sintab[512 - u];
-    const int32_t v0 = sintab[256 + v], v1 = sintab[v];
-    const int32_t v2 = sintab[256 - v], v3 = sintab[512 - v];
-
-    uint32_t color = 0;
-    uint8_t* pcol = (uint8_t*)&color;
-
-    //a,r,g,b channel
-    for (int32_t i = 0; i < 4; i++)
-    {
-        const int32_t s1 = (p00[i] * u0 + p01[i] * u1 + p02[i] * u2 + p03[i] * u3) * v0;
-        const int32_t s2 = (p10[i] * u0 + p11[i] * u1 + p12[i] * u2 + p13[i] * u3) * v1;
-        const int32_t s3 = (p20[i] * u0 + p21[i] * u1 + p22[i] * u2 + p23[i] * u3) * v2;
-        const int32_t s4 = (p30[i] * u0 + p31[i] * u1 + p32[i] * u2 + p33[i] * u3) * v3;
-        pcol[i] = clamp((s1 + s2 + s3 + s4) >> 16, 0, 255);
-    }
-
-    return color;
-}
-
-//fast calculate pixel at center, don't care boundary
-must_inline uint32_t bicubicGetPixelCenter(const GFX_IMAGE* img, const int16_t* stable, const int32_t sx, const int32_t sy)
-{
-    const int32_t pu = uint8_t(sx >> 8), pv = uint8_t(sy >> 8);
-    const int16_t u0 = stable[256 + pu], u1 = stable[pu];
-    const int16_t u2 = stable[256 - pu], u3 = stable[512 - pu];
-
-    const __m128i xpart = _mm_setr_epi16(u0, u1, u2, u3, u0, u1, u2, u3); //U0 U1 U2 U3 U0 U1 U2 U3
-    const __m128i ypart = _mm_setr_epi32(stable[256 + pv], stable[pv], stable[256 - pv], stable[512 - pv]);
-
-    const uint32_t* psrc = (const uint32_t*)img->mData;
-    const uint32_t *pixel0 = (const uint32_t*)&psrc[((sy >> 16) - 1) * img->mWidth + ((sx >> 16) - 1)];
-    const uint32_t *pixel1 = &pixel0[img->mWidth];
-    const uint32_t *pixel2 = &pixel1[img->mWidth];
-    const uint32_t *pixel3 = &pixel2[img->mWidth];
-
-    //load 16 pixels for calculation
-    __m128i p0 = _mm_lddqu_si128((const __m128i*)pixel0); //P00 P01 P02 P03
-    __m128i p1 = _mm_lddqu_si128((const __m128i*)pixel1); //P10 P11 P12 P13
-    __m128i p2 = _mm_lddqu_si128((const __m128i*)pixel2); //P20 P21 P22 P23
-    __m128i p3 = _mm_lddqu_si128((const __m128i*)pixel3); //P30 P31 P32 P33
-
-    p0 = _mm_shuffle_epi8(p0, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B0 G0 R0 A0
-    p1 = _mm_shuffle_epi8(p1, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B1 G1 R1 A1
-    p2 = _mm_shuffle_epi8(p2, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B2 G2 R2 A2
-    p3 = _mm_shuffle_epi8(p3, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B3 G3 R3 A3
-
-    const __m128i bg01 = _mm_unpacklo_epi32(p0, p1); //B0 B1 G0 G1
-    const __m128i ra01 = _mm_unpackhi_epi32(p0, p1); //R0 R1 A0 A1
-    const __m128i bg23 = _mm_unpacklo_epi32(p2, p3); //B2 B3 G2 G3
-    const __m128i ra23 = _mm_unpackhi_epi32(p2, p3); //R2 R3 A2 A3
-
-    const __m128i b01 = _mm_unpacklo_epi8(bg01, _mm_setzero_si128());
-    const __m128i b23 = _mm_unpacklo_epi8(bg23, _mm_setzero_si128());
-
-    //P00 * U0 + P01 * U1 + P02 * U2 + P03 * U3
-    const __m128i sb = _mm_hadd_epi32(_mm_madd_epi16(b01, xpart), _mm_madd_epi16(b23, xpart));
-
-    const __m128i g01 = _mm_unpackhi_epi8(bg01, _mm_setzero_si128());
-    const __m128i g23 = _mm_unpackhi_epi8(bg23, _mm_setzero_si128());
-
-    //P10 * U0 + P11 * U1 + P12 * U2 + P13 * U3
-    const __m128i sg = _mm_hadd_epi32(_mm_madd_epi16(g01, xpart), _mm_madd_epi16(g23, xpart));
-
-    const __m128i r01 = _mm_unpacklo_epi8(ra01, _mm_setzero_si128());
-    const __m128i r23 = _mm_unpacklo_epi8(ra23, _mm_setzero_si128());
-
-    //P20 * U0 + P21 * U1 + P22 * U2 + P23 * U3
-    const __m128i sr = _mm_hadd_epi32(_mm_madd_epi16(r01, xpart), _mm_madd_epi16(r23, xpart));
-
-    const __m128i a01 = _mm_unpackhi_epi8(ra01, _mm_setzero_si128());
-    const __m128i a23 = _mm_unpackhi_epi8(ra23, _mm_setzero_si128());
-
-    //P30 * U0 + P31 * U1 + P32 * U2 + P33 * U3
-    const __m128i sa = _mm_hadd_epi32(_mm_madd_epi16(a01, xpart), _mm_madd_epi16(a23, xpart));
-
-    //P00 * U0 + P01 * U1 + P02 * U2 + P03 * U3 
-    //P10 * U0 + P11 * U1 + P12 * U2 + P13 * U3 
-    //P20 * U0 + P21 * U1 + P22 * U2 + P23 * U3 
-    //P30 * U0 + P31 * U1 + P32 * U2 + P33 * U3 
-    __m128i result = _mm_setr_epi32(
-        _mm_hsum_epi32(_mm_mullo_epi32(sb, ypart)), //SB * V0
-        _mm_hsum_epi32(_mm_mullo_epi32(sg, ypart)), //SG * V1
-        _mm_hsum_epi32(_mm_mullo_epi32(sr, ypart)), //SR * V2
-        _mm_hsum_epi32(_mm_mullo_epi32(sa, ypart))  //SA * V3
-    );
-
-    //SUM >> 16
-    result = _mm_srai_epi32(result, 16);
-
-    //CLAMP 0, 255
-    return _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(result, result), result));
-}
-
-//this calculate pixel with boundary so quite slowly
-must_inline uint32_t bicubicGetPixelBorder(const GFX_IMAGE* img, const int16_t *sintab, const int32_t sx, const int32_t sy)
-{
-    //peek offset at (px,py)
-    const int32_t px = (sx >> 16) - 1, py = (sy >> 16) - 1;
-
-    //calculate 16 pixels start (px-1, py-1), (px+2, py+2)
-    uint32_t pixels[16] = { 0 };
-    for (int32_t i = 0; i < 4; i++)
-    {
-        const int32_t y = py + i;
-        for (int32_t j = 0; j < 4; j++)
-        {
-            const int32_t x = px + j;
-            pixels[(i << 2) + j] = clampPixels(img, x, y);
-        }
-    }
-
-    //construct matrix 16x16 pixels data
-    GFX_IMAGE mpic = { 0 };
-    mpic.mData = pixels;
-    mpic.mWidth = 4;
-    mpic.mHeight = 4;
-    mpic.mRowBytes = 16;
-
-    //optimize function
-    return bicubicGetPixelCenter(&mpic, sintab, (sx & 0xffff) + 0x10000, (sy & 0xffff) + 0x10000);
-}
-
-//smooth scaling with Bresenham (internal function)
-//because of several simplifications of the algorithm,
-//the zoom range is restricted between 0.5 and 2. That
-//is: dstwidth must be >= srcwidth/2 and <= 2*srcwidth.
-//smooth is used to calculate average pixel and mid-points
-void scaleLineMix(uint8_t* dst, uint8_t* src, int32_t dw, int32_t sw, int32_t type)
-{
-    if (type == INTERPOLATION_TYPE_SMOOTH)
-    {
-#ifdef _USE_ASM
-        uint16_t val = 0;
-        __asm {
-            mov     ebx, dw
-            mov     eax, dw
-            cmp     eax, sw
-            jna     start
-            dec     ebx
-        start:
-            mov     esi, src
-            mov     edi, dst
-            mov     ecx, ebx
-            xor     ebx, ebx
-            mov     edx, dw
-            shr     edx, 1
-        next:
-            cmp     ebx, edx
-            jnae    done
-            mov     al, [esi]
-            mov     val, ax
-            mov     al, [esi + 1]
-            add     ax, val
-            shr     ax, 1
-            stosb
-            jmp     skip
-        done:
-            mov     al, [esi]
-            stosb
-        skip:
-            add     ebx, sw
-            cmp     ebx, dw
-            jnae    cycle
-            sub     ebx, dw
-            inc     esi
-        cycle:
-            dec     ecx
-            jnz     next
-            mov     eax, dw
-            cmp     eax, sw
-            jna     end
-            movsb
-        end:
-        }
-#else
-        int32_t error = 0;
-        int32_t numPixels = dw;
-        const int32_t midPixel = dw >> 1;
-
-        if (dw > sw) numPixels--;
-        while (numPixels-- > 0)
-        {
-            if (error >= midPixel) *dst++ = (*src + *(src + 1)) >> 1;
-            else *dst++ = *src;
-            error += sw;
-            if (error >= dw)
-            {
-                error -= dw;
-                src++;
-            }
-        }
-        if (dw > sw) *dst = *src;
-#endif
-    }
-    else if (type == INTERPOLATION_TYPE_NEAREST)
-    {
-#ifdef _USE_ASM
-        __asm {
-            xor     edx, edx
-            mov     esi, src
-            mov     edi, dst
-            mov     eax, sw
-            mov     ebx, dw
-            div     ebx
-            xor     ebx, ebx
-            mov     ecx, dw
-        next1:
-            movsb
-            dec     esi
-            add     esi, eax
-            add     ebx, edx
-            cmp     ebx, dw
-            jnae    done1
-            sub     ebx, dw
-            inc     esi
-        done1:
-            dec     ecx
-            jnz     next1
-        }
-#else
-        int32_t error = 0;
-        int32_t numPixels = dw;
-        const int32_t intPart = sw / dw;
-        const int32_t fractPart = sw % dw;
-        
-        while (numPixels-- > 0)
-        {
-            *dst++ = *src;
-            src += intPart;
-            error += fractPart;
-            if (error >= dw)
-            {
-                error -= dw;
-                src++;
-            }
-        }
-#endif
-    }
-    else
-    {
-        messageBox(GFX_ERROR, "Unknown interpolation type!");
-        return;
-    }
-}
-
-//Bresenham scale line with rgb color
-void scaleLineNormal(uint32_t* dst, uint32_t* src, int32_t dw, int32_t sw, int32_t type)
-{
-    if (type == INTERPOLATION_TYPE_SMOOTH)
-    {
-#ifdef _USE_ASM
-        uint16_t val = 0;
-        __asm {
-            mov     ebx, dw
-            mov     eax, dw
-            cmp     eax, sw
-            jna     start
-            dec     ebx
-        start:
-            mov     esi, src
-            mov     edi, dst
-            mov     ecx, ebx
-            xor     ebx, ebx
-            mov     edx, dw
-            shr     edx, 1
-        next:
-            cmp     ebx, edx
-            jnae    done
-            mov     al, [esi]
-            mov     val, ax
-            mov     al, [esi + 4]
-            add     ax, val
-            shr     ax, 1
-            stosb
-            mov     al, [esi + 1]
-            mov     val, ax
-            mov     al, [esi + 5]
-            add     ax, val
-            shr     ax, 1
-            stosb
-            mov     al, [esi + 2]
-            mov     val, ax
-            mov     al, [esi + 6]
-            add     ax, val
-            shr     ax, 1
-            stosb
-            inc     edi
-            jmp     skip
-        done:
-            mov     eax, [esi]
-            stosd
-        skip:
-            add     ebx, sw
-            cmp     ebx, dw
-            jnae    cycle
-            sub     ebx, dw
-            add     esi, 4
-        cycle:
-            dec     ecx
-            jnz     next
-            mov     eax, dw
-            cmp     eax, sw
-            jna     end
-            movsd
-        end:
-        }
-#else
-        int32_t error = 0;
-        int32_t numPixels = dw;
-        const int32_t midPixel = dw >> 1;
-        
-        if (dw > sw) numPixels--;
-
-        while (numPixels-- > 0)
-        {
-            //copy source pixel to destination pixel
-            if (error < midPixel) *dst = *src;
-            else
-            {
-                //calculate average pixel pd = (p0 + p1) / 2
-                ARGB* pd = (ARGB*)dst;
-                const ARGB* p0 = (ARGB*)src;
-                const ARGB* p1 = (ARGB*)&src[1];
-                pd->r = (p0->r + p1->r) >> 1;
-                pd->g = (p0->g + p1->g) >> 1;
-                pd->b = (p0->b + p1->b) >> 1;
-            }
-
-            dst++;
-            error += sw;
-
-            if (error >= dw)
-            {
-                error -= dw;
-                src++;
-            }
-        }
-
-        if (dw > sw) *dst = *src;
-#endif
-    }
-    else if (type == INTERPOLATION_TYPE_NEAREST)
-    {
-#ifdef _USE_ASM
-        __asm {
-            xor     edx, edx
-            mov     esi, src
-            mov     edi, dst
-            mov     eax, sw
-            mov     ebx, dw
-            div     ebx
-            shl     eax, 2
-            xor     ebx, ebx
-            mov     ecx, dw
-        begin:
-            movsd
-            sub     esi, 4
-            add     esi, eax
-            add     ebx, edx
-            cmp     ebx, dw
-            jnae    step
-            sub     ebx, dw
-            add     esi, 4
-        step:
-            dec     ecx
-            jnz     begin
-        }        
-#else
-        int32_t error = 0;
-        int32_t numPixels = dw;
-        const int32_t intPart = sw / dw;
-        const int32_t fractPart = sw % dw;
-        
-        while (numPixels-- > 0)
-        {
-            *dst++ = *src;
-            src += intPart;
-            error += fractPart;
-            if (error >= dw)
-            {
-                error -= dw;
-                src++;
-            }
-        }
-#endif
-    }
-    else
-    {
-        messageBox(GFX_ERROR, "Unknown interpolation type!");
-        return;
-    }
-}
-
-//Bresenham scale image buffer
-void scaleImageMix(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t mode)
-{
-#ifdef _USE_ASM
-    //save local value
-    const uint32_t dstWidth  = dst->mWidth;
-    const uint32_t srcWidth  = src->mWidth;
-    const uint32_t dstHeight = dst->mHeight;
-    const uint32_t srcHeight = src->mHeight;
-
-    uint32_t intp = 0, modp = 0;
-
-    //make pointer to call in asm mode
-    void *copier = memcpy;
-    void *scaler = scaleLineMix;
-
-    //save local address
-    void *oldPtr = NULL;
-    void *dstPtr = dst->mData;
-    void *srcPtr = src->mData;
-
-    __asm {
-        mov     edi, dstPtr
-        mov     esi, srcPtr
-        xor     edx, edx
-        mov     eax, srcHeight
-        div     dstHeight
-        mov     modp, edx
-        mul     srcWidth
-        mov     intp, eax
-        xor     ebx, ebx
-        mov     ecx, dstHeight
-    next:
-        push    ecx
-        cmp     esi, oldPtr
-        jne     skip
-        mov     eax, edi
-        sub     eax, dstWidth
-        push    dstWidth
-        push    eax
-        push    edi
-        call    copier
-        add     esp, 12
-        jmp     done
-    skip:
-        mov     edx, mode
-        and     edx, 0Fh
-        push    edx
-        push    srcWidth
-        push    dstWidth
-        push    esi
-        push    edi
-        call    scaler
-        add     esp, 20
-        mov     oldPtr, esi
-    done:
-        add     edi, dstWidth
-        add     esi, intp
-        add     ebx, modp
-        cmp     ebx, dstHeight
-        jnae    cycle
-        sub     ebx, dstHeight
-        add     esi, srcWidth
-    cycle:
-        pop     ecx
-        dec     ecx
-        jnz     next
-    }
-#else    
-    int32_t error = 0;
-    int32_t numPixels = dst->mHeight;
-    const int32_t intPart = (src->mHeight / dst->mHeight) * src->mWidth;
-    const int32_t fractPart = src->mHeight % dst->mHeight;
-    
-    uint8_t* srcPrev = NULL;
-    uint8_t* srcPtr = (uint8_t*)src->mData;
-    uint8_t* dstPtr = (uint8_t*)dst->mData;
-
-    while (numPixels-- > 0)
-    {
-        if (srcPtr == srcPrev)
-        {
-            memcpy(dstPtr, dstPtr - dst->mWidth, dst->mWidth * sizeof(dstPtr[0]));
-        }
-        else
-        {
-            scaleLineMix(dstPtr, srcPtr, dst->mWidth, src->mWidth, mode);
-            srcPrev = srcPtr;
-        }
-
-        dstPtr += dst->mWidth;
-        srcPtr += intPart;
-        error += fractPart;
-
-        if (error >= dst->mHeight)
-        {
-            error -= dst->mHeight;
-            srcPtr += src->mWidth;
-        }
-    }
-#endif
-}
-
-//Bresenham scale line with rgb color
-void scaleLine(void* dst, void* src, int32_t dw, int32_t sw, int32_t type)
-{
-    //mixed mode
-    if (bitsPerPixel == 8)
-    {
-        scaleLineMix((uint8_t*)dst, (uint8_t*)src, dw, sw, type);
-        return;
-    }
-
-    //height color mode
-    scaleLineNormal((uint32_t*)dst, (uint32_t*)src, dw, sw, type);
-}
-
-//Bresenham scale image buffer
-void scaleImageNormal(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t mode)
-{
-#ifdef _USE_ASM
-    //save local value
-    const uint32_t dstWidth  = dst->mWidth;
-    const uint32_t srcWidth  = src->mWidth;
-    const uint32_t dstHeight = dst->mHeight;
-    const uint32_t srcHeight = src->mHeight;
-
-    uint32_t dsi = 0, ddi = 0;
-    uint32_t intp = 0, modp = 0;
-
-    //make pointer to call in asm mode
-    void *copier = memcpy;
-    void *scaler = scaleLine;
-
-    //save local address
-    void *oldPtr = NULL;
-    void *dstPtr = dst->mData;
-    void *srcPtr = src->mData;
-
-    __asm {
-        mov     edi, dstPtr
-        mov     esi, srcPtr
-        xor     edx, edx
-        mov     eax, srcHeight
-        div     dstHeight
-        mov     modp, edx
-        mul     srcWidth
-        shl     eax, 2
-        mov     intp, eax
-        mov     eax, dstWidth
-        shl     eax, 2
-        mov     ddi, eax
-        mov     eax, srcWidth
-        shl     eax, 2
-        mov     dsi, eax
-        xor     ebx, ebx
-        mov     ecx, dstHeight
-    next:
-        push    ecx
-        cmp     esi, oldPtr
-        jne     skip
-        mov     eax, edi
-        sub     eax, ddi
-        push    ddi
-        push    eax
-        push    edi
-        call    copier
-        add     esp, 12
-        jmp     done
-    skip:
-        push    mode
-        push    srcWidth
-        push    dstWidth
-        push    esi
-        push    edi
-        call    scaler
-        add     esp, 20
-        mov     oldPtr, esi
-    done:
-        add     edi, ddi
-        add     esi, intp
-        add     ebx, modp
-        cmp     ebx, dstHeight
-        jnae    cycle
-        sub     ebx, dstHeight
-        add     esi, dsi
-    cycle:
-        pop     ecx
-        dec     ecx
-        jnz     next
-    }
-#else    
-    int32_t error = 0;
-    int32_t numPixels = dst->mHeight;
-    const int32_t intPart = (src->mHeight / dst->mHeight) * src->mWidth;
-    const int32_t fractPart = src->mHeight % dst->mHeight;
-    
-    uint32_t* srcPrev = NULL;
-    uint32_t* srcPtr = (uint32_t*)src->mData;
-    uint32_t* dstPtr = (uint32_t*)dst->mData;
-
-    while (numPixels-- > 0)
-    {
-        if (srcPtr == srcPrev)
-        {
-            memcpy(dstPtr, dstPtr - dst->mWidth, dst->mWidth * sizeof(dstPtr[0]));
-        }
-        else
-        {
-            scaleLine(dstPtr, srcPtr, dst->mWidth, src->mWidth, mode);
-            srcPrev = srcPtr;
-        }
-
-        dstPtr += dst->mWidth;
-        srcPtr += intPart;
-        error += fractPart;
-
-        if (error >= dst->mHeight)
-        {
-            error -= dst->mHeight;
-            srcPtr += src->mWidth;
-        }
-    }
-#endif
-}
-
-//nearest neighbor image scaling (using fixed-points)
-void nearestScaleImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //mapping pointer
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    const uint32_t* psrc = (const uint32_t*)src->mData;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-
-    //calculate scale ratio
-    const int32_t scalex = (srcw << 16) / dstw + 1;
-    const int32_t scaley = (srch << 16) / dsth + 1;
-    
-    //very slow loop
-    int32_t sy = 0;
-    for (int32_t y = 0; y < dsth; y++, sy += scaley)
-    {
-        int32_t sx = 0;
-        const uint32_t* msrc = &psrc[(sy >> 16) * srcw];
-        for (int32_t x = 0; x < dstw; x++, sx += scalex) *pdst++ = msrc[sx >> 16];
-    }
-}
-
-//average pixels (smooth) image scaling (using fixed-points)
-void smoothScaleImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //mapping pointer
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-
-    //calculate scale ratio
-    const int32_t scalex = (srcw << 16) / dstw + 1;
-    const int32_t scaley = (srch << 16) / dsth + 1;
-    const int32_t errorx = (scalex >> 1) - 32768;
-    const int32_t errory = (scaley >> 1) - 32768;
-
-    //very slow loop
-    for (int32_t y = 0, sy = errory; y < dsth; y++, sy += scaley)
-    {
-        for (int32_t x = 0, sx = errorx; x < dstw; x++, sx += scalex) *pdst++ = smoothGetPixel(src, sx, sy);
-    }
-}
-
-//bilinear scale image with fixed-points
-void bilinearScaleImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //mapping pointer
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-
-    //calculate scale ratio
-    const int32_t scalex = (srcw << 16) / dstw + 1;
-    const int32_t scaley = (srch << 16) / dsth + 1;
-    const int32_t errorx = (scalex >> 1) - 32768;
-    const int32_t errory = (scaley >> 1) - 32768;
-
-    //very slow loop
-    for (int32_t y = 0, sy = errory; y < dsth; y++, sy += scaley)
-    {
-        for (int32_t x = 0, sx = errorx; x < dstw; x++, sx += scalex) *pdst++ = bilinearGetPixelFixed(src, sx, sy);
-    }
-}
-
-//maximize optimize version (extremely fast)
-//using sticks:
-//1. FIXED-POINT
-//2. separate inbound and outbound pixels calculation
-//3. SSE2 instructions
-void bilinearScaleImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cache local data pointer
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-    const int32_t scalex = (srcw << 16) / dstw + 1;
-    const int32_t scaley = (srch << 16) / dsth + 1;
-    const int32_t errorx = (scalex >> 1) - 32768;
-    const int32_t errory = (scaley >> 1) - 32768;
-
-    int32_t startx = (65536 - errorx) / scalex + 1;
-    if (startx >= dstw) startx = dstw;
-
-    int32_t starty = (65536 - errory) / scaley + 1;
-    if (starty >= dsth) starty = dsth;
-
-    int32_t endx = (((srcw - 2) << 16) - errorx) / scalex + 1;
-    if (endx < startx) endx = startx;
-
-    int32_t endy = (((srch - 2) << 16) - errory) / scaley + 1;
-    if (endy < starty) endy = starty;
-
-    int32_t srcy = errory;
-    for (int32_t y = 0; y < starty; y++, srcy += scaley)
-    {
-        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += scalex) *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
-    }
-
-    for (int32_t y = starty; y < endy; y++, srcy += scaley)
-    {
-        int32_t srcx = errorx;
-        for (int32_t x = 0; x < startx; x++, srcx += scalex)    *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
-        for (int32_t x = startx; x < endx; x++, srcx += scalex) *pdst++ = bilinearGetPixelCenter(src, srcx, srcy);
-        for (int32_t x = endx; x < dstw; x++, srcx += scalex)   *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
-    }
-
-    for (int32_t y = endy; y < dsth; y++, srcy += scaley)
-    {
-        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += scalex) *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
-    }
-}
-
-//normal optimize version (very fast)
-//use hardware acceleration with AVX2, seem no faster than FIXED-POINT
-//benchmark for 5000 iterations
-//CPU: Intel(R) Core(TM) i7-4770K CPU @ 3.50GHz
-//RAM: 32GB
-//OS: Windows 10 Pro x64
-//Compiler: VC++ 2019
-//x64 release build
-//FIXED-POINT: about 8.649s
-//AVX2: about 8.617s --> no much faster than FIXED-POINT
-//x32 release build
-//FIXED-POINT: about 14.658s
-//AVX2: about 9.043s --> seem faster than FIXED-POINT
-//use hardware acceleration will get constantly speed
-//in modern system (64bits) integer will be operated fastest
-void bilinearScaleImageAVX2(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cache local data pointer
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    //cache local dimension
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-
-    //calculate ratio
-    const double xratio = double(intmax_t(srcw) - 1) / dstw;
-    const double yratio = double(intmax_t(srch) - 1) / dsth;
-
-    //very slow loop
-    for (int32_t y = 0; y < dsth; y++)
-    {
-        const double sy = y * yratio;
-        for (int32_t x = 0; x < dstw; x++)
-        {
-            const double sx = x * xratio;
-            *pdst++ = bilinearGetPixelAVX2(src, sx, sy);
-        }
-    }
-}
-
-//bi-cubic scale image
-//original version, very slow
-//this is show bi-cubic interpolation only, don't use in production
-void bicubicScaleImage(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cache local data pointer
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    //cache local dimension
-    const int32_t swidth = src->mWidth;
-    const int32_t sheight = src->mHeight;
-    const int32_t dwidth = dst->mWidth;
-    const int32_t dheight = dst->mHeight;
-
-    //calculate ratio
-    const double xratio = double(intmax_t(swidth) - 1) / dwidth;
-    const double yratio = double(intmax_t(sheight) - 1) / dheight;
-
-    //very slow loop
-    for (int32_t y = 0; y < dheight; y++)
-    {
-        const double sy = y * yratio;
-        for (int32_t x = 0; x < dwidth; x++)
-        {
-            const double sx = x * xratio;
-            *pdst++ = bicubicGetPixel(src, sx, sy);
-        }
-    }
-}
-
-//maximize optimized version (extremely fast)
-//the tricks we're used:
-//1. lookup table
-//2. fixed-points
-//3. SSE2 instructions
-//4. separate calculate pixels (inbound and outbound)
-void bicubicScaleImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-    
-    const int32_t addx = (srcw << 16) / dstw + 1;
-    const int32_t addy = (srch << 16) / dsth + 1;
-    const int32_t errorx = (addx >> 1) - 32768;
-    const int32_t errory = (addy >> 1) - 32768;
-
-    int16_t stable[513] = { 0 };
-    for (int32_t i = 0; i < 513; i++) stable[i] = fround(256.0 * sinXDivX(i / 256.0));
-
-    int32_t sx = (65536 - errorx) / addx + 1;
-    if (sx >= dstw) sx = dstw;
-    int32_t sy = (65536 - errory) / addy + 1;
-    if (sy >= dsth) sy = dsth;
-    int32_t ex = (((srcw - 3) << 16) - errorx) / addx + 1;
-    if (ex < sx) ex = sx;
-    int32_t ey = (((srch - 3) << 16) - errory) / addy + 1;
-    if (ey < sy) ey = sy;
-
-    int32_t srcy = errory;
-    for (int32_t y = 0; y < sy; y++, srcy += addy)
-    {
-        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += addx) *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
-    }
-
-    for (int32_t y = sy; y < ey; y++, srcy += addy)
-    {
-        int32_t srcx = errorx;
-        for (int32_t x = 0; x < sx; x++, srcx += addx)      *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
-        for (int32_t x = sx; x < ex; x++, srcx += addx)     *pdst++ = bicubicGetPixelCenter(src, stable, srcx, srcy);
-        for (int32_t x = ex; x < dstw; x++, srcx += addx)   *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
-    }
-
-    for (int32_t y = ey; y < dsth; y++, srcy += addy)
-    {
-        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += addx) *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
-    }
-}
-
-//nearest neighbor image rotation for mixed mode (optimize version using FIXED-POINT)
-void rotateImageMix(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel != 8) return;
-
-    //cast to image data
-    uint8_t* pdst = (uint8_t*)dst->mData;
-    const uint8_t* psrc = (const uint8_t*)src->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dcx = dstw >> 1;
-    const int32_t dsth = dst->mHeight;
-    const int32_t dcy = dsth >> 1;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t scx = srcw << 15;
-    const int32_t srch = src->mHeight;
-    const int32_t scy = srch << 15;
-    const int32_t scw = (srcw - 1) << 16;
-    const int32_t sch = (srch - 1) << 16;
-
-    const double alpha = (angle * M_PI) / 180;
-    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
-    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
-
-    int32_t xs = scx - (dcx * dy + dcy * dx);
-    int32_t ys = scy - (dcy * dy - dcx * dx);
-
-    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
-    {
-        uint8_t* pline = pdst;
-        int32_t sx = xs, sy = ys;
-        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
-        {
-            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = psrc[(sy >> 16) * srcw + (sx >> 16)];
-            pline++;
-        }
-    }
-}
-
-//nearest neighbor pixel image rotation (optimize version using FIXED-POINT)
-void nearestRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cast to image data
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    const uint32_t* psrc = (const uint32_t*)src->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dcx = dstw >> 1;
-    const int32_t dsth = dst->mHeight;
-    const int32_t dcy = dsth >> 1;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t scx = srcw << 15;
-    const int32_t srch = src->mHeight;
-    const int32_t scy = srch << 15;
-    const int32_t scw = (srcw - 1) << 16;
-    const int32_t sch = (srch - 1) << 16;
-
-    const double alpha = (angle * M_PI) / 180;
-    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
-    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
-
-    int32_t xs = scx - (dcx * dy + dcy * dx);
-    int32_t ys = scy - (dcy * dy - dcx * dx);
-
-    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
-    {
-        int32_t sx = xs, sy = ys;
-        uint32_t* pline = pdst;
-        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
-        {
-            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = psrc[(sy >> 16) * srcw + (sx >> 16)];
-            pline++;
-        }
-    }
-}
-
-//average (smooth) pixel image rotation (optimize version using FIXED-POINT)
-void smoothRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cast to image data
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dcx = dstw >> 1;
-    const int32_t dsth = dst->mHeight;
-    const int32_t dcy = dsth >> 1;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t scx = srcw << 15;
-    const int32_t srch = src->mHeight;
-    const int32_t scy = srch << 15;
-    const int32_t scw = (srcw - 1) << 16;
-    const int32_t sch = (srch - 1) << 16;
-
-    const double alpha = (angle * M_PI) / 180;
-    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
-    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
-
-    int32_t xs = scx - (dcx * dy + dcy * dx);
-    int32_t ys = scy - (dcy * dy - dcx * dx);
-
-    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
-    {
-        int32_t sx = xs, sy = ys;
-        uint32_t* pline = pdst;
-        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
-        {
-            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = smoothGetPixel(src, sx, sy);
-            pline++;
-        }
-    }
-}
-
-//use hardware acceleration with AVX2, seem no faster than FIXED-POINT
-//benchmark for 5000 iterations
-//CPU: Intel(R) Core(TM) i7-4770K CPU @ 3.50GHz
-//RAM: 32GB
-//OS: Windows 10 Pro x64
-//Compiler: VC++ 2019
-//x64 release build
-//FIXED-POINT: about 9.486s
-//AVX2: about 10.250s --> no faster than FIXED-POINT
-//x32 release build
-//FIXED-POINT: about 14.768s
-//AVX2: about 10.422s --> seem faster than FIXED-POINT
-//use hardware acceleration will get constantly speed
-//in modern system (64bits) integer will be operated fastest
-void bilinearRotateImageAVX2(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cast to image data
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dcx = dstw >> 1;
-    const int32_t dsth = dst->mHeight;
-    const int32_t dcy = dsth >> 1;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t scx = srcw >> 1;
-    const int32_t srch = src->mHeight;
-    const int32_t scy = srch >> 1;
-
-    const double alpha = (angle * M_PI) / 180;
-    const double dx = sin(alpha) / scalex;
-    const double dy = cos(alpha) / scaley;
-
-    double xs = scx - (dcx * dy + dcy * dx);
-    double ys = scy - (dcy * dy - dcx * dx);
-
-    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
-    {
-        double sx = xs, sy = ys;
-        uint32_t* pline = pdst;
-        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
-        {
-            if (sx >= 0 && sy >= 0 && sx < srcw && sy < srch) *pline = bilinearGetPixelAVX2(src, sx, sy);
-            pline++;
-        }
-    }
-}
-
-//bilinear image rotation (single optimize version)
-//this version will faster than SSE2 version, in modern CPU, operating
-//on integer will always give lower cost because it aligned memory
-void bilinearRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cast to image data
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dcx = dstw >> 1;
-    const int32_t dsth = dst->mHeight;
-    const int32_t dcy = dsth >> 1;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t scx = srcw << 15;
-    const int32_t srch = src->mHeight;
-    const int32_t scy = srch << 15;
-
-    const int32_t scw = (srcw - 1) << 16;
-    const int32_t sch = (srch - 1) << 16;
-
-    const double alpha = (angle * M_PI) / 180;
-    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
-    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
-
-    int32_t xs = scx - (dcx * dy + dcy * dx);
-    int32_t ys = scy - (dcy * dy - dcx * dx);
-
-    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
-    {
-        int32_t sx = xs, sy = ys;
-        uint32_t* pline = pdst;
-        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
-        {
-            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = bilinearGetPixelFixed(src, sx, sy);
-            pline++;
-        }
-    }
-}
-
-//bilinear rotate scan line (sub-routine of full optimize version)
-//improve smooth border when rotating will make image look better
-void bilinearRotateLine(uint32_t* pdst, const int32_t boundx0, const int32_t inx0, const int32_t inx1, const int32_t boundx1, const GFX_IMAGE* psrc, int32_t sx, int32_t sy, const int32_t addx, const int32_t addy)
-{
-    int32_t x = 0;
-    for (x = boundx0; x < inx0; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bilinearGetPixelBorder(psrc, sx, sy));
-    for (x = inx0; x < inx1; x++, sx += addx, sy += addy)       pdst[x] = bilinearGetPixelCenter(psrc, sx, sy);
-    for (x = inx1; x < boundx1; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bilinearGetPixelBorder(psrc, sx, sy));
-}
-
-//maximize optimize version (extremely fast)
-//use sticks:
-//1. fixed-points
-//2. separate inbound and outbound pixel calculation
-//3. SSE2 instructions
-//4. clipping data
-void bilinearRotateImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    const double scalexy = 1.0 / (scalex * scaley);  
-    const double rscalex = scalexy * scaley;
-    const double rscaley = scalexy * scalex;
-
-    double sina = 0, cosa = 0;
-    sincos(-(angle * M_PI) / 180, &sina, &cosa);
-    const int32_t sini = fround(sina * 65536); //convert to fixed points (no truncated)
-    const int32_t cosi = fround(cosa * 65536); //convert to fixed points (no truncated)
-
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    
-    const int32_t ax = int32_t(rscalex * cosi);
-    const int32_t ay = int32_t(rscalex * sini);
-    const int32_t bx = int32_t(-rscaley * sini);
-    const int32_t by = int32_t(rscaley * cosi);
-
-    const int32_t dcx = dstw >> 1;
-    const int32_t dcy = dsth >> 1;
-    const int32_t scx = srcw << 15; //(srcw >> 1) << 16 convert to fixed points
-    const int32_t scy = srch << 15; //(srch >> 1) << 16 convert to fixed points
-
-    //rotation points
-    const int32_t cx = scx - int32_t(dcx * rscalex * cosi - dcy * rscaley * sini);
-    const int32_t cy = scy - int32_t(dcx * rscalex * sini + dcy * rscaley * cosi); 
-
-    ROTATE_CLIP clip;
-    clip.ax = ax;
-    clip.bx = bx;
-    clip.ay = ay;
-    clip.by = by;
-    clip.cx = cx;
-    clip.cy = cy;
-    clip.dstw = dstw;
-    clip.dsth = dsth;
-    clip.srcw = srcw;
-    clip.srch = srch;
-    
-    //clipping data
-    if (!initClip(&clip, dcx, dcy, 1)) return;
-
-    uint32_t* yline = &pdst[dstw * clip.yDown];
-    while (true)
-    {
-        if (clip.yDown >= dsth) break;
-        if (clip.yDown >= 0) bilinearRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay);
-        if (!nextLineDown(&clip)) break;
-        yline += dstw;
-    }
-
-    yline = &pdst[dstw * clip.yUp];
-    while (nextLineUp(&clip))
-    {
-        if (clip.yUp < 0) break;
-        yline -= dstw;
-        if (clip.yUp < dsth) bilinearRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay);
-    }
-}
-
-//bi-cubic rotate image (original version, very slow)
-//use maximize optimize version below
-void bicubicRotateImage(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cast to image data
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    //calculate haft dimension
-    const int32_t width = src->mWidth;
-    const int32_t height = src->mHeight;
-    const int32_t cx = (width >> 1) - 1;
-    const int32_t cy = (height >> 1) - 1;
-
-    //convert to radian
-    const double alpha = double(angle * M_PI) / 180;
-    const double sina = sin(-alpha) / scalex;
-    const double cosa = cos(-alpha) / scaley;
-    const double mx = -cx * cosa + cx;
-    const double my = -cx * sina + cy;
-    double px = -cy * sina;
-    double py = -cy * cosa;
-    
-    //start pixel manipulation
-    for (int32_t y = 0; y < height; y++, px += sina, py += cosa)
-    {
-        double sx = mx - px;
-        double sy = my + py;
-        for (int32_t x = 0; x < width; x++, sx += cosa, sy += sina)
-        {
-            if (sx >= 0.0 && sx <= width - 1.0 && sy >= 0 && sy <= height - 1.0) *pdst = bicubicGetPixel(src, sx, sy);
-            pdst++;
-        }
-    }
-}
-
-//single optimize version
-//sticks used:
-//1. fixed-points
-//2. lookup table
-void bicubicRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    //only works with rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //cast to image data
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t dstw = dst->mWidth;
-    const int32_t dcx = dstw >> 1;
-    const int32_t dsth = dst->mHeight;
-    const int32_t dcy = dsth >> 1;
-
-    const int32_t srcw = src->mWidth;
-    const int32_t scx = srcw << 15;
-    const int32_t srch = src->mHeight;
-    const int32_t scy = srch << 15;
-    const int32_t scw = (srcw - 1) << 16;
-    const int32_t sch = (srch - 1) << 16;
-
-    const double alpha = (angle * M_PI) / 180;
-    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
-    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
-
-    int16_t stable[513] = { 0 };
-    for (int32_t i = 0; i < 513; i++) stable[i] = fround(256.0 * sinXDivX(i / 256.0));
-
-    int32_t xs = scx - (dcx * dy + dcy * dx);
-    int32_t ys = scy - (dcy * dy - dcx * dx);
-
-    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
-    {
-        int32_t sx = xs, sy = ys;
-        uint32_t* pline = pdst;
-        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
-        {
-            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = bicubicGetPixelFixed(src, stable, sx, sy);
-            pline++;
-        }
-    }
-}
-
-//bi-cubic rotate scan line (sub-routine for maximize optimize version)
-//this use smooth border when rotating to keep image looked
-void bicubicRotateLine(uint32_t* pdst, const int32_t boundx0, const int32_t inx0, const int32_t inx1, const int32_t boundx1, const GFX_IMAGE* psrc, int32_t sx, int32_t sy, const int32_t addx, const int32_t addy, const int16_t* stable)
-{
-    int32_t x = 0;
-
-    for (x = boundx0; x < inx0; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bicubicGetPixelBorder(psrc, stable, sx, sy));
-    for (x = inx0; x < inx1; x++, sx += addx, sy += addy)       pdst[x] = bicubicGetPixelCenter(psrc, stable, sx, sy);
-    for (x = inx1; x < boundx1; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bicubicGetPixelBorder(psrc, stable, sx, sy));
-}
-
-//maximize optimize version (extremely fast)
-//use sticks:
-//1. fixed-points
-//2. separate get pixel inbound and outbound of source image
-//3. SSE2 instructions
-//4. lookup table
-//5. clipping data
-void bicubicRotateImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
-{
-    const double scalexy = 1.0 / (scalex * scaley);  
-    const double rscalex = scalexy * scaley;
-    const double rscaley = scalexy * scalex;
-
-    double sina = 0, cosa = 0;
-    sincos(-(angle * M_PI) / 180, &sina, &cosa);
-    const int32_t sini = fround(sina * 65536); //convert to fixed points (no truncated)
-    const int32_t cosi = fround(cosa * 65536); //convert to fixed points (no truncated)
-
-    const int32_t srcw = src->mWidth;
-    const int32_t srch = src->mHeight;
-    const int32_t dstw = dst->mWidth;
-    const int32_t dsth = dst->mHeight;
-
-    uint32_t* pdst = (uint32_t*)dst->mData;
-
-    const int32_t ax = int32_t(rscalex * cosi);
-    const int32_t ay = int32_t(rscalex * sini);
-    const int32_t bx = -int32_t(rscaley * sini);
-    const int32_t by = int32_t(rscaley * cosi);
-
-    const int32_t dcx = dstw >> 1;
-    const int32_t dcy = dsth >> 1;
-    const int32_t scx = srcw << 15; //(srcw >> 1) << 16 convert to fixed points
-    const int32_t scy = srch << 15; //(srch >> 1) << 16 convert to fixed points
-
-    //rotation points
-    const int32_t cx = scx - int32_t(dcx * rscalex * cosi - dcy * rscaley * sini);
-    const int32_t cy = scy - int32_t(dcx * rscalex * sini + dcy * rscaley * cosi); 
-
-    ROTATE_CLIP clip;
-    clip.ax = ax;
-    clip.bx = bx;
-    clip.ay = ay;
-    clip.by = by;
-    clip.cx = cx;
-    clip.cy = cy;
-    clip.dstw = dstw;
-    clip.dsth = dsth;
-    clip.srcw = srcw;
-    clip.srch = srch;
-
-    //clipping data
-    if (!initClip(&clip, dcx, dcy, 2)) return;
-
-    int16_t stable[513] = { 0 };
-    for (int32_t i = 0; i < 513; i++) stable[i] = fround(256.0 * sinXDivX(i / 256.0));
-
-    uint32_t* yline = &pdst[dstw * clip.yDown];
-    while (true)
-    {
-        if (clip.yDown >= dsth) break;
-        if (clip.yDown >= 0) bicubicRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay, stable);
-        if (!nextLineDown(&clip)) break;
-        yline += dstw;
-    }
-
-    yline = &pdst[dstw * clip.yUp];
-    while (nextLineUp(&clip))
-    {
-        if (clip.yUp < 0) break;
-        yline -= dstw;
-        if (clip.yUp < dsth) bicubicRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay, stable);
-    }
-}
-
-//scale image buffer (export function)
-void scaleImage(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t type /* = INTERPOLATION_TYPE_SMOOTH */)
-{
-    //mixed mode
-    if (bitsPerPixel == 8)
-    {
-        scaleImageMix(dst, src, type);
-        return;
-    }
-
-    //which type?
-    switch (type)
-    {
-    case INTERPOLATION_TYPE_NORMAL:
-        scaleImageNormal(dst, src, 1);
-        break;
-
-    case INTERPOLATION_TYPE_NEAREST:
-        nearestScaleImageFixed(dst, src);
-        break;
-
-    case INTERPOLATION_TYPE_SMOOTH:
-        smoothScaleImageFixed(dst, src);
-        break;
-
-    case INTERPOLATION_TYPE_BILINEAR:
-        bilinearScaleImageMax(dst, src);
-        break;
-
-    case INTERPOLATION_TYPE_BICUBIC:
-        bicubicScaleImageMax(dst, src);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown scale type:%d", type);
-        break;
-    }
-}
-
-//rotate image buffer (export function)
-void rotateImage(const GFX_IMAGE* dst, const GFX_IMAGE* src, double degree, int32_t type /* = INTERPOLATION_TYPE_SMOOTH */)
-{
-    //mixed mode
-    if (bitsPerPixel == 8)
-    {
-        rotateImageMix(dst, src, degree, 1, 1);
-        return;
-    }
-
-    //which type?
-    switch (type)
-    {
-    case INTERPOLATION_TYPE_NEAREST:
-        nearestRotateImageFixed(dst, src, degree, 1, 1);
-        break;
-
-    case INTERPOLATION_TYPE_SMOOTH:
-        smoothRotateImageFixed(dst, src, degree, 1, 1);
-        break;
-
-    case INTERPOLATION_TYPE_BILINEAR:
-        bilinearRotateImageMax(dst, src, degree, 1, 1);
-        break;
-
-    case INTERPOLATION_TYPE_BICUBIC:
-        bicubicRotateImageMax(dst, src, degree, 1, 1);
-        break;
-
-    default:
-        messageBox(GFX_WARNING, "Unknown rotate type:%d", type);
-        break;
-    }
-}
-
-//initialize 3D projection params
-void initProjection(double theta, double phi, double de, double rho /* = 0 */)
-{
-    const double ph = (M_PI * phi) / 180;
-    const double th = (M_PI * theta) / 180;
-    
-    sinth = sin(th);
-    sinph = sin(ph);
-    costh = cos(th);
-    cosph = cos(ph);
-
-    sincosx = sinph * costh;
-    sinsinx = sinth * sinph;
-    coscosx = costh * cosph;
-    sincosy = sinth * cosph;
-
-    DE = de;
-    RHO = rho;
-}
-
-//projection points (x,y,z)
-void projette(double x, double y, double z, double *px, double *py)
-{
-    const double obsX = -x * sinth + y * costh;
-    const double obsY = -x * sincosx - y * sinsinx + z * cosph;
-
-    if (projectionType == PROJECTION_TYPE_PERSPECTIVE)
-    {
-        double obsZ = -x * coscosx - y * sincosy - z * sinph + RHO;
-        if (obsZ == 0.0) obsZ = DBL_MIN;
-        if (px) *px = (DE * obsX) / obsZ;
-        if (py) *py = (DE * obsY) / obsZ;
-    }
-    else if (projectionType == PROJECTION_TYPE_PARALLELE)
-    {
-        if (px) *px = DE * obsX;
-        if (py) *py = DE * obsY;
-    }
-    else
-    {
-        if (px) *px = 0;
-        if (py) *py = 0;
-        messageBox(GFX_WARNING, "Unknown projection type!");
-    }
-}
-
-//reset projection parameters
-void resetProjection()
-{
-    RHO = DE = 0;
-    sinth = sinph = costh = cosph = 0;
-    sincosx = sinsinx = coscosx = sincosy = 0;
-}
-
-//set current projection type
-void setProjection(PROJECTION_TYPE type)
-{
-    projectionType = type;
-}
-
-//move current cursor in 3D mode
-void deplaceEn(double x, double y, double z)
-{
-    double px = 0, py = 0;
-    projette(x, y, z, &px, &py);
-    cranX = int32_t(centerX + px * ECHE);
-    cranY = int32_t(centerY - py);
-    moveTo(cranX, cranY);
-}
-
-//draw line from current cursor in 3D mode
-void traceVers(double x, double y, double z, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    double px = 0, py = 0;
-    projette(x, y, z, &px, &py);
-    cranX = int32_t(centerX + px * ECHE);
-    cranY = int32_t(centerY - py);
-    lineTo(cranX, cranY, col, mode);
-}
-
-//move to drawing pointer
-void moveTo(int32_t x, int32_t y)
-{
-    currX = x;
-    currY = y;
-}
-
-//draw line from current to (x,y)
-void lineTo(int32_t x, int32_t y, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
-{
-    drawLine(currX, currY, x, y, col, mode);
-    moveTo(x, y);
-}
-
-//set palette color to render palette table
-void setPalette(const RGBA* pal)
-{
-    SDL_Palette* palette = SDL_GetSurfacePalette(sdlSurface);
-    if (palette) SDL_SetPaletteColors(palette, pal, 0, 256);
-}
-
-//get current palette table
-void getPalette(RGBA* pal)
-{
-    const SDL_Palette* palette = SDL_GetSurfacePalette(sdlSurface);
-    if (palette) memcpy(pal, palette->colors, palette->ncolors * sizeof(RGBA));
-}
-
-//FX-effect: palette rotation
-void rotatePalette(int32_t from, int32_t to, int32_t loop, int32_t ms)
-{
-    RGBA tmp = { 0 };
-
-    RGBA pal[256] = { 0 };
-    getPalette(pal);
-
-    //how many steps to rotated
-    const uint32_t steps = (to - from) * sizeof(RGBA);
-
-    if (loop > 0)
-    {
-        while (loop--)
-        {
-            memcpy(&tmp, &pal[from], sizeof(RGBA));
-            memcpy(&pal[from], &pal[from + 1], steps);
-            memcpy(&pal[to], &tmp, sizeof(RGBA));
-            setPalette(pal);
-            render();
-            delay(ms);
-            readKeys();
-            if (keyDown(SDL_SCANCODE_RETURN)) break;
-            if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-        }
-    }
-    else
-    {
-        while (true)
-        {
-            memcpy(&tmp, &pal[from], sizeof(RGBA));
-            memcpy(&pal[from], &pal[from + 1], steps);
-            memcpy(&pal[to], &tmp, sizeof(RGBA));
-            setPalette(pal);
-            render();
-            delay(ms);
-            readKeys();
-            if (keyDown(SDL_SCANCODE_RETURN)) break;
-            if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-        }
-    }
-}
-
-//FX-effect: palette fade-in
-void fadeIn(const RGBA* dest, uint32_t ms)
-{
-    RGBA src[256] = { 0 };
-    getPalette(src);
-
-    for (int32_t i = 63; i >= 0; i--)
-    {
-        for (int32_t j = 0; j < 256; j++)
-        {
-            const int32_t k = i << 2;
-            if (dest[j].r > k && src[j].r < 252) src[j].r += 4;
-            if (dest[j].g > k && src[j].g < 252) src[j].g += 4;
-            if (dest[j].b > k && src[j].b < 252) src[j].b += 4;
-        }
-        setPalette(src);
-        render();
-        delay(ms);
-        readKeys();
-        if (keyDown(SDL_SCANCODE_RETURN)) break;
-        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-    }
-}
-
-//FX-effect: palette fade-out
-void fadeOut(const RGBA* dest, uint32_t ms)
-{
-    RGBA src[256] = { 0 };
-    getPalette(src);
-
-    for (int32_t i = 63; i >= 0; i--)
-    {
-        for (int32_t j = 0; j < 256; j++)
-        {
-            const int32_t k = i << 2;
-            if (dest[j].r < k && src[j].r > 4) src[j].r -= 4;
-            if (dest[j].g < k && src[j].g > 4) src[j].g -= 4;
-            if (dest[j].b < k && src[j].b > 4) src[j].b -= 4;
-        }
-        setPalette(src);
-        render();
-        delay(ms);
-        readKeys();
-        if (keyDown(SDL_SCANCODE_RETURN)) break;
-        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-    }
-}
-
-//FX-effect: palette fade-max
-void fadeMax(uint32_t ms)
-{
-    RGBA src[256] = { 0 };
-    getPalette(src);
-
-    for (int32_t i = 0; i < 64; i++)
-    {
-        for (int32_t j = 0; j < 256; j++)
-        {
-            if (src[j].r < 252) src[j].r += 4; else src[j].r = 255;
-            if (src[j].g < 252) src[j].g += 4; else src[j].g = 255;
-            if (src[j].b < 252) src[j].b += 4; else src[j].b = 255;
-        }
-        setPalette(src);
-        render();
-        delay(ms);
-        readKeys();
-        if (keyDown(SDL_SCANCODE_RETURN)) break;
-        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-    }
-}
-
-//FX-effect: palette fade-min
-void fadeMin(uint32_t ms)
-{
-    RGBA src[256] = { 0 };
-    getPalette(src);
-
-    for (int32_t i = 0; i < 64; i++)
-    {
-        for (int32_t j = 0; j < 256; j++)
-        {
-            if (src[j].r > 4) src[j].r -= 4; else src[j].r = 0;
-            if (src[j].g > 4) src[j].g -= 4; else src[j].g = 0;
-            if (src[j].b > 4) src[j].b -= 4; else src[j].b = 0;
-        }
-        setPalette(src);
-        render();
-        delay(ms);
-        readKeys();
-        if (keyDown(SDL_SCANCODE_RETURN)) break;
-        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-    }
-}
-
-//FX-effect: palette fade-down
-void fadeDown(RGBA* pal)
-{
-    for (int32_t i = 0; i < 256; i++)
-    {
-        if (pal[i].r > 4) pal[i].r -= 2; else pal[i].r = 0;
-        if (pal[i].g > 4) pal[i].g -= 2; else pal[i].g = 0;
-        if (pal[i].b > 4) pal[i].b -= 2; else pal[i].b = 0;
-    }
-    setPalette(pal);
-    render();
-}
-
-//convert mixed palette buffer to RGB buffer
-void convertPalette(const uint8_t* palette, RGBA* color)
-{
-    uint8_t* rgb = (uint8_t*)color;
-    uint8_t* pal = (uint8_t*)palette;
-    for (int32_t i = 0; i < 256; i++)
-    {
-        rgb[0] = pal[0] << 2;
-        rgb[1] = pal[1] << 2;
-        rgb[2] = pal[2] << 2;
-        rgb += 4;
-        pal += 3;
-    }
-}
-
-//convert current RGB palette to RGB32
-void shiftPalette(RGBA* pal)
-{
-    RGBA* rgb = (RGBA*)pal;
-    for (int32_t i = 0; i < 256; i++)
-    {
-        rgb->r <<= 2;
-        rgb->g <<= 2;
-        rgb->b <<= 2;
-        rgb++;
-    }
-}
-
-//make a black palette
-void clearPalette()
-{
-    RGBA pal[256] = { 0 };
-    memset(pal, 0, sizeof(pal));
-    setPalette(pal);
-    render();
-}
-
-//make white palette
-void whitePalette()
-{
-    RGBA pal[256] = { 0 };
-    memset(pal, 255, sizeof(pal));
-    setPalette(pal);
-    render();
-}
-
-//build default 256 colors palette
-void getBasePalette(RGBA* pal)
-{
-    memcpy(pal, basePalette, sizeof(basePalette));
-}
-
-//make linear palette (7 circles color)
-void makeLinearPalette()
-{
-    RGBA pal[256] = { 0 };
-    memset(pal, 0, sizeof(pal));
-
-    for (int16_t i = 0; i < 32; i++)
-    {
-        int16_t j = 16 + i;
-        pal[j].r = 63;
-        pal[j].g = 0;
-        pal[j].b = 63 - (i << 1);
-
-        j = 48 + i;
-        pal[j].r = 63;
-        pal[j].g = i << 1;
-        pal[j].b = 0;
-
-        j = 80 + i;
-        pal[j].r = 63 - (i << 1);
-        pal[j].g = 63;
-        pal[j].b = 0;
-
-        j = 112 + i;
-        pal[j].r = 0;
-        pal[j].g = 63;
-        pal[j].b = i << 1;
-
-        j = 144 + i;
-        pal[j].r = 0;
-        pal[j].g = 63 - (i << 1);
-        pal[j].b = 63;
-
-        j = 176 + i;
-        pal[j].r = i << 1;
-        pal[j].g = 0;
-        pal[j].b = 63;
-    }
-
-    shiftPalette(pal);
-    setPalette(pal);
-}
-
-//yet another funky palette
-void makeFunkyPalette()
-{
-    RGBA pal[256] = { 0 };
-
-    int32_t r = 0, g = 0, b = 0;
-    bool ry = true, gy = true, by = true;
-
-    srand(uint32_t(time(NULL)));
-
-    int32_t rx = (rand() % 5) + 1;
-    int32_t gx = (rand() % 5) + 1;
-    int32_t bx = (rand() % 5) + 1;
-    
-    memset(pal, 0, sizeof(pal));
-
-    for (int32_t i = 0; i < 256; i++)
-    {
-        pal[i].r = r;
-        pal[i].g = g;
-        pal[i].b = b;
-
-        if (ry) r += rx; else r -= rx;
-        if (gy) g += gx; else g -= gx;
-        if (by) b += bx; else b -= bx;
-
-        if ((r + rx > 63) || (r - rx < 0))
-        {
-            ry = !ry;
-            rx = (rand() % 5) + 1;
-        }
-
-        if ((g + gx > 63) || (g - gx < 0))
-        {
-            gy = !gy;
-            gx = (rand() % 5) + 1;
-        }
-
-        if ((b + bx > 63) || (b - bx < 0))
-        {
-            by = !by;
-            bx = (rand() % 5) + 1;
-        }
-    }
-
-    shiftPalette(pal);
-    setPalette(pal);
-}
-
-//make rainbow palette
-void makeRainbowPalette()
-{
-    RGBA pal[256] = { 0 };
-    memset(pal, 0, sizeof(pal));
-
-    for (int32_t i = 0; i < 32; i++)
-    {
-        pal[i      ].r = i << 1;
-        pal[63 - i ].r = i << 1;
-        pal[i + 64 ].g = i << 1;
-        pal[127 - i].g = i << 1;
-        pal[i + 128].b = i << 1;
-        pal[191 - i].b = i << 1;
-        pal[i + 192].r = i << 1;
-        pal[i + 192].g = i << 1;
-        pal[i + 192].b = i << 1;
-        pal[255 - i].r = i << 1;
-        pal[255 - i].g = i << 1;
-        pal[255 - i].b = i << 1;
-    }
-
-    shiftPalette(pal);
-    setPalette(pal);
-}
-
-//scrolling current palette
-void scrollPalette(int32_t from, int32_t to, int32_t step)
-{
-    RGBA tmp = { 0 };
-    RGBA pal[256] = { 0 };
-
-    memset(pal, 0, sizeof(pal));
-    getPalette(pal);
-
-    //how many steps to rotated
-    const uint32_t steps = (to - from) * sizeof(RGBA);
-
-    while (step--)
-    {
-        memcpy(&tmp, &pal[from], sizeof(tmp));
-        memcpy(&pal[from], &pal[from + 1], steps);
-        memcpy(&pal[to], &tmp, sizeof(tmp));
-        readKeys();
-        if (keyDown(SDL_SCANCODE_RETURN)) break;;
-        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
-    }
-
-    setPalette(pal);
-}
-
-//string position
-int32_t strPos(char* str, const char* sub)
-{
-    const char* ptr = strstr(str, sub);
-    return ptr ? int32_t(ptr - str) : -1;
-}
-
-//insert character to current string
-void insertChar(char* str, uint8_t chr, int32_t pos)
-{
-    if (pos < 0 || pos >= int32_t(strlen(str))) return;
-    str[pos] = chr;
-}
-
-//delete character of string
-void strDelete(char* str, int32_t i, uint32_t num)
-{
-    if (i < 0 || i >= int32_t(strlen(str))) return;
-    memmove(&str[i + 1], &str[i + num], strlen(str) - i - 1);
-}
-
-//replace current string with another string
-void schRepl(char* str, const char* schr, uint8_t repl)
-{
-    int32_t pos = strPos(str, schr);
-    const uint32_t length = uint32_t(strlen(schr));
-
-    while (pos >= 0)
-    {
-        strDelete(str, pos, length);
-        insertChar(str, repl, pos);
-        pos = strPos(str, schr);
-    }
-}
-
-//character to string conversion
-void chr2Str(uint8_t chr, uint8_t num, char* str)
-{
-    str[0] = chr;
-    str[1] = num;
-    str[2] = '\0';
-}
-
-//encode string to VNI string (format type VNI)
-void makeFont(char* str)
-{
-    char buff[4] = { 0 };
-    schRepl(str, "a8", 128);
-    chr2Str(128, '1', buff);
-    schRepl(str, buff, 129);
-    chr2Str(128, '2', buff);
-    schRepl(str, buff, 130);
-    chr2Str(128, '3', buff);
-    schRepl(str, buff, 131);
-    chr2Str(128, '4', buff);
-    schRepl(str, buff, 132);
-    chr2Str(128, '5', buff);
-    schRepl(str, buff, 133);
-    schRepl(str, "a6", 134);
-    chr2Str(134, '1', buff);
-    schRepl(str, buff, 135);
-    chr2Str(134, '2', buff);
-    schRepl(str, buff, 136);
-    chr2Str(134, '3', buff);
-    schRepl(str, buff, 137);
-    chr2Str(134, '4', buff);
-    schRepl(str, buff, 138);
-    chr2Str(134, '5', buff);
-    schRepl(str, buff, 139);
-    schRepl(str, "e6", 140);
-    chr2Str(140, '1', buff);
-    schRepl(str, buff, 141);
-    chr2Str(140, '2', buff);
-    schRepl(str, buff, 142);
-    chr2Str(140, '3', buff);
-    schRepl(str, buff, 143);
-    chr2Str(140, '4', buff);
-    schRepl(str, buff, 144);
-    chr2Str(140, '5', buff);
-    schRepl(str, buff, 145);
-    schRepl(str, "o7", 146);
-    chr2Str(146, '1', buff);
-    schRepl(str, buff, 147);
-    chr2Str(146, '2', buff);
-    schRepl(str, buff, 148);
-    chr2Str(146, '3', buff);
-    schRepl(str, buff, 149);
-    chr2Str(146, '4', buff);
-    schRepl(str, buff, 150);
-    chr2Str(146, '5', buff);
-    schRepl(str, buff, 151);
-    schRepl(str, "o6", 152);
-    chr2Str(152, '1', buff);
-    schRepl(str, buff, 153);
-    chr2Str(152, '2', buff);
-    schRepl(str, buff, 154);
-    chr2Str(152, '3', buff);
-    schRepl(str, buff, 155);
-    chr2Str(152, '4', buff);
-    schRepl(str, buff, 156);
-    chr2Str(152, '5', buff);
-    schRepl(str, buff, 157);
-    schRepl(str, "u7", 158);
-    chr2Str(158, '1', buff);
-    schRepl(str, buff, 159);
-    chr2Str(158, '2', buff);
-    schRepl(str, buff, 160);
-    chr2Str(158, '3', buff);
-    schRepl(str, buff, 161);
-    chr2Str(158, '4', buff);
-    schRepl(str, buff, 162);
-    chr2Str(158, '5', buff);
-    schRepl(str, buff, 163);
-    schRepl(str, "a1", 164);
-    schRepl(str, "a2", 165);
-    schRepl(str, "a3", 166);
-    schRepl(str, "a4", 167);
-    schRepl(str, "a5", 168);
-    schRepl(str, "e1", 169);
-    schRepl(str, "e2", 170);
-    schRepl(str, "e3", 171);
-    schRepl(str, "e4", 172);
-    schRepl(str, "e5", 173);
-    schRepl(str, "i1", 174);
-    schRepl(str, "i2", 175);
-    schRepl(str, "i3", 181);
-    schRepl(str, "i4", 182);
-    schRepl(str, "i5", 183);
-    schRepl(str, "o1", 184);
-    schRepl(str, "o2", 190);
-    schRepl(str, "o3", 198);
-    schRepl(str, "o4", 199);
-    schRepl(str, "o5", 208);
-    schRepl(str, "u1", 210);
-    schRepl(str, "u2", 211);
-    schRepl(str, "u3", 212);
-    schRepl(str, "u4", 213);
-    schRepl(str, "u5", 214);
-    schRepl(str, "y1", 215);
-    schRepl(str, "y2", 216);
-    schRepl(str, "y3", 221);
-    schRepl(str, "y4", 222);
-    schRepl(str, "y5", 248);
-    schRepl(str, "d9", 249);
-    schRepl(str, "D9", 250);
-}
-
-//generate random word array
-void randomBuffer(void* buff, int32_t count, int32_t range)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     edi, buff
-        mov     ecx, count
-        mov     ebx, randSeed
-    next:
-        mov     eax, ebx
-        mul     factor
-        inc     eax
-        mov     ebx, eax
-        shr     eax, 16
-        mul     range
-        shr     eax, 16
-        stosw
-        dec     ecx
-        jnz     next
-        mov     randSeed, ebx
-    }
-#else
-    //check range
-    uint16_t* ptrBuff = (uint16_t*)buff;
-    if (!count || !randSeed || !range || !ptrBuff) return;
-
-    const uint32_t val = (((randSeed * factor + 1) >> 16) * range) >> 16;
-    for (int32_t i = 0; i < count; i++) *ptrBuff++ = val;
-
-    randSeed = val;
-#endif
-}
-
-//get current loaded GFX font
-GFX_FONT* getFont(int32_t type /* = 0 */)
-{
-    if (type >= GFX_MAX_FONT) type = GFX_MAX_FONT - 1;
-    if (type < 0) type = 0;
-    return gfxFonts[type ? type : fontType].dataPtr ? &gfxFonts[type ? type : fontType] : NULL;
-}
-
-//get current loaded font type
-int32_t getFontType()
-{
-    return fontType;
-}
-
-//selected loaded GFX font
-void setFontType(int32_t type)
-{
-    //check current range
-    if (type >= GFX_MAX_FONT) type = GFX_MAX_FONT - 1;
-    if (type < 0) type = 0;
-    fontType = type;
-}
-
-//set current font size
-void setFontSize(uint32_t size)
-{
-    GFX_FONT* font = getFont(fontType);
-    if (!font) return;
-
-    //have sub-fonts
-    if (font->hdr.subFonts > 0)
-    {
-        //correct sub-fonts number
-        if (size > font->hdr.subFonts) size = font->hdr.subFonts;
-        //copy sub-fonts hdr
-        memcpy(&font->hdr.subData, &font->dataPtr[4 * (font->hdr.subData.endChar - font->hdr.subData.startChar + 1) * (font->hdr.subFonts + 1) + size * sizeof(GFX_CHAR_HEADER)], sizeof(GFX_CHAR_HEADER));
-    }
-    subFonts = size;
-}
-
-//get height of string with current font in pixel
-int32_t getFontHeight(const char* str)
-{
-    uint32_t i = 0;
-    uint32_t height = 0;
-    uint32_t mempos = 0;
-    uint32_t size = 0;
-    const uint32_t len = uint32_t(strlen(str));
-    const GFX_FONT* font = getFont(fontType);
-
-    //check for font is loaded
-    if (!font) return 0;
-    if (!str || !len) return 0;
-
-    //fixed font, all characters have a same height
-    if (font->hdr.flags & GFX_FONT_FIXED) height = font->hdr.subData.height;
-    else
-    {
-        //vector font
-        if (font->hdr.flags & GFX_FONT_VECTOR)
-        {
-            for (i = 0; i < len; i++)
-            {
-                //skip invalid character
-                if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) continue;
-
-                //position of raw data of current character
-                mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
-                size = font->dataPtr[mempos + 1];
-                if (size > height) height = size;
-            }
-            height *= subFonts;
-        }
-        else
-        {
-            //BMP1 font
-            if (font->hdr.subData.bitsPerPixel == 1)
-            {
-                for (i = 0; i < len; i++)
-                {
-                    //skip invalid character
-                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) continue;
-
-                    //position of raw data of current character
-                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
-                    size = font->dataPtr[mempos + 1];
-                    if (size > height) height = size;
-                }
-            }
-            else if (font->hdr.subData.bitsPerPixel >= 2 && font->hdr.subData.bitsPerPixel <= 32)
-            {
-                //BMP8 and RGB font
-                for (i = 0; i < len; i++)
-                {
-                    //skip invalid character
-                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) continue;
-
-                    //position of raw data of current character
-                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
-                    size = *(uint32_t*)&font->dataPtr[mempos + 4] + *(uint32_t*)&font->dataPtr[mempos + 12];
-                    if (size > height) height = size;
-                }
-            }
-        }
-    }
-
-    //animation font
-    if (font->hdr.flags & GFX_FONT_ANIPOS) height += font->hdr.subData.randomY;
-    return height;
-}
-
-//get width of string with current font in pixel
-int32_t getFontWidth(const char* str)
-{
-    GFX_STROKE_DATA* data = NULL;
-    uint32_t i = 0;
-    uint32_t mempos = 0;
-    uint32_t width = 0;
-    uint32_t size = 0;
-    const uint32_t len = uint32_t(strlen(str));
-    const GFX_FONT* font = getFont(fontType);
-
-    //check for font is loaded
-    if (!font) return 0;
-    if (!str || !len) return 0;
-
-    //fixed font, all characters have a same width
-    if (font->hdr.flags & GFX_FONT_FIXED) width = (font->hdr.subData.width + font->hdr.subData.distance) * len;
-    else
-    {
-        //vector font
-        if (font->hdr.flags & GFX_FONT_VECTOR)
-        {
-            for (i = 0; i < len; i++)
-            {
-                //skip invalid character
-                if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) size = font->hdr.subData.spacer;
-                else
-                {
-                    //position of raw data of current character
-                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
-                    data = (GFX_STROKE_DATA*)&font->dataPtr[mempos];
-                    size = data->width * subFonts;
-                }
-                width += size + font->hdr.subData.distance;
-            }
-        }
-        else
-        {
-            //BMP1 font
-            if (font->hdr.subData.bitsPerPixel == 1)
-            {
-                for (i = 0; i < len; i++)
-                {
-                    //skip invalid character
-                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar)
-                    {
-                        width += font->hdr.subData.spacer + font->hdr.subData.distance;
-                        continue;
-                    }
-
-                    //position of raw data of current character
-                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
-                    width += *(uint8_t*)&font->dataPtr[mempos] + font->hdr.subData.distance;
-                }
-            }
-            else if (font->hdr.subData.bitsPerPixel >= 2 && font->hdr.subData.bitsPerPixel <= 32)
-            {
-                //BMP8 and RGB font
-                for (i = 0; i < len; i++)
-                {
-                    //skip invalid character
-                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar)
-                    {
-                        width += font->hdr.subData.spacer + font->hdr.subData.distance;
-                        continue;
-                    }
-
-                    //position of raw data of current character
-                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
-                    width += *(uint32_t*)&font->dataPtr[mempos] + *(uint32_t*)&font->dataPtr[mempos + 8] + font->hdr.subData.distance;
-                }
-            }
-        }
-    }
-
-    //animation font
-    if (font->hdr.flags & GFX_FONT_ANIPOS) width += font->hdr.subData.randomX;
-    return width - font->hdr.subData.distance;
-}
-
-//load font name to memory
-int32_t loadFont(const char* fname, int32_t type)
-{
-    //check for type range
-    if (type >= GFX_MAX_FONT)
-    {
-        messageBox(GFX_WARNING, "Error load font: %s! unknown font type!", fname);
-        return 0;
-    }
-
-    //check for already loaded
-    if (gfxFonts[type].dataPtr)
-    {
-        messageBox(GFX_WARNING, "Error load font: %s! font type: %d already loaded!", fname, type);
-        return 0;
-    }
-
-    //open font file
-    FILE* fp = fopen(fname, "rb");
-    if (!fp)
-    {
-        messageBox(GFX_WARNING, "Error load font: %s! file not found!", fname);
-        return 0;
-    }
-
-    //read font hdr
-    fread(&gfxFonts[type].hdr, sizeof(GFX_FONT_HEADER), 1, fp);
-
-    //check font signature, version number and memory size
-    if (memcmp(gfxFonts[type].hdr.signature, "Fnt2", 4) || gfxFonts[type].hdr.version != 0x0101 || !gfxFonts[type].hdr.memSize)
-    {
-        fclose(fp);
-        messageBox(GFX_WARNING, "Error load font: %s! wrong GFX font!", fname);
-        return 0;
-    }
-
-    //allocate raw data buffer
-    gfxFonts[type].dataPtr = (uint8_t*)calloc(gfxFonts[type].hdr.memSize, 1);
-    if (!gfxFonts[type].dataPtr)
-    {
-        fclose(fp);
-        messageBox(GFX_WARNING, "Error load font: %s! not enough memory!", fname);
-        return 0;
-    }
-
-    //read raw font data
-    fread(gfxFonts[type].dataPtr, gfxFonts[type].hdr.memSize, 1, fp);
-    fclose(fp);
-
-    //reset font header for old font
-    if (gfxFonts[type].hdr.flags & GFX_FONT_MULTI) setFontSize(0);
-
-    //default sub-fonts
-    if (gfxFonts[type].hdr.flags & GFX_FONT_VECTOR) subFonts = 1;
-    else subFonts = 0;
-
-    //BMP8 font palette
-    if (gfxFonts[type].hdr.subData.usedColors > 1)
-    {
-        //BMP8 use up to 128 colors (128 * 4)
-        fontPalette[type] = (uint8_t*)calloc(512, 1);
-        if (!fontPalette[type])
-        {
-            free(gfxFonts[type].dataPtr);
-            messageBox(GFX_WARNING, "Error load font: %s! wrong font palette!", fname);
-            return 0;
-        }
-    }
-
-    return 1;
-}
-
-//release current loaded font
-void freeFont(int32_t type)
-{
-    //check for type range
-    if (type < 0) return;
-    if (type >= GFX_MAX_FONT) return;
-
-    //free font raw data buffer
-    if (gfxFonts[type].dataPtr)
-    {
-        free(gfxFonts[type].dataPtr);
-        gfxFonts[type].dataPtr = NULL;
-    }
-
-    //free font palette
-    if (fontPalette[type])
-    {
-        free(fontPalette[type]);
-        fontPalette[type] = NULL;
-    }
-
-    //reset header
-    memset(&gfxFonts[type].hdr, 0, sizeof(GFX_FONT_HEADER));
-}
-
-//draw a stroke of BGI font (YES we also support BGI font)
-int32_t outStroke(int32_t x, int32_t y, char chr, uint32_t col, uint32_t mode)
-{
-    const GFX_FONT* font = getFont(fontType);
-
-    //check for font is loaded
-    if (!font) return 0;
-
-    //check for non-drawable character
-    if (font->hdr.subData.startChar > chr || font->hdr.subData.endChar < chr) return font->hdr.subData.spacer;
-
-    //memory position of character
-    uint32_t mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((chr - font->hdr.subData.startChar) << 2)];
-    const GFX_STROKE_DATA* data = (GFX_STROKE_DATA*)&font->dataPtr[mempos];
-    GFX_STROKE_INFO* stroke = (GFX_STROKE_INFO*)&font->dataPtr[mempos + sizeof(GFX_STROKE_DATA)];
-
-    //scan for all lines
-    for (int32_t i = 0; i < data->numOfLines; i++)
-    {
-        const uint32_t mx = x + stroke->x * subFonts;
-        const uint32_t my = y + stroke->y * subFonts;
-
-        //check for drawable
-        if (stroke->code == 1) moveTo(mx, my);
-        else
-        {
-            if (mode == 2) lineTo(mx, my, col, BLEND_MODE_ADD);
-            else if (mode == 3) lineTo(mx, my, col, BLEND_MODE_SUB);
-            else lineTo(mx, my, col);
-        }
-        stroke++;
-    }
-
-    return data->width * subFonts;
-}
-
-//draw string with current loaded font
-void writeString(int32_t x, int32_t y, uint32_t col, uint32_t mode, const char* str)
-{
-    uint32_t i = 0, cx = 0, cy = 0;
-    uint32_t data = 0, datapos = 0, mempos = 0;
-    uint32_t width = 0, height = 0, addx = 0, addy = 0;
-    const GFX_FONT* font = getFont(fontType);
-
-    //check for font is loaded
-    if (!font) return;
-
-    const uint32_t len = uint32_t(strlen(str));
-
-    //check for vector font
-    if (font->hdr.flags & GFX_FONT_VECTOR)
-    {
-        for (i = 0; i < len; i++)
-        {
-            x += outStroke(x, y, str[i], col, mode) + font->hdr.subData.distance;
-            if (mode == 1) col++;
-        }
-        return;
-    }
-
-    //BMP1 font format
-    if (font->hdr.subData.bitsPerPixel == 1)
-    {
-        for (i = 0; i < len; i++)
-        {
-            //invalid character, update position
-            if (uint8_t(str[i]) < font->hdr.subData.startChar || uint8_t(str[i]) > font->hdr.subData.endChar)
-            {
-                if (!(font->hdr.flags & GFX_FONT_FIXED)) x += font->hdr.subData.spacer + font->hdr.subData.distance;
-                else x += font->hdr.subData.width + font->hdr.subData.distance;
-                continue;
-            }
-
-            //memory position for each character
-            mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((uint8_t(str[i]) - font->hdr.subData.startChar) << 2)];
-            width = font->dataPtr[mempos];
-            height = font->dataPtr[mempos + 1];
-            mempos += 2;
-
-            //scans for font width and height
-            for (cy = 0; cy < height; cy++)
-            {
-                datapos = 0;
-                data = *(uint32_t*)&font->dataPtr[mempos];
-                for (cx = 0; cx < width; cx++)
-                {
-                    if ((cx > 31) && !(cx & 31))
-                    {
-                        datapos += 4;
-                        data = *(uint32_t*)&font->dataPtr[mempos + datapos];
-                    }
-                    if (data & (1 << (cx & 31)))
-                    {
-                        if (mode == 2) putPixel(x + cx, y + cy, col, BLEND_MODE_ADD);
-                        else if (mode == 3) putPixel(x + cx, y + cy, col, BLEND_MODE_SUB);
-                        else putPixel(x + cx, y + cy, col);
-                    }
-                }
-                mempos += font->hdr.subData.bytesPerLine;
-            }
-            x += width + font->hdr.subData.distance;
-            if (mode == 1) col++;
-        }
-    }
-    //BMP8 font format
-    else if (font->hdr.subData.bitsPerPixel > 1 && font->hdr.subData.bitsPerPixel < 8)
-    {
-        //calculate font palette, use for hi-color and true-color
-        if (bitsPerPixel > 8)
-        {
-            const ARGB* pcol = (const ARGB*)&col;
-            for (i = 0; i < font->hdr.subData.usedColors; i++)
-            {
-                ARGB* pixels = (ARGB*)&fontPalette[fontType][i << 2];
-                pixels->r = pcol->r * (i + 1) / font->hdr.subData.usedColors;
-                pixels->g = pcol->g * (i + 1) / font->hdr.subData.usedColors;
-                pixels->b = pcol->b * (i + 1) / font->hdr.subData.usedColors;
-            }
-        }
-
-        //generate random position for animation font
-        if (font->hdr.flags & GFX_FONT_ANIPOS)
-        {
-            randomBuffer(gfxBuff, len + 1, font->hdr.subData.randomX);
-            randomBuffer(&gfxBuff[512], len + 1, font->hdr.subData.randomY);
-        }
-
-        for (i = 0; i < len; i++)
-        {
-            //invalid character, update character position
-            if (uint8_t(str[i]) < font->hdr.subData.startChar || uint8_t(str[i]) > font->hdr.subData.endChar)
-            {
-                if (!(font->hdr.flags & GFX_FONT_FIXED)) x += font->hdr.subData.spacer + font->hdr.subData.distance;
-                else x += font->hdr.subData.width + font->hdr.subData.distance;
-                continue;
-            }
-
-            //lookup character position
-            mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((uint8_t(str[i]) - font->hdr.subData.startChar) << 2)];
-            addx = *(uint32_t*)&font->dataPtr[mempos];
-            addy = *(uint32_t*)&font->dataPtr[mempos + 4];
-
-            //update position for animation font
-            if (font->hdr.flags & GFX_FONT_ANIPOS)
-            {
-                addx += gfxBuff[i << 1];
-                addy += gfxBuff[(i << 1) + 512];
-            }
-
-            //get font width and height
-            width = *(uint32_t*)&font->dataPtr[mempos + 8];
-            height = *(uint32_t*)&font->dataPtr[mempos + 12];
-            mempos += 16;
-            x += addx;
-
-            //scans font raw data
-            for (cy = 0; cy < height; cy++)
-            {
-                for (cx = 0; cx < width; cx++)
-                {
-                    data = font->dataPtr[mempos++];
-                    if (!(data & 0x80))
-                    {
-                        if (bitsPerPixel == 8) putPixel(x + cx, y + cy + addy, data);
-                        else if (mode == 2) putPixel(x + cx, y + cy + addy, *(uint32_t*)&fontPalette[fontType][data << 2], BLEND_MODE_ADD);
-                        else if (mode == 3) putPixel(x + cx, y + cy + addy, *(uint32_t*)&fontPalette[fontType][data << 2], BLEND_MODE_SUB);
-                        else putPixel(x + cx, y + cy + addy, *(uint32_t*)&fontPalette[fontType][data << 2]);
-                    }
-                }
-            }
-
-            //update next position
-            if (font->hdr.flags & GFX_FONT_ANIPOS) x -= gfxBuff[i << 1];
-            if (font->hdr.flags & GFX_FONT_FIXED) x += font->hdr.subData.width + font->hdr.subData.distance;
-            else x += width + font->hdr.subData.distance;
-        }
-    }
-    //alpha channel font
-    else if (font->hdr.subData.bitsPerPixel == 32)
-    {
-        //generate random position for animation font
-        if (font->hdr.flags & GFX_FONT_ANIPOS)
-        {
-            randomBuffer(gfxBuff, len + 1, font->hdr.subData.randomX);
-            randomBuffer(&gfxBuff[512], len + 1, font->hdr.subData.randomY);
-        }
-
-        for (i = 0; i < len; i++)
-        {
-            //invalid character, update character position
-            if (uint8_t(str[i]) < font->hdr.subData.startChar || uint8_t(str[i]) > font->hdr.subData.endChar)
-            {
-                if (!(font->hdr.flags & GFX_FONT_FIXED)) x += font->hdr.subData.spacer + font->hdr.subData.distance;
-                else x += font->hdr.subData.width + font->hdr.subData.distance;
-                continue;
-            }
-
-            //lookup character position
-            mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((uint8_t(str[i]) - font->hdr.subData.startChar) << 2)];
-            addx = *(uint32_t*)&font->dataPtr[mempos];
-            addy = *(uint32_t*)&font->dataPtr[mempos + 4];
-
-            //update position for animation font
-            if (font->hdr.flags & GFX_FONT_ANIPOS)
-            {
-                addx += gfxBuff[i << 1];
-                addy += gfxBuff[(i << 1) + 512];
-            }
-
-            //get font width and height
-            width = *(uint32_t*)&font->dataPtr[mempos + 8];
-            height = *(uint32_t*)&font->dataPtr[mempos + 12];
-            mempos += 16;
-            x += addx;
-
-            //scans raw font data
-            for (cy = 0; cy < height; cy++)
-            {
-                for (cx = 0; cx < width; cx++)
-                {
-                    data = *(uint32_t*)&font->dataPtr[mempos];
-                    putPixel(x + cx, y + addy + cy, rgba(data, 255), BLEND_MODE_ALPHA);
-                    mempos += 4;
-                }
-            }
-
-            //update next position
-            if (font->hdr.flags & GFX_FONT_ANIPOS) x -= gfxBuff[i << 1];
-            if (font->hdr.flags & GFX_FONT_FIXED) x += font->hdr.subData.width + font->hdr.subData.distance;
-            else x += width + font->hdr.subData.distance;
-        }
-    }
-}
-
-//print text with format to display screen
-void writeText(int32_t x, int32_t y, uint32_t color, uint32_t mode, const char* format, ...)
-{
-    char buffer[1024] = { 0 };
-    va_list args;
-    va_start(args, format);
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
-    writeString(x, y, color, mode, buffer);
-}
-
-//draw multi-line string font
-int32_t drawText(const char* const str[], uint32_t count, int32_t ypos)
-{
-    //check for font loaded
-    if (!gfxFonts[fontType].dataPtr) return 0;
-    for (uint32_t i = 0; i < count; i++)
-    {
-        if (ypos > -30) writeString(centerX - (getFontWidth(str[i]) >> 1), ypos, 62, 0, str[i]);
-        ypos += getFontHeight(str[i]);
-        if (ypos > cmaxY) break;
-    }
-
-    return ypos;
-}
-
-//fast show BMP image to screen (demo version)
-void showBMP(const char* fname)
-{
-    GFX_IMAGE bmp;
-    loadImage(fname, &bmp);
-    putImage(0, 0, &bmp);
-    render();
-    freeImage(&bmp);
-}
-
-//fast show 32 bits PNG image to screen (demo version)
-void showPNG(const char* fname)
-{
-    GFX_IMAGE png;
-    loadImage(fname, &png);
-
-    //background color
-    const uint32_t cols[2] = { RGB_GREY191, RGB_WHITE };
-
-    //make background
-    for (int32_t y = 0; y < texHeight; y++)
-    {
-        for (int32_t x = 0; x < texWidth; x++) fillRect(alignedSize(x), y, 8, 8, cols[((x ^ y) >> 3) & 1]);
-    }
-
-    //render image
-    putImage(0, 0, &png, BLEND_MODE_ALPHA);
-    render();
-    freeImage(&png);
-}
-
-//fast show JPG image to screen (demo version)
-void showJPG(const char* fname)
-{
-    //load jpeg image with SIMD support
-    GFX_IMAGE jpg;
-    loadImage(fname, &jpg);
-
-    //render image
-    putImage(0, 0, &jpg, BLEND_MODE_NORMAL);
-    render();
-    freeImage(&jpg);
-}
-
-//load image as 8bits texture to output buffer
-int32_t loadPNG(uint8_t* raw, RGBA* pal, const char* fname)
-{
-    //simple image loader for all supported types
-    SDL_Surface* image = IMG_Load(fname);
-    if (!image)
-    {
-        messageBox(GFX_ERROR, "Load image error: %s", IMG_GetError());
-        return 0;
-    }
-
-    //check image format type (must 256 palette colors)
-    if (image->format != SDL_PIXELFORMAT_INDEX8)
-    {
-        messageBox(GFX_ERROR, "Only 8 bits image format is supported! %s", fname);
-        return 0;
-    }
-
-    //copy raw data and palette
-    if (raw) memcpy(raw, image->pixels, image->pitch * image->h);
-    
-    //copy palette color
-    if (pal)
-    {
-        const SDL_Palette* palette = SDL_GetSurfacePalette(image);
-        if (palette) memcpy(pal, palette->colors, palette->ncolors * sizeof(RGBA));
-    }
-
-    SDL_DestroySurface(image);
-    return 1;
-}
-
-//load image as GFXLIB texture format
-int32_t loadImage(const char* fname, GFX_IMAGE* im)
-{
-    //simple image loader for all supported types
-    SDL_Surface* image = IMG_Load(fname);
-    if (!image)
-    {
-        messageBox(GFX_ERROR, "Load image error: %s", IMG_GetError());
-        return 0;
-    }
-
-    //create 32bits texture to convert image format (support alpha channel image)
-    SDL_Surface* texture = SDL_CreateSurface(image->w, image->h, SDL_PIXELFORMAT_ARGB8888);
-    if (!texture)
-    {
-        SDL_DestroySurface(image);
-        messageBox(GFX_ERROR, "Error create surface: %s!", SDL_GetError());
-        return 0;
-    }
-
-    //convert to target pixel format
-    if (SDL_BlitSurface(image, NULL, texture, NULL))
-    {
-        SDL_DestroySurface(image);
-        SDL_DestroySurface(texture);
-        messageBox(GFX_ERROR, "Error convert texture: %s!", SDL_GetError());
-        return 0;
-    }
-
-    //build GFX texture
-    if (!newImage(texture->w, texture->h, im))
-    {
-        messageBox(GFX_ERROR, "Error create new image!");
-        SDL_DestroySurface(image);
-        SDL_DestroySurface(texture);
-        return 0;
-    }
-
-    //copy data to image buffer
-    memcpy(im->mData, texture->pixels, im->mSize);
-    SDL_DestroySurface(image);
-    SDL_DestroySurface(texture);
-    return 1;
-}
-
-//load image as 32bits texture to output buffer
-int32_t loadTexture(uint32_t** txout, int32_t* txw, int32_t* txh, const char* fname)
-{
-    //simple load image from file
-    SDL_Surface* image = IMG_Load(fname);
-    if (!image)
-    {
-        messageBox(GFX_ERROR, "Error load texture: %s", IMG_GetError());
-        return 0;
-    }
-
-    //create 32bits texture
-    SDL_Surface* texture = SDL_CreateSurface(image->w, image->h, SDL_PIXELFORMAT_ARGB8888);
-    if (!texture)
-    {
-        SDL_DestroySurface(image);
-        messageBox(GFX_ERROR, "Error create surface: %s!", SDL_GetError());
-        return 0;
-    }
-
-    //convert raw data to texture format
-    if (SDL_BlitSurface(image, NULL, texture, NULL))
-    {
-        SDL_DestroySurface(image);
-        SDL_DestroySurface(texture);
-        messageBox(GFX_ERROR, "Error convert texture: %s!", SDL_GetError());
-        return 0;
-    }
-
-    //create output data buffer
-    const uint32_t size = texture->pitch * texture->h;
-    txout[0] = (uint32_t*)calloc(size, 1);
-    if (!txout[0])
-    {
-        SDL_DestroySurface(image);
-        SDL_DestroySurface(texture);
-        messageBox(GFX_ERROR, "Error alloc memory!");
-        return 0;
-    }
-
-    //copy raw data after converted
-    memcpy(txout[0], texture->pixels, size);
-    if (txw) *txw = texture->w;
-    if (txh) *txh = texture->h;
-    SDL_DestroySurface(image);
-    SDL_DestroySurface(texture);
-    return 1;
-}
-
-//initialize mouse driver and bitmap mouse image
-int32_t initMouseButton(GFX_MOUSE* mi)
-{
-    //initialize mouse image value
-    mi->msPosX   = centerX;
-    mi->msPosY   = centerY;
-    mi->msWidth  = 0;
-    mi->msHeight = 0;
-    mi->msUnder  = NULL;
-    mi->msBitmap = NULL;
-    return 1;
-}
-
-//draw mouse cursor
-void drawMouseCursor(GFX_MOUSE* mi)
-{
-    //only rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    int32_t mx = mi->msPosX - mi->msBitmap->mbHotX;
-    int32_t my = mi->msPosY - mi->msBitmap->mbHotY;
-
-    //check clip boundary
-    if (mx < cminX) mx = cminX;
-    if (mx > cmaxX) mx = cmaxX;
-    if (my < cminY) my = cminY;
-    if (my > cmaxY) my = cmaxY;
-
-    const int32_t msWidth   = mi->msWidth;
-    const int32_t msHeight  = mi->msHeight;
-    uint32_t* msUnder = (uint32_t*)mi->msUnder;
-    uint32_t* msImage = (uint32_t*)mi->msBitmap->mbData;
-
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, my
-        mul     texWidth
-        add     eax, mx
-        shl     eax, 2
-        mov     esi, drawBuff
-        add     esi, eax
-        mov     edi, msUnder
-        mov     eax, texWidth
-        sub     eax, msWidth
-        shl     eax, 2
-        push    eax
-        xor     edx, edx
-    next:
-        xor     ecx, ecx
-    step:
-        //check mouse boundary
-        mov     ebx, mx
-        add     ebx, ecx
-        cmp     ebx, cminX
-        jb      skip
-        cmp     ebx, cmaxX
-        ja      skip
-        mov     ebx, my
-        add     ebx, edx
-        cmp     ebx, cminY
-        jb      skip
-        cmp     ebx, cmaxY
-        ja      skip
-        //copy screen background to mouse under
-        movsd
-        push    esi
-        push    edi
-        //render mouse cursor to screen
-        mov     eax, edi
-        sub     eax, msUnder
-        mov     edi, esi
-        sub     edi, 4
-        mov     esi, msImage  
-        add     esi, eax
-        sub     esi, 4
-        //don't render color key
-        lodsd
-        and     eax, 00ffffffh
-        test    eax, eax
-        jz      done
-        stosd
-        jmp     done
-    skip:
-        add     esi, 4
-        add     edi, 4
-        jmp     cycle
-    done:
-        pop     edi
-        pop     esi
-    cycle:
-        inc     ecx
-        cmp     ecx, msWidth
-        jb      step
-        add     esi, [esp]
-        inc     edx
-        cmp     edx, msHeight
-        jb      next
-        pop     ebx
-    }
-#else
-    //calculate starting address
-    const int32_t addOffs = texWidth - msWidth;
-    uint32_t* srcPixels = (uint32_t*)drawBuff + (texWidth * my + mx);
-
-    //scan bitmap data
-    for (int32_t i = 0; i < msHeight; i++)
-    {
-        for (int32_t j = 0; j < msWidth; j++)
-        {
-            //check for mouse boundary
-            if (mx + j >= cminX && mx + j <= cmaxX && my + i >= cminY && my + i <= cmaxY)
-            {
-                //copy current background under cursor
-                *msUnder = *srcPixels;
-
-                //check color and copy pixel from cursor image to render buffer
-                if (*msImage & 0x00ffffff) *srcPixels = *msImage;
-            }
-
-            //goto next pixel
-            msUnder++;
-            msImage++;
-            srcPixels++;
-        }
-
-        //goto next render offset
-        if (addOffs > 0) srcPixels += addOffs;
-    }
-#endif
-}
-
-//hide the mouse cursor
-void clearMouseCursor(GFX_MOUSE* mi)
-{
-    int32_t mx = mi->msPosX - mi->msBitmap->mbHotX;
-    int32_t my = mi->msPosY - mi->msBitmap->mbHotY;
-
-    //only rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //check clip boundary
-    if (mx < cminX) mx = cminX;
-    if (mx > cmaxX) mx = cmaxX;
-    if (my < cminY) my = cminY;
-    if (my > cmaxY) my = cmaxY;
-
-    const int32_t msWidth = mi->msWidth;
-    const int32_t msHeight = mi->msHeight;
-    uint32_t* msUnder = (uint32_t*)mi->msUnder;
-
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, my
-        mul     texWidth
-        add     eax, mx
-        shl     eax, 2
-        mov     edi, drawBuff
-        add     edi, eax
-        mov     esi, msUnder
-        mov     ebx, texWidth
-        sub     ebx, msWidth
-        shl     ebx, 2
-        xor     edx, edx
-    next:
-        xor     ecx, ecx
-    step:
-        //check mouse boundary
-        mov     eax, mx
-        add     eax, ecx
-        cmp     eax, cminX
-        jb      skip
-        cmp     eax, cmaxX
-        ja      skip
-        mov     eax, my
-        add     eax, edx
-        cmp     eax, cminY
-        jb      skip
-        cmp     eax, cmaxY
-        ja      skip
-        movsd
-        jmp     done
-    skip:
-        add     edi, 4
-        add     esi, 4
-    done:
-        inc     ecx
-        cmp     ecx, msWidth
-        jb      step
-        add     edi, ebx
-        inc     edx
-        cmp     edx, msHeight
-        jb      next
-    }
-#else
-    //calculate starting address
-    const int32_t addOffs = texWidth - msWidth;
-    uint32_t* pdata = (uint32_t*)drawBuff;
-    uint32_t* dstPixels = &pdata[texWidth * my + mx];
-
-    //scan bitmap data
-    for (int32_t i = 0; i < msHeight; i++)
-    {
-        for (int32_t j = 0; j < msWidth; j++)
-        {
-            //check for mouse boundary
-            if (mx + j >= cminX && mx + j <= cmaxX && my + i >= cminY && my + i <= cmaxY) *dstPixels = *msUnder;
-            dstPixels++;
-            msUnder++;
-        }
-
-        if (addOffs > 0) dstPixels += addOffs;
-    }
-#endif
- }
-
-//draw bitmap button
-void drawButton(GFX_BUTTON* btn)
-{
-    //only rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //calculate coordinator
-    const int32_t x1 = btn->btPosX;
-    const int32_t y1 = btn->btPosY;
-    const int32_t x2 = (x1 + btn->btWidth) - 1;
-    const int32_t y2 = (y1 + btn->btHeight) - 1;
-
-    //clip button image to context boundaries
-    const int32_t lx1 = (x1 > cminX) ? x1 : cminX;
-    const int32_t ly1 = (y1 > cminY) ? y1 : cminY;
-    const int32_t lx2 = (x2 < cmaxX) ? x2 : cmaxX;
-    const int32_t ly2 = (y2 < cmaxY) ? y2 : cmaxY;
-
-    //validate boundaries
-    if (lx1 >= lx2) return;
-    if (ly1 >= ly2) return;
-
-    //initialize loop variables
-    const int32_t lbWidth = (lx2 - lx1) + 1;
-    const int32_t lbHeight = (ly2 - ly1) + 1;
-
-    //check for loop
-    if (!lbWidth || !lbHeight) return;
-
-    const int32_t btnWidth = btn->btWidth;
-    void* btnData = btn->btData[btn->btState % BUTTON_STATE_COUNT];
-
-#ifdef _USE_ASM
-    __asm {
-        mov     edi, drawBuff
-        mov     eax, ly1
-        mul     texWidth
-        add     eax, lx1
-        shl     eax, 2
-        add     edi, eax
-        mov     esi, btnData
-        mov     eax, ly1
-        sub     eax, y1
-        mul     btnWidth
-        mov     ebx, lx1
-        sub     ebx, x1
-        add     eax, ebx
-        shl     eax, 2
-        add     esi, eax
-        mov     ebx, texWidth
-        sub     ebx, lbWidth
-        shl     ebx, 2
-        mov     edx, btnWidth
-        sub     edx, lbWidth
-        shl     edx, 2
-    next:
-        mov     ecx, lbWidth
-    plot:
-        lodsd
-        and     eax, 00ffffffh
-        test    eax, eax
-        jz      skip
-        stosd
-        jmp     done
-    skip:
-        add     edi, 4
-    done:
-        dec     ecx
-        jnz     plot
-        add     edi, ebx
-        add     esi, edx
-        dec     lbHeight
-        jnz     next
-    }
-#else
-    //calculate starting address
-    const int32_t addDstOffs = texWidth - lbWidth;
-    const int32_t addImgOffs = btnWidth - lbWidth;
-
-    uint32_t* dstData = (uint32_t*)drawBuff;
-    uint32_t* srcData = (uint32_t*)btnData;
-    uint32_t* dstPixels = &dstData[texWidth * ly1 + lx1];
-    uint32_t* srcPixels = &srcData[btnWidth * (ly1 - y1) + (lx1 - x1)];
-
-    //scan button image
-    for (int32_t i = 0; i < lbHeight; i++)
-    {
-        for (int32_t j = 0; j < lbWidth; j++)
-        {
-            if (*srcPixels & 0x00ffffff) *dstPixels = *srcPixels;
-            dstPixels++;
-            srcPixels++;
-        }
-        if (addDstOffs > 0) dstPixels += addDstOffs;
-        if (addImgOffs > 0) srcPixels += addImgOffs;
-    }
-#endif
-}
-
-//load mouse sprite pointer
-void loadMouse(const char* fname, GFX_MOUSE* mi, GFX_BITMAP* mbm)
-{
-    //load mouse pointers
-    GFX_IMAGE msPointer = { 0 };
-    if (!loadImage(fname, &msPointer))
-    {
-        messageBox(GFX_ERROR, "Cannot load mouse image:%s", fname);
-        return;
-    }
-
-    const int32_t msHeight = msPointer.mHeight;
-    const int32_t msWidth = msPointer.mWidth / 9;
-    const uint32_t msize = msWidth * msHeight;
-    const uint32_t bytesLine = msWidth * bytesPerPixel;
-
-    //allocate memory for mouse under background
-    mi->msUnder = (uint8_t*)calloc(msize, bytesPerPixel);
-    if (!mi->msUnder)
-    {
-        messageBox(GFX_ERROR, "Error alloc memory!");
-        return;
-    }
-
-    //init mouse image width and height
-    mi->msWidth = msWidth;
-    mi->msHeight = msHeight;
-
-    //copy mouse cursors
-    for (int32_t i = 0; i < MOUSE_SPRITE_COUNT; i++)
-    {
-        mbm[i].mbData = (uint8_t*)calloc(msize, bytesPerPixel);
-        if (!mbm[i].mbData)
-        {
-            messageBox(GFX_ERROR, "Error create mouse sprite:%d!", i);
-            return;
-        }
-
-        //initialize mouse state
-        mbm[i].mbHotX = 12;
-        mbm[i].mbHotY = 12;
-        mbm[i].mbNext = &mbm[i + 1];
-
-        //copy data from mouse image to gfx mouse struct
-        const int32_t mwidth = i * msWidth;
-        for (int32_t y = 0; y < msHeight; y++)
-        {
-            uint8_t* dst = &mbm[i].mbData[y * bytesLine];
-            const uint8_t* psrc = (const uint8_t*)msPointer.mData;
-            const uint8_t* src = &psrc[(mwidth + y * msPointer.mWidth) * bytesPerPixel];
-            memcpy(dst, src, bytesLine);
-        }
-    }
-
-    //init current and next mouse animated
-    mbm[0].mbHotX = 7;
-    mbm[0].mbHotY = 2;
-    mbm[0].mbNext = &mbm[0];
-    mbm[8].mbNext = &mbm[1];
-    freeImage(&msPointer);
-}
-
-//load GFX button
-void loadButton(const char* fname, GFX_BUTTON* btn)
-{
-    //load button
-    GFX_IMAGE img = { 0 };
-    if (!loadImage(fname, &img))
-    {
-        messageBox(GFX_ERROR, "Cannot load image button:%s", fname);
-        return;
-    }
-
-    const int32_t btnHeight = img.mHeight;
-    const int32_t btnWidth = img.mWidth / BUTTON_STATE_COUNT;
-    const uint32_t msize = btnWidth * btnHeight;
-    const uint32_t bytesLine = btnWidth * bytesPerPixel;
-
-    btn->btWidth = btnWidth;
-    btn->btHeight = btnHeight;
-
-    //create button
-    for (int32_t i = 0; i < BUTTON_STATE_COUNT; i++)
-    {
-        btn->btData[i] = (uint8_t*)calloc(msize, bytesPerPixel);
-        if (!btn->btData[i])
-        {
-            messageBox(GFX_ERROR, "Error create button:%d!", i);
-            return;
-        }
-
-        //copy button data
-        const int32_t bwidth = i * btnWidth;
-        for (int32_t y = 0; y < btnHeight; y++)
-        {
-            uint8_t* dst = &btn->btData[i][y * bytesLine];
-            const uint8_t* psrc = (const uint8_t*)img.mData;
-            const uint8_t* src = &psrc[(bwidth + y * img.mWidth) * bytesPerPixel];
-            memcpy(dst, src, bytesLine);
-        }
-    }
-
-    freeImage(&img);
-}
-
-//release mouse sprite
-void freeMouse(GFX_MOUSE* mi, GFX_BITMAP* mbm)
-{
-    //cleanup mouse bitmap
-    for (int32_t i = 0; i < MOUSE_SPRITE_COUNT; i++)
-    {
-        if (mbm[i].mbData)
-        {
-            free(mbm[i].mbData);
-            mbm[i].mbData = NULL;
-        }
-    }
-
-    //cleanup mouse underground
-    clearMouseCursor(mi);
-    if (mi->msUnder)
-    {
-        free(mi->msUnder);
-        mi->msUnder = NULL;
-    }
-}
-
-//free button
-void freeButton(GFX_BUTTON* btn)
-{
-    for (int32_t i = 0; i < BUTTON_STATE_COUNT; i++)
-    {
-        if (btn->btData[i])
-        {
-            free(btn->btData[i]);
-            btn->btData[i] = NULL;
-        }
-    }
-}
-
-//simulation mouse event handler
-void handleMouseButton()
-{
-    const char* const bkg[] = { "assets/1lan8.bmp", "assets/1lan16.bmp", "assets/1lan24.bmp", "assets/1lan32.bmp" };
-
-    //init and setup bitmap mouse and button
-    GFX_MOUSE mi = { 0 };
-    if (!initMouseButton(&mi))
-    {
-        messageBox(GFX_ERROR, "Error initialize mouse button!");
-        return;
-    }
-    
-    GFX_BITMAP mbm[MOUSE_SPRITE_COUNT] = { 0 };
-    loadMouse("assets/mpointer24.png", &mi, mbm);
-
-    GFX_BUTTON btn[BUTTON_HANDLE_COUNT] = { 0 };
-    loadButton("assets/clickbtn24.png", &btn[0]);
-    loadButton("assets/exitbtn24.png", &btn[1]);
-
-    //init button 'click me'
-    btn[0].btPosX = centerX - btn[0].btWidth - 20;
-    btn[0].btPosY = centerY - (btn[0].btHeight >> 1);
-    btn[0].btState = BUTTON_STATE_NORMAL;
-
-    //init button 'exit'
-    btn[1].btPosX = centerX + btn[1].btWidth + 10;
-    btn[1].btPosY = centerY - (btn[1].btHeight >> 1);
-    btn[1].btState = BUTTON_STATE_NORMAL;
-
-    //hide mouse pointer
-    hideMouseCursor();
-
-    //install user-define mouse handler
-    setMousePosition(centerX, centerY);
-
-    //init mouse normal and wait cursor bitmap
-    GFX_BITMAP* msNormal = &mbm[0];
-    GFX_BITMAP* msWait = &mbm[1];
-
-    mi.msBitmap = msNormal;
-
-    //setup screen background
-    showBMP(bkg[bytesPerPixel - 1]);
-    drawMouseCursor(&mi);
-
-    //update last mouse pos
-    int32_t lastx = centerX;
-    int32_t lasty = centerY;
-    uint64_t lastTime = getTime();
-    
-    //current mouse pointer
-    GFX_BITMAP* msNew = NULL;
-
-    int32_t i = 0, done = 0;
-    int32_t mcx = 0, mdx = 0, mbx = 0;
-    uint32_t needDraw = 0xffff;
-
-    do
-    {
-        //get current mouse coordinate
-        getMouseState(&mcx, &mdx, &mbx, NULL);
-
-        //limit pointer range
-        if (mcx < centerX - 100) mcx = centerX - 100;
-        if (mcx > centerX + 110) mcx = centerX + 110;
-        if (mdx < centerY - 100) mdx = centerY - 100;
-        if (mdx > centerY + 110) mdx = centerY + 110;
-
-        //only draw if needed
-        if (needDraw)
-        {
-            //clear old mouse position
-            clearMouseCursor(&mi);
-
-            //draw buttons
-            if (needDraw > 1)
-            {
-                for (i = 0; i < BUTTON_HANDLE_COUNT; i++)
-                {
-                    if (needDraw & (2 << i)) drawButton(&btn[i]);
-                }
-            }
-
-            //update new button bitmap
-            if (msNew) mi.msBitmap = msNew;
-
-            //update mouse position and draw new mouse position
-            mi.msPosX = mcx;
-            mi.msPosY = mdx;
-            drawMouseCursor(&mi);
-
-            //update last ticks count and turn off drawable
-            lastTime = getTime();
-            needDraw = 0;
-            msNew = NULL;
-        }
-
-        //check for draw new state button
-        if (getTime() != lastTime)
-        {
-            if (mi.msBitmap != mi.msBitmap->mbNext)
-            {
-                needDraw = 1;
-                mi.msBitmap = mi.msBitmap->mbNext;
-            }
-            else
-            {
-                lastTime = getTime();
-            }
-        }
-
-        //update drawable when position changing
-        if (lastx != mcx || lasty != mdx)
-        {
-            lastx = mcx;
-            lasty = mdx;
-            needDraw = 1;
-        }
-
-        //check for new button state
-        for (i = 0; i < BUTTON_HANDLE_COUNT; i++)
-        {
-            //check if mouse inside the button region
-            if (mcx >= btn[i].btPosX && mcx <= btn[i].btPosX + btn[i].btWidth && mdx >= btn[i].btPosY && mdx <= btn[i].btPosY + btn[i].btHeight)
-            {
-                if (mbx == 0 && btn[i].btState == BUTTON_STATE_PRESSED)
-                {
-                    btn[i].btState = BUTTON_STATE_ACTIVE;
-                    needDraw |= (2 << i);
-                    if (i == 0)
-                    {
-                        if (mi.msBitmap == msNormal) msNew = msWait;
-                        else msNew = msNormal;
-                    }
-                    else if (i == 1) done = 1;
-                }
-                else if (mbx == 1)
-                {
-                    btn[i].btState = BUTTON_STATE_PRESSED;
-                    needDraw |= (2 << i);
-                }
-                else if (btn[i].btState == BUTTON_STATE_NORMAL && mbx == 0)
-                {
-                    btn[i].btState = BUTTON_STATE_ACTIVE;
-                    needDraw |= (2 << i);
-                }
-                else if (btn[i].btState == BUTTON_STATE_WAITING)
-                {
-                    if (mbx == 1)
-                    {
-                        btn[i].btState = BUTTON_STATE_PRESSED;
-                    }
-                    else
-                    {
-                        btn[i].btState = BUTTON_STATE_ACTIVE;
-                    }
-                    needDraw |= (2 << i);
-                }
-            }
-            else if (btn[i].btState == BUTTON_STATE_ACTIVE)
-            {
-                btn[i].btState = BUTTON_STATE_NORMAL;
-                needDraw |= (2 << i);
-            }
-            else if (btn[i].btState == BUTTON_STATE_PRESSED && mbx == 1)
-            {
-                btn[i].btState = BUTTON_STATE_WAITING;
-                needDraw |= (2 << i);
-            }
-            else if (btn[i].btState == BUTTON_STATE_WAITING && mbx == 0)
-            {
-                btn[i].btState = BUTTON_STATE_NORMAL;
-                needDraw |= (2 << i);
-            }
-        }
-
-        render();
-        delay(FPS_60);
-    } while (!finished(SDL_SCANCODE_RETURN) && !done);
-
-    //release mouse bitmap and callback handler
-    freeMouse(&mi, mbm);
-    freeButton(&btn[0]);
-    freeButton(&btn[1]);
-    showMouseCursor();
-}
-
-//create texture plasma
-void createPlasma(uint8_t* dx, uint8_t* dy, const uint8_t* sint, const uint8_t* cost, GFX_IMAGE* img)
-{
-#ifdef _USE_ASM
-    const uint8_t lx = (*dx) += 2;
-    const uint8_t ly = (*dy)--;
-    
-    void* data = img->mData;
-    const uint32_t ofs = img->mWidth;
-    const uint8_t sx = img->mWidth >> 1;
-    const uint8_t sy = img->mHeight >> 1;
-
-    __asm {
-        mov     edi, data
-        xor     eax, eax
-        xor     dh, dh
-    next0:
-        xor     bh, bh
-        mov     al, dh
-        mov     bl, ly
-        add     ax, bx
-        cmp     ax, 255
-        jbe     skip0
-        sub     ax, 255
-    skip0:
-        mov     esi, sint
-        add     esi, eax
-        mov     cl, [esi]
-        mov     al, lx
-        mov     esi, sint
-        add     esi, eax
-        mov     ch, [esi]
-        xor     dl, dl
-    next1:
-        xor     bh, bh
-        mov     al, dl
-        mov     bl, cl
-        add     ax, bx
-        cmp     ax, 255
-        jbe     skip1
-        sub     ax, 255
-    skip1:
-        mov     esi, sint
-        add     esi, eax
-        mov     bl, [esi]
-        mov     al, dh
-        add     al, ch
-        mov     esi, cost
-        add     esi, eax
-        add     bl, [esi]
-        shr     bl, 1
-        add     bl, 128
-        mov     bh, bl
-        mov     esi, ofs
-        mov     [edi], bx
-        mov     [edi + esi], bx
-        add     edi, 2
-        inc     dl
-        cmp     dl, sx
-        jb      next1
-        add     edi, esi
-        inc     dh
-        cmp     dh, sy
-        jb      next0
-    }
-#else
-    const uint8_t lx = (*dx) += 2;
-    const uint8_t ly = (*dy)--;
-    const uint16_t cwidth = img->mWidth >> 1;
-    const uint16_t cheight = img->mHeight >> 1;
-
-    uint16_t ofs = 0;
-    uint16_t* data = (uint16_t*)img->mData;
-
-    for (uint16_t sy = 0; sy < cheight; sy++)
-    {
-        uint16_t val = sy + ly;
-        if (val > 255) val -= 255;
-
-        const uint8_t cl = sint[val];
-        const uint8_t ch = sint[lx];
-
-        for (uint16_t sx = 0; sx < cwidth; sx++)
-        {
-            val = cl + sx;
-            if (val > 255) val -= 255;
-            val = (sint[val] + cost[(ch + sy) & 0xff]) & 0xff;
-            val = (val >> 1) + 128;
-            val = (val << 8) | (val & 0xff);
-            data[ofs] = val;
-            data[ofs + cwidth] = val;
-            ofs++;
-        }
-        ofs += cwidth;
-    }
-#endif
-}
-
-//initialize texture plasma
-void initPlasma(uint8_t* sint, uint8_t* cost)
-{
-    int32_t i = 0;
-    RGBA pal[256] = { 0 };
-    memset(pal, 0, sizeof(pal));
-
-    for (i = 0; i < 256; i++)
-    {
-        sint[i] = uint8_t(sin(2 * M_PI * i / 255) * 128 + 128);
-        cost[i] = uint8_t(cos(2 * M_PI * i / 255) * 128 + 128);
-    }
-
-    for (i = 0; i < 64; i++)
-    {
-        pal[i      ].r = i;
-        pal[i      ].g = 0;
-        pal[i      ].b = i << 2;
-        pal[127 - i].r = i;
-        pal[127 - i].g = 0;
-        pal[127 - i].b = i << 2;
-        pal[127 + i].r = i << 2;
-        pal[127 + i].g = i << 1;
-        pal[127 + i].b = 0;
-        pal[254 - i].r = i << 2;
-        pal[254 - i].g = i << 1;
-        pal[254 - i].b = 0;
-    }
-
-    for (i = 127; i >= 0; i--)
-    {
-        pal[i + 128].r = pal[i << 1].r;
-        pal[i + 128].g = pal[i << 1].g;
-        pal[i + 128].b = pal[i << 1].b;
-    }
-
-    setPalette(pal);
-}
-
-//FX-effect: calculate tunnel buffer
-void prepareTunnel(const GFX_IMAGE* dimg, uint8_t* buff1, uint8_t* buff2)
-{
-    const int32_t maxAng = 2048;
-    const double angDec = 0.85;
-    const double dstInc = 0.02;
-    const double preCalc = M_PI / (maxAng >> 2);
-
-    const int32_t dcx = dimg->mWidth >> 1;
-    const int32_t dcy = dimg->mHeight >> 1;
-
-    double tz = 250.0;
-    double dst = 1.0;
-    double ang = maxAng - 1.0;
-    
-    do {
-        const int32_t tx = fround(tz * sin(ang * preCalc)) + dcx;
-        const int32_t ty = fround(tz * cos(ang * preCalc)) + dcy;
-
-        ang -= angDec;
-        if (ang < 0)
-        {
-            ang += maxAng;
-            dst += dst * dstInc;
-            tz -= angDec;
-        }
-
-        if (tx >= 0 && tx < dimg->mWidth && ty >= 0 && ty < dimg->mHeight)
-        {
-            const int32_t ofs = ty * dimg->mWidth + tx;
-            buff1[ofs] = fround(dst);
-            buff2[ofs] = fround(dst - ang / 4);
-        }
-    } while (tz >= 0);
-}
-
-//FX-effect: draw tunnel
-void drawTunnel(GFX_IMAGE* dimg, const GFX_IMAGE* simg, uint8_t* buff1, uint8_t* buff2, uint8_t* ang, uint8_t step)
-{
-    uint32_t nsize = dimg->mSize >> 2;
-    uint32_t* pdst = (uint32_t*)dimg->mData;
-    const uint32_t* psrc = (const uint32_t*)simg->mData;
-    
-    //only rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    *ang += step;
-
-#ifdef _USE_ASM
-    uint8_t tmp = *ang;
-    __asm {
-        mov     ecx, ang
-        mov     edi, pdst
-        mov     esi, psrc
-        mov     ebx, buff1
-        mov     edx, buff2
-        xor     ecx, ecx
-    again:
-        mov     cl, [edx]
-        mov     ch, [ebx]
-        add     ch, tmp
-        mov     eax, [esi + ecx * 4]
-        stosd
-        inc     edx
-        inc     ebx
-        dec     nsize
-        jnz     again
-    }
-#else
-    while (nsize--)
-    {
-        const uint8_t val = *buff1 + *ang;
-        *pdst++ = psrc[(val << 8) + *buff2];
-        buff1++;
-        buff2++;
-    }
-#endif
-}
-
-//FX-effect: blur image buffer
-void blurImageEx(GFX_IMAGE* dst, const GFX_IMAGE* src, int32_t blur)
-{
-    uint8_t* pdst = (uint8_t*)dst->mData;
-    const uint8_t* psrc = (const uint8_t*)src->mData;
-    const uint32_t nsize = src->mSize >> 2;
-
-    //only support for rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //check for small source size
-    if (blur <= 0 || nsize <= uint32_t(2 * blur)) return;
-
-    //check for MAX blur
-    if (blur > 127) blur = 127;
-
-#ifdef _USE_ASM
-    __asm {
-        mov     esi, psrc
-        mov     edi, pdst
-        mov     eax, blur
-        shl     eax, 1
-        mov     ecx, nsize
-        sub     ecx, eax
-        push    ecx
-        mov     eax, 4
-        xor     ebx, ebx
-    nr1bx:
-        xor     ecx, ecx
-        push    esi
-        push    edi
-        push    eax
-    lp1xb:
-        xor     eax, eax
-        mov     al, [esi]
-        push    edi
-        mov     edx, blur
-        add     eax, edx
-        mov     edi, 1
-    lpi1xb:
-        mov     bl, [esi + edi * 4]
-        add     eax, ebx
-        cmp     edi, ecx
-        ja      nb1xb
-        neg     edi
-        mov     bl, [esi + edi * 4]
-        neg     edi
-        add     eax, ebx
-        inc     edx
-    nb1xb:
-        inc     edi
-        cmp     edi, blur
-        jnae    lpi1xb
-        pop     edi
-        mov     ebx, edx
-        xor     edx, edx
-        div     ebx
-        mov     edx, ebx
-        mov     [edi], al
-        add     esi, 4
-        add     edi, 4
-        inc     ecx
-        cmp     ecx, blur
-        jne     lp1xb
-        pop     eax
-        pop     edi
-        pop     esi
-        inc     edi
-        inc     esi
-        dec     eax
-        jnz     nr1bx
-        dec     ecx
-        shl     ecx, 2
-        add     esi, ecx
-        add     edi, ecx
-        pop     ecx
-        mov     edx, blur
-        add     edx, edx
-        inc     edx
-        mov     eax, 4
-    nrxb:
-        push    ecx
-        push    esi
-        push    edi
-        push    eax
-    lpxb:
-        xor     eax, eax
-        mov     al, [esi]
-        push    ecx
-        mov     ecx, blur
-        add     eax, ecx
-    lpixb:
-        mov     bl, [esi + ecx * 4]
-        neg     ecx
-        add     eax, ebx
-        mov     bl, [esi + ecx * 4]
-        neg     ecx
-        add     eax, ebx
-        dec     ecx
-        jnz     lpixb
-        pop     ecx
-        mov     ebx, edx
-        xor     edx, edx
-        div     ebx
-        mov     edx, ebx
-        mov     [edi], al
-        add     esi, 4
-        add     edi, 4
-        dec     ecx
-        jnz     lpxb
-        pop     eax
-        pop     edi
-        pop     esi
-        pop     ecx
-        inc     edi
-        inc     esi
-        dec     eax
-        jnz     nrxb
-        dec     ecx
-        shl     ecx, 2
-        add     esi, ecx
-        add     edi, ecx
-        mov     eax, 4
-    nr2xb:
-        mov     ecx, blur
-        push    esi
-        push    edi
-        push    eax
-    lp2xb:
-        xor     eax, eax
-        mov     al, [esi]
-        push    edi
-        mov     edx, blur
-        add     eax, edx
-        mov     edi, 1
-    lpi2xb:
-        cmp     edi, ecx
-        jae     nb2xb
-        mov     bl, [esi + edi * 4]
-        add     eax, ebx
-        inc     edx
-    nb2xb:
-        neg     edi
-        mov     bl, [esi + edi * 4]
-        neg     edi
-        add     eax, ebx
-        inc     edi
-        cmp     edi, blur
-        jnae    lpi2xb
-        pop     edi
-        mov     ebx, edx
-        xor     edx, edx
-        div     ebx
-        mov     edx, ebx
-        mov     [edi], al
-        add     esi, 4
-        add     edi, 4
-        dec     ecx
-        jnz     lp2xb
-        pop     eax
-        pop     edi
-        pop     esi
-        inc     edi
-        inc     esi
-        dec     eax
-        jnz     nr2xb
-    }
-#else
-    int32_t i = 0, j = 0, k = 0;
-    int32_t ofs = 0, idx = 0;
-    int32_t col1 = 0, col2 = 0;
-    int32_t tsize = nsize - (blur << 1);
-
-    //compute each a,r,g,b channel
-    for (i = 0; i < 4; i++)
-    {
-        ofs = idx;
-        for (j = 0; j < blur; j++)
-        {
-            col1 = blur;
-            col2 = psrc[ofs] + col1;
-            for (k = 1; k < blur; k++)
-            {
-                col2 += psrc[ofs + (k << 2)];
-                if (k <= j)
-                {
-                    col2 += psrc[ofs - (k << 2)];
-                    col1++;
-                }
-            }
-            pdst[ofs] = (col2 / col1) & 0xff;
-            ofs += 4;
-        }
-        idx++;
-    }
-    
-    idx += (blur - 1) << 2;
-    col1 = (blur << 1) + 1;
-
-    //compute each a,r,g,b channel
-    for (i = 0; i < 4; i++)
-    {
-        ofs = idx;
-        for (j = 0; j < tsize; j++)
-        {
-            col2 = psrc[ofs] + blur;
-            for (k = blur; k > 0; k--)
-            {
-                col2 += psrc[ofs + (k << 2)];
-                col2 += psrc[ofs - (k << 2)];
-            }
-            pdst[ofs] = (col2 / col1) & 0xff;
-            ofs += 4;
-        }
-        idx++;
-    }
-    
-    tsize--;
-    tsize <<= 2;
-    idx += tsize;
-
-    //compute each a,r,g,b channel
-    for (i = 0; i < 4; i++)
-    {
-        ofs = idx;
-        for (j = blur; j > 0; j--)
-        {
-            col1 = blur;
-            col2 = psrc[ofs] + col1;
-            for (k = 1; k < blur; k++)
-            {
-                if (k < j)
-                {
-                    col2 += psrc[ofs + (k << 2)];
-                    col1++;
-                }
-                col2 += psrc[ofs - (k << 2)];
-            }
-            pdst[ofs] = (col2 / col1) & 0xff;
-            ofs += 4;
-        }
-        idx++;
-    }
-#endif
-}
-
-//FX-effect: brightness image buffer
-void brightnessImage(GFX_IMAGE* dst, GFX_IMAGE* src, uint8_t bright)
-{
-    ARGB* psrc = (ARGB*)src->mData;
-    const uint32_t nsize = src->mSize >> 2;
-
-    //only support fro rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //check light range
-    if (bright == 0 || bright == 255) return;
-
-#ifdef _USE_ASM
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    __asm {
-        mov     ecx, nsize
-        mov     edi, pdst
-        mov     esi, psrc
-        xor     edx, edx
-        mov     dl, bright
-    next:
-        mov     ebx, [esi]
-        mov     al, bh
-        and     ebx, 00ff00ffh
-        imul    ebx, edx
-        shr     ebx, 8
-        mul     dl
-        mov     bh, ah
-        mov     eax, ebx
-        stosd
-        add     esi, 4
-        dec     ecx
-        jnz     next
-    }
-#else
-    for (uint32_t i = 0; i < nsize; i++)
-    {
-        psrc->r = (psrc->r * bright) >> 8;
-        psrc->g = (psrc->g * bright) >> 8;
-        psrc->b = (psrc->b * bright) >> 8;
-        psrc++;
-    }
-#endif
-}
-
-//FX-effect: block-out image buffer
-void blockOutMid(uint32_t* dst, uint32_t* src, int32_t count, int32_t val)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     edx, count
-        mov     ebx, val
-        mov     edi, dst
-        mov     esi, src
-        mov     ecx, ebx
-        shr     ecx, 17
-        lea     esi, [esi + ecx * 4 + 4]
-        mov     ecx, ebx
-        shr     ecx, 16
-        and     ebx, 00FFFFh
-    next:
-        mov     eax, [esi]
-        sub     edx, ecx
-        cmp     edx, 0
-        jg      skip
-        add     ecx, edx
-        rep     stosd
-        jmp     done
-    skip:
-        lea     esi, [esi + ecx * 4]
-        rep     stosd
-        mov     ecx, ebx
-        cmp     edx, 0
-        jg      next
-    done:
-    }
-#else
-    int32_t i = 0;
-    int32_t mid = val >> 16;
-    const int32_t block = val & 0xffff;
-    uint32_t* psrc = &src[(val >> 17) + 1];
-    
-    do {
-        count -= mid;
-        if (count <= 0)
-        {
-            mid += count;
-            for (i = 0; i < mid; i++) *dst++ = *psrc;
-        }
-        else
-        {
-            for (i = 0; i < mid; i++) *dst++ = *psrc;
-            psrc += mid;
-            mid = block;
-        }
-    } while (count > 0);
-#endif
-}
-
-//FX-effect: brightness alpha buffer
-void brightnessAlpha(GFX_IMAGE* img, uint8_t bright)
-{
-    ARGB* data = (ARGB*)img->mData;
-    const uint32_t nsize = img->mSize >> 2;
-    
-    //only support 32bit color
-    if (bitsPerPixel != 32) return;
-
-#ifdef _USE_ASM
-    __asm {
-        mov     ecx, nsize
-        mov     edi, data
-        xor     eax, eax
-        mov     bl, bright
-    next:
-        mov     al, [edi + 3]
-        mul     bl
-        mov     [edi + 3], ah
-        add     edi, 4
-        dec     ecx
-        jnz     next
-    }
-#else
-    for (uint32_t i = 0; i < nsize; i++)
-    {
-        data->a = uint16_t(data->a * bright) >> 8;
-        data++;
-    }
-#endif
-}
-
-//FX-effect: block-out and middle image buffer
-void blockOutMidImage(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t xb, int32_t yb)
-{
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    uint32_t* psrc = (uint32_t*)src->mData;
-
-    //only support for rgb mode
-    if (bitsPerPixel <= 8) return;
-
-    //check minimum blocking
-    if (xb <= 0) xb = 1;
-    if (yb <= 0) yb = 1;
-
-    //nothing to do, make source and destination are the same
-    if (xb == 1 && yb == 1) memcpy(pdst, psrc, src->mSize);
-    else
-    {
-        //calculate delta x, delta y
-        const int32_t cx = (((src->mWidth >> 1) % xb) << 16) | xb;
-        const int32_t cy = (yb - ((src->mHeight >> 1) % yb));
-
-        //process line by line
-        for (int32_t y = 0; y < src->mHeight; y++)
-        {
-            //blocking line by line
-            if ((y + cy) % yb == 0 || y == 0)
-            {
-                int32_t mid = y + (cy >> 1);
-                if (mid >= src->mHeight) mid = (src->mHeight + y) >> 1;
-                blockOutMid(pdst, &psrc[mid * src->mWidth], src->mWidth, cx);
-            }
-            //already blocking, copy it
-            else memcpy(pdst, pdst - dst->mWidth, dst->mRowBytes);
-            pdst += dst->mWidth;
-        }
-    }
-}
-
-//FX-effect: fade circle image buffer
-void fadeOutCircle(double pc, int32_t size, int32_t type, uint32_t col)
-{
-    int32_t val = 0, x = 0, y = 0;
-
-    const int32_t dsize = size << 1;
-    const int32_t smax = int32_t(size * 1.4);
-
-    if (pc < 0.0) pc = 0.0;
-    if (pc > 100.0) pc = 100.0;
-
-    switch (type)
-    {
-    case 0:
-        for (y = 0; y < texHeight / dsize; y++)
-        {
-            val = int32_t(smax * pc / 100.0);
-            for (x = 0; x < texWidth / dsize; x++) fillCircle(x * dsize + size, y * dsize + size, val, col);
-        }
-        break;
-
-    case 1:
-        for (y = 0; y < texHeight / dsize; y++)
-        {
-            for (x = 0; x < texWidth / dsize; x++)
-            {
-                val = int32_t((smax + (double(texHeight) / dsize - y) * 2.0) * pc / 100.0);
-                if (val > smax) val = smax;
-                fillCircle(x * dsize + size, y * dsize + size, val, col);
-            }
-        }
-        break;
-
-    case 2:
-        for (y = 0; y < texHeight / dsize; y++)
-        {
-            for (x = 0; x < texWidth / dsize; x++)
-            {
-                val = int32_t((smax + (double(texWidth) / dsize - x) * 2.0) * pc / 100.0);
-                if (val > smax) val = smax;
-                fillCircle(x * dsize + size, y * dsize + size, val, col);
-            }
-        }
-        break;
-
-    case 3:
-        for (y = 0; y < texHeight / dsize; y++)
-        {
-            for (x = 0; x < texWidth / dsize; x++)
-            {
-                val = int32_t((smax + (double(texWidth) / size - (double(x) + y))) * pc / 100.0);
-                if (val > smax) val = smax;
-                fillCircle(x * dsize + size, y * dsize + size, val, col);
-            }
-        }
-        break;
-
-    default:
-        break;
-    }
-}
-
-//FX-effect: scale-up image buffer
-void scaleUpLine(uint32_t* dst, const uint32_t* src, int32_t* tables, int32_t count, int32_t yval)
-{
-#ifdef _USE_ASM
-    yval <<= 2;
-    __asm {
-        mov     ecx, count
-        mov     ebx, src
-        add     ebx, yval
-        mov     esi, tables
-        mov     edi, dst
-    next:
-        lodsd
-        mov     eax, [ebx + eax * 4]
-        stosd
-        dec     ecx
-        jnz     next
-    }
-#else
-    for (int32_t i = 0; i < count; i++) *dst++ = src[tables[i] + yval];
-#endif
-}
-
-//FX-effect: scale-up image buffer
-void scaleUpImage(GFX_IMAGE* dst, const GFX_IMAGE* src, int32_t* tables, int32_t xfact, int32_t yfact)
-{
-    int32_t i = 0, y = 0;
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    const uint32_t* psrc = (const uint32_t*)src->mData;
-
-    //check color mode
-    if (bitsPerPixel <= 8)
-    {
-        messageBox(GFX_ERROR, "Wrong pixel format!");
-        return;
-    }
-
-    //init lookup table
-    for (i = 0; i < src->mWidth; i++) tables[i] = fround(double(i) / (intmax_t(src->mWidth) - 1) * ((intmax_t(src->mWidth) - 1) - (intmax_t(xfact) << 1))) + xfact;
-
-    //scale up line by line
-    for (i = 0; i < src->mHeight; i++)
-    {
-        y = fround(double(i) / (intmax_t(src->mHeight) - 1) * ((intmax_t(src->mHeight) - 1) - (intmax_t(yfact) << 1)) + yfact);
-        scaleUpLine(pdst, psrc, tables, src->mWidth, y * src->mWidth);
-        pdst += dst->mWidth;
-    }
-}
-
-//FX-effect: blur image buffer
-void blurImage(const GFX_IMAGE* img)
-{
-    if (bitsPerPixel <= 8)
-    {
-        messageBox(GFX_ERROR, "Wrong pixel format!");
-        return;
-    }
-
-    const uint32_t width = img->mWidth;
-    const uint32_t* data = (const uint32_t*)img->mData;
-
-#ifdef _USE_ASM
-    uint32_t height = img->mHeight;
-    __asm {
-        mov     edi, data
-    step:
-        mov     edx, width
-        sub     edx, 2
-        push    edx
-        mov     edx, width
-        shl     edx, 2
-        mov     ebx, [edi]
-        mov     esi, [edi + 4]
-        and     ebx, 00ff00ffh
-        and     esi, 00ff00ffh
-        add     ebx, ebx
-        mov     ecx, [edi + edx]
-        add     esi, ebx
-        and     ecx, 00ff00ffh
-        add     esi, ecx
-        mov     al, [edi + 5]
-        mov     bl, [edi + 1]
-        add     ebx, ebx
-        mov     cl, [edi + edx + 1]
-        add     eax, ebx
-        xor     ebx, ebx
-        shr     esi, 2
-        add     eax, ecx
-        and     esi, 00ff00ffh
-        shl     eax, 6
-        and     eax, 0000ff00h
-        or      eax, esi
-        stosd
-    next:
-        mov     esi, [edi - 4]
-        mov     ecx, [edi + 4]
-        and     esi, 00ff00ffh
-        and     ecx, 00ff00ffh
-        mov     ebx, [edi]
-        add     esi, ecx
-        and     ebx, 00ff00ffh
-        mov     ecx, [edi + edx]
-        add     esi, ebx
-        and     ecx, 00ff00ffh
-        xor     eax, eax
-        mov     al, [edi - 3]
-        add     esi, ecx
-        mov     cl, [edi + 5]
-        mov     bl, [edi + 1]
-        add     eax, ecx
-        mov     cl, [edi + edx + 1]
-        add     eax, ebx
-        shr     esi, 2
-        add     eax, ecx
-        and     esi, 00ff00ffh
-        shl     eax, 6
-        and     eax, 0000ff00h
-        or      eax, esi
-        stosd
-        dec     dword ptr[esp]
-        jnz     next
-        mov     ebx, [edi]
-        mov     esi, [edi - 4]
-        and     ebx, 00ff00ffh
-        and     esi, 00ff00ffh
-        add     ebx, ebx
-        mov     ecx, [edi + edx]
-        add     esi, ebx
-        and     ecx, 00ff00ffh
-        add     esi, ecx
-        mov     al, [edi - 3]
-        mov     bl, [edi - 4]
-        add     ebx, ebx
-        mov     cl, [edi + edx + 1]
-        add     eax, ebx
-        xor     ebx, ebx
-        shr     esi, 2
-        add     eax, ecx
-        and     esi, 00ff00ffh
-        shl     eax, 6
-        and     eax, 0000ff00h
-        or      eax, esi
-        stosd
-        pop     edx
-        dec     height
-        jnz     step
-    }
-#else
-    const uint32_t offset = (img->mSize >> 2) - (width << 1);
-    for (uint32_t i = width; i < offset; i++)
-    {
-        ARGB* col0 = (ARGB*)&data[i];
-        const ARGB* col1 = (const ARGB*)&data[i - 1];
-        const ARGB* col2 = (const ARGB*)&data[i + 1];
-        const ARGB* col3 = (const ARGB*)&data[i - width];
-        const ARGB* col4 = (const ARGB*)&data[i + width];
-        col0->r = (col1->r + col2->r + col3->r + col4->r) >> 2;
-        col0->g = (col1->g + col2->g + col3->g + col4->g) >> 2;
-        col0->b = (col1->b + col2->b + col3->b + col4->b) >> 2;
-    }
-#endif
-}
-
-//FX-effect: alpha-blending image buffer
-void blendImage(GFX_IMAGE* dst, GFX_IMAGE* src1, GFX_IMAGE* src2, int32_t cover)
-{
-    const uint32_t pixels = src1->mSize >> 2;
-    uint32_t* pdst  = (uint32_t*)dst->mData;
-    uint32_t* psrc1 = (uint32_t*)src1->mData;
-    uint32_t* psrc2 = (uint32_t*)src2->mData;
-    
-    if (bitsPerPixel <= 8)
-    {
-        messageBox(GFX_ERROR, "Wrong pixel format!");
-        return;
-    }
-
-#ifdef _USE_ASM
-    __asm {
-        mov         ecx, pixels
-        shr         ecx, 1
-        jz          end
-        mov         edi, pdst
-        mov         edx, psrc1
-        mov         esi, psrc2
-        movzx       eax, cover
-        xor         eax, 0FFh
-        movd        mm3, eax
-        punpcklwd   mm3, mm3
-        pxor        mm2, mm2
-        punpckldq   mm3, mm3
-    again:
-        movq        mm0, [edx]
-        movq        mm1, [esi]
-        movq        mm5, mm0
-        punpcklbw   mm0, mm2
-        movq        mm4, mm1
-        punpcklbw   mm1, mm2
-        psubw       mm0, mm1
-        pmullw      mm0, mm3
-        movq        mm6, mm4
-        psrlw       mm0, 8
-        psrlq       mm5, 32
-        psrlq       mm4, 32
-        punpcklbw   mm5, mm2
-        punpcklbw   mm4, mm2
-        psubw       mm5, mm4
-        pmullw      mm5, mm3
-        psrlw       mm5, 8
-        packuswb    mm0, mm5
-        paddb       mm0, mm6
-        movq        [edi], mm0
-        add         edx, 8
-        add         edi, 8
-        add         esi, 8
-        dec         ecx
-        jnz         again
-        emms
-    end:
-    }
-#else
-    //32-bytes aligned
-    const int32_t aligned = pixels >> 3;
-    const int32_t remainder = pixels % 8;
-
-    //all zero
-    const __m256i ymm0 = _mm256_setzero_si256();
-
-    //alpha and inverted alpha, 8 x 32 bits
-    const __m256i alpha = _mm256_set1_epi16(cover);
-    const __m256i invert = _mm256_set1_epi16(256 - cover);
-
-    //process 32-bytes
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        //load 8 pixes width from src1 (8 x 32 bits data)
-        __m256i los1 = _mm256_stream_load_si256((const __m256i*)psrc1);
-        __m256i his1 = los1;
-
-        //unpack to low & hi
-        los1 = _mm256_unpacklo_epi8(los1, ymm0);
-        his1 = _mm256_unpackhi_epi8(his1, ymm0);
-
-        //load 8 pixes width from src2 (8 x 32 bits data)
-        __m256i los2 = _mm256_stream_load_si256((const __m256i*)psrc2);
-        __m256i his2 = los2;
-
-        //unpack to low & high
-        los2 = _mm256_unpacklo_epi8(los2, ymm0);
-        his2 = _mm256_unpackhi_epi8(his2, ymm0);
-
-        //blending low = (A * SRC + B * DST) >> 8, (8 x 32 bits data)
-        los1 = _mm256_mullo_epi16(los1, alpha);
-        los2 = _mm256_mullo_epi16(los2, invert);
-        __m256i los = _mm256_adds_epu16(los1, los2);
-        los = _mm256_srli_epi16(los, 8);
-
-        //blending high = (A * SRC + B * DST) >> 8, (8 x 32 bits data)
-        his1 = _mm256_mullo_epi16(his1, alpha);
-        his2 = _mm256_mullo_epi16(his2, invert);
-        __m256i his = _mm256_adds_epu16(his1, his2);
-        his = _mm256_srli_epi16(his, 8);
-
-        //destination = PACKED(low,hi) 32 x 8 bits
-        const __m256i res = _mm256_packus_epi16(los, his);
-        _mm256_stream_si256((__m256i*)pdst, res);
-
-        //next 8 pixels
-        pdst += 8;
-        psrc1 += 8;
-        psrc2 += 8;
-    }
-
-    //have unaligned bytes
-    if (remainder > 0)
-    {
-        const uint8_t rcover = 255 - cover;
-        for (int32_t i = 0; i < remainder; i++)
-        {
-            const uint32_t lsrc = *psrc1;
-            const uint32_t ldst = *psrc2;
-            const uint32_t rb = ((ldst & 0x00ff00ff) * rcover + (lsrc & 0x00ff00ff) * cover);
-            const uint32_t ag = (((ldst & 0xff00ff00) >> 8) * rcover + ((lsrc & 0xff00ff00) >> 8) * cover);
-            *pdst++ = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
-            psrc1++;
-            psrc2++;
-        }
-    }
-#endif
-}
-
-//FX-effect: rotate image buffer, line by line
-void rotateLine(uint32_t* dst, const uint32_t* src, const int32_t* tables, int32_t width, int32_t siny, int32_t cosy)
-{
-#ifdef _USE_ASM
-    const int32_t pos = (width + 1) << 3;
-    __asm {
-        mov     ecx, width
-        dec     ecx
-        mov     esi, src
-        mov     edi, dst
-        mov     ebx, tables
-    next:
-        mov     eax, [ebx + ecx * 8 + 8]
-        mov     edx, [ebx + ecx * 8 + 12]
-        add     eax, cosy
-        sub     edx, siny
-        sar     eax, 1
-        js      skip
-        sar     edx, 1
-        js      skip
-        cmp     eax, [ebx + 4]
-        jnl     skip
-        cmp     edx, [ebx]
-        jnl     skip
-        shl     eax, 2
-        add     eax, pos
-        mov     eax, [ebx + eax]
-        shl     edx, 2
-        add     eax, edx
-        mov     eax, [esi + eax]
-        mov     [edi], eax
-    skip:
-        add     edi, 4
-        dec     ecx
-        jns     next
-    }
-#else
-    int32_t idx = 0;
-    const int32_t mx = tables[0];
-    const int32_t my = tables[1];
-    const int32_t pos = (width + 1) << 1;
-
-    for (int32_t i = width - 1; i > 0; i--)
-    {
-        const int32_t ofs = (i + 1) << 1;
-        const int32_t y = (tables[ofs    ] + cosy) >> 1;
-        const int32_t x = (tables[ofs + 1] - siny) >> 1;
-        if (y > 0 && x > 0 && y < my && x < mx)
-        {
-            const int32_t t = tables[y + pos];
-            dst[idx] = src[x + (t >> 2)];
-        }
-        idx++;
-    }
-#endif
-}
-
-//FX-effect: rotate image buffer
-void rotateImage(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t* tables, int32_t axisx, int32_t axisy, double angle, double scale)
-{
-    int32_t x = 0, y = 0, lineWidth = 0;
-    uint32_t* pdst = (uint32_t*)dst->mData;
-    const uint32_t* psrc = (const uint32_t*)src->mData;
-
-    if (bitsPerPixel <= 8)
-    {
-        messageBox(GFX_ERROR, "Wrong pixel format!");
-        return;
-    }
-
-    //recalculate axisx, axisy
-    axisx = dst->mWidth - axisx;
-    axisy = dst->mHeight - axisy;
-
-    //store source image width, height
-    tables[0] = src->mWidth;
-    tables[1] = src->mHeight;
-
-    //calculate rotation data
-    const double th = M_PI * (180 - angle) / 180.0;
-    double sint = sin(th) / scale;
-    double cost = cos(th) / scale;
-
-    const double primex = -(2.0 * axisx + 1);
-    double sinx = primex * sint - 1;
-    double cosx = primex * cost - 1 + src->mWidth;
-
-    sint *= 2;
-    cost *= 2;
-
-    //init lookup tables
-    for (x = 0; x < dst->mWidth; x++)
-    {
-        tables[(x << 1) + 2] = int32_t(sinx);
-        tables[(x << 1) + 3] = int32_t(cosx);
-        sinx += sint;
-        cosx += cost;
-    }
-
-    sint /= 2;
-    cost /= 2;
-
-    for (y = 0; y < src->mHeight; y++)
-    {
-        tables[y + ((src->mWidth + 1) << 1)] = lineWidth;
-        lineWidth += src->mRowBytes;
-    }
-
-    const double primey = ((intmax_t(dst->mHeight) - 1 - axisy) * 2.0) + 1;
-    double siny = primey * sint;
-    double cosy = primey * cost + src->mHeight;
-
-    sint *= 2;
-    cost *= 2;
-
-    //process rotate line by line
-    for (y = 0; y < dst->mHeight; y++)
-    {
-        rotateLine(pdst, psrc, tables, dst->mWidth, int32_t(siny), int32_t(cosy));
-        pdst += dst->mWidth;
-        siny -= sint;
-        cosy -= cost;
-    }
-}
-
-//FX-effect: 2d bumping
-void bumpImage(const GFX_IMAGE* dst, const GFX_IMAGE* src1, const GFX_IMAGE* src2, int32_t lx, int32_t ly)
-{
-    const uint32_t* dstdata = (const uint32_t*)dst->mData;
-    const uint32_t* src1data = (const uint32_t*)src1->mData;
-    const uint32_t* src2data = (const uint32_t*)src2->mData;
-
-    const int32_t src1width = src1->mWidth;
-    const int32_t src2width = src2->mWidth;
-    const int32_t dstwidth = dst->mWidth;
-    const int32_t src1len = src1->mRowBytes - 1;
-
-    const int32_t bmax = 400;
-    const int32_t xstart = 100, ystart = 100;
-    const int32_t endx = getDrawBufferWidth() - xstart;
-    const int32_t endy = getDrawBufferHeight() - ystart;
-
-    int32_t nx = 0, ny = 0, vlx = 0, vly = 0;
-    int32_t x = 0, y = 0, osrc2 = 0, osrc1 = 0, odst = 0;
-    
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, ystart
-        mov     y, eax
-    starty:
-        mov     ebx, y
-        mov     eax, src1width
-        mul     ebx
-        add     eax, 99
-        shl     eax, 2
-        mov     osrc1, eax
-        mov     eax, src2width
-        mul     ebx
-        add     eax, 99
-        shl     eax, 2
-        mov     osrc2, eax
-        mov     eax, dstwidth
-        mul     ebx
-        add     eax, 99
-        shl     eax, 2
-        mov     odst, eax
-        mov     eax, xstart
-        mov     x, eax
-    startx:
-        mov     eax, x
-        sub     eax, lx
-        mov     vlx, eax
-        mov     eax, y
-        sub     eax, ly
-        mov     vly, eax
-        mov     ecx, vlx
-        mov     eax, vly
-        mov     ebx, bmax
-        neg     ebx
-        cmp     ecx, bmax
-        jnl     stop
-        cmp     eax, bmax
-        jnl     stop
-        cmp     ecx, ebx
-        jng     stop
-        cmp     eax, ebx
-        jng     stop
-        xor     eax, eax
-        xor     ebx, ebx
-        mov     edi, src1data
-        add     edi, osrc1
-        mov     al, [edi + 1]
-        or      al, al
-        jz      stop
-        mov     bl, [edi - 1]
-        sub     eax, ebx
-        mov     nx, eax
-        mov     ecx, src1len
-        mov     al, [edi + ecx]
-        sub     edi, ecx
-        mov     bl, [edi]
-        sub     eax, ebx
-        mov     ny, eax
-        mov     eax, vlx
-        sub     eax, nx
-        jns     nsx
-        neg     eax
-    nsx:
-        shr     eax, 1
-        cmp     eax, 127
-        jna     nax
-        mov     eax, 127
-    nax:
-        mov     ebx, 127
-        sub     ebx, eax
-        jns     nsx2
-        mov     ebx, 1
-    nsx2:
-        mov     eax, vly
-        sub     eax, ny
-        jns     nsy
-        neg     eax
-    nsy:
-        shr     eax, 1
-        cmp     eax, 127
-        jna     nay
-        mov     eax, 127
-    nay:
-        mov     ecx, 127
-        sub     ecx, eax
-        jns     nsy2
-        mov     ecx, 1
-    nsy2:
-        add     ebx, ecx
-        cmp     ebx, 128
-        jna     stop
-        sub     ebx, 128
-        mov     edi, src2data
-        add     edi, osrc2
-        mov     ecx, [edi]
-        mov     edi, dstdata
-        add     edi, odst
-        xor     eax, eax
-        mov     al, cl
-        mul     ebx
-        shr     eax, 5
-        cmp     eax, 255
-        jna     nextb
-        mov     eax, 255
-    nextb:
-        mov     [edi], al
-        mov     al, ch
-        mul     ebx
-        shr     eax, 5
-        cmp     eax, 255
-        jna     nextg
-        mov     eax, 255
-    nextg:
-        mov     [edi + 1], al
-        shr     ecx, 16
-        mov     al, cl
-        mul     ebx
-        shr     eax, 5
-        cmp     eax, 255
-        jna     nextr
-        mov     eax, 255
-    nextr:
-        mov     [edi + 2], al
-    stop:
-        add     osrc2, 4
-        add     osrc1, 4
-        add     odst, 4
-        inc     x
-        mov     eax, endx
-        cmp     x, eax
-        jna     startx
-        inc     y
-        mov     eax, endy
-        cmp     y, eax
-        jna     starty
-    }
-#else
-    //scan for image height
-    for (y = ystart; y <= endy; y++)
-    {
-        //calculate starting offset
-        odst = dstwidth * y + 99;
-        osrc1 = src1width * y + 99;
-        osrc2 = src2width * y + 99;
-        
-        //scan for image width
-        for (x = xstart; x <= endx; x++)
-        {
-            //calculate delta x,y
-            vlx = x - lx;
-            vly = y - ly;
-
-            //range checking
-            if (vlx > -bmax && vlx < bmax && vly > -bmax && vly < bmax)
-            {
-                nx = (src1data[osrc1 + 1] & 0xff) - (src1data[osrc1 - 1] & 0xff);
-                ny = (src1data[osrc1 + src1len] & 0xff) - (src1data[osrc1 - src1len] & 0xff);
-                uint8_t difx = 127 - min(abs(vlx - nx) >> 1, 127);
-                if (difx <= 0) difx = 1;
-                uint8_t dify = 127 - min(abs(vly - ny) >> 1, 127);
-                if (dify <= 0) dify = 1;
-                uint8_t col = difx + dify;
-                if (col > 128)
-                {
-                    col -= 128;
-                    ARGB* pdst = (ARGB*)&dstdata[odst];
-                    const ARGB* psrc = (const ARGB*)&src2data[osrc2];
-                    pdst->r = min((col * psrc->r) >> 5, 255);
-                    pdst->g = min((col * psrc->g) >> 5, 255);
-                    pdst->b = min((col * psrc->b) >> 5, 255);
-                }
-            }
-
-            //next pixel
-            odst++;
-            osrc1++;
-            osrc2++;
-        }
-    }
-#endif
-}
-
-//FX-effect: fade-out image buffer
-void fadeOutImage(GFX_IMAGE* img, uint8_t step)
-{
-    if (bitsPerPixel <= 8) return;
-
-    ARGB* pixels = (ARGB*)img->mData;
-    const uint32_t msize = img->mSize >> 2;
-
-#ifdef _USE_ASM
-    __asm {
-        mov         edi, pixels
-        xor         eax, eax
-        mov         al, step
-        movd        mm1, eax
-        punpcklbw   mm1, mm1
-        punpcklwd   mm1, mm1
-        mov         ecx, msize
-        shr         ecx, 1
-        jz          once
-        punpckldq   mm1, mm1
-    plot:
-        movq        mm0, [edi]
-        psubusb     mm0, mm1
-        movq        [edi], mm0
-        add         edi, 8
-        dec         ecx
-        jnz         plot
-    once:
-        test        msize, 1
-        jz          end
-        movd        mm0, [edi]
-        psubusb     mm0, mm1
-        movd        [edi], mm0
-    end:
-        emms
-    }
-#else
-    //make 32-bytes alignment (8 pixels)
-    const int32_t aligned = msize >> 3;
-    const int32_t remainder = msize % 8;
-
-    //make 32-bytes step
-    const __m256i mstep = _mm256_set1_epi8(step);
-
-    //start loop for 32-bytes aligned
-    for (int32_t i = 0; i < aligned; i++)
-    {
-        //stream load 8 pixels (256-bits data)
-        const __m256i ymm0 = _mm256_stream_load_si256((const __m256i*)pixels);
-
-        //sub 32-bytes pixels with saturating
-        const __m256i ymm1 = _mm256_subs_epu8(ymm0, mstep);
-        
-        //store data 32-bytes
-        _mm256_stream_si256((__m256i*)pixels, ymm1);
-        
-        //next-to 32-bytes align (8 pixels)
-        pixels += 8;
-    }
-
-    //have unaligned bytes?
-    if (remainder > 0)
-    {
-        //process remainder bytes
-        for (int32_t i = 0; i < remainder; i++)
-        {
-            pixels->r = max(pixels->r - step, 0);
-            pixels->g = max(pixels->g - step, 0);
-            pixels->b = max(pixels->b - step, 0);
-            pixels++;
-        }
-    }
-#endif
-}
-
-//get total system momory in MB
-void initMemoryInfo()
-{
-#ifdef SDL_PLATFORM_APPLE
-    size_t len = 0;
-    uint64_t physMem = 0, memSize = 0;
-    len = sizeof(memSize);
-    if (!sysctlbyname("hw.memsize", &memSize, &len, NULL, 0)) totalMemory = uint32_t(memSize >> 20);
-    len = sizeof(physMem);
-    if (!sysctlbyname("hw.physmem", &physMem, &len, NULL, 0)) availableMemory = uint32_t(physMem >> 20);
-#else
-    MEMORYSTATUSEX statex = { 0 };
-    statex.dwLength = sizeof(statex);
-    if (GlobalMemoryStatusEx(&statex))
-    {
-        totalMemory = uint32_t(statex.ullTotalPhys >> 20);
-        availableMemory = uint32_t(statex.ullAvailPhys >> 20);
-    }
-#endif
-}
-
-//CPUID instruction wrapper
-void CPUID(int32_t* cpuinfo, uint32_t funcid)
-{
-#ifdef _USE_ASM
-    __asm {
-        mov     eax, funcid
-        mov     edi, cpuinfo
-        cpuid
-        mov     [edi     ], eax
-        mov     [edi +  4], ebx
-        mov     [edi +  8], ecx
-        mov     [edi + 12], edx
-    }
-#elif defined(SDL_PLATFORM_APPLE)
-    __cpuid(funcid, cpuinfo[0], cpuinfo[1], cpuinfo[2], cpuinfo[3]);
-#else
-    __cpuid(cpuinfo, funcid);
-#endif
-}
-
-//get RDTSC count
-uint64_t getCyclesCount()
-{
-#ifdef _USE_ASM
-    __asm {
-        cpuid
-        rdtsc
-    }
-#else
-    return __rdtsc();
-#endif
-}
-
-//get current CPU clock rate in MHz
-void calcCpuSpeed()
-{
-    const uint64_t start = getCyclesCount();
-    SDL_Delay(200);
-    const uint64_t stop = getCyclesCount();
-    const uint64_t speed = (stop - start) / 200000;
-    cpuSpeed = uint32_t(speed);
-}
-
-//return CPU type (INTEL, AMD, ...)
-void calcCpuType()
-{
-    int32_t i = 0;
-    int32_t cpuInfo[4] = { 0 };
-
-    memset(cpuType, 0, sizeof(cpuType));
-    CPUID(cpuInfo, 0x00000000);
-
-    cpuType[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-    cpuType[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-    cpuType[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-    cpuType[i++] = cpuInfo[1] & 0xff;
-    cpuType[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-    cpuType[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-    cpuType[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-    cpuType[i++] = cpuInfo[3] & 0xff;
-    cpuType[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-    cpuType[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-    cpuType[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-    cpuType[i++] = cpuInfo[2] & 0xff;
-    if (!cpuType[0]) strncpy(cpuType, "<unknown>", sizeof(cpuType));
-}
-
-//return full CPU description string (i.e: Intel(R) Core(TM) i7-4770K CPU @ 3.50GHz)
-void calcCpuName()
-{
-    int32_t i = 0;
-    int32_t cpuInfo[4] = { 0 };
-    
-    memset(cpuName, 0, sizeof(cpuName));
-    CPUID(cpuInfo, 0x80000000);
-
-    if (cpuInfo[0] >= 0x80000004)
-    {
-        CPUID(cpuInfo, 0x80000002);
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        CPUID(cpuInfo, 0x80000003);
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        CPUID(cpuInfo, 0x80000004);
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
-    }
-    if (!cpuName[0]) strncpy(cpuName, "<unknown>", sizeof(cpuName));
-}
-
-//AMD 3DNow! detected
-bool have3DNow()
-{
-    int32_t cpuInfo[4] = { 0 };
-    CPUID(cpuInfo, 0x80000000);
-    if (cpuInfo[0] >= 0x80000001)
-    {
-        CPUID(cpuInfo, 0x80000001);
-        return cpuInfo[3] & 0x80000000;
-    }
-    return false;
-}
-
-//calculate some CPU features...
-void calcCpuFeatures()
-{
-    int32_t cpuInfo[4] = { 0 };
-    CPUID(cpuInfo, 0);
-    if (cpuInfo[0] >= 1) CPUID(cpuInfo, 1);
-
-    memset(cpuFeatures, 0, sizeof(cpuFeatures));
-
-    if (have3DNow()) strncat(cpuFeatures, "3DNow!,", sizeof(cpuFeatures) - 1);
-    if (cpuInfo[3] & 0x00800000) strncat(cpuFeatures, "MMX,", sizeof(cpuFeatures) - 1);
-    if (cpuInfo[3] & 0x02000000) strncat(cpuFeatures, "SSE,", sizeof(cpuFeatures) - 1);
-    if (cpuInfo[3] & 0x04000000) strncat(cpuFeatures, "SSE2,", sizeof(cpuFeatures) - 1);
-    if (cpuInfo[2] & 0x10000000) strncat(cpuFeatures, "AVX,", sizeof(cpuFeatures) - 1);
-
-#ifdef SDL_PLATFORM_APPLE
-    __cpuid_count(7, 0, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
-#else
-    __cpuidex(cpuInfo, 7, 0);
-#endif
-
-    if (cpuInfo[1] & 0x00000020) strncat(cpuFeatures, "AVX2,", sizeof(cpuFeatures) - 1);
-    if (cpuInfo[1] & 0x00010000) strncat(cpuFeatures, "AVX512,", sizeof(cpuFeatures) - 1);
-
-    size_t len = strlen(cpuFeatures);
-    if (len > 1) cpuFeatures[len - 1] = '\0';
-    else strncpy(cpuFeatures, "<none>", sizeof(cpuFeatures));
-}
-
-//initialize CPU info
-void initCpuInfo()
-{
-    calcCpuSpeed();
-    calcCpuType();
-    calcCpuName();
-    calcCpuFeatures();
-}
-
-//initialize video info
-void initVideoInfo()
-{
-    videoMemory = 0;
-    strncpy(videoName, "<unknown>", sizeof(videoName));
-    strncpy(modeInfo, "<unknown>", sizeof(modeInfo));
-    strncpy(driverVersion, "0.0.0.0", sizeof(driverVersion));
-    strncpy(renderVersion, "0.0.0.0", sizeof(renderVersion));
-    strncpy(imageVersion, "0.0.0.0", sizeof(imageVersion));
-    
-    //retrive SDL and SDL_image version string
-    const int32_t sdlver = SDL_GetVersion();
-    const int32_t imgver = IMG_Version();
-
-    snprintf(renderVersion, sizeof(renderVersion), "SDL %d.%d.%d", SDL_VERSIONNUM_MAJOR(sdlver), SDL_VERSIONNUM_MINOR(sdlver), SDL_VERSIONNUM_MICRO(sdlver));
-    snprintf(imageVersion, sizeof(imageVersion), "SDL_image %d.%d.%d", SDL_VERSIONNUM_MAJOR(imgver), SDL_VERSIONNUM_MINOR(imgver), SDL_VERSIONNUM_MICRO(imgver));
-    
-    //retrive current video mode info string
-    int width = 0, height = 0;
-    SDL_GetCurrentRenderOutputSize(sdlRenderer, &width, &height);
-    const SDL_DisplayMode* mode = (const SDL_DisplayMode*)SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(sdlWindow));
-    if (mode) snprintf(modeInfo, sizeof(modeInfo), "%dx%dx%db @ %.2fHz", width, height, SDL_BYTESPERPIXEL(mode->format) << 3, mode->refresh_rate);
-
-#ifdef SDL_PLATFORM_APPLE
-    io_iterator_t iterator;
-    CFMutableDictionaryRef matchDict;
-
-    //get dictionary of all the PCI Devices
-    matchDict = IOServiceMatching("IOPCIDevice");
-    
-    //get IOService descriptor
-    if (IOServiceGetMatchingServices(kIOMasterPortDefault, matchDict, &iterator) == kIOReturnSuccess)
-    {
-        //iterator for devices found
-        io_registry_entry_t regEntry;
-        
-        while ((regEntry = IOIteratorNext(iterator)))
-        {
-            //put this services object into a dictionary object.
-            CFMutableDictionaryRef serviceDictionary;
-            if (IORegistryEntryCreateCFProperties(regEntry, &serviceDictionary, kCFAllocatorDefault, kNilOptions) != kIOReturnSuccess)
-            {
-                //service dictionary creation failed.
-                IOObjectRelease(regEntry);
-                continue;
-            }
-            
-            //get graphic card model
-            CFDataRef GPUModel = (CFDataRef)CFDictionaryGetValue(serviceDictionary, CFSTR("model"));
-            if (GPUModel == NULL) continue;
-
-            //get graphic card name
-            CFIndex length = CFDataGetLength(GPUModel);
-            memcpy(videoName, CFDataGetBytePtr(GPUModel), length);
-            
-            //retrived driver version???
-            CFDataRef devNum = (CFDataRef)CFDictionaryGetValue(serviceDictionary, CFSTR("device-id"));
-            CFDataRef revNum = (CFDataRef)CFDictionaryGetValue(serviceDictionary, CFSTR("revision-id"));
-            if (revNum != NULL && devNum != NULL)
-            {
-                uint32_t deviceId = 0, revisionId = 0;
-                length = CFDataGetLength(devNum);
-                memcpy(&deviceId, CFDataGetBytePtr(devNum), length);
-                length = CFDataGetLength(revNum);
-                memcpy(&revisionId, CFDataGetBytePtr(revNum), length);
-                snprintf(driverVersion, sizeof(driverVersion), "%u.%u.%u.%u", HIWORD(deviceId), LOWORD(deviceId), HIWORD(revisionId), LOWORD(revisionId));
-            }
-            
-            // Release the dictionary
-            CFRelease(serviceDictionary);
-            
-            // Release the serviceObject
-            IOObjectRelease(regEntry);
-        }
-        
-        // Release the iterator
-        IOObjectRelease(iterator);
-    }
-    
-    //get graphic card memory
-    matchDict = IOServiceMatching(kIOAcceleratorClassName);
-    if (IOServiceGetMatchingServices(kIOMasterPortDefault, matchDict, &iterator) == kIOReturnSuccess)
-    {
-        //iterator for devices found
-        io_registry_entry_t regEntry;
-        
-        while ((regEntry = IOIteratorNext(iterator)))
-        {
-            //put this services object into a dictionary object.
-            CFMutableDictionaryRef serviceDictionary;
-            if (IORegistryEntryCreateCFProperties(regEntry, &serviceDictionary, kCFAllocatorDefault, kNilOptions) != kIOReturnSuccess)
-            {
-                //service dictionary creation failed.
-                IOObjectRelease(regEntry);
-                continue;
-            }
-            
-            //catch video memory key
-            CFNumberRef vram = (CFNumberRef)CFDictionaryGetValue(serviceDictionary, CFSTR("VRAM,totalMB"));
-            if (vram == NULL) continue;
-            
-            //get total video memory
-            CFNumberGetValue(vram, kCFNumberSInt32Type, &videoMemory);
-            
-            //release the dictionary
-            CFRelease(serviceDictionary);
-            
-            //release the serviceObject
-            IOObjectRelease(regEntry);
-        }
-        
-        //release the iterator
-        IOObjectRelease(iterator);
-    }
-#else
-    //retrive video memory of graphic card name
-    LUID luid = { 0 };
-    IDXGIFactory* factory = NULL;
-    if (SUCCEEDED(CreateDXGIFactory(IID_PPV_ARGS(&factory))))
-    {
-        IDXGIAdapter* adapter = NULL;
-        if (SUCCEEDED(factory->EnumAdapters(0, &adapter)))
-        {
-            DXGI_ADAPTER_DESC desc;
-            adapter->GetDesc(&desc);
-            adapter->Release();
-            luid = desc.AdapterLuid;
-            videoMemory = uint32_t(desc.DedicatedVideoMemory >> 20);
-            wcstombs(videoName, desc.Description, 128);
-        }
-        factory->Release();
-    }
-
-    //retrive graphic card driver version by fetch registry data
-    HKEY dxKeyHandle = NULL;
-    if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, _T("SOFTWARE\\Microsoft\\DirectX"), 0, KEY_READ | KEY_WOW64_64KEY, &dxKeyHandle) != ERROR_SUCCESS) return;
-
-    //find all subkeys
-    DWORD numOfAdapters = 0;
-    DWORD subKeyMaxLength = 0;
-    if (RegQueryInfoKey(dxKeyHandle, NULL, NULL, NULL, &numOfAdapters, &subKeyMaxLength, NULL, NULL, NULL, NULL, NULL, NULL) != ERROR_SUCCESS)
-    {
-        RegCloseKey(dxKeyHandle);
-        return;
-    }
-
-    //must include the null character
-    subKeyMaxLength += 1;
-
-    bool foundVersion = false;
-    LARGE_INTEGER driverVersionRaw = { 0 };
-    TCHAR* subKeyName = (TCHAR*)calloc(subKeyMaxLength, sizeof(TCHAR));
-
-    for (DWORD i = 0; i < numOfAdapters; ++i)
-    {
-        DWORD subKeyLength = subKeyMaxLength;
-        if (RegEnumKeyEx(dxKeyHandle, i, subKeyName, &subKeyLength, NULL, NULL, NULL, NULL) == ERROR_SUCCESS)
-        {
-            LUID adapterLUID = {};
-            DWORD qwordSize = sizeof(uint64_t);
-
-            //find match the vendor ID and device ID
-            if (RegGetValue(dxKeyHandle, subKeyName, _T("AdapterLuid"), RRF_RT_QWORD, NULL, &adapterLUID, &qwordSize) == ERROR_SUCCESS && adapterLUID.HighPart == luid.HighPart && adapterLUID.LowPart == luid.LowPart)
-            {
-                //let's get the driver version num now
-                if (RegGetValue(dxKeyHandle, subKeyName, _T("DriverVersion"), RRF_RT_QWORD, NULL, &driverVersionRaw, &qwordSize) == ERROR_SUCCESS)
-                {
-                    foundVersion = true;
-                    break;
-                }
-            }
-        }
-    }
-
-    //print driver version string
-    if (foundVersion) snprintf(driverVersion, sizeof(driverVersion), "%u.%u.%u.%u", HIWORD(driverVersionRaw.HighPart), LOWORD(driverVersionRaw.HighPart), HIWORD(driverVersionRaw.LowPart), LOWORD(driverVersionRaw.LowPart));
-    
-    //cleanup...
-    RegCloseKey(dxKeyHandle);
-    free(subKeyName);
-#endif
-}
-
-//initialize some system info
-bool initSystemInfo()
-{
-    initCpuInfo();
-    initVideoInfo();
-    initMemoryInfo();
-
-    //check CPU extension
-    if (!strstr(cpuFeatures, "AVX2") && !strstr(cpuFeatures, "3DNow!"))
-    {
-        messageBox(GFX_ERROR, "GFXLIB require modern CPU with support 3DNow!, MMX, SSE2, AVX2 features!");
-        return false;
-    }
-
-    //check CPU speed
-    if (cpuSpeed < 2000)
-    {
-        messageBox(GFX_ERROR, "GFXLIB require CPU speed more than 2000 MHz!");
-        return false;
-    }
-
-    //check free memory
-    if (availableMemory < 500)
-    {
-        messageBox(GFX_ERROR, "GFXLIB require system RAM more than 500 MB!");
-        return false;
-    }
-
-    //check for video RAM
-    if (videoMemory < 64)
-    {
-        messageBox(GFX_ERROR, "GFXLIB require video RAM more than 64 MB!");
-        return false;
-    }
-
-    return true;
-}
-
-//set windows title text
-void setWindowTitle(const char* title)
-{
-    SDL_SetWindowTitle(sdlWindow, title);
-}
-
-//return current video memory in GB
-uint32_t getVideoMemory()
-{
-    return videoMemory;
-}
-
-//return total system memory in GB
-uint32_t getTotalMemory()
-{
-    return totalMemory;
-}
-
-//return free memory in GB
-uint32_t getAvailableMemory()
-{
-    return availableMemory;
-}
-
-//return name of graphic card
-const char* getVideoName()
-{
-    return videoName;
-}
-
-//return current CPU speed in MHZ
-uint32_t getCpuSpeed()
-{
-    return cpuSpeed;
-}
-
-//return current CPU type (INTEL, AMD)
-const char* getCpuType()
-{
-    return cpuType;
-}
-
-//return full string of CPU name
-const char* getCpuName()
-{
-    return cpuName;
-}
-
-//return CPU features (MMX, 3DNow!, SSE, SSE2, SSE3, ...)
-const char* getCpuFeatures()
-{
-    return cpuFeatures;
-}
-
-//return version of render system
-const char* getRenderVersion()
-{
-    return renderVersion;
-}
-
-//return version of image file loading
-const char* getImageVersion()
-{
-    return imageVersion;
-}
-
-//return render driver version
-const char* getDriverVersion()
-{
-    return driverVersion;
-}
-
-//return current video mode info (resolution-bitsperpixels-refreshrate)
-const char* getVideoModeInfo()
-{
-    return modeInfo;
-}
-
-/*============================ END OF GFXLIB.CPP ========================*/
+/*===============================================================*/
+/*                 GFXLIB Graphics Library                       */
+/*               Use SDL3 for backend render                     */
+/*               SDL3_image for backend image                    */
+/*            Target OS: cross-platform (win32, macos)           */
+/*               Author: Nguyen Ngoc Van                         */
+/*               Create: 22/10/2018                              */
+/*              Version: 1.4.5                                   */
+/*          Last Update: 2024-09-27                              */
+/*              Website: http://codedemo.net                     */
+/*                Email: pherosiden@gmail.com                    */
+/*           References: https://lodev.org                       */
+/*                       https://permadi.com                     */
+/*                       https://sources.ru                      */
+/*                       http://eyecandyarchive.com              */
+/*                       https://crossfire-designs.de            */
+/*              License: GNU GPL                                 */
+/*===============================================================*/
+
+#include <map>
+#include "gfxlib.h"
+#ifdef SDL_PLATFORM_APPLE
+#include <cpuid.h>
+#include <sys/sysctl.h>
+#else
+#include <dxgi.h>
+#include <tchar.h>
+#pragma comment (lib, "DXGI")
+#pragma comment (lib, "SDL3")
+#pragma comment (lib, "SDL3_image")
+#endif
+
+//default drawing context (buffer, view port, cursor and projection states)
+GFX_CONTEXT     gfxContext = { 0 };                 //free drawing functions use this context
+
+//screen render buffer
+void*           screenBuff = NULL;                  //screen buffer (draw buffer after initialized)
+int32_t         screenWidth = 0, screenHeight = 0;  //screen buffer height
+
+//GFX font data
+GFX_FONT        gfxFonts[GFX_MAX_FONT] = { 0 };     //GFX font loadable at the same time
+uint8_t*        fontPalette[GFX_MAX_FONT] = { 0 };  //GFX font palette data (BMP8 type)
+uint8_t*        gfxBuff = NULL;                     //GFX buffer
+uint32_t        subFonts = 0;                       //GFX sub-fonts
+uint32_t        fontType = 0;                       //current selected font (use for multiple loaded font)
+uint32_t        randSeed = 0;                       //global random seed
+uint32_t        factor = 0x8088405;                 //global factor
+
+//pattern filled styles
+uint8_t         ptnLine[]           = { 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00 };
+uint8_t         ptnLiteSlash[]      = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
+uint8_t         ptnSlash[]          = { 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC1, 0x83 };
+uint8_t         ptnBackSlash[]      = { 0x07, 0x83, 0xC1, 0xE0, 0x70, 0x38, 0x1C, 0x0E };
+uint8_t         ptnLiteBackSlash[]  = { 0x5A, 0x2D, 0x96, 0x4B, 0xA5, 0xD2, 0x69, 0xB4 };
+uint8_t         ptnHatch[]          = { 0xff, 0x88, 0x88, 0x88, 0xff, 0x88, 0x88, 0x88 };
+uint8_t         ptnHatchX[]         = { 0x18, 0x24, 0x42, 0x81, 0x81, 0x42, 0x24, 0x18 };
+uint8_t         ptnInterLeave[]     = { 0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33, 0xCC, 0x33 };
+uint8_t         ptnWideDot[]        = { 0x80, 0x00, 0x08, 0x00, 0x80, 0x00, 0x08, 0x00 };
+uint8_t         ptnCloseDot[]       = { 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00 };
+
+//CPU and video card parameters
+char            cpuName[50] = { 0 };                //full CPU name string
+char            cpuType[16] = { 0 };                //CPU type (GenuineIntel, AuthenticAMD, ...)
+char            cpuFeatures[50] = { 0 };            //CPU features (MMX, 3DNow!, 3DNowExt!, SSE, SSE2, SSE3, ...)
+char            videoName[128] = { 0 };             //full name of graphic card
+char            driverVersion[32] = { 0 };          //graphic driver version string
+char            renderVersion[32] = { 0 };          //SDL2 version string
+char            imageVersion[32] = { 0 };           //SDL2_image version string
+char            modeInfo[32] = { 0 };               //current display mode info string
+
+//system memory profiles
+uint32_t        cpuSpeed = 0;                       //CPU speed in MHz
+uint32_t        totalMemory = 0;                    //total physical memory in MB
+uint32_t        availableMemory = 0;                //available physical memory in MB
+uint32_t        videoMemory = 0;                    //total video memory in MB
+
+//global SDL objects
+SDL_Window*     sdlWindow = NULL;                   //display windows
+SDL_Surface*    sdlSurface = NULL;                  //display windows surface
+SDL_Texture*    sdlTexture = NULL;                  //texture steaming
+SDL_Renderer*   sdlRenderer = NULL;                 //render object
+SDL_Event		sdlEvent = { 0 };                   //store key input event
+
+//screen mode and frame-commit hook
+uint32_t        screenFlags = 0;                    //current screen initialize flags
+uint64_t        frameCount = 0;                     //number of committed frames
+GFX_FRAME_FUNC  frameFunc = NULL;                   //frame-commit hook (headless mode)
+
+//8 bits palette expansion
+alignas(32) uint32_t paletteTable[256] = { 0 };    //current palette as 32 bits lookup table
+uint32_t*       frameBuff = NULL;                   //32 bits frame buffer (headless 8 bits mode)
+
+//async present thread
+SDL_Thread*     presentThread = NULL;               //present thread handle
+SDL_Mutex*      presentMutex = NULL;                //frame state lock
+SDL_Condition*  presentCond = NULL;                 //frame state changed
+GFX_PRESENT_FRAME presentFrame[MAX_FRAME_BUFFERS] = { 0 };//double/triple frame buffers
+int32_t         presentQueue[MAX_FRAME_BUFFERS] = { 0 };//queued frames (FIFO)
+int32_t         queueHead = 0, queueCount = 0;      //queued frames head and count
+int32_t         frameBuffers = 0;                   //number of frame buffers
+int32_t         drawFrame = 0;                      //current drawing frame
+int32_t         presentQuit = 0;                    //signal present thread to quit
+
+//damaged rectangles of current frame
+SDL_Rect        dirtyRects[MAX_DIRTY_RECTS] = { 0 };//damaged rectangles list
+int32_t         dirtyCount = 0;                     //number of damaged rectangles
+int32_t         dirtyFull = 0;                      //whole screen is damaged
+
+//keyboard status
+uint8_t*        keyStates = 0;                      //key input states
+
+//the "keyPressed" status map
+std::map<int32_t, int32_t> keyStatus;               //key input status
+
+//simulation mode for automated runs
+int32_t         simFrames = 0;                      //frames per segment before RETURN key is pressed (0: simulation is off)
+uint32_t        simSeed = 0;                        //fixed random seed
+uint64_t        simClock = 0;                       //simulated clock in milliseconds
+uint64_t        simStart = 0;                       //frame count at start of current segment
+uint64_t        simPressed = 0;                     //frame count when RETURN key was pressed (hold until next frame)
+uint32_t        simPolls = 0;                       //number of key polls without new frame
+char            simTitle[128] = { 0 };              //title of current segment
+GFX_SEGMENT_FUNC segmentFunc = NULL;                //segment done hook
+
+//default 8-bits palette entries for mixed mode, SDL3 initialized with black palette
+SDL_Color basePalette[256] = {
+    { 0,  0,  0, 0}, { 0,  0, 42, 0}, { 0, 42,  0, 0}, { 0, 42, 42, 0}, {42,  0,  0, 0}, {42,  0, 42, 0}, {42, 21,  0, 0}, {42, 42, 42, 0}, {21, 21, 21, 0}, {21, 21, 63, 0}, {21, 63, 21, 0}, {21, 63, 63, 0}, {63, 21, 21, 0}, {63, 21, 63, 0}, {63, 63, 21, 0}, {63, 63, 63, 0},
+    { 0,  0,  0, 0}, { 5,  5,  5, 0}, { 8,  8,  8, 0}, {11, 11, 11, 0}, {14, 14, 14, 0}, {17, 17, 17, 0}, {20, 20, 20, 0}, {24, 24, 24, 0}, {28, 28, 28, 0}, {32, 32, 32, 0}, {36, 36, 36, 0}, {40, 40, 40, 0}, {45, 45, 45, 0}, {50, 50, 50, 0}, {56, 56, 56, 0}, {63, 63, 63, 0},
+    { 0,  0, 63, 0}, {16,  0, 63, 0}, {31,  0, 63, 0}, {47,  0, 63, 0}, {63,  0, 63, 0}, {63,  0, 47, 0}, {63,  0, 31, 0}, {63,  0, 16, 0}, {63,  0,  0, 0}, {63, 16,  0, 0}, {63, 31,  0, 0}, {63, 47,  0, 0}, {63, 63,  0, 0}, {47, 63,  0, 0}, {31, 63,  0, 0}, {16, 63,  0, 0},
+    { 0, 63,  0, 0}, { 0, 63, 16, 0}, { 0, 63, 31, 0}, { 0, 63, 47, 0}, { 0, 63, 63, 0}, { 0, 47, 63, 0}, { 0, 31, 63, 0}, { 0, 16, 63, 0}, {31, 31, 63, 0}, {39, 31, 63, 0}, {47, 31, 63, 0}, {55, 31, 63, 0}, {63, 31, 63, 0}, {63, 31, 55, 0}, {63, 31, 47, 0}, {63, 31, 39, 0},
+    {63, 31, 31, 0}, {63, 39, 31, 0}, {63, 47, 31, 0}, {63, 55, 31, 0}, {63, 63, 31, 0}, {55, 63, 31, 0}, {47, 63, 31, 0}, {39, 63, 31, 0}, {31, 63, 31, 0}, {31, 63, 39, 0}, {31, 63, 47, 0}, {31, 63, 55, 0}, {31, 63, 63, 0}, {31, 55, 63, 0}, {31, 47, 63, 0}, {31, 39, 63, 0},
+    {45, 45, 63, 0}, {49, 45, 63, 0}, {54, 45, 63, 0}, {58, 45, 63, 0}, {63, 45, 63, 0}, {63, 45, 58, 0}, {63, 45, 54, 0}, {63, 45, 49, 0}, {63, 45, 45, 0}, {63, 49, 45, 0}, {63, 54, 45, 0}, {63, 58, 45, 0}, {63, 63, 45, 0}, {58, 63, 45, 0}, {54, 63, 45, 0}, {49, 63, 45, 0},
+    {45, 63, 45, 0}, {45, 63, 49, 0}, {45, 63, 54, 0}, {45, 63, 58, 0}, {45, 63, 63, 0}, {45, 58, 63, 0}, {45, 54, 63, 0}, {45, 49, 63, 0}, { 0,  0, 28, 0}, { 7,  0, 28, 0}, {14,  0, 28, 0}, {21,  0, 28, 0}, {28,  0, 28, 0}, {28,  0, 21, 0}, {28,  0, 14, 0}, {28,  0,  7, 0},
+    {28,  0,  0, 0}, {28,  7,  0, 0}, {28, 14,  0, 0}, {28, 21,  0, 0}, {28, 28,  0, 0}, {21, 28,  0, 0}, {14, 28,  0, 0}, { 7, 28,  0, 0}, { 0, 28,  0, 0}, { 0, 28,  7, 0}, { 0, 28, 14, 0}, { 0, 28, 21, 0}, { 0, 28, 28, 0}, { 0, 21, 28, 0}, { 0, 14, 28, 0}, { 0,  7, 28, 0},
+    {14, 14, 28, 0}, {17, 14, 28, 0}, {21, 14, 28, 0}, {24, 14, 28, 0}, {28, 14, 28, 0}, {28, 14, 24, 0}, {28, 14, 21, 0}, {28, 14, 17, 0}, {28, 14, 14, 0}, {28, 17, 14, 0}, {28, 21, 14, 0}, {28, 24, 14, 0}, {28, 28, 14, 0}, {24, 28, 14, 0}, {21, 28, 14, 0}, {17, 28, 14, 0},
+    {14, 28, 14, 0}, {14, 28, 17, 0}, {14, 28, 21, 0}, {14, 28, 24, 0}, {14, 28, 28, 0}, {14, 24, 28, 0}, {14, 21, 28, 0}, {14, 17, 28, 0}, {20, 20, 28, 0}, {22, 20, 28, 0}, {24, 20, 28, 0}, {26, 20, 28, 0}, {28, 20, 28, 0}, {28, 20, 26, 0}, {28, 20, 24, 0}, {28, 20, 22, 0},
+    {28, 20, 20, 0}, {28, 22, 20, 0}, {28, 24, 20, 0}, {28, 26, 20, 0}, {28, 28, 20, 0}, {26, 28, 20, 0}, {24, 28, 20, 0}, {22, 28, 20, 0}, {20, 28, 20, 0}, {20, 28, 22, 0}, {20, 28, 24, 0}, {20, 28, 26, 0}, {20, 28, 28, 0}, {20, 26, 28, 0}, {20, 24, 28, 0}, {20, 22, 28, 0},
+    { 0,  0, 16, 0}, { 4,  0, 16, 0}, { 8,  0, 16, 0}, {12,  0, 16, 0}, {16,  0, 16, 0}, {16,  0, 12, 0}, {16,  0,  8, 0}, {16,  0,  4, 0}, {16,  0,  0, 0}, {16,  4,  0, 0}, {16,  8,  0, 0}, {16, 12,  0, 0}, {16, 16,  0, 0}, {12, 16,  0, 0}, { 8, 16,  0, 0}, { 4, 16,  0, 0},
+    { 0, 16,  0, 0}, { 0, 16,  4, 0}, { 0, 16,  8, 0}, { 0, 16, 12, 0}, { 0, 16, 16, 0}, { 0, 12, 16, 0}, { 0,  8, 16, 0}, { 0,  4, 16, 0}, { 8,  8, 16, 0}, {10,  8, 16, 0}, {12,  8, 16, 0}, {14,  8, 16, 0}, {16,  8, 16, 0}, {16,  8, 14, 0}, {16,  8, 12, 0}, {16,  8, 10, 0},
+    {16,  8,  8, 0}, {16, 10,  8, 0}, {16, 12,  8, 0}, {16, 14,  8, 0}, {16, 16,  8, 0}, {14, 16,  8, 0}, {12, 16,  8, 0}, {10, 16,  8, 0}, { 8, 16,  8, 0}, { 8, 16, 10, 0}, { 8, 16, 12, 0}, { 8, 16, 14, 0}, { 8, 16, 16, 0}, { 8, 14, 16, 0}, { 8, 12, 16, 0}, { 8, 10, 16, 0},
+    {11, 11, 16, 0}, {12, 11, 16, 0}, {13, 11, 16, 0}, {15, 11, 16, 0}, {16, 11, 16, 0}, {16, 11, 15, 0}, {16, 11, 13, 0}, {16, 11, 12, 0}, {16, 11, 11, 0}, {16, 12, 11, 0}, {16, 13, 11, 0}, {16, 15, 11, 0}, {16, 16, 11, 0}, {15, 16, 11, 0}, {13, 16, 11, 0}, {12, 16, 11, 0},
+    {11, 16, 11, 0}, {11, 16, 12, 0}, {11, 16, 13, 0}, {11, 16, 15, 0}, {11, 16, 16, 0}, {11, 15, 16, 0}, {11, 13, 16, 0}, {11, 12, 16, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0}, { 0,  0,  0, 0},
+};
+
+//current position input data
+int32_t dataX = 0, dataY = 0;
+
+//get current position x
+int32_t getDataX()
+{
+    return dataX;
+}
+
+//get current position y
+int32_t getDataY()
+{
+    return dataY;
+}
+
+//end current simulation segment, call user hook if segment has any frame
+void endSegment()
+{
+    if (frameCount > simStart && segmentFunc) segmentFunc(simTitle);
+    simStart = frameCount;
+    simPolls = 0;
+}
+
+//simulated exit key, pressed when current segment has enough frames (or too many polls without rendering)
+//the key is hold until next frame, so nested loops checking the same key all see it
+int32_t simulateExit()
+{
+    if (simPressed == frameCount + 1) return 1;
+    if (frameCount - simStart < uint64_t(simFrames) && ++simPolls < 0x100000) return 0;
+    endSegment();
+    simPressed = frameCount + 1;
+    simPolls = 0;
+    return 1;
+}
+
+//read current keyboard state
+void readKeys()
+{
+    SDL_PumpEvents();
+    keyStates = (uint8_t*)SDL_GetKeyboardState(NULL);
+}
+
+//this checks if the key is held down, returns true all the time until the key is up
+int32_t keyDown(int32_t key)
+{
+    if (simFrames) return (key == SDL_SCANCODE_RETURN) ? simulateExit() : 0;
+    if (!keyStates) return 0;
+    return (keyStates[key] != 0);
+}
+
+//this checks if the key is *just* pressed, returns true only once until the key is up again
+int32_t keyPressed(int32_t key)
+{
+    if (simFrames) return (key == SDL_SCANCODE_RETURN) ? simulateExit() : 0;
+    if (!keyStates) return 0;
+
+    if (keyStatus.find(key) == keyStatus.end()) keyStatus[key] = 0;
+
+    if (keyStates[key])
+    {
+        if (keyStatus[key] == 0)
+        {
+            keyStatus[key] = 1;
+            return 1;
+        }
+    }
+    else
+    {
+        keyStatus[key] = 0;
+    }
+
+    return 0;
+}
+
+//read input from user
+int32_t waitUserInput(int32_t inputMask /* = INPUT_KEY_PRESSED */)
+{
+    SDL_Event event = { 0 };
+
+    //simulation mode, user always press RETURN key
+    if (simFrames)
+    {
+        endSegment();
+        return SDL_SCANCODE_RETURN;
+    }
+
+    while (1)
+    {
+        if (SDL_WaitEvent(&event))
+        {
+            switch (event.type)
+            {
+            case SDL_EVENT_QUIT:
+                quit();
+                break;
+
+            case SDL_EVENT_KEY_DOWN:
+                if (inputMask & INPUT_KEY_PRESSED)
+                {
+                    return event.key.scancode;
+                }
+                break;
+
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:
+                if (inputMask & INPUT_MOUSE_CLICK)
+                {
+                    float px = 0, py = 0;
+                    SDL_GetMouseState(&px, &py);
+                    dataX = int32_t(px);
+                    dataY = int32_t(py);
+                    return SDL_EVENT_MOUSE_BUTTON_DOWN;
+                }
+                break;
+
+            case SDL_EVENT_MOUSE_BUTTON_UP:
+                if (inputMask & INPUT_MOUSE_CLICK)
+                {
+                    float px = 0, py = 0;
+                    SDL_GetMouseState(&px, &py);
+                    dataX = int32_t(px);
+                    dataY = int32_t(py);
+                    return SDL_EVENT_MOUSE_BUTTON_UP;
+                }
+                break;
+
+            case SDL_EVENT_MOUSE_MOTION:
+                if (inputMask & INPUT_MOUSE_MOTION)
+                {
+                    float px = 0, py = 0;
+                    SDL_GetMouseState(&px, &py);
+                    dataX = int32_t(px);
+                    dataY = int32_t(py);
+                    return SDL_EVENT_MOUSE_MOTION;
+                }
+                break;
+
+            case SDL_EVENT_MOUSE_WHEEL:
+                if (inputMask & INPUT_MOUSE_WHEEL)
+                {
+                    dataX = int32_t(event.wheel.x);
+                    dataY = int32_t(event.wheel.y);
+                    return SDL_EVENT_MOUSE_WHEEL;
+                }
+                break;
+
+            case SDL_EVENT_WINDOW_RESIZED:
+                if ((inputMask & INPUT_WIN_RESIZED) && (event.window.type == SDL_EVENT_WINDOW_RESIZED))
+                {
+                    dataX = event.window.data1;
+                    dataY = event.window.data2;
+                    return SDL_EVENT_WINDOW_RESIZED;
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+}
+
+//returns the time in milliseconds since the program started
+uint64_t getTime()
+{
+    if (simFrames) return simClock;
+    return SDL_GetTicks();
+}
+
+//return passing time from start time
+uint64_t getElapsedTime(uint64_t tmstart)
+{
+    return getTime() - tmstart;
+}
+
+//sleep CPU execution
+void delay(uint32_t miliseconds)
+{
+    if (simFrames)
+    {
+        simClock += miliseconds;
+        return;
+    }
+
+    SDL_Delay(miliseconds);
+}
+
+//only return 1 when exit key scanCode (not escape) is given, ESCAPE key to exit program
+bool finished(int32_t scanCode)
+{
+    //simulation mode, exit key is pressed after number of frames
+    if (simFrames) return simulateExit() != 0;
+
+    //what the user input key?
+    readKeys();
+    if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+    if (keyStates[scanCode])
+    {
+        //clear buffer
+        keyStates[scanCode] = 0;
+        return true;
+    }
+
+    return false;
+}
+
+//wait for key with scancode is pressed
+void waitKeyPressed(int32_t scanCode)
+{
+    if (simFrames)
+    {
+        endSegment();
+        return;
+    }
+
+    while (!finished(scanCode)) SDL_Delay(1);
+}
+
+//wait until time wait is passed, program exit when ESCAPE key pressed
+void waitFor(uint64_t tmstart, uint64_t tmwait)
+{
+    if (simFrames)
+    {
+        simClock = max(simClock, tmstart + tmwait);
+        return;
+    }
+
+    while (getElapsedTime(tmstart) < tmwait)
+    {
+        SDL_PollEvent(&sdlEvent);
+        if (sdlEvent.type == SDL_EVENT_QUIT) quit();
+        keyStates = (uint8_t*)SDL_GetKeyboardState(NULL);
+        if (keyStates[SDL_SCANCODE_ESCAPE]) quit();
+        SDL_Delay(1);
+    }
+}
+
+//sleep until time wait is passed or enter key, program exit when ESCAPE key pressed
+void sleepFor(uint64_t tmwait)
+{
+    int32_t done = 0;
+    const uint64_t tmstart = getTime();
+
+    if (simFrames)
+    {
+        simClock += tmwait;
+        return;
+    }
+
+    while (!done && getElapsedTime(tmstart) < tmwait)
+    {
+        SDL_PollEvent(&sdlEvent);
+        if (sdlEvent.type == SDL_EVENT_QUIT) quit();
+        keyStates = (uint8_t*)SDL_GetKeyboardState(NULL);
+        if (keyStates[SDL_SCANCODE_ESCAPE]) quit();
+        if (keyStates[SDL_SCANCODE_RETURN])
+        {
+            done = 1;
+            keyStates[SDL_SCANCODE_RETURN] = 0;
+        }
+        SDL_Delay(1);
+    }
+}
+
+//exit program
+void quit()
+{
+    cleanup();
+    exit(1);
+}
+
+//start simulation mode: screen is forced to headless, delay and wait functions return at once with simulated clock,
+//RETURN key is pressed when a segment has number of frames (ESCAPE key is never pressed), random seed is fixed.
+//a segment is ended by RETURN key, initScreen, setWindowTitle and cleanup
+void beginSimulation(int32_t frames, uint32_t seed, GFX_SEGMENT_FUNC func)
+{
+    simFrames = max(frames, 1);
+    simSeed = seed;
+    simClock = 0;
+    simStart = frameCount;
+    simPressed = 0;
+    simPolls = 0;
+    simTitle[0] = 0;
+    segmentFunc = func;
+    srand(seed);
+}
+
+//stop simulation mode
+void endSimulation()
+{
+    simFrames = 0;
+    segmentFunc = NULL;
+}
+
+//get seed for random number generation (fixed seed in simulation mode)
+uint32_t getRandomSeed()
+{
+    return simFrames ? simSeed : uint32_t(time(NULL));
+}
+
+//show the mouse cursor
+void showMouseCursor()
+{
+    SDL_ShowCursor();
+}
+
+//hide the mouse cursor
+void hideMouseCursor()
+{
+    SDL_HideCursor();
+}
+
+//get current mouse state
+void getMouseState(int32_t* mx, int32_t* my, int32_t* lmb, int32_t* rmb)
+{
+    float px = 0, py = 0;
+    const SDL_MouseButtonFlags mstate = SDL_GetMouseState(&px, &py);
+    if (lmb) *lmb = (mstate == SDL_BUTTON_LEFT);
+    if (rmb) *rmb = (mstate == SDL_BUTTON_RIGHT);
+    if (mx) *mx = int32_t(px);
+    if (my) *my = int32_t(py);
+}
+
+//set mouse position
+void setMousePosition(int32_t px, int32_t py)
+{
+    if (!sdlWindow) return;
+    SDL_SetWindowMouseGrab(sdlWindow, SDL_TRUE);
+    SDL_WarpMouseInWindow(sdlWindow, float(px), float(py));
+}
+
+//convert 8 bits indexed pixels to 32 bits using palette lookup table
+void expandPixels(uint32_t* dst, const uint8_t* src, int32_t count, const uint32_t* table)
+{
+    for (int32_t i = 0; i < count; i++) dst[i] = table[src[i]];
+}
+
+//convert 8 bits indexed pixels to 32 bits (SSE4.1 version, 16 pixels per loop)
+target_sse41 void expandPixelsSSE41(uint32_t* dst, const uint8_t* src, int32_t count, const uint32_t* table)
+{
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i xmm0 = _mm_loadu_si128((const __m128i*)&src[i]);
+        const uint32_t idx0 = _mm_cvtsi128_si32(xmm0);
+        const uint32_t idx1 = _mm_extract_epi32(xmm0, 1);
+        const uint32_t idx2 = _mm_extract_epi32(xmm0, 2);
+        const uint32_t idx3 = _mm_extract_epi32(xmm0, 3);
+        _mm_storeu_si128((__m128i*)&dst[i     ], _mm_setr_epi32(table[idx0 & 0xff], table[(idx0 >> 8) & 0xff], table[(idx0 >> 16) & 0xff], table[idx0 >> 24]));
+        _mm_storeu_si128((__m128i*)&dst[i +  4], _mm_setr_epi32(table[idx1 & 0xff], table[(idx1 >> 8) & 0xff], table[(idx1 >> 16) & 0xff], table[idx1 >> 24]));
+        _mm_storeu_si128((__m128i*)&dst[i +  8], _mm_setr_epi32(table[idx2 & 0xff], table[(idx2 >> 8) & 0xff], table[(idx2 >> 16) & 0xff], table[idx2 >> 24]));
+        _mm_storeu_si128((__m128i*)&dst[i + 12], _mm_setr_epi32(table[idx3 & 0xff], table[(idx3 >> 8) & 0xff], table[(idx3 >> 16) & 0xff], table[idx3 >> 24]));
+    }
+
+    //remainder pixels
+    for (; i < count; i++) dst[i] = table[src[i]];
+}
+
+//convert 8 bits indexed pixels to 32 bits (AVX2 version, gather 32 pixels per loop)
+target_avx2 void expandPixelsAVX2(uint32_t* dst, const uint8_t* src, int32_t count, const uint32_t* table)
+{
+    int32_t i = 0;
+    const int32_t* lut = (const int32_t*)table;
+
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256((const __m256i*)&src[i]);
+        const __m128i xmm0 = _mm256_castsi256_si128(ymm0);
+        const __m128i xmm1 = _mm256_extracti128_si256(ymm0, 1);
+        _mm256_storeu_si256((__m256i*)&dst[i     ], _mm256_i32gather_epi32(lut, _mm256_cvtepu8_epi32(xmm0), 4));
+        _mm256_storeu_si256((__m256i*)&dst[i +  8], _mm256_i32gather_epi32(lut, _mm256_cvtepu8_epi32(_mm_srli_si128(xmm0, 8)), 4));
+        _mm256_storeu_si256((__m256i*)&dst[i + 16], _mm256_i32gather_epi32(lut, _mm256_cvtepu8_epi32(xmm1), 4));
+        _mm256_storeu_si256((__m256i*)&dst[i + 24], _mm256_i32gather_epi32(lut, _mm256_cvtepu8_epi32(_mm_srli_si128(xmm1, 8)), 4));
+    }
+
+    //8 pixels per loop
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i xmm0 = _mm_loadl_epi64((const __m128i*)&src[i]);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_i32gather_epi32(lut, _mm256_cvtepu8_epi32(xmm0), 4));
+    }
+
+    //remainder pixels
+    for (; i < count; i++) dst[i] = table[src[i]];
+}
+
+//coverage of accumulated signed area (non-zero clamps to 1, even-odd folds winding of 2 back to 0)
+static must_inline uint8_t coverPixel(float area, const int32_t rule)
+{
+    float cover = fabsf(area);
+    if (rule == FILL_RULE_NON_ZERO) cover = min(cover, 1.0f);
+    else
+    {
+        cover -= 2.0f * floorf(cover * 0.5f);
+        cover = min(cover, 2.0f - cover);
+    }
+    return uint8_t(cover * 255.0f + 0.5f);
+}
+
+//resolve coverage of cells starting from running area, cells are summed in blocks of 4 the same as SIMD prefix scan
+//(float adds are not associative, so all kernels must add in this order to give the same coverage)
+static must_inline void coverCells(uint8_t* dst, const float* src, int32_t count, const int32_t rule, float area)
+{
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float sum1 = src[i + 1] + src[i];
+        const float sum2 = (src[i + 2] + src[i + 1]) + src[i];
+        const float sum3 = (src[i + 3] + src[i + 2]) + sum1;
+        dst[i    ] = coverPixel(src[i] + area, rule);
+        dst[i + 1] = coverPixel(sum1 + area, rule);
+        dst[i + 2] = coverPixel(sum2 + area, rule);
+        dst[i + 3] = coverPixel(sum3 + area, rule);
+        area = sum3 + area;
+    }
+
+    //remainder pixels
+    for (; i < count; i++)
+    {
+        area += src[i];
+        dst[i] = coverPixel(area, rule);
+    }
+}
+
+//resolve coverage span: prefix sum of signed area cells to 8 bits coverage
+void coverSpan(uint8_t* dst, const float* src, int32_t count, int32_t rule)
+{
+    coverCells(dst, src, count, rule, 0);
+}
+
+//coverage of 4 areas (SSE2 version)
+static must_inline __m128i coverLanesSSE2(__m128 area, const int32_t rule)
+{
+    __m128 cover = _mm_andnot_ps(_mm_set1_ps(-0.0f), area);
+    if (rule == FILL_RULE_NON_ZERO) cover = _mm_min_ps(cover, _mm_set1_ps(1.0f));
+    else
+    {
+        //cover is positive, so truncate is floor
+        const __m128 half = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(cover, _mm_set1_ps(0.5f))));
+        cover = _mm_sub_ps(cover, _mm_add_ps(half, half));
+        cover = _mm_min_ps(cover, _mm_sub_ps(_mm_set1_ps(2.0f), cover));
+    }
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(cover, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+}
+
+//resolve coverage span (SSE2 version, 8 pixels per loop, in-register prefix sum)
+void coverSpanSSE2(uint8_t* dst, const float* src, int32_t count, int32_t rule)
+{
+    int32_t i = 0;
+    __m128 carry = _mm_setzero_ps();
+
+    for (; i + 8 <= count; i += 8)
+    {
+        //prefix sum of 4 cells: shift and add twice, then add the running total
+        __m128 lo = _mm_loadu_ps(&src[i]);
+        lo = _mm_add_ps(lo, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(lo), 4)));
+        lo = _mm_add_ps(lo, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(lo), 8)));
+        lo = _mm_add_ps(lo, carry);
+        carry = _mm_shuffle_ps(lo, lo, 0xff);
+
+        __m128 hi = _mm_loadu_ps(&src[i + 4]);
+        hi = _mm_add_ps(hi, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(hi), 4)));
+        hi = _mm_add_ps(hi, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(hi), 8)));
+        hi = _mm_add_ps(hi, carry);
+        carry = _mm_shuffle_ps(hi, hi, 0xff);
+
+        const __m128i words = _mm_packs_epi32(coverLanesSSE2(lo, rule), coverLanesSSE2(hi, rule));
+        _mm_storel_epi64((__m128i*)&dst[i], _mm_packus_epi16(words, words));
+    }
+
+    //remainder pixels
+    coverCells(&dst[i], &src[i], count - i, rule, _mm_cvtss_f32(carry));
+}
+
+//resolve coverage span (AVX2 version, 8 pixels per loop, same in-register prefix sum as SSE2 version)
+target_avx2 void coverSpanAVX2(uint8_t* dst, const float* src, int32_t count, int32_t rule)
+{
+    int32_t i = 0;
+    __m256 carry = _mm256_setzero_ps();
+    const __m256i third = _mm256_set1_epi32(3);
+    const __m256i last = _mm256_set1_epi32(7);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        //prefix sum in each 128 bits lane, add running total to low lane, then low lane total to high lane
+        __m256 area = _mm256_loadu_ps(&src[i]);
+        area = _mm256_add_ps(area, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(area), 4)));
+        area = _mm256_add_ps(area, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(area), 8)));
+        const __m256 low = _mm256_permutevar8x32_ps(_mm256_add_ps(area, carry), third);
+        area = _mm256_add_ps(area, _mm256_blend_ps(carry, low, 0xf0));
+        carry = _mm256_permutevar8x32_ps(area, last);
+
+        __m256 cover = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), area);
+        if (rule == FILL_RULE_NON_ZERO) cover = _mm256_min_ps(cover, _mm256_set1_ps(1.0f));
+        else
+        {
+            const __m256 half = _mm256_floor_ps(_mm256_mul_ps(cover, _mm256_set1_ps(0.5f)));
+            cover = _mm256_sub_ps(cover, _mm256_add_ps(half, half));
+            cover = _mm256_min_ps(cover, _mm256_sub_ps(_mm256_set1_ps(2.0f), cover));
+        }
+
+        //add 0.5 and truncate, as scalar kernel rounds
+        const __m256i dwords = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(cover, _mm256_set1_ps(255.0f)), _mm256_set1_ps(0.5f)));
+        const __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(dwords), _mm256_extracti128_si256(dwords, 1));
+        _mm_storel_epi64((__m128i*)&dst[i], _mm_packus_epi16(words, words));
+    }
+
+    //remainder pixels
+    coverCells(&dst[i], &src[i], count - i, rule, _mm_cvtss_f32(_mm256_castps256_ps128(carry)));
+}
+
+//fill 32 bits span with color
+void fillSpan(uint32_t* dst, uint32_t color, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) dst[i] = color;
+}
+
+//fill 32 bits span with color (SSE2 version, 4 pixels per loop)
+void fillSpanSSE2(uint32_t* dst, uint32_t color, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i xmm0 = _mm_set1_epi32(color);
+    for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i*)&dst[i], xmm0);
+    for (; i < count; i++) dst[i] = color;
+}
+
+//lane mask of first n pixels (n = 0..8) for AVX2 masked loads and stores
+static must_inline target_avx2 __m256i laneMask(const int32_t n)
+{
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+//number of pixels before next 32-bytes boundary (at most count)
+static must_inline int32_t headPixels(const uint32_t* dst, const int32_t count)
+{
+    return min(int32_t(((32 - (uintptr_t(dst) & 31)) & 31) >> 2), count);
+}
+
+//store policy: last level cache size and fill size in bytes that use non-temporal stores (see setStorePolicy)
+uint32_t llcSize = DEFAULT_LLC_SIZE;
+uint64_t streamThreshold = uint64_t(DEFAULT_LLC_SIZE) * STORE_LLC_PERCENT / 100;
+
+//fills larger than store policy threshold use non-temporal stores (others stay in cache)
+//decide once by whole fill size, a single span never reach the threshold
+static must_inline int32_t streamStores(const uint64_t bytes)
+{
+    return bytes >= streamThreshold;
+}
+
+//fill 32 bits span with color (AVX2 version, 8 pixels per loop)
+//masked head to 32-bytes boundary, aligned body, masked tail
+target_avx2 void fillSpanAVX2(uint32_t* dst, uint32_t color, int32_t count)
+{
+    const __m256i ymm0 = _mm256_set1_epi32(color);
+
+    int32_t i = headPixels(dst, count);
+    if (i > 0) _mm256_maskstore_epi32((int*)dst, laneMask(i), ymm0);
+
+    for (; i + 8 <= count; i += 8) _mm256_store_si256((__m256i*)&dst[i], ymm0);
+
+    if (i < count) _mm256_maskstore_epi32((int*)&dst[i], laneMask(count - i), ymm0);
+}
+
+//fill 32 bits span with non-temporal stores (large fills that are not read back soon)
+void streamSpan(uint32_t* dst, uint32_t color, int32_t count)
+{
+    fillSpan(dst, color, count);
+}
+
+//fill 32 bits span with non-temporal stores (SSE2 version, head to 16-bytes boundary, streamed body)
+void streamSpanSSE2(uint32_t* dst, uint32_t color, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i xmm0 = _mm_set1_epi32(color);
+    for (; i < count && (uintptr_t(&dst[i]) & 15); i++) dst[i] = color;
+    for (; i + 4 <= count; i += 4) _mm_stream_si128((__m128i*)&dst[i], xmm0);
+    for (; i < count; i++) dst[i] = color;
+}
+
+//fill 32 bits span with non-temporal stores (AVX2 version, masked head and tail, streamed body)
+target_avx2 void streamSpanAVX2(uint32_t* dst, uint32_t color, int32_t count)
+{
+    const __m256i ymm0 = _mm256_set1_epi32(color);
+
+    int32_t i = headPixels(dst, count);
+    if (i > 0) _mm256_maskstore_epi32((int*)dst, laneMask(i), ymm0);
+    for (; i + 8 <= count; i += 8) _mm256_stream_si256((__m256i*)&dst[i], ymm0);
+    if (i < count) _mm256_maskstore_epi32((int*)&dst[i], laneMask(count - i), ymm0);
+}
+
+//fill 32 bits span with color (AVX-512 version, 16 pixels per loop, masked tail)
+target_avx512 void fillSpanAVX512(uint32_t* dst, uint32_t color, int32_t count)
+{
+    int32_t i = 0;
+    const __m512i zmm0 = _mm512_set1_epi32(color);
+    for (; i + 16 <= count; i += 16) _mm512_storeu_si512(&dst[i], zmm0);
+    if (i < count) _mm512_mask_storeu_epi32(&dst[i], __mmask16((1 << (count - i)) - 1), zmm0);
+}
+
+//fill 32 bits span with non-temporal stores (AVX-512 version, masked head to 64-bytes boundary and tail, streamed body)
+target_avx512 void streamSpanAVX512(uint32_t* dst, uint32_t color, int32_t count)
+{
+    const __m512i zmm0 = _mm512_set1_epi32(color);
+
+    int32_t i = min(int32_t(((64 - (uintptr_t(dst) & 63)) & 63) >> 2), count);
+    if (i > 0) _mm512_mask_storeu_epi32(dst, __mmask16((1 << i) - 1), zmm0);
+    for (; i + 16 <= count; i += 16) _mm512_stream_si512((__m512i*)&dst[i], zmm0);
+    if (i < count) _mm512_mask_storeu_epi32(&dst[i], __mmask16((1 << (count - i)) - 1), zmm0);
+}
+
+//blend pixel with pre-multiplied source channels (S * A + D * (256 - A)) >> 8
+static must_inline uint32_t blendPixel(const uint32_t dst, const uint32_t srb, const uint32_t sag, const uint32_t rcover)
+{
+    const uint32_t rb = (((dst & 0x00ff00ff) * rcover + srb) >> 8) & 0x00ff00ff;
+    const uint32_t ag = (((dst >> 8) & 0x00ff00ff) * rcover + sag) & 0xff00ff00;
+    return rb | ag;
+}
+
+//alpha-blending 32 bits span with color (alpha = argb >> 24)
+void blendSpan(uint32_t* dst, uint32_t argb, int32_t count)
+{
+    const uint32_t cover = argb >> 24;
+    const uint32_t srb = (argb & 0x00ff00ff) * cover;
+    const uint32_t sag = ((argb >> 8) & 0x00ff00ff) * cover;
+    for (int32_t i = 0; i < count; i++) dst[i] = blendPixel(dst[i], srb, sag, 256 - cover);
+}
+
+//alpha-blending 32 bits span with color (SSE2 version, 4 pixels per loop)
+void blendSpanSSE2(uint32_t* dst, uint32_t argb, int32_t count)
+{
+    int32_t i = 0;
+    const uint32_t cover = argb >> 24;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i invert = _mm_set1_epi16(256 - cover);
+
+    //source color (S * A), same for low and high pixels
+    const __m128i src = _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(argb), zero), _mm_set1_epi16(cover));
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i col = _mm_loadu_si128((const __m128i*)&dst[i]);
+        const __m128i lo = _mm_srli_epi16(_mm_add_epi16(src, _mm_mullo_epi16(_mm_unpacklo_epi8(col, zero), invert)), 8);
+        const __m128i hi = _mm_srli_epi16(_mm_add_epi16(src, _mm_mullo_epi16(_mm_unpackhi_epi8(col, zero), invert)), 8);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    const uint32_t srb = (argb & 0x00ff00ff) * cover;
+    const uint32_t sag = ((argb >> 8) & 0x00ff00ff) * cover;
+    for (; i < count; i++) dst[i] = blendPixel(dst[i], srb, sag, 256 - cover);
+}
+
+//alpha-blending 8 pixels with pre-multiplied color (S * A + D * (256 - A)) >> 8
+static must_inline target_avx2 __m256i blendLanes(const __m256i col, const __m256i src, const __m256i invert)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(src, _mm256_mullo_epi16(_mm256_unpacklo_epi8(col, zero), invert)), 8);
+    const __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(src, _mm256_mullo_epi16(_mm256_unpackhi_epi8(col, zero), invert)), 8);
+    return _mm256_packus_epi16(lo, hi);
+}
+
+//alpha-blending 32 bits span with color (AVX2 version, 8 pixels per loop)
+//masked head to 32-bytes boundary, aligned body, masked tail
+target_avx2 void blendSpanAVX2(uint32_t* dst, uint32_t argb, int32_t count)
+{
+    const uint32_t cover = argb >> 24;
+    const __m256i invert = _mm256_set1_epi16(256 - cover);
+
+    //source color (S * A), same for low and high pixels
+    const __m256i src = _mm256_mullo_epi16(_mm256_unpacklo_epi8(_mm256_set1_epi32(argb), _mm256_setzero_si256()), _mm256_set1_epi16(cover));
+
+    int32_t i = headPixels(dst, count);
+    if (i > 0)
+    {
+        const __m256i mask = laneMask(i);
+        _mm256_maskstore_epi32((int*)dst, mask, blendLanes(_mm256_maskload_epi32((const int*)dst, mask), src, invert));
+    }
+
+    for (; i + 8 <= count; i += 8) _mm256_store_si256((__m256i*)&dst[i], blendLanes(_mm256_load_si256((const __m256i*)&dst[i]), src, invert));
+
+    if (i < count)
+    {
+        const __m256i mask = laneMask(count - i);
+        _mm256_maskstore_epi32((int*)&dst[i], mask, blendLanes(_mm256_maskload_epi32((const int*)&dst[i], mask), src, invert));
+    }
+}
+
+//alpha-blending 16 pixels with pre-multiplied color (AVX-512BW version)
+static must_inline target_avx512 __m512i blendLanes(const __m512i col, const __m512i src, const __m512i invert)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i lo = _mm512_srli_epi16(_mm512_add_epi16(src, _mm512_mullo_epi16(_mm512_unpacklo_epi8(col, zero), invert)), 8);
+    const __m512i hi = _mm512_srli_epi16(_mm512_add_epi16(src, _mm512_mullo_epi16(_mm512_unpackhi_epi8(col, zero), invert)), 8);
+    return _mm512_packus_epi16(lo, hi);
+}
+
+//alpha-blending 32 bits span with color (AVX-512BW version, 16 pixels per loop, masked tail)
+target_avx512 void blendSpanAVX512(uint32_t* dst, uint32_t argb, int32_t count)
+{
+    int32_t i = 0;
+    const uint32_t cover = argb >> 24;
+    const __m512i invert = _mm512_set1_epi16(256 - cover);
+
+    //source color (S * A), same for low and high pixels
+    const __m512i src = _mm512_mullo_epi16(_mm512_unpacklo_epi8(_mm512_set1_epi32(argb), _mm512_setzero_si512()), _mm512_set1_epi16(cover));
+
+    for (; i + 16 <= count; i += 16) _mm512_storeu_si512(&dst[i], blendLanes(_mm512_loadu_si512(&dst[i]), src, invert));
+
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        _mm512_mask_storeu_epi32(&dst[i], tail, blendLanes(_mm512_maskz_loadu_epi32(tail, &dst[i]), src, invert));
+    }
+}
+
+//copy 32 bits span
+void copySpan(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    memcpy(dst, src, intptr_t(count) << 2);
+}
+
+//copy 32 bits span (SSE2 version, 4 pixels per loop)
+void copySpanSSE2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i*)&dst[i], _mm_loadu_si128((const __m128i*)&src[i]));
+    for (; i < count; i++) dst[i] = src[i];
+}
+
+//copy 32 bits span (AVX2 version, 8 pixels per loop)
+target_avx2 void copySpanAVX2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8) _mm256_storeu_si256((__m256i*)&dst[i], _mm256_loadu_si256((const __m256i*)&src[i]));
+    for (; i < count; i++) dst[i] = src[i];
+}
+
+//copy 32 bits span (AVX-512 version, 16 pixels per loop, masked tail)
+target_avx512 void copySpanAVX512(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16) _mm512_storeu_si512(&dst[i], _mm512_loadu_si512(&src[i]));
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        _mm512_mask_storeu_epi32(&dst[i], tail, _mm512_maskz_loadu_epi32(tail, &src[i]));
+    }
+}
+
+//alpha-blending 32 bits span with source pixels (alpha = src >> 24)
+void alphaSpan(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        const uint32_t col = src[i];
+        const uint32_t cover = col >> 24;
+        dst[i] = blendPixel(dst[i], (col & 0x00ff00ff) * cover, ((col >> 8) & 0x00ff00ff) * cover, 256 - cover);
+    }
+}
+
+//alpha-blending 32 bits span with source pixels (SSE2 version, 4 pixels per loop)
+void alphaSpanSSE2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i unity = _mm_set1_epi16(256);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i scol = _mm_loadu_si128((const __m128i*)&src[i]);
+        const __m128i dcol = _mm_loadu_si128((const __m128i*)&dst[i]);
+
+        //low pixels (S * A + D * (256 - A)) >> 8
+        __m128i src16 = _mm_unpacklo_epi8(scol, zero);
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src16, 0xff), 0xff);
+        __m128i dst16 = _mm_mullo_epi16(_mm_unpacklo_epi8(dcol, zero), _mm_sub_epi16(unity, alpha));
+        const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src16, alpha), dst16), 8);
+
+        //high pixels
+        src16 = _mm_unpackhi_epi8(scol, zero);
+        alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src16, 0xff), 0xff);
+        dst16 = _mm_mullo_epi16(_mm_unpackhi_epi8(dcol, zero), _mm_sub_epi16(unity, alpha));
+        const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src16, alpha), dst16), 8);
+
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    alphaSpan(&dst[i], &src[i], count - i);
+}
+
+//alpha-blending 32 bits span with source pixels (AVX2 version, 8 pixels per loop)
+target_avx2 void alphaSpanAVX2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i unity = _mm256_set1_epi16(256);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i scol = _mm256_loadu_si256((const __m256i*)&src[i]);
+        const __m256i dcol = _mm256_loadu_si256((const __m256i*)&dst[i]);
+
+        //low pixels (S * A + D * (256 - A)) >> 8
+        __m256i src16 = _mm256_unpacklo_epi8(scol, zero);
+        __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src16, 0xff), 0xff);
+        __m256i dst16 = _mm256_mullo_epi16(_mm256_unpacklo_epi8(dcol, zero), _mm256_sub_epi16(unity, alpha));
+        const __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(src16, alpha), dst16), 8);
+
+        //high pixels
+        src16 = _mm256_unpackhi_epi8(scol, zero);
+        alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src16, 0xff), 0xff);
+        dst16 = _mm256_mullo_epi16(_mm256_unpackhi_epi8(dcol, zero), _mm256_sub_epi16(unity, alpha));
+        const __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(src16, alpha), dst16), 8);
+
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    alphaSpan(&dst[i], &src[i], count - i);
+}
+
+//alpha-blending 16 pixels with source pixels (S * A + D * (256 - A)) >> 8 (AVX-512BW version)
+static must_inline target_avx512 __m512i alphaLanes(const __m512i dcol, const __m512i scol)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i unity = _mm512_set1_epi16(256);
+
+    //low pixels
+    __m512i src16 = _mm512_unpacklo_epi8(scol, zero);
+    __m512i alpha = _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(src16, 0xff), 0xff);
+    __m512i dst16 = _mm512_mullo_epi16(_mm512_unpacklo_epi8(dcol, zero), _mm512_sub_epi16(unity, alpha));
+    const __m512i lo = _mm512_srli_epi16(_mm512_add_epi16(_mm512_mullo_epi16(src16, alpha), dst16), 8);
+
+    //high pixels
+    src16 = _mm512_unpackhi_epi8(scol, zero);
+    alpha = _mm512_shufflehi_epi16(_mm512_shufflelo_epi16(src16, 0xff), 0xff);
+    dst16 = _mm512_mullo_epi16(_mm512_unpackhi_epi8(dcol, zero), _mm512_sub_epi16(unity, alpha));
+    const __m512i hi = _mm512_srli_epi16(_mm512_add_epi16(_mm512_mullo_epi16(src16, alpha), dst16), 8);
+
+    return _mm512_packus_epi16(lo, hi);
+}
+
+//alpha-blending 32 bits span with source pixels (AVX-512BW version, 16 pixels per loop, masked tail)
+target_avx512 void alphaSpanAVX512(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16) _mm512_storeu_si512(&dst[i], alphaLanes(_mm512_loadu_si512(&dst[i]), _mm512_loadu_si512(&src[i])));
+
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        _mm512_mask_storeu_epi32(&dst[i], tail, alphaLanes(_mm512_maskz_loadu_epi32(tail, &dst[i]), _mm512_maskz_loadu_epi32(tail, &src[i])));
+    }
+}
+
+//copy 32 bits span, skip key color pixels (alpha channel of source is turned off)
+void spriteSpan(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        const uint32_t col = src[i] & 0x00ffffff;
+        if (col != keyColor) dst[i] = col;
+    }
+}
+
+//copy 32 bits span, skip key color pixels (SSE2 version, 4 pixels per loop)
+void spriteSpanSSE2(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i key = _mm_set1_epi32(keyColor);
+    const __m128i rgb = _mm_set1_epi32(0x00ffffff);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i col = _mm_and_si128(_mm_loadu_si128((const __m128i*)&src[i]), rgb);
+        const __m128i mask = _mm_cmpeq_epi32(col, key);
+        const __m128i bkg = _mm_and_si128(_mm_loadu_si128((const __m128i*)&dst[i]), mask);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(bkg, _mm_andnot_si128(mask, col)));
+    }
+
+    //remainder pixels
+    spriteSpan(&dst[i], &src[i], keyColor, count - i);
+}
+
+//copy 32 bits span, skip key color pixels (AVX2 version, 8 pixels per loop)
+//key color lanes keep background with blendv, masked tail only store visible pixels
+target_avx2 void spriteSpanAVX2(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    int32_t i = 0;
+    const __m256i key = _mm256_set1_epi32(keyColor);
+    const __m256i rgb = _mm256_set1_epi32(0x00ffffff);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i col = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src[i]), rgb);
+        const __m256i mask = _mm256_cmpeq_epi32(col, key);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_blendv_epi8(col, _mm256_loadu_si256((const __m256i*)&dst[i]), mask));
+    }
+
+    if (i < count)
+    {
+        const __m256i tail = laneMask(count - i);
+        const __m256i col = _mm256_and_si256(_mm256_maskload_epi32((const int*)&src[i], tail), rgb);
+        _mm256_maskstore_epi32((int*)&dst[i], _mm256_andnot_si256(_mm256_cmpeq_epi32(col, key), tail), col);
+    }
+}
+
+//copy 32 bits span, skip key color pixels (AVX-512 version, key color pixels are masked out from store)
+target_avx512 void spriteSpanAVX512(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    int32_t i = 0;
+    const __m512i key = _mm512_set1_epi32(keyColor);
+    const __m512i rgb = _mm512_set1_epi32(0x00ffffff);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512i col = _mm512_and_si512(_mm512_loadu_si512(&src[i]), rgb);
+        _mm512_mask_storeu_epi32(&dst[i], _mm512_cmpneq_epi32_mask(col, key), col);
+    }
+
+    //masked tail
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        const __m512i col = _mm512_and_si512(_mm512_maskz_loadu_epi32(tail, &src[i]), rgb);
+        _mm512_mask_storeu_epi32(&dst[i], _mm512_mask_cmpneq_epi32_mask(tail, col, key), col);
+    }
+}
+
+//blend functors: pixel() blend a 32 bits pixel, lanes() blend 4 (SSE2), 8 (AVX2) or 16 (AVX-512BW, simple modes only) pixels
+//saturated and logical modes only change RGB channels (background alpha is kept)
+//SOURCE_ALPHA tell sprite kernels to keep source alpha channel (other modes turn it off)
+struct BlendNormal {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t, const uint32_t src) { return src; }
+    static must_inline __m128i lanes(const __m128i, const __m128i src) { return src; }
+    static must_inline target_avx2 __m256i lanes(const __m256i, const __m256i src) { return src; }
+    static must_inline target_avx512 __m512i lanes(const __m512i, const __m512i src) { return src; }
+};
+
+struct BlendAdd {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        const uint32_t r = min(int32_t((dst >> 16) & 0xff) + int32_t((src >> 16) & 0xff), 255);
+        const uint32_t g = min(int32_t((dst >> 8) & 0xff) + int32_t((src >> 8) & 0xff), 255);
+        const uint32_t b = min(int32_t(dst & 0xff) + int32_t(src & 0xff), 255);
+        return (dst & 0xff000000) | (r << 16) | (g << 8) | b;
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return _mm_adds_epu8(dst, _mm_and_si128(src, _mm_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return _mm256_adds_epu8(dst, _mm256_and_si256(src, _mm256_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx512 __m512i lanes(const __m512i dst, const __m512i src) { return _mm512_adds_epu8(dst, _mm512_and_si512(src, _mm512_set1_epi32(0x00ffffff))); }
+};
+
+struct BlendSub {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        const uint32_t r = max(int32_t((dst >> 16) & 0xff) - int32_t((src >> 16) & 0xff), 0);
+        const uint32_t g = max(int32_t((dst >> 8) & 0xff) - int32_t((src >> 8) & 0xff), 0);
+        const uint32_t b = max(int32_t(dst & 0xff) - int32_t(src & 0xff), 0);
+        return (dst & 0xff000000) | (r << 16) | (g << 8) | b;
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return _mm_subs_epu8(dst, _mm_and_si128(src, _mm_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return _mm256_subs_epu8(dst, _mm256_and_si256(src, _mm256_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx512 __m512i lanes(const __m512i dst, const __m512i src) { return _mm512_subs_epu8(dst, _mm512_and_si512(src, _mm512_set1_epi32(0x00ffffff))); }
+};
+
+struct BlendAnd {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src) { return dst & (src | 0xff000000); }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return _mm_and_si128(dst, _mm_or_si128(src, _mm_set1_epi32(0xff000000))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return _mm256_and_si256(dst, _mm256_or_si256(src, _mm256_set1_epi32(0xff000000))); }
+    static must_inline target_avx512 __m512i lanes(const __m512i dst, const __m512i src) { return _mm512_and_si512(dst, _mm512_or_si512(src, _mm512_set1_epi32(0xff000000))); }
+};
+
+struct BlendXor {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src) { return dst ^ (src & 0x00ffffff); }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return _mm_xor_si128(dst, _mm_and_si128(src, _mm_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return _mm256_xor_si256(dst, _mm256_and_si256(src, _mm256_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx512 __m512i lanes(const __m512i dst, const __m512i src) { return _mm512_xor_si512(dst, _mm512_and_si512(src, _mm512_set1_epi32(0x00ffffff))); }
+};
+
+//alpha-blending (S * A + D * (256 - A)) >> 8, alpha = src >> 24
+struct BlendAlpha {
+    enum { SOURCE_ALPHA = 1 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        const uint32_t cover = src >> 24;
+        return blendPixel(dst, (src & 0x00ff00ff) * cover, ((src >> 8) & 0x00ff00ff) * cover, 256 - cover);
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i unity = _mm_set1_epi16(256);
+        __m128i src16 = _mm_unpacklo_epi8(src, zero);
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src16, 0xff), 0xff);
+        const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src16, alpha), _mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(unity, alpha))), 8);
+        src16 = _mm_unpackhi_epi8(src, zero);
+        alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src16, 0xff), 0xff);
+        const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(src16, alpha), _mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(unity, alpha))), 8);
+        return _mm_packus_epi16(lo, hi);
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i unity = _mm256_set1_epi16(256);
+        __m256i src16 = _mm256_unpacklo_epi8(src, zero);
+        __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src16, 0xff), 0xff);
+        const __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(src16, alpha), _mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), _mm256_sub_epi16(unity, alpha))), 8);
+        src16 = _mm256_unpackhi_epi8(src, zero);
+        alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(src16, 0xff), 0xff);
+        const __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(src16, alpha), _mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), _mm256_sub_epi16(unity, alpha))), 8);
+        return _mm256_packus_epi16(lo, hi);
+    }
+    static must_inline target_avx512 __m512i lanes(const __m512i dst, const __m512i src) { return alphaLanes(dst, src); }
+};
+
+//pre-multiplied alpha-blending S + (D * (256 - A)) >> 8, alpha = src >> 24 (source colors are already S * A >> 8)
+//sums never exceed 255 for pre-multiplied colors, so channels are added without saturation
+struct BlendPremultiplied {
+    enum { SOURCE_ALPHA = 1 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        const uint32_t rcover = 256 - (src >> 24);
+        const uint32_t rb = (((dst & 0x00ff00ff) * rcover) >> 8) & 0x00ff00ff;
+        const uint32_t ag = (((dst >> 8) & 0x00ff00ff) * rcover) & 0xff00ff00;
+        return src + (rb | ag);
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i unity = _mm_set1_epi16(256);
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_unpacklo_epi8(src, zero), 0xff), 0xff);
+        const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_sub_epi16(unity, alpha)), 8);
+        alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(_mm_unpackhi_epi8(src, zero), 0xff), 0xff);
+        const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_sub_epi16(unity, alpha)), 8);
+        return _mm_add_epi8(src, _mm_packus_epi16(lo, hi));
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i unity = _mm256_set1_epi16(256);
+        __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(_mm256_unpacklo_epi8(src, zero), 0xff), 0xff);
+        const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), _mm256_sub_epi16(unity, alpha)), 8);
+        alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(_mm256_unpackhi_epi8(src, zero), 0xff), 0xff);
+        const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), _mm256_sub_epi16(unity, alpha)), 8);
+        return _mm256_add_epi8(src, _mm256_packus_epi16(lo, hi));
+    }
+};
+
+//gamma-correct (linear light) blending tables: sRGB 8 bits to linear 12 bits and linear 12 bits back to sRGB
+//both tables are padded so 32 bits gathers of the last entry stay inside
+alignas(32) uint16_t srgbToLinear[256 + 2] = { 0 };
+alignas(32) uint8_t linearToSrgb[4096 + 4] = { 0 };
+
+//build linear light tables (sRGB transfer function)
+void initLinearTables()
+{
+    for (int32_t i = 0; i < 256; i++)
+    {
+        const double c = i / 255.0;
+        const double lin = (c <= 0.04045) ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4);
+        srgbToLinear[i] = uint16_t(lin * 4095.0 + 0.5);
+    }
+
+    for (int32_t i = 0; i < 4096; i++)
+    {
+        const double lin = i / 4095.0;
+        const double c = (lin <= 0.0031308) ? lin * 12.92 : 1.055 * pow(lin, 1.0 / 2.4) - 0.055;
+        linearToSrgb[i] = uint8_t(c * 255.0 + 0.5);
+    }
+}
+
+//blend pixel in linear light C = encode((decode(S) * A + decode(D) * (256 - A)) >> 8), alpha channel is blended directly
+static must_inline uint32_t linearPixel(const uint32_t dst, const uint32_t src, const uint32_t cover)
+{
+    const uint32_t rcover = 256 - cover;
+    const uint32_t a = (((src >> 24) * cover + (dst >> 24) * rcover) >> 8) << 24;
+    const uint32_t r = linearToSrgb[(srgbToLinear[(src >> 16) & 0xff] * cover + srgbToLinear[(dst >> 16) & 0xff] * rcover) >> 8] << 16;
+    const uint32_t g = linearToSrgb[(srgbToLinear[(src >> 8) & 0xff] * cover + srgbToLinear[(dst >> 8) & 0xff] * rcover) >> 8] << 8;
+    const uint32_t b = linearToSrgb[(srgbToLinear[src & 0xff] * cover + srgbToLinear[dst & 0xff] * rcover) >> 8];
+    return a | r | g | b;
+}
+
+//blend 8 pixels in linear light (AVX2 gathers), weights = cover | (256 - cover) << 16 of each pixel
+static must_inline target_avx2 __m256i linearLanes(const __m256i dst, const __m256i src, const __m256i weights)
+{
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256i word = _mm256_set1_epi32(0xffff);
+
+    //alpha channel (S * A + D * (256 - A)) >> 8
+    __m256i col = _mm256_or_si256(_mm256_srli_epi32(src, 24), _mm256_slli_epi32(_mm256_srli_epi32(dst, 24), 16));
+    col = _mm256_slli_epi32(_mm256_srli_epi32(_mm256_madd_epi16(col, weights), 8), 24);
+
+    //color channels: decode, blend in 12 bits, encode
+    for (int32_t shift = 0; shift < 24; shift += 8)
+    {
+        const __m256i ls = _mm256_i32gather_epi32((const int*)srgbToLinear, _mm256_and_si256(_mm256_srli_epi32(src, shift), mask), 2);
+        const __m256i ld = _mm256_i32gather_epi32((const int*)srgbToLinear, _mm256_and_si256(_mm256_srli_epi32(dst, shift), mask), 2);
+        const __m256i lin = _mm256_srli_epi32(_mm256_madd_epi16(_mm256_or_si256(_mm256_and_si256(ls, word), _mm256_slli_epi32(ld, 16)), weights), 8);
+        const __m256i enc = _mm256_i32gather_epi32((const int*)linearToSrgb, lin, 1);
+        col = _mm256_or_si256(col, _mm256_slli_epi32(_mm256_and_si256(enc, mask), shift));
+    }
+    return col;
+}
+
+//alpha-blending in linear light, alpha = src >> 24 (SSE2 has no gathers, lanes use the tables pixel by pixel)
+struct BlendLinear {
+    enum { SOURCE_ALPHA = 1 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src) { return linearPixel(dst, src, src >> 24); }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        alignas(16) uint32_t dpix[4], spix[4];
+        _mm_store_si128((__m128i*)dpix, dst);
+        _mm_store_si128((__m128i*)spix, src);
+        for (int32_t i = 0; i < 4; i++) dpix[i] = linearPixel(dpix[i], spix[i], spix[i] >> 24);
+        return _mm_load_si128((const __m128i*)dpix);
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i alpha = _mm256_srli_epi32(src, 24);
+        return linearLanes(dst, src, _mm256_or_si256(alpha, _mm256_slli_epi32(_mm256_sub_epi32(_mm256_set1_epi32(256), alpha), 16)));
+    }
+};
+
+//rounded x / 255 for 16 bits lanes (x <= 65025)
+static must_inline __m128i div255Lanes(const __m128i x)
+{
+    const __m128i t = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+static must_inline target_avx2 __m256i div255Lanes(const __m256i x)
+{
+    const __m256i t = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+//rounded x / 255 (x <= 65025)
+static must_inline uint32_t div255(const uint32_t x)
+{
+    const uint32_t t = x + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+//apply channel function to RGB channels, keep background alpha
+template<typename FUNC>
+static must_inline uint32_t blendChannels(const uint32_t dst, const uint32_t src, FUNC func)
+{
+    const uint32_t r = func((dst >> 16) & 0xff, (src >> 16) & 0xff);
+    const uint32_t g = func((dst >> 8) & 0xff, (src >> 8) & 0xff);
+    const uint32_t b = func(dst & 0xff, src & 0xff);
+    return (dst & 0xff000000) | (r << 16) | (g << 8) | b;
+}
+
+//Porter-Duff source-over with destination alpha (non pre-multiplied)
+//Ao = As + Ad * (1 - As), Co = (Cs * As + Cd * Ad * (1 - As)) / Ao
+//all products and sums are exact integers in float, so scalar and SIMD results are the same
+struct BlendSrcOver {
+    enum { SOURCE_ALPHA = 1 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        const uint32_t sa = src >> 24;
+        const uint32_t da = dst >> 24;
+        const uint32_t ao = sa * 255 + da * (255 - sa);
+        const float fs = float(sa) * 255.0f;
+        const float fd = float(da) * (255.0f - float(sa));
+        const float div = float(max(ao, 1U));
+
+        uint32_t col = div255(ao) << 24;
+        for (int32_t shift = 0; shift < 24; shift += 8)
+        {
+            const float cs = float((src >> shift) & 0xff);
+            const float cd = float((dst >> shift) & 0xff);
+            col |= uint32_t((cs * fs + cd * fd) / div + 0.5f) << shift;
+        }
+        return col;
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i mask = _mm_set1_epi32(0xff);
+        const __m128 c255 = _mm_set1_ps(255.0f);
+        const __m128i sa = _mm_srli_epi32(src, 24);
+        const __m128i da = _mm_srli_epi32(dst, 24);
+        const __m128 fsa = _mm_cvtepi32_ps(sa);
+        const __m128 fs = _mm_mul_ps(fsa, c255);
+        const __m128 fd = _mm_mul_ps(_mm_cvtepi32_ps(da), _mm_sub_ps(c255, fsa));
+        const __m128 ao = _mm_add_ps(fs, fd);
+        const __m128 div = _mm_max_ps(ao, _mm_set1_ps(1.0f));
+
+        //alpha channel (rounded ao / 255)
+        __m128i t = _mm_add_epi32(_mm_cvttps_epi32(ao), _mm_set1_epi32(128));
+        __m128i col = _mm_slli_epi32(_mm_srli_epi32(_mm_add_epi32(t, _mm_srli_epi32(t, 8)), 8), 24);
+
+        //color channels
+        for (int32_t shift = 0; shift < 24; shift += 8)
+        {
+            const __m128 cs = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(src, shift), mask));
+            const __m128 cd = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(dst, shift), mask));
+            const __m128 q = _mm_div_ps(_mm_add_ps(_mm_mul_ps(cs, fs), _mm_mul_ps(cd, fd)), div);
+            col = _mm_or_si128(col, _mm_slli_epi32(_mm_cvttps_epi32(_mm_add_ps(q, _mm_set1_ps(0.5f))), shift));
+        }
+        return col;
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i mask = _mm256_set1_epi32(0xff);
+        const __m256 c255 = _mm256_set1_ps(255.0f);
+        const __m256i sa = _mm256_srli_epi32(src, 24);
+        const __m256i da = _mm256_srli_epi32(dst, 24);
+        const __m256 fsa = _mm256_cvtepi32_ps(sa);
+        const __m256 fs = _mm256_mul_ps(fsa, c255);
+        const __m256 fd = _mm256_mul_ps(_mm256_cvtepi32_ps(da), _mm256_sub_ps(c255, fsa));
+        const __m256 ao = _mm256_add_ps(fs, fd);
+        const __m256 div = _mm256_max_ps(ao, _mm256_set1_ps(1.0f));
+
+        //alpha channel (rounded ao / 255)
+        __m256i t = _mm256_add_epi32(_mm256_cvttps_epi32(ao), _mm256_set1_epi32(128));
+        __m256i col = _mm256_slli_epi32(_mm256_srli_epi32(_mm256_add_epi32(t, _mm256_srli_epi32(t, 8)), 8), 24);
+
+        //color channels
+        for (int32_t shift = 0; shift < 24; shift += 8)
+        {
+            const __m256 cs = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(src, shift), mask));
+            const __m256 cd = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(dst, shift), mask));
+            const __m256 q = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(cs, fs), _mm256_mul_ps(cd, fd)), div);
+            col = _mm256_or_si256(col, _mm256_slli_epi32(_mm256_cvttps_epi32(_mm256_add_ps(q, _mm256_set1_ps(0.5f))), shift));
+        }
+        return col;
+    }
+};
+
+//Porter-Duff destination-in: keep background color, Ao = Ad * As
+struct BlendDstIn {
+    enum { SOURCE_ALPHA = 1 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src) { return (dst & 0x00ffffff) | (div255((dst >> 24) * (src >> 24)) << 24); }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = div255Lanes(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(src, zero)));
+        const __m128i hi = div255Lanes(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(src, zero)));
+        const __m128i amask = _mm_set1_epi32(0xff000000);
+        return _mm_or_si128(_mm_andnot_si128(amask, dst), _mm_and_si128(amask, _mm_packus_epi16(lo, hi)));
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i lo = div255Lanes(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), _mm256_unpacklo_epi8(src, zero)));
+        const __m256i hi = div255Lanes(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), _mm256_unpackhi_epi8(src, zero)));
+        return _mm256_blendv_epi8(dst, _mm256_packus_epi16(lo, hi), _mm256_set1_epi32(0xff000000));
+    }
+};
+
+//Porter-Duff destination-out: keep background color, Ao = Ad * (1 - As)
+struct BlendDstOut {
+    enum { SOURCE_ALPHA = 1 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src) { return BlendDstIn::pixel(dst, src ^ 0xff000000); }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return BlendDstIn::lanes(dst, _mm_xor_si128(src, _mm_set1_epi32(0xff000000))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return BlendDstIn::lanes(dst, _mm256_xor_si256(src, _mm256_set1_epi32(0xff000000))); }
+};
+
+//multiply: Cd * Cs / 255 (source alpha is forced to 255, so background alpha is kept)
+struct BlendMultiply {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        return blendChannels(dst, src, [](uint32_t d, uint32_t s) { return div255(d * s); });
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i col = _mm_or_si128(src, _mm_set1_epi32(0xff000000));
+        const __m128i lo = div255Lanes(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(col, zero)));
+        const __m128i hi = div255Lanes(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(col, zero)));
+        return _mm_packus_epi16(lo, hi);
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i col = _mm256_or_si256(src, _mm256_set1_epi32(0xff000000));
+        const __m256i lo = div255Lanes(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), _mm256_unpacklo_epi8(col, zero)));
+        const __m256i hi = div255Lanes(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), _mm256_unpackhi_epi8(col, zero)));
+        return _mm256_packus_epi16(lo, hi);
+    }
+};
+
+//screen: Cd + Cs - Cd * Cs / 255 (source alpha is turned off, so background alpha is kept)
+struct BlendScreen {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        return blendChannels(dst, src, [](uint32_t d, uint32_t s) { return d + s - div255(d * s); });
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i col = _mm_and_si128(src, _mm_set1_epi32(0x00ffffff));
+        __m128i d16 = _mm_unpacklo_epi8(dst, zero);
+        __m128i s16 = _mm_unpacklo_epi8(col, zero);
+        const __m128i lo = _mm_sub_epi16(_mm_add_epi16(d16, s16), div255Lanes(_mm_mullo_epi16(d16, s16)));
+        d16 = _mm_unpackhi_epi8(dst, zero);
+        s16 = _mm_unpackhi_epi8(col, zero);
+        const __m128i hi = _mm_sub_epi16(_mm_add_epi16(d16, s16), div255Lanes(_mm_mullo_epi16(d16, s16)));
+        return _mm_packus_epi16(lo, hi);
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i col = _mm256_and_si256(src, _mm256_set1_epi32(0x00ffffff));
+        __m256i d16 = _mm256_unpacklo_epi8(dst, zero);
+        __m256i s16 = _mm256_unpacklo_epi8(col, zero);
+        const __m256i lo = _mm256_sub_epi16(_mm256_add_epi16(d16, s16), div255Lanes(_mm256_mullo_epi16(d16, s16)));
+        d16 = _mm256_unpackhi_epi8(dst, zero);
+        s16 = _mm256_unpackhi_epi8(col, zero);
+        const __m256i hi = _mm256_sub_epi16(_mm256_add_epi16(d16, s16), div255Lanes(_mm256_mullo_epi16(d16, s16)));
+        return _mm256_packus_epi16(lo, hi);
+    }
+};
+
+//overlay: multiply dark background (Cd < 128), screen light background, both with doubled source
+struct BlendOverlay {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        return blendChannels(dst, src, [](uint32_t d, uint32_t s) { return (d < 128) ? div255(2 * d * s) : 255 - div255(2 * (255 - d) * (255 - s)); });
+    }
+    static must_inline __m128i overlay(const __m128i d16, const __m128i s16)
+    {
+        const __m128i c255 = _mm_set1_epi16(255);
+        const __m128i dark = div255Lanes(_mm_mullo_epi16(_mm_add_epi16(d16, d16), s16));
+        const __m128i id16 = _mm_sub_epi16(c255, d16);
+        const __m128i light = _mm_sub_epi16(c255, div255Lanes(_mm_mullo_epi16(_mm_add_epi16(id16, id16), _mm_sub_epi16(c255, s16))));
+        const __m128i mask = _mm_cmpgt_epi16(d16, _mm_set1_epi16(127));
+        return _mm_or_si128(_mm_and_si128(mask, light), _mm_andnot_si128(mask, dark));
+    }
+    static must_inline target_avx2 __m256i overlay(const __m256i d16, const __m256i s16)
+    {
+        const __m256i c255 = _mm256_set1_epi16(255);
+        const __m256i dark = div255Lanes(_mm256_mullo_epi16(_mm256_add_epi16(d16, d16), s16));
+        const __m256i id16 = _mm256_sub_epi16(c255, d16);
+        const __m256i light = _mm256_sub_epi16(c255, div255Lanes(_mm256_mullo_epi16(_mm256_add_epi16(id16, id16), _mm256_sub_epi16(c255, s16))));
+        return _mm256_blendv_epi8(dark, light, _mm256_cmpgt_epi16(d16, _mm256_set1_epi16(127)));
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = overlay(_mm_unpacklo_epi8(dst, zero), _mm_unpacklo_epi8(src, zero));
+        const __m128i hi = overlay(_mm_unpackhi_epi8(dst, zero), _mm_unpackhi_epi8(src, zero));
+        const __m128i amask = _mm_set1_epi32(0xff000000);
+        return _mm_or_si128(_mm_and_si128(amask, dst), _mm_andnot_si128(amask, _mm_packus_epi16(lo, hi)));
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i lo = overlay(_mm256_unpacklo_epi8(dst, zero), _mm256_unpacklo_epi8(src, zero));
+        const __m256i hi = overlay(_mm256_unpackhi_epi8(dst, zero), _mm256_unpackhi_epi8(src, zero));
+        return _mm256_blendv_epi8(_mm256_packus_epi16(lo, hi), dst, _mm256_set1_epi32(0xff000000));
+    }
+};
+
+//darken: min(Cd, Cs)
+struct BlendDarken {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        return blendChannels(dst, src, [](uint32_t d, uint32_t s) { return min(d, s); });
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return _mm_min_epu8(dst, _mm_or_si128(src, _mm_set1_epi32(0xff000000))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return _mm256_min_epu8(dst, _mm256_or_si256(src, _mm256_set1_epi32(0xff000000))); }
+};
+
+//lighten: max(Cd, Cs)
+struct BlendLighten {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        return blendChannels(dst, src, [](uint32_t d, uint32_t s) { return max(d, s); });
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src) { return _mm_max_epu8(dst, _mm_and_si128(src, _mm_set1_epi32(0x00ffffff))); }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src) { return _mm256_max_epu8(dst, _mm256_and_si256(src, _mm256_set1_epi32(0x00ffffff))); }
+};
+
+//difference: |Cd - Cs|
+struct BlendDifference {
+    enum { SOURCE_ALPHA = 0 };
+    static must_inline uint32_t pixel(const uint32_t dst, const uint32_t src)
+    {
+        return blendChannels(dst, src, [](uint32_t d, uint32_t s) { return (d > s) ? d - s : s - d; });
+    }
+    static must_inline __m128i lanes(const __m128i dst, const __m128i src)
+    {
+        const __m128i col = _mm_and_si128(src, _mm_set1_epi32(0x00ffffff));
+        return _mm_or_si128(_mm_subs_epu8(dst, col), _mm_subs_epu8(col, dst));
+    }
+    static must_inline target_avx2 __m256i lanes(const __m256i dst, const __m256i src)
+    {
+        const __m256i col = _mm256_and_si256(src, _mm256_set1_epi32(0x00ffffff));
+        return _mm256_or_si256(_mm256_subs_epu8(dst, col), _mm256_subs_epu8(col, dst));
+    }
+};
+
+//pattern bit of pixel j in a row (bit 1, 0, 7, 6, ... 2 as fillRectPattern always did)
+static must_inline uint32_t patternBit(const uint8_t pattern, const int32_t j)
+{
+    return (pattern >> ((1 - j) & 7)) & 1;
+}
+
+//blend a pixel with color
+template<typename BLEND>
+uint32_t blendColorPixel(uint32_t dst, uint32_t color)
+{
+    return BLEND::pixel(dst, color);
+}
+
+//blend vertical span with color (pitch in pixels)
+template<typename BLEND>
+void blendColumnSpan(uint32_t* dst, int32_t pitch, uint32_t color, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++, dst += pitch) *dst = BLEND::pixel(*dst, color);
+}
+
+//blend scattered pixels with their colors (offsets in pixels)
+template<typename BLEND>
+void blendScatterPixels(uint32_t* dst, const int32_t* offsets, const uint32_t* colors, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) dst[offsets[i]] = BLEND::pixel(dst[offsets[i]], colors[i]);
+}
+
+//blend span with color
+template<typename BLEND>
+void blendColorSpan(uint32_t* dst, uint32_t color, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) dst[i] = BLEND::pixel(dst[i], color);
+}
+
+//blend span with color (SSE2 version, 4 pixels per loop)
+template<typename BLEND>
+void blendColorSpanSSE2(uint32_t* dst, uint32_t color, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i src = _mm_set1_epi32(color);
+    for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i*)&dst[i], BLEND::lanes(_mm_loadu_si128((const __m128i*)&dst[i]), src));
+    for (; i < count; i++) dst[i] = BLEND::pixel(dst[i], color);
+}
+
+//blend span with color (AVX2 version, 8 pixels per loop)
+//masked head to 32-bytes boundary, aligned body, masked tail
+template<typename BLEND>
+target_avx2 void blendColorSpanAVX2(uint32_t* dst, uint32_t color, int32_t count)
+{
+    const __m256i src = _mm256_set1_epi32(color);
+
+    int32_t i = headPixels(dst, count);
+    if (i > 0)
+    {
+        const __m256i mask = laneMask(i);
+        _mm256_maskstore_epi32((int*)dst, mask, BLEND::lanes(_mm256_maskload_epi32((const int*)dst, mask), src));
+    }
+
+    for (; i + 8 <= count; i += 8) _mm256_store_si256((__m256i*)&dst[i], BLEND::lanes(_mm256_load_si256((const __m256i*)&dst[i]), src));
+
+    if (i < count)
+    {
+        const __m256i mask = laneMask(count - i);
+        _mm256_maskstore_epi32((int*)&dst[i], mask, BLEND::lanes(_mm256_maskload_epi32((const int*)&dst[i], mask), src));
+    }
+}
+
+//blend span with color where pattern bit is set
+template<typename BLEND>
+void blendPatternSpan(uint32_t* dst, uint32_t color, uint8_t pattern, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (patternBit(pattern, i)) dst[i] = BLEND::pixel(dst[i], color);
+    }
+}
+
+//blend span with color where pattern bit is set (SSE2 version, 4 pixels per loop)
+template<typename BLEND>
+void blendPatternSpanSSE2(uint32_t* dst, uint32_t color, uint8_t pattern, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i src = _mm_set1_epi32(color);
+
+    //pixel masks of first and second half of pattern
+    const __m128i masks[2] = {
+        _mm_setr_epi32(-int32_t(patternBit(pattern, 0)), -int32_t(patternBit(pattern, 1)), -int32_t(patternBit(pattern, 2)), -int32_t(patternBit(pattern, 3))),
+        _mm_setr_epi32(-int32_t(patternBit(pattern, 4)), -int32_t(patternBit(pattern, 5)), -int32_t(patternBit(pattern, 6)), -int32_t(patternBit(pattern, 7)))
+    };
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i mask = masks[(i >> 2) & 1];
+        const __m128i col = _mm_loadu_si128((const __m128i*)&dst[i]);
+        const __m128i res = BLEND::lanes(col, src);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(_mm_and_si128(mask, res), _mm_andnot_si128(mask, col)));
+    }
+
+    for (; i < count; i++)
+    {
+        if (patternBit(pattern, i)) dst[i] = BLEND::pixel(dst[i], color);
+    }
+}
+
+//blend span with color where pattern bit is set (AVX2 version, 8 pixels per loop)
+template<typename BLEND>
+target_avx2 void blendPatternSpanAVX2(uint32_t* dst, uint32_t color, uint8_t pattern, int32_t count)
+{
+    int32_t i = 0;
+    const __m256i src = _mm256_set1_epi32(color);
+    const __m256i mask = _mm256_setr_epi32(
+        -int32_t(patternBit(pattern, 0)), -int32_t(patternBit(pattern, 1)), -int32_t(patternBit(pattern, 2)), -int32_t(patternBit(pattern, 3)),
+        -int32_t(patternBit(pattern, 4)), -int32_t(patternBit(pattern, 5)), -int32_t(patternBit(pattern, 6)), -int32_t(patternBit(pattern, 7)));
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i col = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_blendv_epi8(col, BLEND::lanes(col, src), mask));
+    }
+
+    for (; i < count; i++)
+    {
+        if (patternBit(pattern, i)) dst[i] = BLEND::pixel(dst[i], color);
+    }
+}
+
+//blend span with source pixels
+template<typename BLEND>
+void blendImageSpan(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++) dst[i] = BLEND::pixel(dst[i], src[i]);
+}
+
+//blend span with source pixels (SSE2 version, 4 pixels per loop)
+template<typename BLEND>
+void blendImageSpanSSE2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 4 <= count; i += 4) _mm_storeu_si128((__m128i*)&dst[i], BLEND::lanes(_mm_loadu_si128((const __m128i*)&dst[i]), _mm_loadu_si128((const __m128i*)&src[i])));
+    for (; i < count; i++) dst[i] = BLEND::pixel(dst[i], src[i]);
+}
+
+//blend span with source pixels (AVX2 version, 8 pixels per loop)
+template<typename BLEND>
+target_avx2 void blendImageSpanAVX2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8) _mm256_storeu_si256((__m256i*)&dst[i], BLEND::lanes(_mm256_loadu_si256((const __m256i*)&dst[i]), _mm256_loadu_si256((const __m256i*)&src[i])));
+    for (; i < count; i++) dst[i] = BLEND::pixel(dst[i], src[i]);
+}
+
+//blend span with source pixels, skip key color pixels
+template<typename BLEND>
+void blendSpriteSpan(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        const uint32_t col = src[i] & 0x00ffffff;
+        if (col != keyColor) dst[i] = BLEND::pixel(dst[i], BLEND::SOURCE_ALPHA ? src[i] : col);
+    }
+}
+
+//blend span with source pixels, skip key color pixels (SSE2 version, 4 pixels per loop)
+template<typename BLEND>
+void blendSpriteSpanSSE2(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i key = _mm_set1_epi32(keyColor);
+    const __m128i rgb = _mm_set1_epi32(0x00ffffff);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i scol = _mm_loadu_si128((const __m128i*)&src[i]);
+        const __m128i dcol = _mm_loadu_si128((const __m128i*)&dst[i]);
+        const __m128i col = _mm_and_si128(scol, rgb);
+        const __m128i mask = _mm_cmpeq_epi32(col, key);
+        const __m128i res = BLEND::lanes(dcol, BLEND::SOURCE_ALPHA ? scol : col);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(_mm_and_si128(mask, dcol), _mm_andnot_si128(mask, res)));
+    }
+
+    //remainder pixels
+    blendSpriteSpan<BLEND>(&dst[i], &src[i], keyColor, count - i);
+}
+
+//blend span with source pixels, skip key color pixels (AVX2 version, 8 pixels per loop)
+template<typename BLEND>
+target_avx2 void blendSpriteSpanAVX2(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    int32_t i = 0;
+    const __m256i key = _mm256_set1_epi32(keyColor);
+    const __m256i rgb = _mm256_set1_epi32(0x00ffffff);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i scol = _mm256_loadu_si256((const __m256i*)&src[i]);
+        const __m256i dcol = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        const __m256i col = _mm256_and_si256(scol, rgb);
+        const __m256i mask = _mm256_cmpeq_epi32(col, key);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_blendv_epi8(BLEND::lanes(dcol, BLEND::SOURCE_ALPHA ? scol : col), dcol, mask));
+    }
+
+    //masked tail, key color lanes are also masked out from store
+    if (i < count)
+    {
+        const __m256i tail = laneMask(count - i);
+        const __m256i scol = _mm256_maskload_epi32((const int*)&src[i], tail);
+        const __m256i dcol = _mm256_maskload_epi32((const int*)&dst[i], tail);
+        const __m256i col = _mm256_and_si256(scol, rgb);
+        _mm256_maskstore_epi32((int*)&dst[i], _mm256_andnot_si256(_mm256_cmpeq_epi32(col, key), tail), BLEND::lanes(dcol, BLEND::SOURCE_ALPHA ? scol : col));
+    }
+}
+
+//blend span with color (AVX-512BW version, 16 pixels per loop, masked tail)
+template<typename BLEND>
+target_avx512 void blendColorSpanAVX512(uint32_t* dst, uint32_t color, int32_t count)
+{
+    int32_t i = 0;
+    const __m512i src = _mm512_set1_epi32(color);
+    for (; i + 16 <= count; i += 16) _mm512_storeu_si512(&dst[i], BLEND::lanes(_mm512_loadu_si512(&dst[i]), src));
+
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        _mm512_mask_storeu_epi32(&dst[i], tail, BLEND::lanes(_mm512_maskz_loadu_epi32(tail, &dst[i]), src));
+    }
+}
+
+//blend span with color where pattern bit is set (AVX-512BW version, 16 pixels per loop, pattern is the store mask)
+template<typename BLEND>
+target_avx512 void blendPatternSpanAVX512(uint32_t* dst, uint32_t color, uint8_t pattern, int32_t count)
+{
+    int32_t i = 0;
+    const __m512i src = _mm512_set1_epi32(color);
+
+    //pixel mask of 16 pixels (pattern is repeated every 8 pixels)
+    __mmask16 mask = 0;
+    for (int32_t j = 0; j < 16; j++) mask |= __mmask16(patternBit(pattern, j) << j);
+
+    for (; i + 16 <= count; i += 16) _mm512_mask_storeu_epi32(&dst[i], mask, BLEND::lanes(_mm512_loadu_si512(&dst[i]), src));
+
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        _mm512_mask_storeu_epi32(&dst[i], mask & tail, BLEND::lanes(_mm512_maskz_loadu_epi32(tail, &dst[i]), src));
+    }
+}
+
+//blend span with source pixels (AVX-512BW version, 16 pixels per loop, masked tail)
+template<typename BLEND>
+target_avx512 void blendImageSpanAVX512(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16) _mm512_storeu_si512(&dst[i], BLEND::lanes(_mm512_loadu_si512(&dst[i]), _mm512_loadu_si512(&src[i])));
+
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        _mm512_mask_storeu_epi32(&dst[i], tail, BLEND::lanes(_mm512_maskz_loadu_epi32(tail, &dst[i]), _mm512_maskz_loadu_epi32(tail, &src[i])));
+    }
+}
+
+//blend span with source pixels, skip key color pixels (AVX-512BW version, key color pixels are masked out from store)
+template<typename BLEND>
+target_avx512 void blendSpriteSpanAVX512(uint32_t* dst, const uint32_t* src, uint32_t keyColor, int32_t count)
+{
+    int32_t i = 0;
+    const __m512i key = _mm512_set1_epi32(keyColor);
+    const __m512i rgb = _mm512_set1_epi32(0x00ffffff);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m512i scol = _mm512_loadu_si512(&src[i]);
+        const __m512i col = _mm512_and_si512(scol, rgb);
+        _mm512_mask_storeu_epi32(&dst[i], _mm512_cmpneq_epi32_mask(col, key), BLEND::lanes(_mm512_loadu_si512(&dst[i]), BLEND::SOURCE_ALPHA ? scol : col));
+    }
+
+    //masked tail
+    if (i < count)
+    {
+        const __mmask16 tail = __mmask16((1 << (count - i)) - 1);
+        const __m512i scol = _mm512_maskz_loadu_epi32(tail, &src[i]);
+        const __m512i col = _mm512_and_si512(scol, rgb);
+        _mm512_mask_storeu_epi32(&dst[i], _mm512_mask_cmpneq_epi32_mask(tail, col, key), BLEND::lanes(_mm512_maskz_loadu_epi32(tail, &dst[i]), BLEND::SOURCE_ALPHA ? scol : col));
+    }
+}
+
+//instantiate kernels of a blend mode at kernel level
+template<typename BLEND>
+void setBlendKernels(GFX_BLEND_KERNELS* kernels, int32_t level)
+{
+    kernels->blendPixel     = blendColorPixel<BLEND>;
+    kernels->columnSpan     = blendColumnSpan<BLEND>;
+    kernels->colorSpan      = blendColorSpan<BLEND>;
+    kernels->patternSpan    = blendPatternSpan<BLEND>;
+    kernels->imageSpan      = blendImageSpan<BLEND>;
+    kernels->spriteSpan     = blendSpriteSpan<BLEND>;
+    kernels->scatterPixels  = blendScatterPixels<BLEND>;
+
+    if (level >= KERNEL_LEVEL_SSE2)
+    {
+        kernels->colorSpan      = blendColorSpanSSE2<BLEND>;
+        kernels->patternSpan    = blendPatternSpanSSE2<BLEND>;
+        kernels->imageSpan      = blendImageSpanSSE2<BLEND>;
+        kernels->spriteSpan     = blendSpriteSpanSSE2<BLEND>;
+    }
+
+    if (level >= KERNEL_LEVEL_AVX2)
+    {
+        kernels->colorSpan      = blendColorSpanAVX2<BLEND>;
+        kernels->patternSpan    = blendPatternSpanAVX2<BLEND>;
+        kernels->imageSpan      = blendImageSpanAVX2<BLEND>;
+        kernels->spriteSpan     = blendSpriteSpanAVX2<BLEND>;
+    }
+}
+
+//instantiate AVX-512 kernels of a blend mode (only modes with 16 lanes functors)
+template<typename BLEND>
+void setBlendKernelsAVX512(GFX_BLEND_KERNELS* kernels)
+{
+    kernels->colorSpan      = blendColorSpanAVX512<BLEND>;
+    kernels->patternSpan    = blendPatternSpanAVX512<BLEND>;
+    kernels->imageSpan      = blendImageSpanAVX512<BLEND>;
+    kernels->spriteSpan     = blendSpriteSpanAVX512<BLEND>;
+}
+
+//current span kernels (scalar until initKernels called)
+GFX_KERNELS gfxKernels = { fillSpan, streamSpan, blendSpan, copySpan, alphaSpan, spriteSpan, expandPixels, coverSpan };
+
+//current blend mode kernels (filled by initKernels, ANTIALIASED has no span kernels)
+GFX_BLEND_KERNELS blendKernels[BLEND_MODE_COUNT] = { 0 };
+
+//alpha-blending kernels of pre-multiplied images (BLEND_MODE_ALPHA)
+GFX_BLEND_KERNELS premultipliedKernels = { 0 };
+
+//kernel levels detected from CPU features
+int32_t kernelLevel = KERNEL_LEVEL_SCALAR;
+int32_t maxKernelLevel = -1;
+int32_t haveSSE41 = 0;
+
+//read extended control register 0 (register states saved by OS), call only when OSXSAVE is set
+static target_xsave uint64_t readXCR0()
+{
+    return _xgetbv(0);
+}
+
+//detect the best kernel level for current CPU
+void detectKernelLevel()
+{
+    int32_t out[4] = { 0 };
+
+#ifdef SDL_PLATFORM_APPLE
+    __cpuid(1, out[0], out[1], out[2], out[3]);
+#else
+    __cpuid(out, 1);
+#endif
+
+    const bool sse2    = (out[3] & (1 << 26)) != 0;
+    const bool sse41   = (out[2] & (1 << 19)) != 0;
+    const bool avx     = (out[2] & (1 << 28)) != 0;
+    const bool osxsave = (out[2] & (1 << 27)) != 0;
+
+#ifdef SDL_PLATFORM_APPLE
+    __cpuid_count(7, 0, out[0], out[1], out[2], out[3]);
+#else
+    __cpuidex(out, 7, 0);
+#endif
+
+    const bool avx2     = (out[1] & (1 << 5)) != 0;
+    const bool avx512f  = (out[1] & (1 << 16)) != 0;
+    const bool avx512bw = (out[1] & (1 << 30)) != 0;
+
+    //OS must save YMM (and ZMM, opmask) registers state
+    const uint64_t xcr0 = osxsave ? readXCR0() : 0;
+    const bool ymm = (xcr0 & 0x06) == 0x06;
+    const bool zmm = (xcr0 & 0xe6) == 0xe6;
+
+    haveSSE41 = sse41;
+    maxKernelLevel = KERNEL_LEVEL_SCALAR;
+    if (sse2) maxKernelLevel = KERNEL_LEVEL_SSE2;
+    if (sse2 && avx && avx2 && ymm) maxKernelLevel = KERNEL_LEVEL_AVX2;
+    if (maxKernelLevel == KERNEL_LEVEL_AVX2 && avx512f && avx512bw && zmm) maxKernelLevel = KERNEL_LEVEL_AVX512;
+}
+
+//CPUID with sub-leaf
+static must_inline void cpuidex(int32_t* out, const int32_t leaf, const int32_t subleaf)
+{
+#ifdef SDL_PLATFORM_APPLE
+    __cpuid_count(leaf, subleaf, out[0], out[1], out[2], out[3]);
+#else
+    __cpuidex(out, leaf, subleaf);
+#endif
+}
+
+//detect last level cache size in bytes (deterministic cache parameters, AMD extended leaf as fallback)
+uint32_t detectCacheSize()
+{
+    int32_t out[4] = { 0 };
+    uint32_t size = 0;
+
+    //leaf 4: walk all caches, keep the largest one
+    cpuidex(out, 0, 0);
+    if (out[0] >= 4)
+    {
+        for (int32_t i = 0; i < 16; i++)
+        {
+            cpuidex(out, 4, i);
+            if (!(out[0] & 0x1f)) break;
+
+            const uint32_t ways  = ((uint32_t(out[1]) >> 22) & 0x3ff) + 1;
+            const uint32_t parts = ((uint32_t(out[1]) >> 12) & 0x3ff) + 1;
+            const uint32_t line  = (uint32_t(out[1]) & 0xfff) + 1;
+            const uint32_t sets  = uint32_t(out[2]) + 1;
+            size = max(size, ways * parts * line * sets);
+        }
+    }
+
+    //AMD: L3 size in 512KB units, L2 size in KB
+    if (!size)
+    {
+        cpuidex(out, 0x80000000, 0);
+        if (uint32_t(out[0]) >= 0x80000006)
+        {
+            cpuidex(out, 0x80000006, 0);
+            size = (uint32_t(out[3]) >> 18) * 524288;
+            if (!size) size = (uint32_t(out[2]) >> 16) * 1024;
+        }
+    }
+
+    return size ? size : DEFAULT_LLC_SIZE;
+}
+
+//set store policy: fills larger than percent of last level cache use non-temporal stores (0 = always stream)
+//return the threshold in bytes
+uint64_t setStorePolicy(int32_t percent)
+{
+    if (maxKernelLevel < 0) initKernels();
+    streamThreshold = uint64_t(llcSize) * max(percent, 0) / 100;
+    return streamThreshold;
+}
+
+//get last level cache size in bytes
+uint32_t getCacheSize()
+{
+    if (maxKernelLevel < 0) initKernels();
+    return llcSize;
+}
+
+//select span kernels of level (limit by CPU features), return the selected level
+int32_t setKernelLevel(int32_t level)
+{
+    if (maxKernelLevel < 0)
+    {
+        detectKernelLevel();
+        initLinearTables();
+        llcSize = detectCacheSize();
+        setStorePolicy(STORE_LLC_PERCENT);
+    }
+
+    if (level > maxKernelLevel) level = maxKernelLevel;
+    if (level < KERNEL_LEVEL_SCALAR) level = KERNEL_LEVEL_SCALAR;
+
+    gfxKernels.fillSpan     = fillSpan;
+    gfxKernels.streamSpan   = streamSpan;
+    gfxKernels.blendSpan    = blendSpan;
+    gfxKernels.copySpan     = copySpan;
+    gfxKernels.alphaSpan    = alphaSpan;
+    gfxKernels.spriteSpan   = spriteSpan;
+    gfxKernels.expandPixels = expandPixels;
+    gfxKernels.coverSpan    = coverSpan;
+
+    if (level >= KERNEL_LEVEL_SSE2)
+    {
+        gfxKernels.fillSpan     = fillSpanSSE2;
+        gfxKernels.streamSpan   = streamSpanSSE2;
+        gfxKernels.blendSpan    = blendSpanSSE2;
+        gfxKernels.copySpan     = copySpanSSE2;
+        gfxKernels.alphaSpan    = alphaSpanSSE2;
+        gfxKernels.spriteSpan   = spriteSpanSSE2;
+        gfxKernels.coverSpan    = coverSpanSSE2;
+        if (haveSSE41) gfxKernels.expandPixels = expandPixelsSSE41;
+    }
+
+    if (level >= KERNEL_LEVEL_AVX2)
+    {
+        gfxKernels.fillSpan     = fillSpanAVX2;
+        gfxKernels.streamSpan   = streamSpanAVX2;
+        gfxKernels.blendSpan    = blendSpanAVX2;
+        gfxKernels.copySpan     = copySpanAVX2;
+        gfxKernels.alphaSpan    = alphaSpanAVX2;
+        gfxKernels.spriteSpan   = spriteSpanAVX2;
+        gfxKernels.expandPixels = expandPixelsAVX2;
+        gfxKernels.coverSpan    = coverSpanAVX2;
+    }
+
+    //AVX-512 kernels use BW instructions for 16 bits lanes
+    if (level >= KERNEL_LEVEL_AVX512)
+    {
+        gfxKernels.fillSpan     = fillSpanAVX512;
+        gfxKernels.streamSpan   = streamSpanAVX512;
+        gfxKernels.blendSpan    = blendSpanAVX512;
+        gfxKernels.copySpan     = copySpanAVX512;
+        gfxKernels.alphaSpan    = alphaSpanAVX512;
+        gfxKernels.spriteSpan   = spriteSpanAVX512;
+    }
+
+    //blend mode kernels of the same level
+    setBlendKernels<BlendNormal>(&blendKernels[BLEND_MODE_NORMAL], level);
+    setBlendKernels<BlendAdd>(&blendKernels[BLEND_MODE_ADD], level);
+    setBlendKernels<BlendSub>(&blendKernels[BLEND_MODE_SUB], level);
+    setBlendKernels<BlendAnd>(&blendKernels[BLEND_MODE_AND], level);
+    setBlendKernels<BlendXor>(&blendKernels[BLEND_MODE_XOR], level);
+    setBlendKernels<BlendAlpha>(&blendKernels[BLEND_MODE_ALPHA], level);
+    setBlendKernels<BlendSrcOver>(&blendKernels[BLEND_MODE_SRC_OVER], level);
+    setBlendKernels<BlendDstIn>(&blendKernels[BLEND_MODE_DST_IN], level);
+    setBlendKernels<BlendDstOut>(&blendKernels[BLEND_MODE_DST_OUT], level);
+    setBlendKernels<BlendMultiply>(&blendKernels[BLEND_MODE_MULTIPLY], level);
+    setBlendKernels<BlendScreen>(&blendKernels[BLEND_MODE_SCREEN], level);
+    setBlendKernels<BlendOverlay>(&blendKernels[BLEND_MODE_OVERLAY], level);
+    setBlendKernels<BlendDarken>(&blendKernels[BLEND_MODE_DARKEN], level);
+    setBlendKernels<BlendLighten>(&blendKernels[BLEND_MODE_LIGHTEN], level);
+    setBlendKernels<BlendDifference>(&blendKernels[BLEND_MODE_DIFFERENCE], level);
+    setBlendKernels<BlendLinear>(&blendKernels[BLEND_MODE_LINEAR], level);
+    setBlendKernels<BlendPremultiplied>(&premultipliedKernels, level);
+
+    //AVX-512 blend kernels of simple modes, other modes keep AVX2 kernels
+    if (level >= KERNEL_LEVEL_AVX512)
+    {
+        setBlendKernelsAVX512<BlendNormal>(&blendKernels[BLEND_MODE_NORMAL]);
+        setBlendKernelsAVX512<BlendAdd>(&blendKernels[BLEND_MODE_ADD]);
+        setBlendKernelsAVX512<BlendSub>(&blendKernels[BLEND_MODE_SUB]);
+        setBlendKernelsAVX512<BlendAnd>(&blendKernels[BLEND_MODE_AND]);
+        setBlendKernelsAVX512<BlendXor>(&blendKernels[BLEND_MODE_XOR]);
+        setBlendKernelsAVX512<BlendAlpha>(&blendKernels[BLEND_MODE_ALPHA]);
+    }
+
+    //dedicated span kernels are faster than generic ones (memcpy, AVX-512 masked tails)
+    blendKernels[BLEND_MODE_NORMAL].colorSpan   = gfxKernels.fillSpan;
+    blendKernels[BLEND_MODE_NORMAL].imageSpan   = gfxKernels.copySpan;
+    blendKernels[BLEND_MODE_NORMAL].spriteSpan  = gfxKernels.spriteSpan;
+    blendKernels[BLEND_MODE_ALPHA].colorSpan    = gfxKernels.blendSpan;
+    blendKernels[BLEND_MODE_ALPHA].imageSpan    = gfxKernels.alphaSpan;
+
+    kernelLevel = level;
+    return level;
+}
+
+//get current kernel level
+int32_t getKernelLevel()
+{
+    return kernelLevel;
+}
+
+//get kernel level name
+const char* getKernelName(int32_t level)
+{
+    static const char* names[] = { "scalar", "SSE2", "AVX2", "AVX-512" };
+    if (level < KERNEL_LEVEL_SCALAR || level > KERNEL_LEVEL_AVX512) return "unknown";
+    return names[level];
+}
+
+//select the best span kernels for current CPU
+void initKernels()
+{
+    setKernelLevel(KERNEL_LEVEL_AVX512);
+}
+
+//get span kernels of blend mode (NULL if the mode has no span kernels)
+const GFX_BLEND_KERNELS* getBlendKernels(int32_t mode)
+{
+    if (maxKernelLevel < 0) initKernels();
+    if (mode < 0 || mode >= BLEND_MODE_COUNT || !blendKernels[mode].colorSpan) return NULL;
+    return &blendKernels[mode];
+}
+
+//get span kernels of blend mode for image source (pre-multiplied images have their own alpha-blending)
+const GFX_BLEND_KERNELS* getImageKernels(const GFX_IMAGE* img, int32_t mode)
+{
+    if (mode != BLEND_MODE_ALPHA || !img->mPremultiplied) return getBlendKernels(mode);
+    if (maxKernelLevel < 0) initKernels();
+    return &premultipliedKernels;
+}
+
+//build 32 bits lookup table from palette
+void initPaletteTable(const RGBA* pal)
+{
+    for (int32_t i = 0; i < 256; i++) paletteTable[i] = (pal[i].r << 16) | (pal[i].g << 8) | pal[i].b;
+}
+
+//expand 8 bits area to 32 bits buffer (dst and src point to top-left of the area)
+void expandIndexed(void* dst, int32_t dstPitch, const void* src, int32_t srcPitch, int32_t width, int32_t height, const uint32_t* table)
+{
+    const uint8_t* indices = (const uint8_t*)src;
+    uint8_t* pixels = (uint8_t*)dst;
+
+    for (int32_t y = 0; y < height; y++)
+    {
+        gfxKernels.expandPixels((uint32_t*)pixels, indices, width, table);
+        indices += srcPitch;
+        pixels += dstPitch;
+    }
+}
+
+//upload screen frame to streaming texture (whole frame when rects is NULL, 8 bits indexed pixels when table is not NULL)
+void uploadFrame(const void* buffer, int32_t pitch, const uint32_t* table, const SDL_Rect* rects, int32_t count)
+{
+    const SDL_Rect full = { 0, 0, screenWidth, screenHeight };
+    if (!rects)
+    {
+        rects = &full;
+        count = 1;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        const SDL_Rect* rect = &rects[i];
+        if (table)
+        {
+            //256 colors palette, expand indexed pixels straight to locked texture memory
+            const uint8_t* src = (const uint8_t*)buffer + intptr_t(rect->y) * pitch + rect->x;
+            int32_t texPitch = 0;
+            void* pixels = NULL;
+            if (SDL_LockTexture(sdlTexture, rect, &pixels, &texPitch) < 0) continue;
+            expandIndexed(pixels, texPitch, src, pitch, rect->w, rect->h, table);
+            SDL_UnlockTexture(sdlTexture);
+        }
+        else
+        {
+            //rgb mode, just render texture to video memory without any conversation
+            const uint8_t* src = (const uint8_t*)buffer + intptr_t(rect->y) * pitch + (intptr_t(rect->x) << 2);
+            SDL_UpdateTexture(sdlTexture, rect, src, pitch);
+        }
+    }
+}
+
+//clear screen and render texture to screen
+void presentTexture()
+{
+    SDL_RenderClear(sdlRenderer);
+    SDL_RenderTexture(sdlRenderer, sdlTexture, NULL, NULL);
+    SDL_RenderPresent(sdlRenderer);
+}
+
+//find the oldest queued frame is waiting for conversion (present lock must be held)
+GFX_PRESENT_FRAME* nextQueuedFrame()
+{
+    for (int32_t i = 0; i < queueCount; i++)
+    {
+        GFX_PRESENT_FRAME* frame = &presentFrame[presentQueue[(queueHead + i) % MAX_FRAME_BUFFERS]];
+        if (frame->state == FRAME_STATE_QUEUED) return frame;
+    }
+
+    return NULL;
+}
+
+//present thread, convert queued frames to 32 bits pixels (SDL renderer is only used by main thread)
+int32_t SDLCALL presentLoop(void*)
+{
+    SDL_LockMutex(presentMutex);
+    for (;;)
+    {
+        //wait for next queued frame (convert all queued frames before quit)
+        GFX_PRESENT_FRAME* frame = NULL;
+        while (!(frame = nextQueuedFrame()) && !presentQuit) SDL_WaitCondition(presentCond, presentMutex);
+        if (!frame) break;
+
+        frame->state = FRAME_STATE_CONVERTING;
+        SDL_UnlockMutex(presentMutex);
+
+        //256 colors palette, expand damaged areas with palette of this frame (rgb mode is ready to upload)
+        if (frame->texels)
+        {
+            const SDL_Rect full = { 0, 0, screenWidth, screenHeight };
+            const SDL_Rect* rects = frame->full ? &full : frame->rects;
+            const int32_t count = frame->full ? 1 : frame->count;
+            for (int32_t i = 0; i < count; i++)
+            {
+                const SDL_Rect* rect = &rects[i];
+                const uint8_t* src = (const uint8_t*)frame->pixels + intptr_t(rect->y) * screenWidth + rect->x;
+                uint32_t* dst = (uint32_t*)frame->texels + intptr_t(rect->y) * screenWidth + rect->x;
+                expandIndexed(dst, screenWidth << 2, src, screenWidth, rect->w, rect->h, frame->table);
+            }
+        }
+
+        //hand converted frame back to drawing thread
+        SDL_LockMutex(presentMutex);
+        frame->state = FRAME_STATE_READY;
+        SDL_BroadcastCondition(presentCond);
+    }
+
+    SDL_UnlockMutex(presentMutex);
+    return 0;
+}
+
+//upload and present converted frames in queued order (drawing thread, present lock must be held)
+void presentReadyFrames()
+{
+    while (queueCount && presentFrame[presentQueue[queueHead]].state == FRAME_STATE_READY)
+    {
+        GFX_PRESENT_FRAME* frame = &presentFrame[presentQueue[queueHead]];
+        queueHead = (queueHead + 1) % MAX_FRAME_BUFFERS;
+        queueCount--;
+        SDL_UnlockMutex(presentMutex);
+
+        //texture keep the rest of previous frame, only upload damaged rectangles
+        uploadFrame(frame->texels ? frame->texels : frame->pixels, screenWidth << 2, NULL, frame->full ? NULL : frame->rects, frame->count);
+        presentTexture();
+
+        SDL_LockMutex(presentMutex);
+        frame->state = FRAME_STATE_FREE;
+    }
+}
+
+//stop present thread and release frame buffers
+void closePresentThread()
+{
+    if (!presentThread) return;
+
+    //signal present thread to quit and wait
+    SDL_LockMutex(presentMutex);
+    presentQuit = 1;
+    SDL_BroadcastCondition(presentCond);
+    SDL_UnlockMutex(presentMutex);
+    SDL_WaitThread(presentThread, NULL);
+    presentThread = NULL;
+
+    //flush converted frames to screen
+    SDL_LockMutex(presentMutex);
+    presentReadyFrames();
+    SDL_UnlockMutex(presentMutex);
+
+    SDL_DestroyCondition(presentCond);
+    SDL_DestroyMutex(presentMutex);
+    presentCond = NULL;
+    presentMutex = NULL;
+
+    //release frame buffers (draw buffer point to one of them)
+    for (int32_t i = 0; i < frameBuffers; i++)
+    {
+        if (gfxContext.drawBuff == presentFrame[i].pixels) gfxContext.drawBuff = NULL;
+        if (gfxContext.oldBuffer == presentFrame[i].pixels) gfxContext.oldBuffer = NULL;
+        SDL_aligned_free(presentFrame[i].pixels);
+        SDL_aligned_free(presentFrame[i].texels);
+        presentFrame[i].pixels = NULL;
+        presentFrame[i].texels = NULL;
+    }
+
+    screenBuff = NULL;
+    frameBuffers = 0;
+}
+
+//start present thread with double/triple frame buffers, current screen buffer is the first frame
+int32_t initPresentThread()
+{
+    const uint32_t msize = screenHeight * screenWidth * gfxContext.bytesPerPixel;
+    const uint32_t tsize = screenHeight * screenWidth * sizeof(uint32_t);
+
+    //allocate frame buffers (32-bytes alignment for AVX2 use), 8 bits mode also need 32 bits converted pixels
+    frameBuffers = (screenFlags & SCREEN_TRIPLE_BUFFER) ? 3 : 2;
+    for (int32_t i = 0; i < frameBuffers; i++)
+    {
+        presentFrame[i].pixels = SDL_aligned_alloc(32, msize);
+        presentFrame[i].texels = (gfxContext.bitsPerPixel == 8) ? SDL_aligned_alloc(32, tsize) : NULL;
+        if (!presentFrame[i].pixels || (gfxContext.bitsPerPixel == 8 && !presentFrame[i].texels))
+        {
+            messageBox(GFX_ERROR, "Failed to create frame buffer:%u!", msize);
+            return 0;
+        }
+
+        presentFrame[i].state = FRAME_STATE_FREE;
+    }
+
+    //first frame keep current screen contents
+    memcpy(presentFrame[0].pixels, screenBuff, msize);
+    presentFrame[0].state = FRAME_STATE_DRAWING;
+    drawFrame = 0;
+
+    //32 bits screen buffer is replaced by frame buffers
+    if (gfxContext.bitsPerPixel != 8) SDL_aligned_free(screenBuff);
+
+    //switch drawing to the first frame
+    gfxContext.drawBuff = presentFrame[0].pixels;
+    screenBuff = gfxContext.drawBuff;
+
+    //create synchronize objects and start present thread
+    queueHead = 0;
+    queueCount = 0;
+    presentQuit = 0;
+    presentMutex = SDL_CreateMutex();
+    presentCond = SDL_CreateCondition();
+    if (!presentMutex || !presentCond)
+    {
+        messageBox(GFX_ERROR, "Failed to create present synchronize objects: %s", SDL_GetError());
+        return 0;
+    }
+
+    presentThread = SDL_CreateThread(presentLoop, "gfxPresent", NULL);
+    if (!presentThread)
+    {
+        messageBox(GFX_ERROR, "Failed to create present thread: %s", SDL_GetError());
+        return 0;
+    }
+
+    return 1;
+}
+
+//queue finished frame to present thread, present converted frames and switch to next free frame buffer
+void presentFrameAsync()
+{
+    GFX_PRESENT_FRAME* frame = &presentFrame[drawFrame];
+
+    //snapshot palette and damaged list of this frame
+    if (gfxContext.bitsPerPixel == 8) memcpy(frame->table, paletteTable, sizeof(paletteTable));
+    frame->full = !(screenFlags & SCREEN_DIRTY_RECTS) || dirtyFull;
+    frame->count = dirtyCount;
+    if (dirtyCount) memcpy(frame->rects, dirtyRects, dirtyCount * sizeof(SDL_Rect));
+    dirtyCount = 0;
+    dirtyFull = 0;
+
+    //queue frame, present frames converted by present thread and wait for free back buffer
+    SDL_LockMutex(presentMutex);
+    frame->state = FRAME_STATE_QUEUED;
+    presentQueue[(queueHead + queueCount) % MAX_FRAME_BUFFERS] = drawFrame;
+    queueCount++;
+    SDL_BroadcastCondition(presentCond);
+
+    int32_t next = -1;
+    while (next < 0)
+    {
+        presentReadyFrames();
+        for (int32_t i = 0; i < frameBuffers && next < 0; i++)
+        {
+            if (presentFrame[i].state == FRAME_STATE_FREE) next = i;
+        }
+
+        if (next < 0) SDL_WaitCondition(presentCond, presentMutex);
+    }
+
+    presentFrame[next].state = FRAME_STATE_DRAWING;
+    SDL_UnlockMutex(presentMutex);
+
+    //drawing functions expect the previous frame contents, copy it forward
+    if (!(screenFlags & SCREEN_DISCARD_FRAME)) memcpy(presentFrame[next].pixels, frame->pixels, screenHeight * screenWidth * gfxContext.bytesPerPixel);
+
+    //switch screen buffer, keep the changeDrawBuffer/restoreDrawBuffer pair consistent
+    if (gfxContext.drawBuff == frame->pixels) gfxContext.drawBuff = presentFrame[next].pixels;
+    if (gfxContext.oldBuffer == frame->pixels) gfxContext.oldBuffer = presentFrame[next].pixels;
+    screenBuff = presentFrame[next].pixels;
+    drawFrame = next;
+}
+
+//initialize graphic video system
+int32_t initScreen(int32_t width, int32_t height, int32_t bpp, int32_t scaled, const char* title, int32_t flags)
+{
+    //simulation mode, close previous segment and render to offscreen buffer
+    if (simFrames)
+    {
+        endSegment();
+        flags |= SCREEN_HEADLESS;
+        SDL_strlcpy(simTitle, title, sizeof(simTitle));
+    }
+
+    //save screen flags (headless mode don't need any video device)
+    screenFlags = flags;
+    frameCount = 0;
+    simStart = 0;
+    simPressed = 0;
+
+    //select span kernels by CPU features (keep the level selected by setKernelLevel)
+    if (maxKernelLevel < 0) initKernels();
+
+    //initialize SDL video mode only
+    if (SDL_Init((flags & SCREEN_HEADLESS) ? 0 : SDL_INIT_VIDEO) < 0)
+    {
+        messageBox(GFX_ERROR, "Failed to initialize SDL3: %s", SDL_GetError());
+        return 0;
+    }
+    
+    //initialize SDL2 image lib
+    if ((IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG) != IMG_INIT_PNG)
+    {
+        messageBox(GFX_ERROR, "Failed to initialize SDL3 image: %s", IMG_GetError());
+        return 0;
+    }
+
+    //create window, renderer and streaming texture (headless mode only use offscreen buffers)
+    if (!(flags & SCREEN_HEADLESS))
+    {
+        //create screen to display contents
+        sdlWindow = SDL_CreateWindow(title, scaled ? SCREEN_WIDTH : width, scaled ? SCREEN_HEIGHT : height, (flags & SCREEN_RESIZEABLE) ? SDL_WINDOW_RESIZABLE : 0);
+        if (!sdlWindow)
+        {
+            messageBox(GFX_ERROR, "Failed to create window: %s", SDL_GetError());
+            return 0;
+        }
+
+        //set windows icon
+        SDL_Surface* icon = IMG_Load("assets/gfxicon-128x.png");
+        if (icon)
+        {
+            SDL_SetSurfaceColorKey(icon, SDL_TRUE, SDL_MapRGB(SDL_GetPixelFormatDetails(icon->format), NULL, 0, 0, 0));
+            SDL_SetWindowIcon(sdlWindow, icon);
+            SDL_DestroySurface(icon);
+        }
+
+        //create render windows
+        sdlRenderer = SDL_CreateRenderer(sdlWindow, NULL);
+        if (!sdlRenderer)
+        {
+            messageBox(GFX_ERROR, "Failed to create renderer: %s", SDL_GetError());
+            return 0;
+        }
+
+        //create 32bits texture for render
+        sdlTexture = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+        if (!sdlTexture)
+        {
+            messageBox(GFX_ERROR, "Failed to create texture: %s", SDL_GetError());
+            return 0;
+        }
+    }
+
+    //initialize bits per pixel
+    gfxContext.bitsPerPixel = bpp;
+
+    //initialize bytes per pixel
+    gfxContext.bytesPerPixel = (gfxContext.bitsPerPixel + 7) / 8;
+
+    //initialize bytes per scan line (should be 32-bytes alignment)
+    gfxContext.bytesPerScanline = width * gfxContext.bytesPerPixel;
+
+    //check for 32-bytes alignment
+    if (gfxContext.bytesPerScanline % 32)
+    {
+        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
+        return 0;
+    }
+
+    //use palette color for 8 bits?
+    if (bpp == 8)
+    {
+        //headless mode need 32 bits frame buffer for frame-commit hook
+        if (flags & SCREEN_HEADLESS)
+        {
+            frameBuff = (uint32_t*)SDL_aligned_alloc(32, width * height * sizeof(uint32_t));
+            if (!frameBuff)
+            {
+                messageBox(GFX_ERROR, "Failed to create 32 bits frame buffer!");
+                return 0;
+            }
+        }
+
+        //create 8bits surface with palette
+        sdlSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_INDEX8);
+        if (!sdlSurface)
+        {
+            messageBox(GFX_ERROR, "Failed to create 8 bits surface: %s", SDL_GetError());
+            return 0;
+        }
+
+        //make default palette and retrive the surface palette
+        shiftPalette(basePalette);
+        SDL_Palette* palette = SDL_CreateSurfacePalette(sdlSurface);
+
+        //set default palette to surface
+        if (palette && SDL_SetPaletteColors(palette, basePalette, 0, 256))
+        {
+            messageBox(GFX_ERROR, "Failed to initialize palette colors!");
+            return 0;
+        }
+
+        //initialize palette lookup table
+        initPaletteTable(basePalette);
+
+        //initialize drawing buffer (use current surface pixel buffer)
+        gfxContext.drawBuff = sdlSurface->pixels;
+    }
+    else
+    {
+        //initialize drawing buffer for 32 bits RGBA (32-bytes alignment for AVX2 use)
+        const uint32_t msize = height * gfxContext.bytesPerScanline;
+        gfxContext.drawBuff = SDL_aligned_alloc(32, msize);
+    }
+    
+    //validate drawing buffer
+    if (!gfxContext.drawBuff)
+    {
+        messageBox(GFX_ERROR, "Failed to create render buffer!");
+        return 0;
+    }
+
+    //initialize random number generation
+    randSeed = getRandomSeed();
+    srand(randSeed);
+
+    //initialize GFXLIB buffer
+    gfxBuff = (uint8_t*)SDL_calloc(GFX_BUFF_SIZE, 1);
+    if (!gfxBuff)
+    {
+        messageBox(GFX_ERROR, "Error initialize GFXLIB memory!");
+        return 0;
+    }
+
+    //initialize screen buffer size
+    gfxContext.texWidth    = width;
+    gfxContext.texHeight   = height;
+    gfxContext.centerX     = (gfxContext.texWidth >> 1) - 1;
+    gfxContext.centerY     = (gfxContext.texHeight >> 1) - 1;
+
+    //save screen buffer and mark first frame as full update
+    screenBuff  = gfxContext.drawBuff;
+    screenWidth = width;
+    screenHeight = height;
+    markDirtyScreen();
+
+    //start async present thread (draw to double/triple frame buffers)
+    if ((flags & SCREEN_ASYNC_PRESENT) && !(flags & SCREEN_HEADLESS) && !initPresentThread()) return 0;
+
+    //initialize view port size
+    gfxContext.cminX       = 0;
+    gfxContext.cminY       = 0;
+    gfxContext.cmaxX       = gfxContext.texWidth - 1;
+    gfxContext.cmaxY       = gfxContext.texHeight - 1;
+    
+    //OK, I'm fine!
+    return 1;
+}
+
+//cleanup function must call after graphics operations ended
+void cleanup()
+{
+    //simulation mode, close current segment before release buffers
+    if (simFrames) endSegment();
+
+    //stop present thread before release buffers
+    closePresentThread();
+
+    if (gfxContext.bitsPerPixel == 8)
+    {
+        if (frameBuff)
+        {
+            SDL_aligned_free(frameBuff);
+            frameBuff = NULL;
+        }
+
+        if (sdlSurface)
+        {
+            SDL_DestroySurface(sdlSurface);
+            sdlSurface = NULL;
+        }
+    }
+    else
+    {
+        if (gfxContext.drawBuff)
+        {
+            SDL_aligned_free(gfxContext.drawBuff);
+            gfxContext.drawBuff = NULL;
+        }
+    }
+
+    if (gfxBuff)
+    {
+        SDL_free(gfxBuff);
+        gfxBuff = NULL;
+    }
+
+    if (sdlTexture)
+    {
+        SDL_DestroyTexture(sdlTexture);
+        sdlTexture = NULL;
+    }
+
+    if (sdlRenderer)
+    {
+        SDL_DestroyRenderer(sdlRenderer);
+        sdlRenderer = NULL;
+    }
+
+    if (sdlWindow)
+    {
+        SDL_DestroyWindow(sdlWindow);
+        sdlWindow = NULL;
+    }
+
+    SDL_Quit();
+    IMG_Quit();
+}
+
+//render function, use this to render draw buffer to video memory
+void render()
+{
+    //frame commit: order non-temporal stores of this frame before it is uploaded
+    _mm_sfence();
+
+    //count committed frames (simulated clock run at 60 fps)
+    frameCount++;
+    if (simFrames)
+    {
+        simClock += FPS_60;
+        simPolls = 0;
+    }
+
+    //headless mode, just commit current frame to user hook
+    if (screenFlags & SCREEN_HEADLESS)
+    {
+        dirtyCount = 0;
+        dirtyFull = 0;
+
+        if (!frameFunc) return;
+
+        if (gfxContext.bitsPerPixel == 8)
+        {
+            //256 colors palette, expand to 32 bits before passing to user hook
+            expandIndexed(frameBuff, screenWidth << 2, sdlSurface->pixels, sdlSurface->pitch, screenWidth, screenHeight, paletteTable);
+            frameFunc(frameBuff, screenWidth, screenHeight, screenWidth << 2);
+        }
+        else frameFunc(gfxContext.drawBuff, gfxContext.texWidth, gfxContext.texHeight, gfxContext.bytesPerScanline);
+        return;
+    }
+
+    //async mode, hand the finished frame to present thread and continue drawing
+    if (presentThread)
+    {
+        presentFrameAsync();
+        return;
+    }
+
+    //only upload damaged rectangles when tracking is on, texture keep the rest of previous frame
+    const SDL_Rect* rects = (!(screenFlags & SCREEN_DIRTY_RECTS) || dirtyFull) ? NULL : dirtyRects;
+    if (gfxContext.bitsPerPixel == 8) uploadFrame(sdlSurface->pixels, sdlSurface->pitch, paletteTable, rects, dirtyCount);
+    else uploadFrame(gfxContext.drawBuff, gfxContext.bytesPerScanline, NULL, rects, dirtyCount);
+
+    //start new damaged list for next frame
+    dirtyCount = 0;
+    dirtyFull = 0;
+
+    //clear screen and render texture to screen
+    presentTexture();
+}
+
+//adjust screen buffer and texture to the new size
+int32_t changeScreenSize(int32_t width, int32_t height)
+{
+    const uint32_t rowBytes = width * gfxContext.bytesPerPixel;
+    const uint32_t bytesCopy = height * rowBytes;
+
+    //async mode, flush queued frames and stop present thread before re-create buffers
+    const int32_t async = (presentThread != NULL);
+    closePresentThread();
+
+    //create new texture with new size (no texture in headless mode)
+    if (sdlRenderer)
+    {
+        if (sdlTexture) SDL_DestroyTexture(sdlTexture);
+        sdlTexture = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_XRGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+        if (!sdlTexture)
+        {
+            messageBox(GFX_ERROR, "Failed to create new texture: %s", SDL_GetError());
+            return 0;
+        }
+    }
+
+    //8 bits
+    if (gfxContext.bytesPerPixel == 1)
+    {
+        //save current palette
+        RGBA pal[256] = { 0 };
+        getPalette(pal);
+
+        //create new 32bits frame buffer (headless mode)
+        if (frameBuff)
+        {
+            SDL_aligned_free(frameBuff);
+            frameBuff = (uint32_t*)SDL_aligned_alloc(32, width * height * sizeof(uint32_t));
+            if (!frameBuff)
+            {
+                messageBox(GFX_ERROR, "Failed to create new 32 bits frame buffer!");
+                return 0;
+            }
+        }
+
+        //create new 8bits surface
+        if (sdlSurface) SDL_DestroySurface(sdlSurface);
+        sdlSurface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_INDEX8);
+        if (!sdlSurface)
+        {
+            messageBox(GFX_ERROR, "Failed to create new 8bits surface: %s", SDL_GetError());
+            return 0;
+        }
+
+        //initialize new drawing buffer
+        if (!sdlSurface->pixels)
+        {
+            messageBox(GFX_ERROR, "Failed to create render buffer!");
+            return 0;
+        }
+
+        //make the draw buffer
+        gfxContext.drawBuff = sdlSurface->pixels;
+
+        //restore palette on new surface
+        SDL_Palette* palette = SDL_GetSurfacePalette(sdlSurface);
+        if (palette) SDL_SetPaletteColors(palette, pal, 0, 256);
+    }
+    else
+    {
+        //adjust render buffer (32-bytes alignment)
+        if (gfxContext.drawBuff) SDL_aligned_free(gfxContext.drawBuff);
+        gfxContext.drawBuff = SDL_aligned_alloc(32, bytesCopy);
+        if (!gfxContext.drawBuff)
+        {
+            messageBox(GFX_INFO, "Error create new render buffer:%u!", bytesCopy);
+            return 0;
+        }
+    }
+
+    //update new screen buffer size
+    gfxContext.texWidth = width;
+    gfxContext.texHeight = height;
+    gfxContext.centerX = (gfxContext.texWidth >> 1) - 1;
+    gfxContext.centerY = (gfxContext.texHeight >> 1) - 1;
+
+    //update new view port size
+    gfxContext.cminX = 0;
+    gfxContext.cminY = 0;
+    gfxContext.cmaxX = gfxContext.texWidth - 1;
+    gfxContext.cmaxY = gfxContext.texHeight - 1;
+
+    //update bytes per scan line
+    gfxContext.bytesPerScanline = rowBytes;
+
+    //update screen buffer
+    screenBuff = gfxContext.drawBuff;
+    screenWidth = width;
+    screenHeight = height;
+
+    //restart present thread with new size
+    if (async && !initPresentThread()) return 0;
+
+    return 1;
+}
+
+//render from user-defined buffer
+void renderBuffer(const void* buffer, int32_t width, int32_t height)
+{
+    //calculate amount of bytes transfer (should be 32-bytes alignment)
+    const uint32_t rowBytes = width * gfxContext.bytesPerPixel;
+    const uint32_t bytesCopy = height * rowBytes;
+
+    //check for 32-bytes alignment
+    if (rowBytes % 32)
+    {
+        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
+        return;
+    }
+
+    //detect texture size has changed?
+    if ((gfxContext.texWidth != width || gfxContext.texHeight != height) && !changeScreenSize(width, height)) return;
+
+    //whole buffer changed
+    markDirtyScreen();
+
+    //done adjustment render buffer
+    memcpy(gfxContext.drawBuff, buffer, bytesCopy);
+    render();
+}
+
+//render from user-defined buffer without copying to draw buffer (zero-copy, the draw buffer keeps old contents)
+void presentBuffer(const void* buffer, int32_t width, int32_t height)
+{
+    //frame commit: order non-temporal stores of caller buffer before it is read back
+    _mm_sfence();
+
+    //calculate bytes per row (should be 32-bytes alignment)
+    const uint32_t rowBytes = width * gfxContext.bytesPerPixel;
+
+    //check for 32-bytes alignment
+    if (rowBytes % 32)
+    {
+        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
+        return;
+    }
+
+    //async mode, caller can reuse the buffer right after return so we must copy it
+    if (presentThread)
+    {
+        renderBuffer(buffer, width, height);
+        return;
+    }
+
+    //detect texture size has changed?
+    if ((gfxContext.texWidth != width || gfxContext.texHeight != height) && !changeScreenSize(width, height)) return;
+
+    //texture no longer match the draw buffer, next render must upload whole frame
+    markDirtyScreen();
+    frameCount++;
+    if (simFrames)
+    {
+        simClock += FPS_60;
+        simPolls = 0;
+    }
+
+    //headless mode, pass user buffer to frame-commit hook
+    if (screenFlags & SCREEN_HEADLESS)
+    {
+        if (!frameFunc) return;
+
+        if (gfxContext.bitsPerPixel == 8)
+        {
+            expandIndexed(frameBuff, width << 2, buffer, rowBytes, width, height, paletteTable);
+            frameFunc(frameBuff, width, height, width << 2);
+        }
+        else frameFunc(buffer, width, height, rowBytes);
+        return;
+    }
+
+    //upload straight from user buffer
+    uploadFrame(buffer, rowBytes, (gfxContext.bitsPerPixel == 8) ? paletteTable : NULL, NULL, 0);
+    presentTexture();
+}
+
+//raise a message box
+void messageBox(int32_t type, const char* fmt, ...)
+{
+    char buffer[1024] = { 0 };
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+
+    //headless mode, no window to show message
+    if (screenFlags & SCREEN_HEADLESS)
+    {
+        fprintf(stderr, "%s: %s\n", (type == GFX_ERROR) ? "GFX Error!" : (type == GFX_WARNING) ? "GFX Warning!" : "GFX Info", buffer);
+        return;
+    }
+
+    switch (type)
+    {
+    case GFX_ERROR:
+        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, "GFX Error!", buffer, NULL);
+        break;
+
+    case GFX_WARNING:
+        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_WARNING, "GFX Warning!", buffer, NULL);
+        break;
+
+    default:
+        SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "GFX Info", buffer, NULL);
+        break;
+    }
+}
+
+//get current bits per pixel
+must_inline int32_t getBitsPerPixel()
+{
+    return gfxContext.bitsPerPixel;
+}
+
+//get current bytes per pixel
+must_inline int32_t getBytesPerPixel()
+{
+    return gfxContext.bytesPerPixel;
+}
+
+//get current bytes per line
+must_inline int32_t getBytesPerScanline()
+{
+    return gfxContext.bytesPerScanline;
+}
+
+//get current draw buffer width
+int32_t getDrawBufferWidth()
+{
+    return gfxContext.texWidth;
+}
+
+//get current draw buffer height
+int32_t getDrawBufferHeight()
+{
+    return gfxContext.texHeight;
+}
+
+//retrieve raw pixels data buffer
+void* getDrawBuffer(int32_t *width, int32_t *height)
+{
+    if (width) *width = gfxContext.texWidth;
+    if (height) *height = gfxContext.texHeight;
+    return gfxContext.drawBuff;
+}
+
+//get current screen initialize flags
+uint32_t getScreenFlags()
+{
+    return screenFlags;
+}
+
+//get number of committed frames since screen initialized
+uint64_t getFrameCount()
+{
+    return frameCount;
+}
+
+//set frame-commit hook, render call this in headless mode
+void setFrameCallback(GFX_FRAME_FUNC func)
+{
+    frameFunc = func;
+}
+
+//add damaged rectangle (screen coordinate) to current frame, use this after writing to screen buffer directly
+void markDirtyRect(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    //whole screen already damaged
+    if (dirtyFull) return;
+
+    //clip to screen boundaries
+    const int32_t x1 = max(x, 0);
+    const int32_t y1 = max(y, 0);
+    const int32_t x2 = min(x + width, screenWidth);
+    const int32_t y2 = min(y + height, screenHeight);
+    if (x1 >= x2 || y1 >= y2) return;
+
+    //merge with overlapped or touched rectangle (search from the last added)
+    for (int32_t i = dirtyCount - 1; i >= 0; i--)
+    {
+        SDL_Rect* rect = &dirtyRects[i];
+        if (x1 <= rect->x + rect->w && x2 >= rect->x && y1 <= rect->y + rect->h && y2 >= rect->y)
+        {
+            const int32_t rx2 = max(x2, rect->x + rect->w);
+            const int32_t ry2 = max(y2, rect->y + rect->h);
+            rect->x = min(x1, rect->x);
+            rect->y = min(y1, rect->y);
+            rect->w = rx2 - rect->x;
+            rect->h = ry2 - rect->y;
+            if (rect->w == screenWidth && rect->h == screenHeight) dirtyFull = 1;
+            return;
+        }
+    }
+
+    //list is full, collapse all to bounding box
+    if (dirtyCount == MAX_DIRTY_RECTS)
+    {
+        int32_t bx1 = x1, by1 = y1, bx2 = x2, by2 = y2;
+        for (int32_t i = 0; i < dirtyCount; i++)
+        {
+            bx1 = min(bx1, dirtyRects[i].x);
+            by1 = min(by1, dirtyRects[i].y);
+            bx2 = max(bx2, dirtyRects[i].x + dirtyRects[i].w);
+            by2 = max(by2, dirtyRects[i].y + dirtyRects[i].h);
+        }
+
+        dirtyRects[0].x = bx1;
+        dirtyRects[0].y = by1;
+        dirtyRects[0].w = bx2 - bx1;
+        dirtyRects[0].h = by2 - by1;
+        dirtyCount = 1;
+        if (dirtyRects[0].w == screenWidth && dirtyRects[0].h == screenHeight) dirtyFull = 1;
+        return;
+    }
+
+    //add new rectangle
+    dirtyRects[dirtyCount].x = x1;
+    dirtyRects[dirtyCount].y = y1;
+    dirtyRects[dirtyCount].w = x2 - x1;
+    dirtyRects[dirtyCount].h = y2 - y1;
+    dirtyCount++;
+}
+
+//mark whole screen as damaged (palette changed, direct buffer writing, ...)
+void markDirtyScreen()
+{
+    dirtyCount = 0;
+    dirtyFull = 1;
+}
+
+//record damaged area of drawing functions (only when default context drawing to screen buffer)
+static must_inline void damageRect(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    if (!(screenFlags & SCREEN_DIRTY_RECTS) || ctx != &gfxContext || ctx->drawBuff != screenBuff) return;
+
+    //view port changed the buffer pitch, can't map to screen coordinate
+    if (ctx->texWidth != screenWidth) dirtyFull = 1;
+    else markDirtyRect(x, y, width, height);
+}
+
+//get default drawing context (free drawing functions use this context)
+GFX_CONTEXT* getContext()
+{
+    return &gfxContext;
+}
+
+//initialize drawing context with raw pixels buffer (should be 32-bytes alignment)
+//each thread must use its own context to draw tiles, layers or offscreen images in parallel
+int32_t initContext(GFX_CONTEXT* ctx, void* buffer, int32_t width, int32_t height, int32_t bpp)
+{
+    //validate context and buffer
+    if (!ctx || !buffer || width <= 0 || height <= 0 || (bpp != 8 && bpp != 32))
+    {
+        messageBox(GFX_ERROR, "initContext: invalid buffer (%dx%d) or bits per pixel:%d", width, height, bpp);
+        return 0;
+    }
+
+    //clean all states
+    memset(ctx, 0, sizeof(GFX_CONTEXT));
+
+    //initialize buffer attributes
+    ctx->drawBuff           = buffer;
+    ctx->texWidth           = width;
+    ctx->texHeight          = height;
+    ctx->bitsPerPixel       = bpp;
+    ctx->bytesPerPixel      = bpp >> 3;
+    ctx->bytesPerScanline   = width * ctx->bytesPerPixel;
+    ctx->centerX            = (width >> 1) - 1;
+    ctx->centerY            = (height >> 1) - 1;
+
+    //initialize view port size
+    ctx->cminX = 0;
+    ctx->cminY = 0;
+    ctx->cmaxX = width - 1;
+    ctx->cmaxY = height - 1;
+    return 1;
+}
+
+//initialize drawing context with image buffer (use image pixel format)
+int32_t initContext(GFX_CONTEXT* ctx, GFX_IMAGE* img)
+{
+    if (!img || !img->mData || img->mWidth <= 0)
+    {
+        messageBox(GFX_ERROR, "initContext: invalid image!");
+        return 0;
+    }
+    return initContext(ctx, img->mData, img->mWidth, img->mHeight, (img->mRowBytes / img->mWidth) << 3);
+}
+
+//set the draw buffer
+//!!!changeDrawBuffer and restoreDrawBuffer must be a pair functions!!!
+void changeDrawBuffer(GFX_CONTEXT* ctx, void* newBuff, int32_t newWidth, int32_t newHeight)
+{
+    ctx->oldBuffer = ctx->drawBuff;
+    ctx->drawBuff = newBuff;
+    changeViewPort(ctx, 0, 0, newWidth - 1, newHeight - 1);
+}
+
+//set the draw buffer
+void changeDrawBuffer(void* newBuff, int32_t newWidth, int32_t newHeight)
+{
+    changeDrawBuffer(&gfxContext, newBuff, newWidth, newHeight);
+}
+
+//must call after setDrawBuffer call
+//!!!changeDrawBuffer and restoreDrawBuffer must be a pair functions!!!
+void restoreDrawBuffer(GFX_CONTEXT* ctx)
+{
+    ctx->drawBuff = ctx->oldBuffer;
+    restoreViewPort(ctx);
+}
+
+//must call after setDrawBuffer call
+void restoreDrawBuffer()
+{
+    restoreDrawBuffer(&gfxContext);
+}
+
+//set current screen view port for clipping
+//!!!changeViewPort and restoreViewPort must be a pair functions!!!
+void changeViewPort(GFX_CONTEXT* ctx, int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    //save current view port
+    ctx->oldMinX     = ctx->cminX;
+    ctx->oldMinY     = ctx->cminY;
+    ctx->oldMaxX     = ctx->cmaxX;
+    ctx->oldMaxY     = ctx->cmaxY;
+    ctx->oldWidth    = ctx->texWidth;
+    ctx->oldHeight   = ctx->texHeight;
+
+    //update new clip view port
+    ctx->cminX = x1;
+    ctx->cminY = y1;
+    ctx->cmaxX = x2;
+    ctx->cmaxY = y2;
+
+    //update buffer width and height
+    ctx->texWidth    = ctx->cmaxX - ctx->cminX + 1;
+    ctx->texHeight   = ctx->cmaxY - ctx->cminY + 1;
+
+    //update center x,y
+    ctx->centerX = (ctx->texWidth >> 1) - 1;
+    ctx->centerY = (ctx->texHeight >> 1) - 1;
+
+    //update row bytes
+    ctx->bytesPerScanline = ctx->texWidth * ctx->bytesPerPixel;
+}
+
+//set current screen view port for clipping
+void changeViewPort(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    changeViewPort(&gfxContext, x1, y1, x2, y2);
+}
+
+//must call after changeViewPort call
+//!!!changeViewPort and restoreViewPort must be a pair functions!!!
+void restoreViewPort(GFX_CONTEXT* ctx)
+{
+    ctx->cminX       = ctx->oldMinX;
+    ctx->cminY       = ctx->oldMinY;
+    ctx->cmaxX       = ctx->oldMaxX;
+    ctx->cmaxY       = ctx->oldMaxY;
+    ctx->texWidth    = ctx->oldWidth;
+    ctx->texHeight   = ctx->oldHeight;
+    ctx->centerX     = (ctx->texWidth >> 1) - 1;
+    ctx->centerY     = (ctx->texHeight >> 1) - 1;
+    ctx->bytesPerScanline = ctx->texWidth * ctx->bytesPerPixel;
+}
+
+//must call after changeViewPort call
+void restoreViewPort()
+{
+    restoreViewPort(&gfxContext);
+}
+
+//get current view port
+void getViewPort(GFX_CONTEXT* ctx, int32_t* x1, int32_t* y1, int32_t* x2, int32_t* y2)
+{
+    *x1 = ctx->cminX;
+    *y1 = ctx->cminY;
+    *x2 = ctx->cmaxX;
+    *y2 = ctx->cmaxY;
+}
+
+//get current view port
+void getViewPort(int32_t* x1, int32_t* y1, int32_t* x2, int32_t* y2)
+{
+    getViewPort(&gfxContext, x1, y1, x2, y2);
+}
+
+//get current x center
+int32_t getCenterX()
+{
+    return gfxContext.centerX;
+}
+
+//get current y center
+int32_t getCenterY()
+{
+    return gfxContext.centerY;
+}
+
+//get current max x
+int32_t getMaxX()
+{
+    return gfxContext.cmaxX;
+}
+
+//get current max y
+int32_t getMaxY()
+{
+    return gfxContext.cmaxY;
+}
+
+//get current min x
+int32_t getMinX()
+{
+    return gfxContext.cminX;
+}
+
+//get current min y
+int32_t getMinY()
+{
+    return gfxContext.cminY;
+}
+
+//clear screen with color
+void clearScreenMix(GFX_CONTEXT* ctx, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const uint32_t msize = ctx->texHeight * ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     edi, drawBuff
+        mov     ecx, msize
+        shr     ecx, 2
+        mov     ebx, msize
+        and     ebx, 3
+        mov     al, byte ptr color
+        mov     ah, al
+        mov     dx, ax
+        shl     eax, 16
+        mov     ax, dx
+        rep     stosd
+        mov     ecx, ebx
+        rep     stosb
+    }
+#else
+    memset(drawBuff, color, msize);
+#endif
+}
+
+//clear context buffer with color
+void clearContext(GFX_CONTEXT* ctx, uint32_t color)
+{
+    //whole buffer changed
+    damageRect(ctx, 0, 0, ctx->texWidth, ctx->texHeight);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        clearScreenMix(ctx, color);
+        return;
+    }
+
+    //height color mode
+    void* drawBuff = ctx->drawBuff;
+    const uint32_t msize = ctx->texHeight * ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov         edi, drawBuff
+        movd        mm0, color
+        mov         ecx, msize
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm0, mm0
+    again:
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         again
+    once:
+        test        msize, 1
+        jz          end
+        movd        [edi], mm0
+    end:
+        emms        
+    }
+#else
+    //store policy: small buffers are overdrawn right away, keep them in cache
+    if (streamStores(uint64_t(msize) << 2)) gfxKernels.streamSpan((uint32_t*)drawBuff, color, msize);
+    else gfxKernels.fillSpan((uint32_t*)drawBuff, color, msize);
+#endif
+}
+
+//clear screen with color
+void clearScreen(uint32_t color)
+{
+    clearContext(&gfxContext, color);
+    render();
+}
+
+//fill 8 bits span (SSE2 version, count >= 16): unaligned head store, aligned body, overlapped unaligned tail store
+static void fillSpanMixSSE2(uint8_t* dst, const uint8_t color, const int32_t count, const int32_t stream)
+{
+    const __m128i xmm0 = _mm_set1_epi8(color);
+    _mm_storeu_si128((__m128i*)dst, xmm0);
+
+    int32_t i = (16 - (uintptr_t(dst) & 15)) & 15;
+    if (stream)
+    {
+        for (; i + 16 <= count; i += 16) _mm_stream_si128((__m128i*)&dst[i], xmm0);
+    }
+    else
+    {
+        for (; i + 16 <= count; i += 16) _mm_store_si128((__m128i*)&dst[i], xmm0);
+    }
+
+    if (i < count) _mm_storeu_si128((__m128i*)&dst[count - 16], xmm0);
+}
+
+//fill 8 bits span (AVX2 version, count >= 32): unaligned head store, aligned body, overlapped unaligned tail store
+static target_avx2 void fillSpanMixAVX2(uint8_t* dst, const uint8_t color, const int32_t count, const int32_t stream)
+{
+    const __m256i ymm0 = _mm256_set1_epi8(color);
+    _mm256_storeu_si256((__m256i*)dst, ymm0);
+
+    int32_t i = (32 - (uintptr_t(dst) & 31)) & 31;
+    if (stream)
+    {
+        for (; i + 32 <= count; i += 32) _mm256_stream_si256((__m256i*)&dst[i], ymm0);
+    }
+    else
+    {
+        for (; i + 32 <= count; i += 32) _mm256_store_si256((__m256i*)&dst[i], ymm0);
+    }
+
+    if (i < count) _mm256_storeu_si256((__m256i*)&dst[count - 32], ymm0);
+}
+
+//fill 8 bits span (AVX-512BW version): masked head to 64-bytes boundary and tail
+static target_avx512 void fillSpanMixAVX512(uint8_t* dst, const uint8_t color, const int32_t count, const int32_t stream)
+{
+    const __m512i zmm0 = _mm512_set1_epi8(color);
+
+    int32_t i = min(int32_t((64 - (uintptr_t(dst) & 63)) & 63), count);
+    if (i > 0) _mm512_mask_storeu_epi8(dst, (__mmask64(1) << i) - 1, zmm0);
+
+    if (stream)
+    {
+        for (; i + 64 <= count; i += 64) _mm512_stream_si512((__m512i*)&dst[i], zmm0);
+    }
+    else
+    {
+        for (; i + 64 <= count; i += 64) _mm512_store_si512(&dst[i], zmm0);
+    }
+
+    if (i < count) _mm512_mask_storeu_epi8(&dst[i], (__mmask64(1) << (count - i)) - 1, zmm0);
+}
+
+//fill 8 bits span with the kernel of current level (short spans and scalar level use memset)
+//stream selects non-temporal stores, caller decides it by whole fill size (see streamStores)
+static must_inline void fillSpanMix(uint8_t* dst, const uint8_t color, const int32_t count, const int32_t stream = 0)
+{
+    if (count < 32 || kernelLevel < KERNEL_LEVEL_SSE2) memset(dst, color, count);
+    else if (kernelLevel >= KERNEL_LEVEL_AVX512) fillSpanMixAVX512(dst, color, count, stream);
+    else if (kernelLevel >= KERNEL_LEVEL_AVX2) fillSpanMixAVX2(dst, color, count, stream);
+    else fillSpanMixSSE2(dst, color, count, stream);
+}
+
+//plot a pixel at (x,y) with color
+must_inline void putPixelMix(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     eax, color
+        stosb
+    }
+#else
+    uint8_t* pixels = (uint8_t*)drawBuff + (texWidth * y + x);
+    *pixels = color;
+#endif
+}
+
+#ifdef _USE_ASM
+//plot a pixel at (x,y) with color
+must_inline void putPixelNormal(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     eax, color
+        stosd
+    }
+}
+
+//plot a pixel at (x,y) with alpha-blending
+//correct formular: (SC*SA+DC*(256-SA))>>8
+//don't use (SC*SA+DC*(255-SA))>>8, you'll always get 254 as your maximum value.
+//ie: (255*128+255*(255-128))>>8=254 --> WRONG!!!
+//with: (255*128+255*(256-128))>>8=255 --> ACCEPTED!!!
+must_inline void putPixelAlpha(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t src)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff   
+        add         edi, eax
+        mov         eax, src
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+        movd        mm0, [edi]
+        movd        mm1, src
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+        emms
+    }
+}
+#endif
+
+//plot a pixel at (x,y) with anti-aliased
+must_inline void putPixelAA(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t argb)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff
+        add         edi, eax
+        mov         eax, argb
+        shr         eax, 24
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+        neg         eax
+        add         eax, 256
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        pxor        mm5, mm5
+        movd        mm0, [edi]
+        movd        mm1, argb
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+        emms
+    }
+#else
+    uint32_t* pdata = (uint32_t*)drawBuff;
+    uint32_t* pixels = &pdata[texWidth * y + x];
+    const uint32_t dst = *pixels;
+    const uint8_t cover = argb >> 24;
+    const uint8_t rcover = 255 - cover;
+    const uint32_t rb = ((argb & 0x00ff00ff) * rcover + (dst & 0x00ff00ff) * cover);
+    const uint32_t ag = (((argb & 0xff00ff00) >> 8) * rcover + ((dst & 0xff00ff00) >> 8) * cover);
+    *pixels = ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
+#endif
+}
+
+//plot a pixel at (x,y) with background color
+must_inline void putPixelBob(int32_t x, int32_t y)
+{
+    if (gfxContext.bitsPerPixel != 8) return;
+    if (x < gfxContext.cminX || y < gfxContext.cminY || x > gfxContext.cmaxX || y > gfxContext.cmaxY) return;
+    damageRect(&gfxContext, x, y, 1, 1);
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, y
+        mul     gfxContext.texWidth
+        add     eax, x
+        mov     esi, gfxContext.drawBuff
+        add     esi, eax
+        mov     ebx, eax
+        lodsb
+        mov     edi, gfxContext.drawBuff
+        add     edi, ebx
+        inc     al
+        jnc     plot
+        mov     al, 255
+    plot:
+        stosb
+    }
+#else
+    const uint8_t col = min(getPixel(x, y) + 1, 255);
+    putPixel(x, y, col);
+#endif
+}
+
+#ifdef _USE_ASM
+//plot a pixel at (x,y) with add color
+must_inline void putPixelAdd(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     edi, drawBuff
+        add     edi, eax
+        movd    mm0, [edi]
+        paddusb mm0, color
+        movd    [edi], mm0
+        emms
+    }
+}
+
+//plot a pixel at (x,y) with sub color
+must_inline void putPixelSub(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     edi, drawBuff
+        add     edi, eax
+        movd    mm0, [edi]
+        psubusb mm0, color
+        movd    [edi], mm0
+        emms
+    }
+}
+#endif
+
+//put pixel at (x,y) with color and mode
+void putPixel(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t color, int32_t mode)
+{
+    //range checking
+    if (x < ctx->cminX || y < ctx->cminY || x > ctx->cmaxX || y > ctx->cmaxY) return;
+    damageRect(ctx, x, y, 1, 1);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        putPixelMix(ctx, x, y, color);
+        return;
+    }
+
+    //anti-aliased pixel has no blend kernels
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        putPixelAA(ctx, x, y, color);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        putPixelNormal(ctx, x, y, color);
+        return;
+
+    case BLEND_MODE_ADD:
+        putPixelAdd(ctx, x, y, color);
+        return;
+
+    case BLEND_MODE_SUB:
+        putPixelSub(ctx, x, y, color);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        putPixelAlpha(ctx, x, y, color);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    uint32_t* pixels = (uint32_t*)ctx->drawBuff + (ctx->texWidth * y + x);
+    *pixels = blend->blendPixel(*pixels, color);
+}
+
+//put pixel at (x,y) with color and mode
+void putPixel(int32_t x, int32_t y, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    putPixel(&gfxContext, x, y, color, mode);
+}
+
+//indices of visible points (SSE2 version, 4 points per loop), return number of compared points
+static int32_t clipPointsSSE2(const GFX_CONTEXT* ctx, const int32_t* xs, const int32_t* ys, int32_t n, int32_t* indices, int32_t* count)
+{
+    int32_t i = 0;
+    const __m128i minx = _mm_set1_epi32(ctx->cminX - 1);
+    const __m128i miny = _mm_set1_epi32(ctx->cminY - 1);
+    const __m128i maxx = _mm_set1_epi32(ctx->cmaxX + 1);
+    const __m128i maxy = _mm_set1_epi32(ctx->cmaxY + 1);
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i*)&xs[i]);
+        const __m128i y = _mm_loadu_si128((const __m128i*)&ys[i]);
+        const __m128i inx = _mm_and_si128(_mm_cmpgt_epi32(x, minx), _mm_cmpgt_epi32(maxx, x));
+        const __m128i iny = _mm_and_si128(_mm_cmpgt_epi32(y, miny), _mm_cmpgt_epi32(maxy, y));
+        int32_t mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(inx, iny)));
+        for (int32_t j = i; mask; j++, mask >>= 1)
+        {
+            if (mask & 1) indices[(*count)++] = j;
+        }
+    }
+    return i;
+}
+
+//indices of visible points (AVX2 version, 8 points per loop), return number of compared points
+static target_avx2 int32_t clipPointsAVX2(const GFX_CONTEXT* ctx, const int32_t* xs, const int32_t* ys, int32_t n, int32_t* indices, int32_t* count)
+{
+    int32_t i = 0;
+    const __m256i minx = _mm256_set1_epi32(ctx->cminX - 1);
+    const __m256i miny = _mm256_set1_epi32(ctx->cminY - 1);
+    const __m256i maxx = _mm256_set1_epi32(ctx->cmaxX + 1);
+    const __m256i maxy = _mm256_set1_epi32(ctx->cmaxY + 1);
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i*)&xs[i]);
+        const __m256i y = _mm256_loadu_si256((const __m256i*)&ys[i]);
+        const __m256i inx = _mm256_and_si256(_mm256_cmpgt_epi32(x, minx), _mm256_cmpgt_epi32(maxx, x));
+        const __m256i iny = _mm256_and_si256(_mm256_cmpgt_epi32(y, miny), _mm256_cmpgt_epi32(maxy, y));
+        int32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(inx, iny)));
+        for (int32_t j = i; mask; j++, mask >>= 1)
+        {
+            if (mask & 1) indices[(*count)++] = j;
+        }
+    }
+    return i;
+}
+
+//clip a batch of points (at most POINT_BATCH), store buffer offsets and indices of visible points
+//extend bounding box (x1, y1, x2, y2) of visible points, return number of visible points
+static int32_t clipPoints(const GFX_CONTEXT* ctx, const int32_t* xs, const int32_t* ys, int32_t n, int32_t* offsets, int32_t* indices, int32_t* box)
+{
+    int32_t i = 0, count = 0;
+
+    //compare 8 or 4 points at once, keep indices of visible points
+    if (kernelLevel >= KERNEL_LEVEL_AVX2) i = clipPointsAVX2(ctx, xs, ys, n, indices, &count);
+    else if (kernelLevel >= KERNEL_LEVEL_SSE2) i = clipPointsSSE2(ctx, xs, ys, n, indices, &count);
+
+    //remainder points
+    for (; i < n; i++)
+    {
+        if (xs[i] >= ctx->cminX && ys[i] >= ctx->cminY && xs[i] <= ctx->cmaxX && ys[i] <= ctx->cmaxY) indices[count++] = i;
+    }
+
+    //buffer offsets and bounding box
+    for (i = 0; i < count; i++)
+    {
+        const int32_t x = xs[indices[i]];
+        const int32_t y = ys[indices[i]];
+        offsets[i] = ctx->texWidth * y + x;
+        box[0] = min(box[0], x);
+        box[1] = min(box[1], y);
+        box[2] = max(box[2], x);
+        box[3] = max(box[3], y);
+    }
+
+    return count;
+}
+
+//plot a batch of pixels (xs[i], ys[i]) with colors[i], clipping and blend mode dispatch are done once per batch
+void putPixels(GFX_CONTEXT* ctx, const int32_t* xs, const int32_t* ys, const uint32_t* colors, int32_t n, int32_t mode)
+{
+    //anti-aliased pixel has no blend kernels
+    if (ctx->bitsPerPixel != 8 && mode == BLEND_MODE_ANTIALIASED)
+    {
+        for (int32_t i = 0; i < n; i++) putPixel(ctx, xs[i], ys[i], colors[i], mode);
+        return;
+    }
+
+    //blend mode kernels (8 bits mode just plot colors)
+    const GFX_BLEND_KERNELS* blend = NULL;
+    if (ctx->bitsPerPixel != 8)
+    {
+        blend = getBlendKernels(mode);
+        if (!blend)
+        {
+            messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+            return;
+        }
+    }
+
+    int32_t offsets[POINT_BATCH] = { 0 };
+    int32_t indices[POINT_BATCH] = { 0 };
+    uint32_t cols[POINT_BATCH] = { 0 };
+    int32_t box[4] = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+
+    for (int32_t i = 0; i < n; i += POINT_BATCH)
+    {
+        const int32_t count = clipPoints(ctx, &xs[i], &ys[i], min(n - i, POINT_BATCH), offsets, indices, box);
+        if (!count) continue;
+
+        //mixed mode?
+        if (ctx->bitsPerPixel == 8)
+        {
+            uint8_t* pixels = (uint8_t*)ctx->drawBuff;
+            for (int32_t j = 0; j < count; j++) pixels[offsets[j]] = uint8_t(colors[i + indices[j]]);
+        }
+        else
+        {
+            for (int32_t j = 0; j < count; j++) cols[j] = colors[i + indices[j]];
+            blend->scatterPixels((uint32_t*)ctx->drawBuff, offsets, cols, count);
+        }
+    }
+
+    if (box[0] <= box[2]) damageRect(ctx, box[0], box[1], box[2] - box[0] + 1, box[3] - box[1] + 1);
+}
+
+//plot a batch of pixels with colors and mode
+void putPixels(const int32_t* xs, const int32_t* ys, const uint32_t* colors, int32_t n, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    putPixels(&gfxContext, xs, ys, colors, n, mode);
+}
+
+//peek a pixel at (x,y)
+must_inline uint32_t getPixelMix(GFX_CONTEXT* ctx, int32_t x, int32_t y)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        mov     esi, drawBuff
+        add     esi, eax
+        xor     eax, eax
+        lodsb
+    }
+    //eax will auto returned
+#else
+    const uint8_t* pixels = (uint8_t*)drawBuff;
+    return pixels[y * texWidth + x];
+#endif
+}
+
+//peek a pixel at (x,y)
+uint32_t getPixel(GFX_CONTEXT* ctx, int32_t x, int32_t y)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    //range checking
+    if (x < ctx->cminX || y < ctx->cminY || x > ctx->cmaxX || y > ctx->cmaxY) return 0;
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8) return getPixelMix(ctx, x, y);
+        
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     esi, drawBuff
+        add     esi, eax
+        xor     eax, eax
+        lodsd
+    }
+    //eax will auto returned
+#else
+    const uint32_t* pixel = (uint32_t*)drawBuff;
+    return pixel[y * texWidth + x];
+#endif
+}
+
+//peek a pixel at (x,y)
+uint32_t getPixel(int32_t x, int32_t y)
+{
+    return getPixel(&gfxContext, x, y);
+}
+
+//fast horizontal line from (x,y) with sx length, and color
+must_inline void horizLineMix(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sx, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     al, byte ptr [color]
+        mov     ah, al
+        mov     dx, ax
+        shl     eax, 16
+        mov     ax, dx
+        mov     edx, sx
+        shr     edx, 2
+        mov     ebx, sx
+        and     ebx, 3
+        mov     ecx, edx
+        rep     stosd
+        mov     ecx, ebx
+        rep     stosb
+    }
+#else
+    fillSpanMix((uint8_t*)drawBuff + (texWidth * y + x), color, sx);
+#endif
+}
+
+#ifdef _USE_ASM
+//fast horizontal line from (x,y) with sx length, and color
+must_inline void horizLineNormal(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sx, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff
+        add         edi, eax
+        movd        mm0, color
+        mov         ecx, sx
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm0, mm0
+    plot:
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        sx, 1
+        jz          end
+        movd        [edi], mm0
+    end:
+        emms
+    }
+}
+
+//fast horizontal line from (x,y) with sx length, and add color
+must_inline void horizLineAdd(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sx, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff
+        add         edi, eax
+        movd        mm1, color
+        mov         ecx, sx
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    next:
+        movq        mm0, [edi]
+        paddusb     mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         next
+    once:
+        test        sx, 1
+        jz          end
+        movd        mm0, [edi]
+        paddusb     mm0, mm1
+        movd        [edi], mm0
+    end:
+        emms
+    }
+}
+
+//fast horizontal line from (x,y) with sx length, and sub color
+must_inline void horizLineSub(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sx, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff
+        add         edi, eax
+        movd        mm1, color
+        mov         ecx, sx
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    next:
+        movq        mm0, [edi]
+        psubusb     mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         next
+    once:
+        test        sx, 1
+        jz          end
+        movd        mm0, [edi]
+        psubusb     mm0, mm1
+        movd        [edi], mm0
+    end:
+        emms
+    }
+}
+
+//fast horizontal line from (x,y) with sx length, and blending pixel
+must_inline void horizLineAlpha(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sx, uint32_t argb)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff
+        add         edi, eax
+        mov         eax, argb
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+    next:
+        movd        mm0, [edi]
+        movd        mm1, argb
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+        add         edi, 4
+        dec         sx
+        jnz         next
+        emms
+    }
+}
+#endif
+
+//fast horizon line from (x, y) with sx length
+void horizLine(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sx, uint32_t color, int32_t mode)
+{
+    //check for clip-y
+    if (y > ctx->cmaxY || y < ctx->cminY) return;
+    if (x > ctx->cmaxX || sx <= 0) return;
+
+    //check clip boundary
+    if (x < ctx->cminX)
+    {
+        //re-calculate sx
+        sx -= (ctx->cminX - x) + 1;
+        x = ctx->cminX;
+    }
+
+    //inbound check
+    if (sx > ctx->cmaxX - x) sx = (ctx->cmaxX - x) + 1;
+    if (sx <= 0) return;
+    damageRect(ctx, x, y, sx, 1);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        horizLineMix(ctx, x, y, sx, color);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        horizLineNormal(ctx, x, y, sx, color);
+        return;
+
+    case BLEND_MODE_ADD:
+        horizLineAdd(ctx, x, y, sx, color);
+        return;
+
+    case BLEND_MODE_SUB:
+        horizLineSub(ctx, x, y, sx, color);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        horizLineAlpha(ctx, x, y, sx, color);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    blend->colorSpan((uint32_t*)ctx->drawBuff + (ctx->texWidth * y + x), color, sx);
+}
+
+//fast horizon line from (x, y) with sx length
+void horizLine(int32_t x, int32_t y, int32_t sx, uint32_t color, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    horizLine(&gfxContext, x, y, sx, color, mode);
+}
+
+//draw a batch of horizontal spans (xs[i], ys[i]) with widths[i] and colors[i], blend mode dispatch is done once
+void drawSpans(GFX_CONTEXT* ctx, const int32_t* xs, const int32_t* ys, const int32_t* widths, const uint32_t* colors, int32_t n, int32_t mode)
+{
+    //blend mode kernels (8 bits mode just fill colors)
+    const GFX_BLEND_KERNELS* blend = NULL;
+    if (ctx->bitsPerPixel != 8)
+    {
+        blend = getBlendKernels(mode);
+        if (!blend)
+        {
+            messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+            return;
+        }
+    }
+
+    int32_t box[4] = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+    for (int32_t i = 0; i < n; i++)
+    {
+        //clip span to context boundaries
+        const int32_t y = ys[i];
+        if (y < ctx->cminY || y > ctx->cmaxY) continue;
+        //end point is clipped in 64 bits, xs[i] + widths[i] can overflow 32 bits
+        const int32_t x1 = max(xs[i], ctx->cminX);
+        const int32_t x2 = int32_t(min(int64_t(xs[i]) + widths[i] - 1, int64_t(ctx->cmaxX)));
+        if (x1 > x2) continue;
+
+        //mixed mode?
+        const int32_t offset = ctx->texWidth * y + x1;
+        if (ctx->bitsPerPixel == 8) memset((uint8_t*)ctx->drawBuff + offset, uint8_t(colors[i]), x2 - x1 + 1);
+        else blend->colorSpan((uint32_t*)ctx->drawBuff + offset, colors[i], x2 - x1 + 1);
+
+        box[0] = min(box[0], x1);
+        box[1] = min(box[1], y);
+        box[2] = max(box[2], x2);
+        box[3] = max(box[3], y);
+    }
+
+    if (box[0] <= box[2]) damageRect(ctx, box[0], box[1], box[2] - box[0] + 1, box[3] - box[1] + 1);
+}
+
+//draw a batch of horizontal spans with colors and mode
+void drawSpans(const int32_t* xs, const int32_t* ys, const int32_t* widths, const uint32_t* colors, int32_t n, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawSpans(&gfxContext, xs, ys, widths, colors, n, mode);
+}
+
+//fast vertical line from (x,y) with sy length, and palette color
+must_inline void vertLineMix(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sy, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     ecx, sy
+        mov     ebx, texWidth
+        sub     ebx, 1
+        mov     al, byte ptr[color]
+    next:
+        stosb
+        add     edi, ebx
+        dec     ecx
+        jnz     next
+    }
+#else
+    //calculate starting address
+    uint8_t* pixels = (uint8_t*)drawBuff + (texWidth * y + x);
+    for (int32_t i = 0; i < sy; i++)
+    {
+        *pixels = color;
+        pixels += texWidth;
+    }
+#endif
+}
+
+#ifdef _USE_ASM
+//fast vertical line from (x,y) with sy length, and rgb color
+must_inline void vertLineNormal(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sy, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     ecx, sy
+        mov     ebx, texWidth
+        sub     ebx, 1
+        shl     ebx, 2
+        mov     eax, color
+    next:
+        stosd
+        add     edi, ebx
+        dec     ecx
+        jnz     next
+    }
+}
+
+//fast vertical line from (x,y) with sy length, and add color
+must_inline void vertLineAdd(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sy, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     ecx, sy
+        mov     ebx, texWidth
+        shl     ebx, 2
+    next:
+        movd    mm0, [edi]
+        paddusb mm0, color
+        movd    [edi], mm0
+        add     edi, ebx 
+        dec     ecx
+        jnz     next
+        emms
+    }
+}
+
+//fast vertical line from (x,y) with sy length, and sub color
+must_inline void vertLineSub(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sy, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        mov     edi, drawBuff
+        add     edi, eax
+        mov     ecx, sy
+        mov     ebx, texWidth
+        shl     ebx, 2
+    next:
+        movd    mm0, [edi]
+        psubusb mm0, color
+        movd    [edi], mm0
+        add     edi, ebx
+        dec     ecx
+        jnz     next
+        emms
+    }
+}
+
+//fast vertical line from (x,y) with sy length, and blending pixels
+must_inline void vertLineAlpha(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sy, uint32_t argb)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        mov         edi, drawBuff
+        add         edi, eax
+        xor         eax, eax
+        mov         edx, texWidth
+        shl         edx, 2
+        mov         eax, argb
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+    next:
+        movd        mm0, [edi]
+        movd        mm1, argb
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+        add         edi, edx
+        dec         sy
+        jnz         next
+        emms
+    }
+}
+#endif
+
+//fast vertical line from (x,y) with sy length, and color
+void vertLine(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t sy, uint32_t color, int32_t mode)
+{
+    //check for clip-x
+    if (x > ctx->cmaxX || x < ctx->cminX) return;
+    if (y > ctx->cmaxY || sy <= 0) return;
+
+    if (y < ctx->cminY)
+    {
+        //re-calculate sy
+        sy -= (ctx->cminY - y) + 1;
+        y = ctx->cminY;
+    }
+
+    //inbound check
+    if (sy > ctx->cmaxY - y) sy = (ctx->cmaxY - y) + 1;
+    if (sy <= 0) return;
+    damageRect(ctx, x, y, 1, sy);
+
+    if (ctx->bitsPerPixel == 8)
+    {
+        vertLineMix(ctx, x, y, sy, color);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        vertLineNormal(ctx, x, y, sy, color);
+        return;
+
+    case BLEND_MODE_ADD:
+        vertLineAdd(ctx, x, y, sy, color);
+        return;
+
+    case BLEND_MODE_SUB:
+        vertLineSub(ctx, x, y, sy, color);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        vertLineAlpha(ctx, x, y, sy, color);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    blend->columnSpan((uint32_t*)ctx->drawBuff + (ctx->texWidth * y + x), ctx->texWidth, color, sy);
+}
+
+//fast vertical line from (x,y) with sy length, and color
+void vertLine(int32_t x, int32_t y, int32_t sy, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    vertLine(&gfxContext, x, y, sy, color, mode);
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectMix(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        add     edi, eax
+        mov     edx, texWidth
+        sub     edx, width
+        push    edx
+        mov     ebx, width
+        shr     ebx, 2
+        mov     edx, width
+        and     edx, 3
+        mov     eax, color
+        shl     eax, 8
+        or      eax, color
+        shl     eax, 8
+        or      eax, color
+        shl     eax, 8
+        or      eax, color
+    next:
+        mov     ecx, ebx
+        rep     stosd
+        mov     ecx, edx
+        rep     stosb
+        add     edi, [esp]
+        dec     height
+        jnz     next
+        pop     edx
+    }
+#else
+    //store policy: decide by whole rectangle, rows are short
+    const int32_t stream = streamStores(uint64_t(width) * height);
+
+    //lines-by-lines (any x, head and tail are handled by span filler)
+    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * y + x);
+    for (int32_t i = 0; i < height; i++)
+    {
+        fillSpanMix(dstPixels, color, width, stream);
+        dstPixels += texWidth;
+    }
+#endif
+}
+
+#ifdef _USE_ASM
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectNormal(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         edx, texWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm0, color
+    again:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm0, mm0
+    next:
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         next
+    once:
+        test        width, 1
+        jz          end
+        movd        [edi], mm0
+        add         edi, 4
+    end:
+        add         edi, edx
+        dec         height
+        jnz         again
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectAdd(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        movd        mm1, color
+    again:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    plot:
+        movq        mm0, [edi]
+        paddusb     mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          end
+        movd        mm0, [edi]
+        paddusb     mm0, mm1
+        movd        [edi], mm0
+        add         edi, 4
+    end:
+        add         edi, ebx
+        dec         height
+        jnz         again
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectSub(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        movd        mm1, color
+    again:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    plot:
+        movq        mm0, [edi]
+        psubusb     mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          end
+        movd        mm0, [edi]
+        psubusb     mm0, mm1
+        movd        [edi], mm0
+        add         edi, 4
+    end:
+        add         edi, ebx
+        dec         height
+        jnz         again
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectAnd(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        movd        mm1, color
+    again:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    plot:
+        movq        mm0, [edi]
+        pand        mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          end
+        movd        mm0, [edi]
+        pand        mm0, mm1
+        movd        [edi], mm0
+        add         edi, 4
+    end:
+        add         edi, ebx
+        dec         height
+        jnz         again
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectXor(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        movd        mm1, color
+    again:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    plot:
+        movq        mm0, [edi]
+        pxor        mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          end
+        movd        mm0, [edi]
+        pxor        mm0, mm1
+        movd        [edi], mm0
+        add         edi, 4
+    end:
+        add         edi, ebx
+        dec         height
+        jnz         again
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and blending pixel
+void fillRectAlpha(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t argb)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         edx, texWidth
+        sub         edx, width
+        shl         edx, 2
+        mov         eax, argb
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+    next:
+        mov         ecx, width
+    plot:
+        movd        mm0, [edi]
+        movd        mm1, argb
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+        add         edi, 4
+        dec         ecx
+        jnz         plot
+        add         edi, edx
+        dec         height
+        jnz         next
+        emms
+    }
+}
+#endif
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRect(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color, int32_t mode)
+{
+    //calculate new position
+    const int32_t x1 = x + (width - 1);
+    const int32_t y1 = y + (height - 1);
+
+    //clip image to context boundaries
+    const int32_t lx = max(x, ctx->cminX);
+    const int32_t ly = max(y, ctx->cminY);
+    const int32_t lx1 = min(x1, ctx->cmaxX);
+    const int32_t ly1 = min(y1, ctx->cmaxY);
+
+    //initialize loop variables
+    const int32_t lwidth = (lx1 - lx) + 1;
+    const int32_t lheight = (ly1 - ly) + 1;
+
+    //check for loop
+    if (lwidth <= 0 || lheight <= 0) return;
+    damageRect(ctx, lx, ly, lwidth, lheight);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        fillRectMix(ctx, lx, ly, lwidth, lheight, color);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        fillRectNormal(ctx, lx, ly, lwidth, lheight, color);
+        return;
+
+    case BLEND_MODE_ADD:
+        fillRectAdd(ctx, lx, ly, lwidth, lheight, color);
+        return;
+
+    case BLEND_MODE_SUB:
+        fillRectSub(ctx, lx, ly, lwidth, lheight, color);
+        return;
+
+    case BLEND_MODE_AND:
+        fillRectAnd(ctx, lx, ly, lwidth, lheight, color);
+        return;
+
+    case BLEND_MODE_XOR:
+        fillRectXor(ctx, lx, ly, lwidth, lheight, color);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        fillRectAlpha(ctx, lx, ly, lwidth, lheight, color);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    //store policy: large opaque fills bypass cache (rows are short, decide by whole rectangle)
+    void (*fillSpan)(uint32_t*, uint32_t, int32_t) = blend->colorSpan;
+    if (mode == BLEND_MODE_NORMAL && streamStores((uint64_t(lwidth) * lheight) << 2)) fillSpan = gfxKernels.streamSpan;
+
+    //lines-by-lines
+    uint32_t* pixels = (uint32_t*)ctx->drawBuff + (ctx->texWidth * ly + lx);
+    for (int32_t i = 0; i < lheight; i++)
+    {
+        fillSpan(pixels, color, lwidth);
+        pixels += ctx->texWidth;
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRect(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    fillRect(&gfxContext, x, y, width, height, color, mode);
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectPatternMix(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        add     edi, eax
+        mov     edx, texWidth
+        sub     edx, width
+        mov     esi, pattern
+    plot:
+        mov     ecx, x
+        and     ecx, 7
+        mov     ebx, height
+        and     ebx, 7
+        mov     al, [esi + ebx]
+        rol     al, cl
+        mov     ebx, col
+        mov     ecx, width
+    next:
+        test    al, 1
+        jz      step
+        mov     [edi], bl
+    step: 
+        inc     edi
+        rol     al, 1
+        dec     ecx
+        jnz     next
+        add     edi, edx
+        dec     height
+        jnz     plot
+    }
+#else
+    //calculate starting address
+    const int32_t addDstOffs = texWidth - width;
+    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * y + x);
+
+    for (int32_t i = 0; i < height; i++)
+    {
+        uint8_t pat = pattern[i & 7];
+        pat = _rotl8(pat, 7);
+        for (int32_t j = 0; j < width; j++)
+        {
+            if (pat & 1) *dstPixels = uint8_t(col);
+            pat = _rotl8(pat, 1);
+            dstPixels++;
+        }
+        if (addDstOffs > 0) dstPixels += addDstOffs;
+    }
+#endif
+}
+
+#ifdef _USE_ASM
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectPatternNormal(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         esi, pattern
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         edx, texWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm0, col
+    plot:
+        mov         ecx, x
+        and         ecx, 7
+        mov         ebx, height
+        and         ebx, 7
+        mov         al, [esi + ebx]
+        rol         al, cl
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm0, mm0
+    next:
+        test        al, 1
+        jz          skip1
+        test        al, 2
+        jz          skip2
+        movq        [edi], mm0
+        jmp         skip0
+    skip2:
+        movd        [edi + 4], mm0
+        jmp         skip0
+    skip1:
+        test        al, 2
+        jz          skip0
+        movd        [edi], mm0
+    skip0:
+        add         edi, 8
+        rol         al, 2
+        dec         ecx
+        jnz         next
+    once:
+        test        width, 1
+        jz          end1
+        test        al, 2
+        jz          end0
+        movd        [edi], mm0
+    end0:
+        add         edi, 4
+    end1:
+        add         edi, edx
+        dec         height
+        jnz         plot
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectPatternAdd(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         esi, pattern
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         edx, texWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm1, col
+    plot:
+        mov         ecx, x
+        and         ecx, 7
+        mov         ebx, height
+        and         ebx, 7
+        mov         al, [esi + ebx]
+        rol         al, cl
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    next:
+        test        al, 1
+        jz          skip1
+        test        al, 2
+        jz          skip2
+        movq        mm0, [edi]
+        paddusb     mm0, mm1
+        movq        [edi], mm0
+        jmp         skip0
+    skip2:
+        movd        mm0, [edi + 4]
+        paddusb     mm0, mm1
+        movd        [edi + 4], mm0
+        jmp         skip0
+    skip1:
+        test        al, 2
+        jz          skip0
+        movd        mm0, [edi]
+        paddusb     mm0, mm1
+        movd        [edi], mm0
+    skip0:
+        add         edi, 8
+        rol         al, 2
+        dec         ecx
+        jnz         next
+    once:
+        test        width, 1
+        jz          end1
+        test        al, 2
+        jz          end0
+        movd        mm0, [edi]
+        paddusb     mm0, mm1
+        movd        [edi], mm0
+    end0:
+        add         edi, 4
+    end1:
+        add         edi, edx
+        dec         height
+        jnz         plot
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectPatternSub(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         esi, pattern
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         edx, texWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm1, col
+    plot:
+        mov         ecx, x
+        and         ecx, 7
+        mov         ebx, height
+        and         ebx, 7
+        mov         al, [esi + ebx]
+        rol         al, cl
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    next:
+        test        al, 1
+        jz          skip1
+        test        al, 2
+        jz          skip2
+        movq        mm0, [edi]
+        psubusb     mm0, mm1
+        movq        [edi], mm0
+        jmp         skip0
+    skip2:
+        movd        mm0, [edi + 4]
+        psubusb     mm0, mm1
+        movd        [edi + 4], mm0
+        jmp         skip0
+    skip1:
+        test        al, 2
+        jz          skip0
+        movd        mm0, [edi]
+        psubusb     mm0, mm1
+        movd        [edi], mm0
+    skip0:
+        add         edi, 8
+        rol         al, 2
+        dec         ecx
+        jnz         next
+    once:
+        test        width, 1
+        jz          end1
+        test        al, 2
+        jz          end0
+        movd        mm0, [edi]
+        psubusb     mm0, mm1
+        movd        [edi], mm0
+    end0:
+        add         edi, 4
+    end1:
+        add         edi, edx
+        dec         height
+        jnz         plot
+        emms
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and blending pixel
+void fillRectPatternAlpha(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t argb, const uint8_t* pattern)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, y
+        mul         texWidth
+        add         eax, x
+        shl         eax, 2
+        add         edi, eax
+        mov         edx, texWidth
+        sub         edx, width
+        shl         edx, 2
+        mov         esi, pattern
+        mov         eax, argb
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+    plot:
+        push        edx
+        mov         ecx, x
+        and         ecx, 7
+        mov         ebx, height
+        and         ebx, 7
+        mov         dl, [esi + ebx]
+        rol         dl, cl
+        mov         ecx, width
+    next:
+        test        dl, 1
+        jz          step
+        movd        mm0, [edi]
+        movd        mm1, argb
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+    step:
+        add         edi, 4
+        rol         dl, 1
+        dec         ecx
+        jnz         next
+        pop         edx
+        add         edi, edx
+        dec         height
+        jnz         plot
+        emms
+    }
+}
+#endif
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectPattern(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern, int32_t mode)
+{
+    //calculate new position
+    const int32_t x1 = x + (width - 1);
+    const int32_t y1 = y + (height - 1);
+
+    //clip image to context boundaries
+    const int32_t lx = max(x, ctx->cminX);
+    const int32_t ly = max(y, ctx->cminY);
+    const int32_t lx1 = min(x1, ctx->cmaxX);
+    const int32_t ly1 = min(y1, ctx->cmaxY);
+
+    //initialize loop variables
+    const int32_t lwidth = (lx1 - lx) + 1;
+    const int32_t lheight = (ly1 - ly) + 1;
+
+    //check for loop
+    if (lwidth <= 0 || lheight <= 0) return;
+    damageRect(ctx, lx, ly, lwidth, lheight);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        fillRectPatternMix(ctx, lx, ly, lwidth, lheight, col, pattern);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        fillRectPatternNormal(ctx, lx, ly, lwidth, lheight, col, pattern);
+        return;
+
+    case BLEND_MODE_ADD:
+        fillRectPatternAdd(ctx, lx, ly, lwidth, lheight, col, pattern);
+        return;
+
+    case BLEND_MODE_SUB:
+        fillRectPatternSub(ctx, lx, ly, lwidth, lheight, col, pattern);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        fillRectPatternAlpha(ctx, lx, ly, lwidth, lheight, col, pattern);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    //lines-by-lines, pattern repeat each 8 lines
+    uint32_t* pixels = (uint32_t*)ctx->drawBuff + (ctx->texWidth * ly + lx);
+    for (int32_t i = 0; i < lheight; i++)
+    {
+        blend->patternSpan(pixels, col, pattern[i & 7], lwidth);
+        pixels += ctx->texWidth;
+    }
+}
+
+//fill rectangle with corners (x1,y1) and (width,height) and color
+void fillRectPattern(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t col, const uint8_t* pattern, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    fillRectPattern(&gfxContext, x, y, width, height, col, pattern, mode);
+}
+
+//get current pattern type
+uint8_t* getPattern(int32_t type)
+{
+    switch (type)
+    {
+    case PATTERN_TYPE_LINE:
+        return ptnLine;
+
+    case PATTERN_TYPE_LITE_SLASH:
+        return ptnLiteSlash;
+
+    case PATTERN_TYPE_SLASH:
+        return ptnSlash;
+
+    case PATTERN_TYPE_BACK_SLASH:
+        return ptnBackSlash;
+
+    case PATTERN_TYPE_LITE_BACK_SLASH:
+        return ptnLiteBackSlash;
+
+    case PATTERN_TYPE_HATCH:
+        return ptnHatch;
+
+    case PATTERN_TYPE_HATCH_X:
+        return ptnHatchX;
+
+    case PATTERN_TYPE_INTER_LEAVE:
+        return ptnInterLeave;
+
+    case PATTERN_TYPE_WIDE_DOT:
+        return ptnWideDot;
+
+    case PATTERN_TYPE_CLOSE_DOT:
+        return ptnCloseDot;
+
+    default:
+        messageBox(GFX_ERROR, "Unknown pattern type:%d", type);
+        return NULL;
+        break;
+    }
+}
+
+//Cohen-Sutherland clipping algorithm
+int32_t getCode(GFX_CONTEXT* ctx, int32_t x, int32_t y)
+{
+    int32_t code = 0;
+    if (y >= ctx->texHeight)	code |= 1; //top
+    else if (y < 0)		code |= 2; //bottom
+    if (x >= ctx->texWidth)	code |= 4; //right
+    else if (x < 0)		code |= 8; //left
+    return code;
+}
+
+//Cohen-Sutherland clipping line (xs,ys)-(xe, ye)
+void clipLine(GFX_CONTEXT* ctx, int32_t* xs, int32_t* ys, int32_t* xe, int32_t* ye)
+{
+    int32_t accept = 0, done = 0;
+    int32_t x1 = *xs, x2 = *xe, y1 = *ys, y2 = *ye;
+
+    //the region out codes for the endpoints
+    int32_t code1 = getCode(ctx, x1, y1);
+    int32_t code2 = getCode(ctx, x2, y2);
+
+    //in theory, this can never end up in an infinite loop, it'll always come in one of the trivial cases eventually
+    do {
+        //accept because both endpoints are in screen or on the border, trivial accept
+        if (!(code1 | code2)) accept = done = 1;
+
+        //the line isn't visible on screen, trivial reject
+        else if (code1 & code2) done = 1;
+
+        //if no trivial reject or accept, continue the loop
+        else
+        {
+            int32_t x = 0, y = 0;
+            const int32_t codeout = code1 ? code1 : code2;
+
+            if (codeout & 1)
+            {
+                //top
+                x = x1 + (x2 - x1) * (ctx->texHeight - y1) / (y2 - y1);
+                y = ctx->texHeight - 1;
+            }
+            else if (codeout & 2)
+            {
+                //bottom
+                x = x1 + (x2 - x1) * -y1 / (y2 - y1);
+                y = 0;
+            }
+            else if (codeout & 4)
+            {
+                //right
+                y = y1 + (y2 - y1) * (ctx->texWidth - x1) / (x2 - x1);
+                x = ctx->texWidth - 1;
+            }
+            else
+            {
+                //left
+                y = y1 + (y2 - y1) * -x1 / (x2 - x1);
+                x = 0;
+            }
+
+            if (codeout == code1)
+            {
+                //first endpoint was clipped
+                x1 = x;
+                y1 = y;
+                code1 = getCode(ctx, x1, y1);
+            }
+            else
+            {
+                //second endpoint was clipped
+                x2 = x;
+                y2 = y;
+                code2 = getCode(ctx, x2, y2);
+            }
+        }
+    } while (!done);
+
+    if (accept)
+    {
+        *xs = x1;
+        *xe = x2;
+        *ys = y1;
+        *ye = y2;
+    }
+    else
+    {
+        *xs = 0;
+        *xe = 0;
+        *ys = 0;
+        *ye = 0;
+    }
+}
+
+//Cohen-Sutherland clipping line (xs,ys)-(xe, ye)
+void clipLine(int32_t* xs, int32_t* ys, int32_t* xe, int32_t* ye)
+{
+    clipLine(&gfxContext, xs, ys, xe, ye);
+}
+
+//Wu's line from (x1,y1) to (x2,y2) with anti-aliased
+void drawLineAA(GFX_CONTEXT* ctx, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t argb)
+{
+    const int32_t dx = abs(x1 - x0);
+    const int32_t sx = x0 < x1 ? 1 : -1;
+    const int32_t dy = abs(y1 - y0);
+    const int32_t sy = y0 < y1 ? 1 : -1;
+    const int32_t ed = ((dx + dy) == 0) ? 1 : int32_t(sqrt(sqr(double(dx)) + sqr(double(dy))));
+
+    int32_t err = dx - dy;
+
+    while (1)
+    {
+        putPixel(ctx, x0, y0, rgba(argb, 255 * abs(err - dx + dy) / ed), BLEND_MODE_ANTIALIASED);
+        const int32_t e2 = err;
+        const int32_t x2 = x0;
+
+        if (2 * e2 >= -dx)
+        {
+            if (x0 == x1) break;
+            if (e2 + dy < ed) putPixel(ctx, x0, y0 + sy, rgba(argb, 255 * (e2 + dy) / ed), BLEND_MODE_ANTIALIASED);
+            err -= dy;
+            x0 += sx;
+        }
+
+        if (2 * e2 <= dy)
+        {
+            if (y0 == y1) break;
+            if (dx - e2 < ed) putPixel(ctx, x2 + sx, y0, rgba(argb, 255 * (dx - e2) / ed), BLEND_MODE_ANTIALIASED);
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+//Bresenham line from (x1,y1) to (x2,y2) with color and mode
+void drawLine(GFX_CONTEXT* ctx, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color, int32_t mode)
+{
+    //alpha mode
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        drawLineAA(ctx, x1, y1, x2, y2, color);
+        return;
+    }
+
+    const int32_t step = abs(y2 - y1) > abs(x2 - x1);
+
+    if (step)
+    {
+        swap(x1, y1);
+        swap(x2, y2);
+    }
+
+    if (x1 > x2)
+    {
+        swap(x1, x2);
+        swap(y1, y2);
+    }
+
+    const int32_t dx = x2 - x1;
+    const int32_t dy = abs(y2 - y1);
+    const int32_t ystep = (y1 < y2) ? 1 : -1;
+
+    int32_t y = y1;
+    int32_t error = dx >> 1;
+
+    for (int32_t x = x1; x <= x2; x++)
+    {
+        putPixel(ctx, step ? y : x, step ? x : y, color, mode);
+        error -= dy;
+        if (error < 0)
+        {
+            y += ystep;
+            error += dx;
+        }
+    }
+}
+
+//Bresenham line from (x1,y1) to (x2,y2) with color and mode
+void drawLine(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawLine(&gfxContext, x1, y1, x2, y2, color, mode);
+}
+
+//plot functors for batched lines
+struct LinePlotMix
+{
+    typedef uint8_t PIXEL;
+    uint8_t color;
+    must_inline void operator()(uint8_t* dst) const { *dst = color; }
+};
+
+struct LinePlotNormal
+{
+    typedef uint32_t PIXEL;
+    uint32_t color;
+    must_inline void operator()(uint32_t* dst) const { *dst = color; }
+};
+
+struct LinePlotBlend
+{
+    typedef uint32_t PIXEL;
+    uint32_t color;
+    uint32_t (*blendPixel)(uint32_t dst, uint32_t color);
+    must_inline void operator()(uint32_t* dst) const { *dst = blendPixel(*dst, color); }
+};
+
+//Bresenham steps of a line going up on major axis from (a, b), da >= |db| > 0, same pixels as drawLine
+//amove, bmove are buffer steps of major and minor axis, range is view port (amin, amax, bmin, bmax)
+//crossing lines skip the steps outside range, so no pixel is tested in the inner loop
+template<typename PLOT>
+static void plotLineSteps(const PLOT& plot, typename PLOT::PIXEL* pixels, int32_t a, int32_t b, const int32_t da, const int32_t db, const intptr_t amove, intptr_t bmove, const int32_t clip, const int32_t* range)
+{
+    const int32_t bstep = (db < 0) ? -1 : 1;
+    const int32_t dm = abs(db);
+
+    int32_t error = da >> 1;
+    int32_t first = 0, last = da;
+
+    if (clip)
+    {
+        //major range
+        first = max(range[0] - a, 0);
+        last = min(range[1] - a, da);
+
+        //minor range as count of minor steps, step k has ceil((k * dm - error) / da) minor steps
+        const int32_t mlo = max((bstep > 0) ? range[2] - b : b - range[3], 0);
+        const int32_t mhi = (bstep > 0) ? range[3] - b : b - range[2];
+        if (mhi < mlo) return;
+        if (mlo > 0) first = max(first, int32_t((error + int64_t(mlo - 1) * da) / dm + 1));
+        last = min(last, int32_t((error + int64_t(mhi) * da) / dm));
+        if (first > last) return;
+
+        //move Bresenham state to first visible step
+        const int32_t m = int32_t((int64_t(first) * dm - error + da - 1) / da);
+        error = int32_t(error + int64_t(m) * da - int64_t(first) * dm);
+        a += first;
+        b += m * bstep;
+    }
+
+    typename PLOT::PIXEL* dst = pixels + (amove * a + bmove * b);
+    bmove *= bstep;
+
+    for (int32_t k = first; k <= last; k++)
+    {
+        plot(dst);
+        dst += amove;
+        error -= dm;
+        if (error < 0)
+        {
+            dst += bmove;
+            error += da;
+        }
+    }
+}
+
+//plot sloped lines of one class, major is 0 for x-major lines (|dx| >= |dy|) and 1 for y-major lines
+template<typename PLOT>
+static void plotLines(const GFX_CONTEXT* ctx, const PLOT& plot, const int32_t* segs, const int32_t* list, const uint8_t* codes, const int32_t count, const int32_t major)
+{
+    typename PLOT::PIXEL* pixels = (typename PLOT::PIXEL*)ctx->drawBuff;
+    const intptr_t pitch = ctx->texWidth;
+
+    if (!major)
+    {
+        const int32_t range[4] = { ctx->cminX, ctx->cmaxX, ctx->cminY, ctx->cmaxY };
+        for (int32_t i = 0; i < count; i++)
+        {
+            const int32_t* seg = &segs[list[i] << 2];
+            const int32_t j = (seg[0] > seg[2]) ? 2 : 0;
+            plotLineSteps(plot, pixels, seg[j], seg[j + 1], abs(seg[2] - seg[0]), seg[3 - j] - seg[j + 1], 1, pitch, codes[list[i]], range);
+        }
+    }
+    else
+    {
+        const int32_t range[4] = { ctx->cminY, ctx->cmaxY, ctx->cminX, ctx->cmaxX };
+        for (int32_t i = 0; i < count; i++)
+        {
+            const int32_t* seg = &segs[list[i] << 2];
+            const int32_t j = (seg[1] > seg[3]) ? 2 : 0;
+            plotLineSteps(plot, pixels, seg[j + 1], seg[j], abs(seg[3] - seg[1]), seg[2 - j] - seg[j], pitch, 1, codes[list[i]], range);
+        }
+    }
+}
+
+//out codes of 4 segments from x1, y1, x2, y2 vectors (struct of arrays), codes are 0, 1 or 2 in each 32 bits lane
+static must_inline __m128i clipLanesSSE2(const __m128i x1, const __m128i y1, const __m128i x2, const __m128i y2, const __m128i minx, const __m128i miny, const __m128i maxx, const __m128i maxy)
+{
+    const __m128i bx1 = _mm_cmpgt_epi32(minx, x1), ax1 = _mm_cmpgt_epi32(x1, maxx);
+    const __m128i by1 = _mm_cmpgt_epi32(miny, y1), ay1 = _mm_cmpgt_epi32(y1, maxy);
+    const __m128i bx2 = _mm_cmpgt_epi32(minx, x2), ax2 = _mm_cmpgt_epi32(x2, maxx);
+    const __m128i by2 = _mm_cmpgt_epi32(miny, y2), ay2 = _mm_cmpgt_epi32(y2, maxy);
+
+    //crossing when any end point is out, outside when both end points are on the same side (masks are -1)
+    const __m128i any = _mm_or_si128(_mm_or_si128(_mm_or_si128(bx1, ax1), _mm_or_si128(by1, ay1)), _mm_or_si128(_mm_or_si128(bx2, ax2), _mm_or_si128(by2, ay2)));
+    const __m128i out = _mm_or_si128(_mm_or_si128(_mm_and_si128(bx1, bx2), _mm_and_si128(ax1, ax2)), _mm_or_si128(_mm_and_si128(by1, by2), _mm_and_si128(ay1, ay2)));
+    return _mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(any, out));
+}
+
+//out codes of segments from i to n (SSE2 version, 4 segments per loop), return number of compared segments
+//4 segments are transposed to x1, y1, x2, y2 vectors, so each compare classify 4 segments
+static int32_t clipLineCodesSSE2(const GFX_CONTEXT* ctx, const int32_t* segs, int32_t i, int32_t n, uint8_t* codes)
+{
+    const __m128i minx = _mm_set1_epi32(ctx->cminX);
+    const __m128i miny = _mm_set1_epi32(ctx->cminY);
+    const __m128i maxx = _mm_set1_epi32(ctx->cmaxX);
+    const __m128i maxy = _mm_set1_epi32(ctx->cmaxY);
+
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i* seg = (const __m128i*)&segs[i << 2];
+        const __m128i s0 = _mm_loadu_si128(&seg[0]);
+        const __m128i s1 = _mm_loadu_si128(&seg[1]);
+        const __m128i s2 = _mm_loadu_si128(&seg[2]);
+        const __m128i s3 = _mm_loadu_si128(&seg[3]);
+
+        //transpose segments to struct of arrays
+        const __m128i t0 = _mm_unpacklo_epi32(s0, s1);
+        const __m128i t1 = _mm_unpacklo_epi32(s2, s3);
+        const __m128i t2 = _mm_unpackhi_epi32(s0, s1);
+        const __m128i t3 = _mm_unpackhi_epi32(s2, s3);
+        const __m128i code = clipLanesSSE2(_mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1), _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3), minx, miny, maxx, maxy);
+
+        const __m128i words = _mm_packs_epi32(code, code);
+        const int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+        memcpy(&codes[i], &bytes, 4);
+    }
+    return i;
+}
+
+//out codes of 8 segments from x1, y1, x2, y2 vectors (AVX2 version of clipLanesSSE2)
+static must_inline target_avx2 __m256i clipLanesAVX2(const __m256i x1, const __m256i y1, const __m256i x2, const __m256i y2, const __m256i minx, const __m256i miny, const __m256i maxx, const __m256i maxy)
+{
+    const __m256i bx1 = _mm256_cmpgt_epi32(minx, x1), ax1 = _mm256_cmpgt_epi32(x1, maxx);
+    const __m256i by1 = _mm256_cmpgt_epi32(miny, y1), ay1 = _mm256_cmpgt_epi32(y1, maxy);
+    const __m256i bx2 = _mm256_cmpgt_epi32(minx, x2), ax2 = _mm256_cmpgt_epi32(x2, maxx);
+    const __m256i by2 = _mm256_cmpgt_epi32(miny, y2), ay2 = _mm256_cmpgt_epi32(y2, maxy);
+    const __m256i any = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(bx1, ax1), _mm256_or_si256(by1, ay1)), _mm256_or_si256(_mm256_or_si256(bx2, ax2), _mm256_or_si256(by2, ay2)));
+    const __m256i out = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(bx1, bx2), _mm256_and_si256(ax1, ax2)), _mm256_or_si256(_mm256_and_si256(by1, by2), _mm256_and_si256(ay1, ay2)));
+    return _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_add_epi32(any, out));
+}
+
+//out codes of segments (AVX2 version, 8 segments per loop), return number of compared segments
+//each 128 bits lane holds 4 segments transposed the same as SSE2 version (even segments in low lane, odd in high lane)
+static target_avx2 int32_t clipLineCodesAVX2(const GFX_CONTEXT* ctx, const int32_t* segs, int32_t n, uint8_t* codes)
+{
+    int32_t i = 0;
+    const __m256i minx = _mm256_set1_epi32(ctx->cminX);
+    const __m256i miny = _mm256_set1_epi32(ctx->cminY);
+    const __m256i maxx = _mm256_set1_epi32(ctx->cmaxX);
+    const __m256i maxy = _mm256_set1_epi32(ctx->cmaxY);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256i* seg = (const __m256i*)&segs[i << 2];
+        const __m256i s0 = _mm256_loadu_si256(&seg[0]);
+        const __m256i s1 = _mm256_loadu_si256(&seg[1]);
+        const __m256i s2 = _mm256_loadu_si256(&seg[2]);
+        const __m256i s3 = _mm256_loadu_si256(&seg[3]);
+
+        //transpose segments to struct of arrays in each lane
+        const __m256i t0 = _mm256_unpacklo_epi32(s0, s1);
+        const __m256i t1 = _mm256_unpacklo_epi32(s2, s3);
+        const __m256i t2 = _mm256_unpackhi_epi32(s0, s1);
+        const __m256i t3 = _mm256_unpackhi_epi32(s2, s3);
+        const __m256i lanes = clipLanesAVX2(_mm256_unpacklo_epi64(t0, t1), _mm256_unpackhi_epi64(t0, t1), _mm256_unpacklo_epi64(t2, t3), _mm256_unpackhi_epi64(t2, t3), minx, miny, maxx, maxy);
+
+        //restore segment order and pack codes to bytes
+        const __m256i code = _mm256_permutevar8x32_epi32(lanes, order);
+        const __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(code), _mm256_extracti128_si256(code, 1));
+        _mm_storel_epi64((__m128i*)&codes[i], _mm_packus_epi16(words, words));
+    }
+    return i;
+}
+
+//out codes of a batch of segments (at most LINE_BATCH): 0 inside view port, 1 crossing border, 2 outside
+//bit 0-3 of the mask mark x1, y1, x2, y2 less than view port, bit 4-7 mark them greater than view port
+//segment is outside when both end points are on the same side (mask & (mask >> 2) & 0x33)
+static void clipLineCodes(const GFX_CONTEXT* ctx, const int32_t* segs, int32_t n, uint8_t* codes)
+{
+    int32_t i = 0;
+
+    //compare 8 or 4 segments at once, remainder of AVX2 goes to SSE2 then scalar code
+    if (kernelLevel >= KERNEL_LEVEL_AVX2) i = clipLineCodesAVX2(ctx, segs, n, codes);
+    if (kernelLevel >= KERNEL_LEVEL_SSE2) i = clipLineCodesSSE2(ctx, segs, i, n, codes);
+
+    //remainder segments
+    for (; i < n; i++)
+    {
+        const int32_t* seg = &segs[i << 2];
+        int32_t mask = 0;
+        for (int32_t j = 0; j < 4; j++)
+        {
+            const int32_t lo = (j & 1) ? ctx->cminY : ctx->cminX;
+            const int32_t hi = (j & 1) ? ctx->cmaxY : ctx->cmaxX;
+            if (seg[j] < lo) mask |= 1 << j;
+            if (seg[j] > hi) mask |= 16 << j;
+        }
+        codes[i] = !mask ? 0 : (mask & (mask >> 2) & 0x33) ? 2 : 1;
+    }
+}
+
+//draw n segments (x1, y1, x2, y2 in segs[4 * i]) with color and mode, same pixels as drawLine
+//segments are clipped per batch with SIMD out codes, sorted to horizontal, vertical, x-major and y-major classes
+//then each class runs its own inner loop writing straight to the buffer
+void drawLines(GFX_CONTEXT* ctx, const int32_t* segs, int32_t n, uint32_t col, int32_t mode)
+{
+    //blend mode kernels (8 bits mode just plot colors)
+    const GFX_BLEND_KERNELS* blend = NULL;
+    if (ctx->bitsPerPixel != 8 && mode != BLEND_MODE_ANTIALIASED)
+    {
+        blend = getBlendKernels(mode);
+        if (!blend)
+        {
+            messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+            return;
+        }
+    }
+
+    uint8_t codes[LINE_BATCH] = { 0 };
+    int32_t lists[4][LINE_BATCH] = { 0 };
+    int32_t box[4] = { INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN };
+
+    for (int32_t i = 0; i < n; i += LINE_BATCH)
+    {
+        const int32_t* batch = &segs[intptr_t(i) << 2];
+        const int32_t count = min(n - i, LINE_BATCH);
+        clipLineCodes(ctx, batch, count, codes);
+
+        //sort visible segments to classes: 0 = horizontal, 1 = vertical, 2 = x-major, 3 = y-major
+        int32_t counts[4] = { 0 };
+        for (int32_t j = 0; j < count; j++)
+        {
+            if (codes[j] == 2) continue;
+
+            const int32_t* seg = &batch[j << 2];
+            const int32_t dx = abs(seg[2] - seg[0]);
+            const int32_t dy = abs(seg[3] - seg[1]);
+            const int32_t type = !dy ? 0 : !dx ? 1 : (dx >= dy) ? 2 : 3;
+            lists[type][counts[type]++] = j;
+
+            box[0] = min(box[0], max(min(seg[0], seg[2]), ctx->cminX));
+            box[1] = min(box[1], max(min(seg[1], seg[3]), ctx->cminY));
+            box[2] = max(box[2], min(max(seg[0], seg[2]), ctx->cmaxX));
+            box[3] = max(box[3], min(max(seg[1], seg[3]), ctx->cmaxY));
+        }
+
+        //anti-aliased lines have no inner loop, only rejected segments are skipped
+        if (mode == BLEND_MODE_ANTIALIASED && ctx->bitsPerPixel != 8)
+        {
+            for (int32_t type = 0; type < 4; type++)
+            {
+                for (int32_t j = 0; j < counts[type]; j++)
+                {
+                    const int32_t* seg = &batch[lists[type][j] << 2];
+                    drawLineAA(ctx, seg[0], seg[1], seg[2], seg[3], col);
+                }
+            }
+            continue;
+        }
+
+        //horizontal segments
+        for (int32_t j = 0; j < counts[0]; j++)
+        {
+            const int32_t* seg = &batch[lists[0][j] << 2];
+            const int32_t y = seg[1];
+            const int32_t x1 = max(min(seg[0], seg[2]), ctx->cminX);
+            const int32_t x2 = min(max(seg[0], seg[2]), ctx->cmaxX);
+            if (y < ctx->cminY || y > ctx->cmaxY || x1 > x2) continue;
+
+            const intptr_t offset = intptr_t(ctx->texWidth) * y + x1;
+            if (ctx->bitsPerPixel == 8) fillSpanMix((uint8_t*)ctx->drawBuff + offset, uint8_t(col), x2 - x1 + 1);
+            else blend->colorSpan((uint32_t*)ctx->drawBuff + offset, col, x2 - x1 + 1);
+        }
+
+        //vertical segments
+        for (int32_t j = 0; j < counts[1]; j++)
+        {
+            const int32_t* seg = &batch[lists[1][j] << 2];
+            const int32_t x = seg[0];
+            const int32_t y1 = max(min(seg[1], seg[3]), ctx->cminY);
+            const int32_t y2 = min(max(seg[1], seg[3]), ctx->cmaxY);
+            if (x < ctx->cminX || x > ctx->cmaxX || y1 > y2) continue;
+
+            const intptr_t offset = intptr_t(ctx->texWidth) * y1 + x;
+            if (ctx->bitsPerPixel == 8)
+            {
+                uint8_t* dst = (uint8_t*)ctx->drawBuff + offset;
+                for (int32_t y = y1; y <= y2; y++, dst += ctx->texWidth) *dst = uint8_t(col);
+            }
+            else blend->columnSpan((uint32_t*)ctx->drawBuff + offset, ctx->texWidth, col, y2 - y1 + 1);
+        }
+
+        //sloped segments
+        for (int32_t major = 0; major < 2; major++)
+        {
+            const int32_t* list = lists[major + 2];
+            const int32_t num = counts[major + 2];
+            if (!num) continue;
+
+            if (ctx->bitsPerPixel == 8)
+            {
+                const LinePlotMix plot = { uint8_t(col) };
+                plotLines(ctx, plot, batch, list, codes, num, major);
+            }
+            else if (mode == BLEND_MODE_NORMAL)
+            {
+                const LinePlotNormal plot = { col };
+                plotLines(ctx, plot, batch, list, codes, num, major);
+            }
+            else
+            {
+                const LinePlotBlend plot = { col, blend->blendPixel };
+                plotLines(ctx, plot, batch, list, codes, num, major);
+            }
+        }
+    }
+
+    if (box[0] <= box[2] && box[1] <= box[3]) damageRect(ctx, box[0], box[1], box[2] - box[0] + 1, box[3] - box[1] + 1);
+}
+
+//draw n segments (x1, y1, x2, y2 in segs[4 * i]) with color and mode
+void drawLines(const int32_t* segs, int32_t n, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawLines(&gfxContext, segs, n, col, mode);
+}
+
+//Bresenham diagonal line from(x1, y1) to (x2, y2) with added background color
+void drawLineBob(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    //this function only support mixed mode
+    if (gfxContext.bitsPerPixel != 8) return;
+
+    //range check
+    if (x1 < 0 || x1 > gfxContext.cmaxX || x2 < 0 || x2 > gfxContext.cmaxX || y1 < 0 || y1 > gfxContext.cmaxY || y2 < 0 || y2 > gfxContext.cmaxY) return;
+
+#ifdef _USE_ASM    
+    int32_t dst = 0, sc = 0, dc = 0;
+    int32_t adddx = 0, adddy = 0;
+    int32_t addsx = 0, addsy = 0;
+    void* plotpixel = putPixelBob;
+
+    __asm {
+        mov     ecx, 1
+        mov     edx, 1
+        mov     edi, y2
+        sub     edi, y1
+        jge     keepy
+        neg     edx
+        neg     edi
+    keepy:
+        mov     adddy, edx
+        mov     esi, x2
+        sub     esi, x1
+        jge     keepx
+        neg     ecx
+        neg     esi
+    keepx:
+        mov     adddx, ecx
+        cmp     esi, edi
+        jge     horiz
+        xor     ecx, ecx
+        xchg    esi, edi
+        jmp     saves
+    horiz:
+        xor     edx, edx
+    saves:
+        mov     dst, edi
+        mov     addsx, ecx
+        mov     addsy, edx
+        mov     eax, dst
+        shl     eax, 1
+        mov     sc, eax
+        sub     eax, esi
+        mov     ebx, eax
+        sub     eax, esi
+        mov     dc, eax
+        mov     ecx, x1
+        mov     edx, y1
+    again:
+        dec     esi
+        jz      done
+        push    edx
+        push    ecx
+        call    plotpixel
+        pop     ecx
+        pop     edx
+        cmp     ebx, 0
+        jge     dline
+        add     ecx, addsx
+        add     edx, addsy
+        add     ebx, sc
+        jmp     again
+    dline:
+        add     ecx, adddx
+        add     edx, adddy
+        add     ebx, dc
+        jmp     again
+    done:
+    }
+#else
+    const int32_t dx = abs(x2 - x1);
+    const int32_t dy = abs(y2 - y1);
+
+    int32_t x = x1;
+    int32_t y = y1;
+    int32_t addx1 = 0, addx2 = 0;
+    int32_t addy1 = 0, addy2 = 0;
+    int32_t numpixels = 0, curpixel = 0;
+    int32_t den = 0, num = 0, numadd = 0;
+
+    if (x2 >= x1)
+    {
+        addx1 = 1;
+        addx2 = 1;
+    }
+    else
+    {
+        addx1 = -1;
+        addx2 = -1;
+    }
+
+    if (y2 >= y1)
+    {
+        addy1 = 1;
+        addy2 = 1;
+    }
+    else
+    {
+        addy1 = -1;
+        addy2 = -1;
+    }
+
+    if (dx >= dy)
+    {
+        addx1 = 0;
+        addy2 = 0;
+        den = dx;
+        num = dx >> 1;
+        numadd = dy;
+        numpixels = dx;
+    }
+    else
+    {
+        addx2 = 0;
+        addy1 = 0;
+        den = dy;
+        num = dy >> 1;
+        numadd = dx;
+        numpixels = dy;
+    }
+
+    for (curpixel = 0; curpixel < numpixels; curpixel++)
+    {
+        putPixelBob(x, y);
+        num += numadd;
+        if (num >= den)
+        {
+            num -= den;
+            x += addx1;
+            y += addy1;
+        }
+        x += addx2;
+        y += addy2;
+    }
+#endif
+}
+
+//pre-calculate lookup table for filled-circle
+void calcCircle(int32_t rd, int32_t* points)
+{
+    //validate radius
+    if (rd <= 0) return;
+
+#ifdef _USE_ASM
+    __asm {
+        mov     ebx, 1
+        sub     ebx, rd
+        mov     edi, points
+        mov     esi, edi
+        mov     eax, rd
+        shl     eax, 2
+        add     esi, eax
+        mov     eax, rd
+        xor     ecx, ecx
+    start:
+        or      ebx, ebx
+        jns     next
+        mov     edx, ecx
+        shl     edx, 1
+        add     edx, 3
+        add     ebx, edx
+        inc     ecx
+        sub     esi, 4
+        jmp     stop
+    next:
+        mov     edx, ecx
+        sub     edx, eax
+        shl     edx, 1
+        add     edx, 3
+        add     ebx, edx
+        inc     ecx
+        dec     eax
+        sub     esi, 4
+        add     edi, 4
+    stop:
+        mov     [edi], ecx
+        mov     [esi], eax
+        cmp     eax, ecx
+        jg      start
+    }
+#else
+    int32_t eax = rd;
+    int32_t ebx = 1 - rd;
+    int32_t edi = 0, esi = rd;
+    int32_t ecx = 0, edx = 0;
+
+    while (ecx < eax)
+    {
+        if (ebx < 0)
+        {
+            edx = (ecx++ << 1) + 3;
+            ebx += edx;
+            esi--;
+        }
+        else
+        {
+            edx = ((ecx++ - eax--) << 1) + 3;
+            ebx += edx;
+            esi--;
+            edi++;
+        }
+        points[edi] = ecx;
+        points[esi] = eax;
+    }
+#endif
+}
+
+//pre-calculate lookup table for filled-ellipse
+void calcEllipse(int32_t rx, int32_t ry, int32_t* points)
+{
+    int32_t ra = 0, aa = 0, bb = 0;
+    int32_t xa = 0, mx = 0, my = 0;
+    int32_t aq = 0, bq = 0, xd = 0, yd = 0;
+
+    //validate radius
+    if (rx <= 0 || ry <= 0) return;
+
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, rx
+        mov     xa, eax
+        neg     eax
+        mov     mx, eax
+        xor     edx, edx
+        mov     eax, rx
+        mul     eax
+        mov     aq, eax
+        shl     eax, 1
+        mov     xd, eax
+        mov     eax, ry
+        mul     eax
+        mov     bq, eax
+        shl     eax, 1
+        mov     yd, eax
+        mov     eax, rx
+        mul     bq
+        mov     ra, eax
+        shl     eax, 1
+        mov     aa, eax
+    next:
+        cmp     ra, 0
+        jle     skip
+        inc     my
+        mov     eax, bb
+        add     eax, xd
+        mov     bb, eax
+        sub     ra, eax
+    skip:
+        cmp     ra, 0
+        jg      done
+        dec     xa
+        inc     mx
+        mov     eax, aa
+        sub     eax, yd
+        mov     aa, eax
+        add     ra, eax
+    done:
+        mov     edi, points
+        mov     ebx, ry
+        sub     ebx, my
+        shl     ebx, 2
+        add     edi, ebx
+        mov     eax, mx
+        neg     eax
+        stosd
+        cmp     xa, 0
+        jg      next
+    }
+#else
+    xa = rx;
+    mx = -rx;
+    aq = rx * rx;
+    xd = aq << 1;
+
+    bq = ry * ry;
+    yd = bq << 1;
+    ra = bq * rx;
+    aa = ra << 1;
+
+    while (xa > 0)
+    {
+        if (ra > 0)
+        {
+            my++;
+            ra -= (bb + xd);
+            bb += xd;
+        }
+        if (ra <= 0)
+        {
+            xa--;
+            mx++;
+            ra += (aa - yd);
+            aa -= yd;
+        }
+        points[ry - my] = -mx;
+    }
+#endif
+}
+
+//Wu's circle with anti-aliased
+void drawCircleAA(GFX_CONTEXT* ctx, int32_t xm, int32_t ym, int32_t rad, uint32_t argb)
+{
+    int32_t y = 0;
+    int32_t x = -rad;
+    int32_t err = (1 - rad) << 1;
+
+    if (rad <= 0) return;
+
+    rad = 1 - err;
+
+    do {
+        int32_t alpha = 255 * abs(err - 2 * (x + y) - 2) / rad;
+        uint32_t col = rgba(argb, alpha);
+        putPixel(ctx, xm - x, ym + y, col, BLEND_MODE_ANTIALIASED);
+        putPixel(ctx, xm - y, ym - x, col, BLEND_MODE_ANTIALIASED);
+        putPixel(ctx, xm + x, ym - y, col, BLEND_MODE_ANTIALIASED);
+        putPixel(ctx, xm + y, ym + x, col, BLEND_MODE_ANTIALIASED);
+
+        const int32_t x2 = x;
+        const int32_t e2 = err;
+        
+        if (err + y > 0)
+        {
+            alpha = 255 * (err - 2 * x - 1) / rad;
+            if (alpha < 256)
+            {
+                col = rgba(argb, alpha);
+                putPixel(ctx, xm - x, ym + y + 1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, xm - y - 1, ym - x, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, xm + x, ym - y - 1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, xm + y + 1, ym + x, col, BLEND_MODE_ANTIALIASED);
+            }
+
+            err += ++x * 2 + 1;
+        }
+
+        if (e2 + x2 <= 0)
+        {
+            alpha = 255 * (2 * y + 3 - e2) / rad;
+            if (alpha < 256)
+            {
+                col = rgba(argb, alpha);
+                putPixel(ctx, xm - x2 - 1, ym + y, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, xm - y, ym - x2 - 1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, xm + x2 + 1, ym - y, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, xm + y, ym + x2 + 1, col, BLEND_MODE_ANTIALIASED);
+            }
+            err += ++y * 2 + 1;
+        }
+    } while (x < 0);
+}
+
+//Bresenham circle at (xc,yc) with radius and color
+void drawCircle(GFX_CONTEXT* ctx, int32_t xc, int32_t yc, int32_t rad, uint32_t color, int32_t mode)
+{
+    //range checking
+    if (rad <= 0) return;
+
+    //alpha mode
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        drawCircleAA(ctx, xc, yc, rad, color);
+        return;
+    }
+
+    int32_t x = 0, y = rad;
+    int32_t p = 1 - rad;
+
+    while (x <= y)
+    {
+        putPixel(ctx, xc + x, yc + y, color, mode);
+        putPixel(ctx, xc - x, yc + y, color, mode);
+        putPixel(ctx, xc + x, yc - y, color, mode);
+        putPixel(ctx, xc - x, yc - y, color, mode);
+        putPixel(ctx, xc + y, yc + x, color, mode);
+        putPixel(ctx, xc - y, yc + x, color, mode);
+        putPixel(ctx, xc + y, yc - x, color, mode);
+        putPixel(ctx, xc - y, yc - x, color, mode);
+        if (p < 0) p += (x++ << 1) + 3;
+        else p += ((x++ - y--) << 1) + 5;
+    }
+}
+
+//Bresenham circle at (xc,yc) with radius and color
+void drawCircle(int32_t xc, int32_t yc, int32_t rad, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawCircle(&gfxContext, xc, yc, rad, color, mode);
+}
+
+//Wu's ellipse with anti-aliased
+void drawEllipseAA(GFX_CONTEXT* ctx, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t argb)
+{
+    int32_t f = 0;
+    uint32_t col = 0;
+    double alpha = 0;
+
+    //only 32bit support alpha-blend mode
+    if (ctx->bitsPerPixel <= 8) return;
+    if (x0 <= 0 || y0 <= 0 || x1 <= 0 || y1 <= 0) return;
+
+    int32_t a = abs(x1 - x0);
+    const int32_t b = abs(y1 - y0);
+    
+    //check for line
+    if (a <= 0 || b <= 0) return;
+
+    int32_t b1 = b & 1;
+    double dx = 4.0 * (a - 1.0) * b * b;
+    double dy = 4.0 * (b1 + 1.0) * a * a;
+    double err = double(b1) * a * a - dx + dy;
+
+    if (x0 > x1)
+    {
+        x0 = x1;
+        x1 += a;
+    }
+
+    if (y0 > y1) y0 = y1;
+
+    y0 += ((b + 1) >> 1);
+    y1 = y0 - b1;
+    a = 8 * a * a;
+    b1 = 8 * b * b;
+
+    while (1)
+    {
+        double ed = max(dx, dy);
+        alpha = min(dx, dy);
+
+        if (y0 == y1 + 1 && err > dy && a > b1) ed = 255.0 * 4 / a;
+        else ed = 255 / (ed + 2 * ed * alpha * alpha / (4 * ed * ed + alpha * alpha));
+
+        alpha = ed * fabs(err + dx - dy);
+        col = rgba(argb, uint8_t(alpha));
+        putPixel(ctx, x0, y0, col, BLEND_MODE_ANTIALIASED);
+        putPixel(ctx, x0, y1, col, BLEND_MODE_ANTIALIASED);
+        putPixel(ctx, x1, y0, col, BLEND_MODE_ANTIALIASED);
+        putPixel(ctx, x1, y1, col, BLEND_MODE_ANTIALIASED);
+
+        if ((f = (2 * err + dy) >= 0))
+        {
+            if (x0 >= x1) break;
+            alpha = ed * (err + dx);
+            if (alpha < 255)
+            {
+                col = rgba(argb, uint8_t(alpha));
+                putPixel(ctx, x0, y0 + 1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, x0, y1 - 1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, x1, y0 + 1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, x1, y1 - 1, col, BLEND_MODE_ANTIALIASED);
+            }
+        }
+
+        if (2 * err <= dx)
+        {
+            alpha = ed * (dy - err);
+            if (alpha < 255)
+            {
+                col = rgba(argb, uint8_t(alpha));
+                putPixel(ctx, x0 + 1, y0, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, x1 - 1, y0, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, x0 + 1, y1, col, BLEND_MODE_ANTIALIASED);
+                putPixel(ctx, x1 - 1, y1, col, BLEND_MODE_ANTIALIASED);
+            }
+
+            y0++;
+            y1--;
+            err += dy += a;
+        }
+
+        if (f)
+        {
+            x0++;
+            x1--;
+            err -= dx -= b1;
+        }
+    }
+
+    if (--x0 == x1++)
+    {
+        while (y0 - y1 < b)
+        {
+            alpha = 255.0 * 4 * fabs(err + dx) / b1;
+            col = rgba(argb, uint8_t(alpha));
+            putPixel(ctx, x0, ++y0, col, BLEND_MODE_ANTIALIASED);
+            putPixel(ctx, x1, y0, col, BLEND_MODE_ANTIALIASED);
+            putPixel(ctx, x0, --y1, col, BLEND_MODE_ANTIALIASED);
+            putPixel(ctx, x1, y1, col, BLEND_MODE_ANTIALIASED);
+            err += dy += a;
+        }
+    }
+}
+
+//Bresenham drawing an ellipses with sub color
+void drawEllipse(GFX_CONTEXT* ctx, int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t color, int32_t mode)
+{
+    //range checking
+    if (ra <= 0 || rb <= 0) return;
+
+    //alpha mode?
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        drawEllipseAA(ctx, xc, yc, ra, rb, color);
+        return;
+    }
+
+    int32_t mx1 = xc - ra;
+    int32_t mx2 = xc + ra;
+    int32_t my1 = yc;
+    int32_t my2 = yc;
+
+    putPixel(ctx, mx2, yc, color, mode);
+    putPixel(ctx, mx1, yc, color, mode);
+
+    const int32_t aq = ra * ra;
+    const int32_t bq = rb * rb;
+    const int32_t dx = aq << 1;
+    const int32_t dy = bq << 1;
+
+    int32_t rd = ra * bq;
+    int32_t rx = rd << 1;
+    int32_t ry = 0;
+    int32_t ax = ra;
+
+    while (ax > 0)
+    {
+        if (rd > 0)
+        {
+            my1++;
+            my2--;
+            ry += dx;
+            rd -= ry;
+        }
+
+        if (rd <= 0)
+        {
+            ax--;
+            mx1++;
+            mx2--;
+            rx -= dy;
+            rd += rx;
+        }
+
+        putPixel(ctx, mx1, my1, color, mode);
+        putPixel(ctx, mx1, my2, color, mode);
+        putPixel(ctx, mx2, my1, color, mode);
+        putPixel(ctx, mx2, my2, color, mode);
+    }
+}
+
+//Bresenham drawing an ellipses with sub color
+void drawEllipse(int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawEllipse(&gfxContext, xc, yc, ra, rb, color, mode);
+}
+
+//rectangle with corners (x1,y1) and (width,height) and color
+void drawRect(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color, int32_t mode)
+{
+    horizLine(ctx, x, y, width, color, mode);
+    vertLine(ctx, x, y, height, color, mode);
+    horizLine(ctx, x, y + height - 1, width, color, mode);
+    vertLine(ctx, x + width - 1, y, height, color, mode);
+}
+
+//rectangle with corners (x1,y1) and (width,height) and color
+void drawRect(int32_t x, int32_t y, int32_t width, int32_t height, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawRect(&gfxContext, x, y, width, height, color, mode);
+}
+
+//draw rectangle with rounded border and color
+void drawRoundRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t rad, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    int32_t i = 0, j = 0;
+    int32_t points[500] = { 0 };
+
+    const int32_t x1 = x + width - 1;
+    const int32_t y1 = y + height - 1;
+    const int32_t mid = height >> 1;
+
+    if (rad >= mid - 1) rad = mid - 1;
+
+    calcCircle(rad, points);
+
+    horizLine(x + rad - points[0], y + 1, width - ((rad - points[0]) << 1), col, mode);
+    vertLine(x, y + rad, height - (rad << 1), col, mode);
+    horizLine(x + rad - points[0], y1 - 1, width - ((rad - points[0]) << 1), col, mode);
+    vertLine(x1, y + rad, height - (rad << 1), col, mode);
+
+    for (i = 1; i <= rad; i++)
+    {
+        for (j = rad - points[i]; j <= rad - points[i - 1]; j++)
+        {
+            putPixel(x + j, y + i, col, mode);
+            putPixel(x1 - j, y + i, col, mode);
+        }
+    }
+
+    for (i = 1; i <= rad; i++)
+    {
+        for (j = rad - points[i]; j <= rad - points[i - 1]; j++)
+        {
+            putPixel(x + j, y1 - i, col, mode);
+            putPixel(x1 - j, y1 - i, col, mode);
+        }
+    }
+}
+
+//draw boxed with color
+void drawBox(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    const int32_t x1 = x + width - 1;
+    const int32_t y1 = y + height - 1;
+    const int32_t x0 = x + dx;
+    const int32_t y0 = y - dy;
+    const int32_t x2 = x1 + dx;
+    const int32_t y2 = y1 - dy;
+
+    drawRect(x, y, width, height, col, mode);
+    drawRect(x0, y0, width, height, col, mode);
+    drawLine(x, y, x0, y0, col, mode);
+    drawLine(x1, y, x2, y0, col, mode);
+    drawLine(x1, y1, x2, y2, col, mode);
+    drawLine(x, y1, x0, y2, col, mode);
+}
+
+//draw anti-aliased line with width
+void drawLineWidthAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, double wd, uint32_t col)
+{
+    const int32_t dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+    const int32_t dy = abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+    int32_t err = dx - dy, e2 = 0, x2 = 0, y2 = 0;
+
+    const double ed = (dx + dy == 0) ? 1 : sqrt(sqr(double(dx)) + sqr(double(dy)));
+
+    wd = (wd + 1) / 2;
+
+    while (true)
+    {
+        putPixel(x0, y0, rgba(col, uint8_t(max(0, 255 * (abs(err - dx + dy) / ed - wd + 1)))), BLEND_MODE_ALPHA);
+
+        e2 = err;
+        x2 = x0;
+
+        if (2 * e2 >= -dx)
+        {
+            for (e2 += dy, y2 = y0; e2 < ed * wd && (y1 != y2 || dx > dy); e2 += dx) putPixel(x0, y2 += sy, rgba(col, uint8_t(max(0, 255 * (abs(e2) / ed - wd + 1)))), BLEND_MODE_ALPHA);
+            if (x0 == x1) break;
+            e2 = err;
+            err -= dy;
+            x0 += sx;
+        }
+
+        if (2 * e2 <= dy)
+        {
+            for (e2 = dx - e2; e2 < ed * wd && (x1 != x2 || dx < dy); e2 += dy) putPixel(x2 += sx, y0, rgba(col, uint8_t(max(0, 255 * (abs(e2) / ed - wd + 1)))), BLEND_MODE_ALPHA);
+            if (y0 == y1) break;
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+//draw anti-aliased full quad bezier segment
+void drawQuadBezierSegAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col)
+{
+    int32_t sx = x2 - x1, sy = y2 - y1;
+    int32_t xx = x0 - x1, yy = y0 - y1, xy = 0;
+    double dx = 0.0, dy = 0.0, err = 0.0, ed = 0.0;
+    double cur = double(xx) * sy - double(yy) * sx;
+
+    if (sqr(sx) + sqr(sy) > sqr(xx) + sqr(yy))
+    {
+        x2 = x0;
+        x0 = sx + x1;
+        y2 = y0;
+        y0 = sy + y1;
+        cur = -cur;
+    }
+
+    if (cur != 0)
+    {
+        xx += sx;
+        xx *= sx = x0 < x2 ? 1 : -1;
+        yy += sy;
+        yy *= sy = y0 < y2 ? 1 : -1;
+        xy = 2 * xx * yy;
+        xx *= xx;
+        yy *= yy;
+
+        if (cur * sx * sy < 0)
+        {
+            xx = -xx;
+            yy = -yy;
+            xy = -xy;
+            cur = -cur;
+        }
+
+        dx = 4.0 * sy * (intmax_t(x1) - x0) * cur + xx - xy;
+        dy = 4.0 * sx * (intmax_t(y0) - y1) * cur + yy - xy;
+        xx += xx;
+        yy += yy;
+        err = dx + dy + xy;
+
+        do {
+            cur = min(dx + xy, -xy - dy);
+            ed = max(dx + xy, -xy - dy);
+            ed += 2 * ed * sqr(cur) / (4 * sqr(ed) + sqr(cur));
+            putPixel(x0, y0, rgba(col, uint8_t(255 * fabs(err - dx - dy - xy) / ed)), BLEND_MODE_ANTIALIASED);
+
+            if (x0 == x2 || y0 == y2) break;
+
+            x1 = x0;
+            cur = dx - err;
+            y1 = 2 * err + dy < 0;
+
+            if (2 * err + dx > 0)
+            {
+                if (err - dy < ed) putPixel(x0, y0 + sy, rgba(col, uint8_t(255 * fabs(err - dy) / ed)), BLEND_MODE_ANTIALIASED);
+                x0 += sx;
+                dx -= xy;
+                err += dy += yy;
+            }
+
+            if (y1)
+            {
+                if (cur < ed) putPixel(x1 + sx, y0, rgba(col, uint8_t(255 * fabs(cur) / ed)), BLEND_MODE_ANTIALIASED);
+                y0 += sy;
+                dy -= xy;
+                err += dx += xx;
+            }
+        } while (dy < dx);
+    }
+
+    drawLine(x0, y0, x2, y2, col, BLEND_MODE_ANTIALIASED);
+}
+
+//draw a quad bezier segment
+void drawQuadBezierSeg(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    //anti-aliased mode?
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        drawQuadBezierSegAA(x0, y0, x1, y1, x2, y2, col);
+        return;
+    }
+
+    int32_t sx = x2 - x1, sy = y2 - y1;
+    int32_t xx = x0 - x1, yy = y0 - y1, xy = 0;
+    double dx = 0.0, dy = 0.0, err = 0.0;
+    double cur = double(xx) * sy - double(yy) * sx;
+
+    if (sqr(sx) + sqr(sy) > sqr(xx) + sqr(yy))
+    {
+        x2 = x0;
+        x0 = sx + x1;
+        y2 = y0;
+        y0 = sy + y1;
+        cur = -cur;
+    }
+
+    if (cur != 0)
+    {
+        xx += sx;
+        xx *= sx = x0 < x2 ? 1 : -1;
+        yy += sy;
+        yy *= sy = y0 < y2 ? 1 : -1;
+        xy = 2 * xx * yy;
+        xx *= xx;
+        yy *= yy;
+
+        if (cur * sx * sy < 0)
+        {
+            xx = -xx;
+            yy = -yy;
+            xy = -xy;
+            cur = -cur;
+        }
+
+        dx = 4.0 * sy * cur * (intmax_t(x1) - x0) + xx - xy;
+        dy = 4.0 * sx * cur * (intmax_t(y0) - y1) + yy - xy;
+        xx += xx;
+        yy += yy;
+        err = dx + dy + xy;
+
+        do {
+            putPixel(x0, y0, col, mode);
+
+            if (x0 == x2 && y0 == y2) return;
+            
+            y1 = 2 * err < dx;
+            
+            if (2 * err > dy)
+            {
+                x0 += sx;
+                dx -= xy;
+                err += dy += yy;
+            }
+            
+            if (y1)
+            {
+                y0 += sy;
+                dy -= xy;
+                err += dx += xx;
+            }
+        } while (dy < 0 && dx > 0);
+    }
+
+    drawLine(x0, y0, x2, y2, col, mode);
+}
+
+//draw anti-aliased cubic bezier segment
+void drawCubicBezierSegAA(int32_t x0, int32_t y0, double x1, double y1, double x2, double y2, int32_t x3, int32_t y3, uint32_t col)
+{
+    int32_t f = 0, fx = 0, fy = 0, leg = 1;
+    int32_t sx = x0 < x3 ? 1 : -1, sy = y0 < y3 ? 1 : -1;
+
+    const double EP = 0.01;
+    const double xc = -fabs(x0 + x1 - x2 - x3);
+    const double xa = xc - 4.0 * sx * (x1 - x2);
+    const double yc = -fabs(y0 + y1 - y2 - y3);
+    const double ya = yc - 4.0 * sy * (y1 - y2);
+
+    double xb = sx * (x0 - x1 - x2 + x3);
+    double yb = sy * (y0 - y1 - y2 + y3);
+
+    double ip = 0.0;
+    double ab = 0.0, ac = 0.0, bc = 0.0, ba = 0.0;
+    double xx = 0.0, xy = 0.0, yy = 0.0;
+    double dx = 0.0, dy = 0.0, ex = 0.0;
+    double px = 0.0, py = 0.0, ed = 0.0;
+
+    if (xa == 0 && ya == 0)
+    {
+        sx = int32_t(floor((3 * x1 - x0 + 1) / 2));
+        sy = int32_t(floor((3 * y1 - y0 + 1) / 2));
+        drawQuadBezierSeg(x0, y0, sx, sy, x3, y3, col, BLEND_MODE_ANTIALIASED);
+        return;
+    }
+
+    x1 = (x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0) + 1;
+    x2 = (x2 - x3) * (x2 - x3) + (y2 - y3) * (y2 - y3) + 1;
+
+    do {
+        ab = xa * yb - xb * ya;
+        ac = xa * yc - xc * ya;
+        bc = xb * yc - xc * yb;
+        ip = 4 * ab * bc - sqr(ac);
+        ex = ab * (ab + ac - 3 * bc) + sqr(ac);
+        f = (ex > 0) ? 1 : int32_t(sqrt(1 + 1024 / x1));
+        ab *= f;
+        ac *= f;
+        bc *= f;
+        ex *= sqr(intmax_t(f));
+        xy = 9 * (ab + ac + bc) / 8;
+        ba = 8 * (xa - ya);
+        dx = 27 * (8 * ab * (yb * yb - ya * yc) + ex * (ya + 2 * yb + yc)) / 64 - ya * ya * (xy - ya);
+        dy = 27 * (8 * ab * (xb * xb - xa * xc) - ex * (xa + 2 * xb + xc)) / 64 - xa * xa * (xy + xa);
+
+        xx = 3 * (3 * ab * (3 * yb * yb - ya * ya - 2 * ya * yc) - ya * (3 * ac * (ya + yb) + ya * ba)) / 4;
+        yy = 3 * (3 * ab * (3 * xb * xb - xa * xa - 2 * xa * xc) - xa * (3 * ac * (xa + xb) + xa * ba)) / 4;
+        xy = xa * ya * (6 * ab + 6 * ac - 3 * bc + ba);
+        ac = ya * ya;
+        ba = xa * xa;
+        xy = 3 * (xy + 9.0 * f * (ba * yb * yc - xb * xc * ac) - 18 * xb * yb * ab) / 8;
+
+        if (ex < 0)
+        {
+            dx = -dx;
+            dy = -dy;
+            xx = -xx;
+            yy = -yy;
+            xy = -xy;
+            ac = -ac;
+            ba = -ba;
+        }
+
+        ab = 6 * ya * ac;
+        ac = -6 * xa * ac;
+        bc = 6 * ya * ba;
+        ba = -6 * xa * ba;
+        
+        dx += xy;
+        ex = dx + dy;
+        dy += xy;
+
+        for (fx = fy = f; x0 != x3 && y0 != y3;)
+        {
+            y1 = min(fabs(xy - dx), fabs(dy - xy));
+            ed = max(fabs(xy - dx), fabs(dy - xy));
+            ed = f * (ed + 2 * ed * y1 * y1 / (4 * ed * ed + y1 * y1));
+
+            y1 = 255 * fabs(ex - (intmax_t(f) - fx + 1) * dx - (intmax_t(f) - fy + 1) * dy + f * xy) / ed;
+            if (y1 < 256) putPixel(x0, y0, rgba(col, uint8_t(y1)), BLEND_MODE_ANTIALIASED);
+
+            px = fabs(ex - (intmax_t(f) - fx + 1) * dx + (intmax_t(fy) - 1) * dy);
+            py = fabs(ex + (intmax_t(fx) - 1) * dx - (intmax_t(f) - fy + 1) * dy);
+            y2 = y0;
+
+            do {
+                if ((ip >= -EP) && (dx + xx > xy || dy + yy < xy)) goto exit;
+                y1 = 2 * ex + dx;
+                if (2 * ex + dy > 0)
+                {
+                    fx--;
+                    ex += dx += xx;
+                    dy += xy += ac;
+                    yy += bc;
+                    xx += ab;
+                }
+                else if (y1 > 0) goto exit;
+
+                if (y1 <= 0)
+                {
+                    fy--;
+                    ex += dy += yy;
+                    dx += xy += bc;
+                    xx += ac;
+                    yy += ba;
+                }
+            } while (fx > 0 && fy > 0);
+
+            if (2 * fy <= f)
+            {
+                if (py < ed) putPixel(x0 + sx, y0, rgba(col, uint8_t(255 * py / ed)), BLEND_MODE_ANTIALIASED);
+                
+                y0 += sy;
+                fy += f;
+            }
+
+            if (2 * fx <= f)
+            {
+                if (px < ed) putPixel(x0, int32_t(y2) + sy, rgba(col, uint8_t(255 * px / ed)), BLEND_MODE_ANTIALIASED);
+                
+                x0 += sx;
+                fx += f;
+            }
+        }
+
+    exit:
+        if (2 * ex < dy && 2 * fy <= f + 2)
+        {
+            if (py < ed) putPixel(x0 + sx, y0, rgba(col, uint8_t(255 * py / ed)), BLEND_MODE_ANTIALIASED);
+            y0 += sy;
+        }
+
+        if (2 * ex > dx && 2 * fx <= f + 2)
+        {
+            if (px < ed) putPixel(x0, int32_t(y2) + sy, rgba(col, uint8_t(255 * px / ed)), BLEND_MODE_ANTIALIASED);
+            x0 += sx;
+        }
+
+        xx = x0;
+        x0 = x3;
+        x3 = int32_t(xx);
+        
+        sx = -sx;
+        xb = -xb;
+     
+        yy = y0;
+        y0 = y3;
+        y3 = int32_t(yy);
+
+        sy = -sy;
+        yb = -yb;
+        x1 = x2;
+    } while (leg--);
+
+    drawLine(x0, y0, x3, y3, col, BLEND_MODE_ANTIALIASED);
+}
+
+//draw full quad bezier (export function)
+void drawQuadBezier(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    int32_t x = x0 - x1, y = y0 - y1;
+    double t = x0 - 2.0 * x1 + x2, r = 0.0;
+
+    if (x * (x2 - x1) > 0)
+    {
+        if ((y * (y2 - y1) > 0) && fabs((y0 - 2.0 * y1 + y2) / t * x) > abs(y))
+        {
+            x0 = x2;
+            x2 = x + x1;
+            y0 = y2;
+            y2 = y + y1;
+        }
+
+        t = (intmax_t(x0) - x1) / t;
+        r = (1 - t) * ((1 - t) * y0 + 2.0 * t * y1) + t * t * y2;
+        t = (intmax_t(x0) * x2 - intmax_t(x1) * x1) * t / (intmax_t(x0) - x1);
+        x = int32_t(floor(t + 0.5));
+        y = int32_t(floor(r + 0.5));
+        r = (intmax_t(y1) - y0) * (t - x0) / (intmax_t(x1) - x0) + y0;
+        
+        drawQuadBezierSeg(x0, y0, x, int32_t(floor(r + 0.5)), x, y, col, mode);
+        
+        r = (intmax_t(y1) - y2) * (t - x2) / (intmax_t(x1) - x2) + y2;
+        x0 = x1 = x;
+        y0 = y;
+        y1 = int32_t(floor(r + 0.5));
+    }
+
+    if ((y0 - y1) * (y2 - y1) > 0)
+    {
+        t = y0 - 2.0 * y1 + y2;
+        t = (intmax_t(y0) - y1) / t;
+        r = (1 - t) * ((1 - t) * x0 + 2.0 * t * x1) + t * t * x2;
+        t = (intmax_t(y0) * y2 - intmax_t(y1) * y1) * t / (intmax_t(y0) - y1);
+        x = int32_t(floor(r + 0.5));
+        y = int32_t(floor(t + 0.5));
+        r = (intmax_t(x1) - x0) * (t - y0) / (intmax_t(y1) - y0) + x0;
+
+        drawQuadBezierSeg(x0, y0, int32_t(floor(r + 0.5)), y, x, y, col, mode);
+        
+        r = (intmax_t(x1) - x2) * (t - y2) / (intmax_t(y1) - y2) + x2;
+        x0 = x;
+        x1 = int32_t(floor(r + 0.5));
+        y0 = y1 = y;
+    }
+
+    drawQuadBezierSeg(x0, y0, x1, y1, x2, y2, col, mode);
+}
+
+//draw anti-aliased rotation quad bezier segment
+void drawQuadRationalBezierSegAA(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, double w, uint32_t col)
+{
+    int32_t f = 0;
+    int32_t sx = x2 - x1, sy = y2 - y1;
+
+    double err = 0.0, ed = 0.0;
+    double dx = double(x0) - x2, dy = double(y0) - y2;
+    double xx = double(x0) - x1, yy = double(y0) - y1;
+    double xy = xx * sy + yy * sx, cur = xx * sy - yy * sx;
+    
+    if (cur != 0.0 && w > 0.0)
+    {
+        if (sqr(double(sx)) + sqr(double(sy)) > sqr(xx) + sqr(yy))
+        {
+            x2 = x0;
+            x0 -= int32_t(dx);
+            y2 = y0;
+            y0 -= int32_t(dy);
+            cur = -cur;
+        }
+
+        xx = 2.0 * (4.0 * w * sx * xx + sqr(dx));
+        yy = 2.0 * (4.0 * w * sy * yy + sqr(dy));
+        sx = x0 < x2 ? 1 : -1;
+        sy = y0 < y2 ? 1 : -1;
+        xy = -2.0 * sx * sy * (2.0 * w * xy + dx * dy);
+
+        if (cur * sx * sy < 0)
+        {
+            xx = -xx;
+            yy = -yy;
+            cur = -cur;
+            xy = -xy;
+        }
+
+        dx = 4.0 * w * (intmax_t(x1) - x0) * sy * cur + xx / 2.0 + xy;
+        dy = 4.0 * w * (intmax_t(y0) - y1) * sx * cur + yy / 2.0 + xy;
+
+        if (w < 0.5 && dy > dx)
+        {
+            cur = (w + 1.0) / 2.0;
+            w = sqrt(w);
+            xy = 1.0 / (w + 1.0);
+            
+            sx = int32_t(floor((x0 + 2.0 * w * x1 + x2) * xy / 2.0 + 0.5));
+            sy = int32_t(floor((y0 + 2.0 * w * y1 + y2) * xy / 2.0 + 0.5));
+            
+            dx = floor((w * x1 + x0) * xy + 0.5);
+            dy = floor((y1 * w + y0) * xy + 0.5);
+            drawQuadRationalBezierSegAA(x0, y0, int32_t(dx), int32_t(dy), sx, sy, cur, col);
+            
+            dx = floor((w * x1 + x2) * xy + 0.5);
+            dy = floor((y1 * w + y2) * xy + 0.5);
+            drawQuadRationalBezierSegAA(sx, sy, int32_t(dx), int32_t(dy), x2, y2, cur, col);
+            
+            return;
+        }
+
+        err = dx + dy - xy;
+
+        do {
+            cur = min(dx - xy, xy - dy);
+            ed = max(dx - xy, xy - dy);
+            ed += 2 * ed * sqr(cur) / (4.0 * sqr(ed) + sqr(cur));
+
+            x1 = int32_t(255 * fabs(err - dx - dy + xy) / ed);
+            if (x1 < 256) putPixel(x0, y0, rgba(col, x1), BLEND_MODE_ANTIALIASED);
+
+            if ((f = 2 * err + dy < 0))
+            {
+                if (y0 == y2) return;
+                if (dx - err < ed) putPixel(x0 + sx, y0, rgba(col, uint8_t(255 * fabs(dx - err) / ed)), BLEND_MODE_ANTIALIASED);
+            }
+
+            if (2 * err + dx > 0)
+            {
+                if (x0 == x2) return;
+                if (err - dy < ed) putPixel(x0, y0 + sy, rgba(col, uint8_t(255 * fabs(err - dy) / ed)), BLEND_MODE_ANTIALIASED);
+                
+                x0 += sx;
+                dx += xy;
+                err += dy += yy;
+            }
+
+            if (f)
+            {
+                y0 += sy;
+                dy += xy;
+                err += dx += xx;
+            }
+        } while (dy < dx);
+    }
+
+    drawLine(x0, y0, x2, y2, col, BLEND_MODE_ANTIALIASED);
+}
+
+//draw rotation quad bezier segment
+void drawQuadRationalBezierSeg(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, double w, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    //anti-aliased mode
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        drawQuadRationalBezierSegAA(x0, y0, x1, y1, x2, y2, w, col);
+        return;
+    }
+
+    int32_t sx = x2 - x1, sy = y2 - y1;
+
+    double dx = double(x0) - x2, dy = double(y0) - y2;
+    double xx = double(x0) - x1, yy = double(y0) - y1;
+
+    double err = 0.0;
+    double xy = xx * sy + yy * sx, cur = xx * sy - yy * sx;
+
+    if (cur != 0.0 && w > 0.0)
+    {
+        if (sqr(double(sx)) + sqr(double(sy)) > sqr(xx) + sqr(yy))
+        {
+            x2 = x0;
+            x0 -= int32_t(dx);
+            y2 = y0;
+            y0 -= int32_t(dy);
+            cur = -cur;
+        }
+
+        xx = 2.0 * (4.0 * w * sx * xx + sqr(dx));
+        yy = 2.0 * (4.0 * w * sy * yy + sqr(dy));
+        sx = x0 < x2 ? 1 : -1;
+        sy = y0 < y2 ? 1 : -1;
+        xy = -2.0 * sx * sy * (2.0 * w * xy + dx * dy);
+
+        if (cur * sx * sy < 0.0)
+        {
+            xx = -xx;
+            yy = -yy;
+            xy = -xy;
+            cur = -cur;
+        }
+
+        dx = 4.0 * w * (intmax_t(x1) - x0) * sy * cur + xx / 2.0 + xy;
+        dy = 4.0 * w * (intmax_t(y0) - y1) * sx * cur + yy / 2.0 + xy;
+
+        if (w < 0.5 && (dy > xy || dx < xy))
+        {
+            cur = (w + 1.0) / 2.0;
+            w = sqrt(w);
+            xy = 1.0 / (w + 1.0);
+            
+            sx = int32_t(floor((x0 + 2.0 * w * x1 + x2) * xy / 2.0 + 0.5));
+            sy = int32_t(floor((y0 + 2.0 * w * y1 + y2) * xy / 2.0 + 0.5));
+            
+            dx = floor((w * x1 + x0) * xy + 0.5);
+            dy = floor((y1 * w + y0) * xy + 0.5);
+            drawQuadRationalBezierSeg(x0, y0, int32_t(dx), int32_t(dy), sx, sy, cur, col, mode);
+            
+            dx = floor((w * x1 + x2) * xy + 0.5);
+            dy = floor((y1 * w + y2) * xy + 0.5);
+            drawQuadRationalBezierSeg(sx, sy, int32_t(dx), int32_t(dy), x2, y2, cur, col, mode);
+            
+            return;
+        }
+
+        err = dx + dy - xy;
+
+        do {
+            putPixel(x0, y0, col, mode);
+
+            if (x0 == x2 && y0 == y2) return;
+
+            x1 = 2 * err > dy;
+            y1 = 2 * (err + yy) < -dy;
+            
+            if (2 * err < dx || y1)
+            {
+                y0 += sy;
+                dy += xy;
+                err += dx += xx;
+            }
+
+            if (2 * err > dx || x1)
+            {
+                x0 += sx;
+                dx += xy;
+                err += dy += yy;
+            }
+        } while (dy <= xy && dx >= xy);
+    }
+
+    drawLine(x0, y0, x2, y2, col, mode);
+}
+
+//draw rotation full quad bezier segment (export function)
+void drawQuadRationalBezier(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, double w, int32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    int32_t x = x0 - 2 * x1 + x2;
+    int32_t y = y0 - 2 * y1 + y2;
+
+    double xx = double(x0) - x1;
+    double yy = double(y0) - y1;
+    double ww = 0.0, t = 0.0, q = 0.0;
+
+    if (xx * (intmax_t(x2) - x1) > 0)
+    {
+        if (yy * (intmax_t(y2) - y1) > 0 && fabs(xx * y) > fabs(yy * x))
+        {
+            x0 = x2;
+            x2 = int32_t(xx) + x1;
+            y0 = y2;
+            y2 = int32_t(yy) + y1;
+        }
+
+        if (x0 == x2 || w == 1.0) t = (intmax_t(x0) - x1) / double(x);
+        else
+        {
+            q = sqrt(4.0 * w * w * (intmax_t(x0) - x1) * (intmax_t(x2) - x1) + (intmax_t(x2) - x0) * (intmax_t(x2) - x0));
+            if (x1 < x0) q = -q;
+            t = (2.0 * w * (intmax_t(x0) - x1) - x0 + x2 + q) / (2.0 * (1.0 - w) * (intmax_t(x2) - x0));
+        }
+
+        q = 1.0 / (2.0 * t * (1.0 - t) * (w - 1.0) + 1.0);
+        xx = (t * t * (x0 - 2.0 * w * x1 + x2) + 2.0 * t * (w * x1 - x0) + x0) * q;
+        yy = (t * t * (y0 - 2.0 * w * y1 + y2) + 2.0 * t * (w * y1 - y0) + y0) * q;
+        ww = t * (w - 1.0) + 1.0;
+        ww *= ww * q;
+        w = ((1.0 - t) * (w - 1.0) + 1.0) * sqrt(q);
+        x = int32_t(floor(xx + 0.5));
+        y = int32_t(floor(yy + 0.5));
+        yy = (xx - x0) * (intmax_t(y1) - y0) / (intmax_t(x1) - x0) + y0;
+        
+        drawQuadRationalBezierSeg(x0, y0, x, int32_t(floor(yy + 0.5)), x, y, ww, col, mode);
+        
+        yy = (xx - x2) * (intmax_t(y1) - y2) / (intmax_t(x1) - x2) + y2;
+        y1 = int32_t(floor(yy + 0.5));
+        x0 = x1 = x;
+        y0 = y;
+    }
+
+    if ((y0 - y1) * (y2 - y1) > 0)
+    {
+        if (y0 == y2 || w == 1.0) t = (intmax_t(y0) - y1) / (y0 - 2.0 * y1 + y2);
+        else
+        {
+            q = sqrt(4.0 * w * w * (intmax_t(y0) - y1) * (intmax_t(y2) - y1) + (intmax_t(y2) - y0) * (intmax_t(y2) - y0));
+            if (y1 < y0) q = -q;
+            t = (2.0 * w * (intmax_t(y0) - y1) - y0 + y2 + q) / (2.0 * (1.0 - w) * (intmax_t(y2) - y0));
+        }
+
+        q = 1.0 / (2.0 * t * (1.0 - t) * (w - 1.0) + 1.0);
+        xx = (t * t * (x0 - 2.0 * w * x1 + x2) + 2.0 * t * (w * x1 - x0) + x0) * q;
+        yy = (t * t * (y0 - 2.0 * w * y1 + y2) + 2.0 * t * (w * y1 - y0) + y0) * q;
+        ww = t * (w - 1.0) + 1.0;
+        ww *= ww * q;
+        w = ((1.0 - t) * (w - 1.0) + 1.0) * sqrt(q);
+        x = int32_t(floor(xx + 0.5));
+        y = int32_t(floor(yy + 0.5));
+        xx = (intmax_t(x1) - x0) * (yy - y0) / (intmax_t(y1) - y0) + x0;
+        
+        drawQuadRationalBezierSeg(x0, y0, int32_t(floor(xx + 0.5)), y, x, y, ww, col, mode);
+        
+        xx = (intmax_t(x1) - x2) * (yy - y2) / (intmax_t(y1) - y2) + x2;
+        x1 = int32_t(floor(xx + 0.5));
+        x0 = x;
+        y0 = y1 = y;
+    }
+
+    drawQuadRationalBezierSeg(x0, y0, x1, y1, x2, y2, w * w, col, mode);
+}
+
+//draw rotation of ellipse with rect
+void drawRotatedEllipseRect(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t zd, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    int32_t xd = x1 - x0, yd = y1 - y0;
+    double w = double(xd) * yd;
+
+    if (zd == 0)
+    {
+        drawEllipse(x0, y0, xd + 1, yd + 1, col, mode);
+        return;
+    }
+
+    if (w != 0.0) w = (w - zd) / (w + w);
+
+    xd = int32_t(floor(xd * w + 0.5));
+    yd = int32_t(floor(yd * w + 0.5));
+
+    drawQuadRationalBezierSeg(x0, y0 + yd, x0, y0, x0 + xd, y0, 1.0 - w, col, mode);
+    drawQuadRationalBezierSeg(x0, y0 + yd, x0, y1, x1 - xd, y1, w, col, mode);
+    drawQuadRationalBezierSeg(x1, y1 - yd, x1, y1, x1 - xd, y1, 1.0 - w, col, mode);
+    drawQuadRationalBezierSeg(x1, y1 - yd, x1, y0, x0 + xd, y0, w, col, mode);
+}
+
+//draw rotation of ellipse (export function)
+void drawRotatedEllipse(int32_t x, int32_t y, int32_t ra, int32_t rb, double angle, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    const double s = sin(angle);
+    double xd = sqr(double(ra));
+    double yd = sqr(double(rb));
+    double zd = (xd - yd) * s;
+
+    xd = sqrt(xd - zd * s);
+    yd = sqrt(yd + zd * s);
+    ra = int32_t(xd + 0.5);
+    rb = int32_t(yd + 0.5);
+    zd = zd * ra * rb / (xd * yd);
+
+    drawRotatedEllipseRect(x - ra, y - rb, x + ra, y + rb, int32_t(4 * zd * cos(angle)), col, mode);
+}
+
+//draw cubic bezier segment
+void drawCubicBezierSeg(int32_t x0, int32_t y0, double x1, double y1, double x2, double y2, int32_t x3, int32_t y3, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    //anti-aliased mode?
+    if (mode == BLEND_MODE_ANTIALIASED)
+    {
+        drawCubicBezierSegAA(x0, y0, x1, y1, x2, y2, x3, y3, col);
+        return;
+    }
+
+    int32_t leg = 1;
+    int32_t f = 0, fx = 0, fy = 0;
+    int32_t sx = x0 < x3 ? 1 : -1;
+    int32_t sy = y0 < y3 ? 1 : -1;
+    
+    const double xc = -fabs(x0 + x1 - x2 - x3), xa = xc - 4.0 * sx * (x1 - x2);
+    const double yc = -fabs(y0 + y1 - y2 - y3), ya = yc - 4.0 * sy * (y1 - y2);
+    
+    double* pxy = NULL, EP = 0.01;
+    double xb = sx * (x0 - x1 - x2 + x3);
+    double yb = sy * (y0 - y1 - y2 + y3);
+    double ab = 0.0, ac = 0.0, bc = 0.0, cb = 0.0;
+    double xx = 0.0, xy = 0.0, yy = 0.0;
+    double dx = 0.0, dy = 0.0, ex = 0.0;
+        
+    if (xa == 0 && ya == 0)
+    {
+        sx = int32_t(floor((3 * x1 - x0 + 1) / 2));
+        sy = int32_t(floor((3 * y1 - y0 + 1) / 2));
+        drawQuadBezierSeg(x0, y0, sx, sy, x3, y3, col, mode);
+        return;
+    }
+
+    x1 = (x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0) + 1;
+    x2 = (x2 - x3) * (x2 - x3) + (y2 - y3) * (y2 - y3) + 1;
+
+    do {
+        ab = xa * yb - xb * ya;
+        ac = xa * yc - xc * ya;
+        bc = xb * yc - xc * yb;
+        ex = ab * (ab + ac - 3 * bc) + sqr(ac);
+        f = (ex > 0) ? 1 : int32_t(sqrt(1 + 1024 / x1));
+
+        ab *= f;
+        ac *= f;
+        bc *= f;
+        ex *= intmax_t(f) * f;
+
+        xy = 9 * (ab + ac + bc) / 8;
+        cb = 8 * (xa - ya);
+        dx = 27 * (8 * ab * (yb * yb - ya * yc) + ex * (ya + 2 * yb + yc)) / 64 - ya * ya * (xy - ya);
+        dy = 27 * (8 * ab * (xb * xb - xa * xc) - ex * (xa + 2 * xb + xc)) / 64 - xa * xa * (xy + xa);
+
+        xx = 3 * (3 * ab * (3 * yb * yb - ya * ya - 2 * ya * yc) - ya * (3 * ac * (ya + yb) + ya * cb)) / 4;
+        yy = 3 * (3 * ab * (3 * xb * xb - xa * xa - 2 * xa * xc) - xa * (3 * ac * (xa + xb) + xa * cb)) / 4;
+        xy = xa * ya * (6 * ab + 6 * ac - 3 * bc + cb);
+        
+        ac = ya * ya;
+        cb = xa * xa;
+        xy = 3 * (xy + 9.0 * f * (cb * yb * yc - xb * xc * ac) - 18 * xb * yb * ab) / 8;
+
+        if (ex < 0)
+        {
+            dx = -dx;
+            dy = -dy;
+            xx = -xx;
+            yy = -yy;
+            xy = -xy;
+            ac = -ac;
+            cb = -cb;
+        }
+
+        ab = 6 * ya * ac;
+        ac = -6 * xa * ac;
+        bc = 6 * ya * cb;
+        cb = -6 * xa * cb;
+
+        dx += xy;
+        ex = dx + dy;
+        dy += xy;
+
+        for (pxy = &xy, fx = fy = f; x0 != x3 && y0 != y3; )
+        {
+            putPixel(x0, y0, col, mode);
+
+            do {
+                if (dx > *pxy || dy < *pxy) goto exit;
+
+                y1 = 2 * ex - dy;
+                if (2 * ex >= dx)
+                {
+                    fx--;
+                    ex += dx += xx;
+                    dy += xy += ac;
+                    yy += bc;
+                    xx += ab;
+                }
+
+                if (y1 <= 0)
+                {
+                    fy--;
+                    ex += dy += yy;
+                    dx += xy += bc;
+                    xx += ac;
+                    yy += cb;
+                }
+            } while (fx > 0 && fy > 0);
+
+            if (2 * fx <= f)
+            {
+                x0 += sx;
+                fx += f;
+            }
+
+            if (2 * fy <= f)
+            {
+                y0 += sy;
+                fy += f;
+            }
+
+            if (pxy == &xy && dx < 0 && dy > 0) pxy = &EP;
+        }
+
+    exit:
+        xx = x0;
+        x0 = x3;
+        x3 = int32_t(xx);
+
+        sx = -sx;
+        xb = -xb;
+        yy = y0;
+        y0 = y3;
+        y3 = int32_t(yy);
+        sy = -sy;
+        yb = -yb;
+        x1 = x2;
+    } while (leg--);
+
+    drawLine(x0, y0, x3, y3, col, mode);
+}
+
+//draw cubic bezier (export function)
+void drawCubicBezier(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, int32_t x3, int32_t y3, uint32_t col, int32_t mode /*= BLEND_MODE_NORMAL*/)
+{
+    int32_t n = 0, i = 0;
+    const int32_t xc = x0 + x1 - x2 - x3, xa = xc - 4 * (x1 - x2);
+    const int32_t xb = x0 - x1 - x2 + x3, xd = xb + 4 * (x1 + x2);
+    const int32_t yc = y0 + y1 - y2 - y3, ya = yc - 4 * (y1 - y2);
+    const int32_t yb = y0 - y1 - y2 + y3, yd = yb + 4 * (y1 + y2);
+
+    double t2 = 0, t[10] = { 0 };
+    double fx0 = x0, fx1 = 0.0, fx2 = 0.0, fx3 = 0.0;
+    double fy0 = y0, fy1 = 0.0, fy2 = 0.0, fy3 = 0.0;
+    double t1 = double(xb) * xb - double(xa) * xc;
+    
+    if (xa == 0)
+    {
+        if (abs(xc) < 2 * abs(xb)) t[n++] = xc / (2.0 * xb);
+    }
+    else if (t1 > 0.0)
+    {
+        t2 = sqrt(t1);
+        
+        t1 = (xb - t2) / xa;
+        if (fabs(t1) < 1.0) t[n++] = t1;
+
+        t1 = (xb + t2) / xa;
+        if (fabs(t1) < 1.0) t[n++] = t1;
+    }
+
+    t1 = sqr(double(yb)) - double(ya) * yc;
+
+    if (ya == 0)
+    {
+        if (abs(yc) < 2 * abs(yb)) t[n++] = yc / (2.0 * yb);
+    }
+    else if (t1 > 0.0)
+    {
+        t2 = sqrt(t1);
+        t1 = (yb - t2) / ya; if (fabs(t1) < 1.0) t[n++] = t1;
+        t1 = (yb + t2) / ya; if (fabs(t1) < 1.0) t[n++] = t1;
+    }
+
+    for (i = 1; i != n; i++)
+    {
+        if ((t1 = t[i - 1]) > t[i])
+        {
+            t[i - 1] = t[i];
+            t[i] = t1;
+            i = 0;
+        }
+    }
+
+    t1 = -1.0;
+    t[n] = 1.0;
+
+    for (i = 0; i <= n; i++)
+    {
+        t2 = t[i];
+        fx1 = (t1 * (t1 * xb - 2.0 * xc) - t2 * (t1 * (t1 * xa - 2.0 * xb) + xc) + xd) / 8 - fx0;
+        fy1 = (t1 * (t1 * yb - 2.0 * yc) - t2 * (t1 * (t1 * ya - 2.0 * yb) + yc) + yd) / 8 - fy0;
+        fx2 = (t2 * (t2 * xb - 2.0 * xc) - t1 * (t2 * (t2 * xa - 2.0 * xb) + xc) + xd) / 8 - fx0;
+        fy2 = (t2 * (t2 * yb - 2.0 * yc) - t1 * (t2 * (t2 * ya - 2.0 * yb) + yc) + yd) / 8 - fy0;
+        fx0 -= fx3 = (t2 * (t2 * (3.0 * xb - t2 * xa) - 3.0 * xc) + xd) / 8;
+        fy0 -= fy3 = (t2 * (t2 * (3.0 * yb - t2 * ya) - 3.0 * yc) + yd) / 8;
+        x3 = int32_t(floor(fx3 + 0.5));
+        y3 = int32_t(floor(fy3 + 0.5));
+        
+        if (fx0 != 0.0)
+        {
+            fx1 *= fx0 = (intmax_t(x0) - x3) / fx0;
+            fx2 *= fx0;
+        }
+
+        if (fy0 != 0.0)
+        {
+            fy1 *= fy0 = (intmax_t(y0) - y3) / fy0;
+            fy2 *= fy0;
+        }
+        
+        if (x0 != x3 || y0 != y3) drawCubicBezierSeg(x0, y0, x0 + fx1, y0 + fy1, x0 + fx2, y0 + fy2, x3, y3, col, mode);
+        
+        x0 = x3;
+        y0 = y3;
+        fx0 = fx3;
+        fy0 = fy3;
+        t1 = t2;
+    }
+}
+
+//draw boxed with rounded border
+void drawRoundBox(int32_t x, int32_t y, int32_t width, int32_t height, int32_t rad, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    int32_t i = 0, j = 0;
+    int32_t a = 0, b = 0;
+    int32_t points[500] = { 0 };
+
+    const int32_t x1 = x + width - 1;
+    const int32_t y1 = y + height - 1;
+    const int32_t mid = height >> 1;
+
+    if (rad >= mid - 1) rad = mid - 1;
+
+    calcCircle(rad, points);
+
+    horizLine(x + rad - points[0], y + 1, width - ((rad - points[0]) << 1), col, mode);
+    vertLine(x, y + rad, height - (rad << 1), col, mode);
+    horizLine(x + rad - points[0], y1 - 1, width - ((rad - points[0]) << 1), col, mode);
+    vertLine(x1, y + rad, height - (rad << 1), col, mode);
+
+    for (i = 1; i <= rad; i++)
+    {
+        a = rad - points[i];
+        b = rad - points[i - 1];
+        for (j = a; j <= b; j++)
+        {
+            putPixel(x + j, y + i, col, mode);
+            putPixel(x1 - j, y + i, col, mode);
+        }
+    }
+
+    for (i = 1; i <= rad; i++)
+    {
+        a = rad - points[i];
+        b = rad - points[i - 1];
+        for (j = a; j <= b; j++)
+        {
+            putPixel(x + j, y1 - i, col, mode);
+            putPixel(x1 - j, y1 - i, col, mode);
+        }
+    }
+
+    for (i = 1; i <= rad; i++) horizLine(x + rad - points[i - 1] + 1, y + i, width - ((rad << 1) - (points[i - 1] << 1)) - 1, col, mode);
+    fillRect(x + 1, y + rad + 1, width - 2, height - (rad << 1) - 2, col, mode);
+    for (i = rad; i >= 1; i--) horizLine(x + rad - points[i - 1] + 1, y1 - i, width - ((rad << 1) - (points[i - 1] << 1)) - 1, col, mode);
+}
+
+//draw polygon
+void drawPolygon(GFX_CONTEXT* ctx, const POINT2D* points, int32_t num, uint32_t col, int32_t mode)
+{
+    if (num < 3) return;
+
+    //edges are drawn by batches of drawLines
+    int32_t segs[LINE_BATCH << 2] = { 0 };
+    for (int32_t i = 0; i < num; i += LINE_BATCH)
+    {
+        const int32_t count = min(num - i, LINE_BATCH);
+        for (int32_t j = 0; j < count; j++)
+        {
+            const int32_t k = i + j;
+            const int32_t next = (k + 1 < num) ? k + 1 : 0;
+            segs[(j << 2)    ] = int32_t(points[k].x);
+            segs[(j << 2) + 1] = int32_t(points[k].y);
+            segs[(j << 2) + 2] = int32_t(points[next].x);
+            segs[(j << 2) + 3] = int32_t(points[next].y);
+        }
+        drawLines(ctx, segs, count, col, mode);
+    }
+}
+
+//draw polygon
+void drawPolygon(const POINT2D* points, int32_t num, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawPolygon(&gfxContext, points, num, col, mode);
+}
+
+//fast filled Bresenham circle at (xc,yc) with radius and color
+void fillCircle(GFX_CONTEXT* ctx, int32_t xc, int32_t yc, int32_t radius, uint32_t color, int32_t mode)
+{
+    int32_t i = 0;
+    int32_t points[500] = { 0 };
+
+    //range limited
+    if (radius <= 0) return;
+
+    //out of range
+    if (radius > 499)
+    {
+        messageBox(GFX_ERROR, "fillCircle: radius must be in [0-499] pixels");
+        return;
+    }
+
+    int32_t mc = yc - radius;
+    calcCircle(radius, points);
+
+    for (i = 0; i <= radius - 1; i++, mc++) horizLine(ctx, xc - points[i], mc, (points[i] << 1), color, mode);
+    for (i = radius - 1; i >= 0; i--, mc++) horizLine(ctx, xc - points[i], mc, (points[i] << 1), color, mode);
+}
+
+//fast filled Bresenham circle at (xc,yc) with radius and color
+void fillCircle(int32_t xc, int32_t yc, int32_t radius, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    fillCircle(&gfxContext, xc, yc, radius, color, mode);
+}
+
+//filled ellipse with color
+void fillEllipse(GFX_CONTEXT* ctx, int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t color, int32_t mode)
+{
+    int32_t i = 0;
+    int32_t points[500] = { 0 };
+
+    //range limited
+    if (ra <= 0 || rb <= 0) return;
+
+    //out of range
+    if (ra > 499 || rb > 499)
+    {
+        messageBox(GFX_ERROR, "fillEllipse: ra, rb must be in [0-499] pixels");
+        return;
+    }
+
+    int32_t mc = yc - rb;
+
+    if (ra != rb) calcEllipse(ra, rb, points);
+    else calcCircle(ra, points);
+
+    for (i = 0; i <= rb - 1; i++, mc++) horizLine(ctx, xc - points[i], mc, points[i] << 1, color, mode);
+    for (i = rb - 1; i >= 0; i--, mc++) horizLine(ctx, xc - points[i], mc, points[i] << 1, color, mode);
+}
+
+//filled ellipse with color
+void fillEllipse(int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t color, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    fillEllipse(&gfxContext, xc, yc, ra, rb, color, mode);
+}
+
+//edge of scanline polygon filler, x is 16.16 fixed-point sampled at pixel centers
+struct PolyEdge {
+    int64_t x;          //x at current scanline
+    int64_t dx;         //x step per scanline
+    int32_t yend;       //first scanline after the edge
+    int32_t winding;    //+1 edge goes down, -1 edge goes up
+    int32_t next;       //next edge starting at the same scanline (-1 is end of list)
+};
+
+//insertion sort edge indices by x (fast for almost sorted lists)
+static must_inline void insertSortEdges(const PolyEdge* edges, int32_t* list, const int32_t count)
+{
+    for (int32_t i = 1; i < count; i++)
+    {
+        const int32_t e = list[i];
+        const int64_t x = edges[e].x;
+        int32_t j = i - 1;
+        while (j >= 0 && edges[list[j]].x > x)
+        {
+            list[j + 1] = list[j];
+            j--;
+        }
+        list[j + 1] = e;
+    }
+}
+
+//sort edge indices by x: insertion sort runs of 16 edges, then merge runs between list and temp
+//return the buffer that hold sorted indices (list or temp)
+static int32_t* sortEdges(const PolyEdge* edges, int32_t* list, int32_t* temp, const int32_t count)
+{
+    for (int32_t i = 0; i < count; i += 16) insertSortEdges(edges, &list[i], min(16, count - i));
+
+    for (int32_t width = 16; width < count; width <<= 1)
+    {
+        for (int32_t lo = 0; lo < count; lo += width << 1)
+        {
+            const int32_t mid = min(lo + width, count);
+            const int32_t hi = min(lo + (width << 1), count);
+            int32_t i = lo, j = mid, k = lo;
+            while (i < mid && j < hi) temp[k++] = (edges[list[j]].x < edges[list[i]].x) ? list[j++] : list[i++];
+            while (i < mid) temp[k++] = list[i++];
+            while (j < hi) temp[k++] = list[j++];
+        }
+
+        int32_t* sorted = temp;
+        temp = list;
+        list = sorted;
+    }
+
+    return list;
+}
+
+//fill polygon contours using edge table and active edge list (no limit of vertices)
+//contour i has counts[i] points, contours are closed and stored back-to-back in points
+//pixels are covered when their centers are inside by even-odd or non-zero winding rule
+static void fillContours(GFX_CONTEXT* ctx, const POINT2D* points, const int32_t* counts, int32_t contours, uint32_t col, int32_t mode, int32_t rule)
+{
+    //blend mode kernels (8 bits mode just fill colors)
+    const GFX_BLEND_KERNELS* blend = NULL;
+    if (ctx->bitsPerPixel != 8)
+    {
+        blend = getBlendKernels(mode);
+        if (!blend)
+        {
+            messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+            return;
+        }
+    }
+
+    //vertical range of polygon (clipped)
+    int32_t total = 0;
+    double ymin = DBL_MAX, ymax = -DBL_MAX;
+    for (int32_t c = 0; c < contours; c++)
+    {
+        for (int32_t i = 0; i < counts[c]; i++)
+        {
+            ymin = min(ymin, points[total + i].y);
+            ymax = max(ymax, points[total + i].y);
+        }
+        total += counts[c];
+    }
+
+    if (total < 3) return;
+    const int32_t top = int32_t(max(ceil(ymin - 0.5), double(ctx->cminY)));
+    const int32_t bottom = int32_t(min(ceil(ymax - 0.5), double(ctx->cmaxY) + 1));
+    if (top >= bottom) return;
+
+    //edge table: edges are bucketed by their first scanline, active, merged, new and sort lists store edge index
+    PolyEdge* edges = (PolyEdge*)malloc(intptr_t(total) * sizeof(PolyEdge));
+    int32_t* lists = (int32_t*)malloc(intptr_t(total) * 4 * sizeof(int32_t));
+    int32_t* buckets = (int32_t*)malloc(intptr_t(bottom - top) * sizeof(int32_t));
+    if (!edges || !lists || !buckets)
+    {
+        if (edges) free(edges);
+        if (lists) free(lists);
+        if (buckets) free(buckets);
+        messageBox(GFX_ERROR, "Error alloc memory!");
+        return;
+    }
+
+    memset(buckets, -1, intptr_t(bottom - top) * sizeof(int32_t));
+
+    //build edges, horizontal edges and edges without pixel centers are dropped
+    int32_t numEdges = 0;
+    const POINT2D* contour = points;
+    for (int32_t c = 0; c < contours; c++)
+    {
+        for (int32_t i = 0, j = counts[c] - 1; i < counts[c]; j = i++)
+        {
+            const int32_t winding = (contour[j].y > contour[i].y) ? -1 : 1;
+            const POINT2D* p0 = (winding > 0) ? &contour[j] : &contour[i];
+            const POINT2D* p1 = (winding > 0) ? &contour[i] : &contour[j];
+
+            //edge cover pixel centers y + 0.5 in [p0->y, p1->y)
+            const int32_t ys = int32_t(max(ceil(p0->y - 0.5), double(top)));
+            const int32_t ye = int32_t(min(ceil(p1->y - 0.5), double(bottom)));
+            if (ys >= ye) continue;
+
+            const double slope = (p1->x - p0->x) / (p1->y - p0->y);
+            PolyEdge* edge  = &edges[numEdges];
+            edge->x         = llround((p0->x + (ys + 0.5 - p0->y) * slope) * 65536);
+            edge->dx        = llround(slope * 65536);
+            edge->yend      = ye;
+            edge->winding   = winding;
+            edge->next      = buckets[ys - top];
+            buckets[ys - top] = numEdges++;
+        }
+        contour += counts[c];
+    }
+
+    int32_t numActive = 0;
+    int32_t* active = lists;
+    int32_t* merged = &lists[total];
+    int32_t* fresh = &lists[total << 1];
+    int32_t* temp = &lists[total * 3];
+    int32_t box[4] = { INT32_MAX, top, INT32_MIN, top };
+    for (int32_t y = top; y < bottom; y++)
+    {
+        //active list is almost sorted from previous scanline, only crossing edges move
+        insertSortEdges(edges, active, numActive);
+
+        //new edges of this scanline are sorted alone, then merged to active list
+        int32_t numFresh = 0;
+        for (int32_t e = buckets[y - top]; e >= 0; e = edges[e].next) fresh[numFresh++] = e;
+        if (numFresh)
+        {
+            const int32_t* sorted = sortEdges(edges, fresh, temp, numFresh);
+            int32_t i = 0, j = 0, k = 0;
+            while (i < numActive && j < numFresh) merged[k++] = (edges[sorted[j]].x < edges[active[i]].x) ? sorted[j++] : active[i++];
+            while (i < numActive) merged[k++] = active[i++];
+            while (j < numFresh) merged[k++] = sorted[j++];
+
+            int32_t* list = active;
+            active = merged;
+            merged = list;
+            numActive = k;
+        }
+
+        if (!numActive) continue;
+
+        //emit spans between inside intervals, pixel centers in [xl, xr) are filled
+        int32_t winding = 0;
+        for (int32_t i = 0; i < numActive - 1; i++)
+        {
+            winding += (rule == FILL_RULE_NON_ZERO) ? edges[active[i]].winding : 1;
+            if ((rule == FILL_RULE_NON_ZERO) ? !winding : !(winding & 1)) continue;
+
+            const int32_t x1 = int32_t(max((edges[active[i]].x + 0x7fff) >> 16, int64_t(ctx->cminX)));
+            const int32_t x2 = int32_t(min((edges[active[i + 1]].x + 0x7fff) >> 16, int64_t(ctx->cmaxX) + 1));
+            if (x1 >= x2) continue;
+
+            //mixed mode?
+            const intptr_t offset = intptr_t(ctx->texWidth) * y + x1;
+            if (ctx->bitsPerPixel == 8) fillSpanMix((uint8_t*)ctx->drawBuff + offset, uint8_t(col), x2 - x1);
+            else blend->colorSpan((uint32_t*)ctx->drawBuff + offset, col, x2 - x1);
+
+            box[0] = min(box[0], x1);
+            box[2] = max(box[2], x2 - 1);
+            box[3] = y;
+        }
+
+        //step to next scanline and remove finished edges
+        int32_t count = 0;
+        for (int32_t i = 0; i < numActive; i++)
+        {
+            PolyEdge* edge = &edges[active[i]];
+            edge->x += edge->dx;
+            if (edge->yend > y + 1) active[count++] = active[i];
+        }
+        numActive = count;
+    }
+
+    if (box[0] <= box[2]) damageRect(ctx, box[0], box[1], box[2] - box[0] + 1, box[3] - box[1] + 1);
+
+    free(edges);
+    free(lists);
+    free(buckets);
+}
+
+//fill polygon using edge table and active edge list scanline algorithm
+//test vectors (screen resolution: 800x600)
+//pt1[] = {{300, 100}, {192, 209}, {407, 323}, {320, 380}, {214, 350}, {375, 209}};
+//pt2[] = {{169, 164}, {169, 264}, {223, 300}, {296, 209}, {214, 255}, {223, 200}, {386, 192}, {341, 273}, {404, 300}, {431, 146}};
+//pt3[] = {{97, 56}, {115, 236}, {205, 146}, {276, 146}, {151, 325}, {259, 433}, {510, 344}, {510, 218}, {242, 271}, {384, 110}};
+//pt4[] = {{256, 150}, {148, 347}, {327, 329}, {311, 204}, {401, 204}, {418, 240}, {257, 222}, {293, 365}, {436, 383}, {455, 150}};
+//pt5[] = {{287, 76}, {129, 110}, {42, 301}, {78, 353}, {146, 337}, {199, 162}, {391, 180}, {322, 353}, {321, 198}, {219, 370}, {391, 405}, {444, 232}, {496, 440}, {565, 214}};
+//pt6[] = {{659, 336}, {452, 374}, {602, 128}, {509, 90}, {433, 164}, {300, 71}, {113, 166}, {205, 185}, {113, 279}, {169, 278}, {206, 334}, {263, 279}, {355, 129}, {301, 335}, {432, 204}, {433, 297}, {245, 467}, {414, 392}, {547, 523}};
+void fillPolygon(GFX_CONTEXT* ctx, const POINT2D* points, int32_t num, uint32_t col, int32_t mode, int32_t rule)
+{
+    fillContours(ctx, points, &num, 1, col, mode, rule);
+}
+
+//fill polygon with even-odd or non-zero winding rule
+void fillPolygon(const POINT2D* points, int32_t num, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL*/, int32_t rule /* = FILL_RULE_EVEN_ODD */)
+{
+    fillPolygon(&gfxContext, points, num, col, mode, rule);
+}
+
+//accumulate signed area of line inside [0, width] x [0, height] (font-rs style)
+//each cell get the area between line and right edge of the cell, the row prefix sum is the coverage
+static void accumulateLine(float* acc, int32_t stride, float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1) return;
+
+    //walk downward, direction keep the winding
+    const float dir = (y0 < y1) ? 1.0f : -1.0f;
+    const float top = min(y0, y1);
+    const float bottom = max(y0, y1);
+    const float dxdy = (x1 - x0) / (y1 - y0);
+    const float xmin = min(x0, x1);
+    const float xmax = max(x0, x1);
+    float x = (y0 < y1) ? x0 : x1;
+
+    for (int32_t y = int32_t(top); y < int32_t(ceilf(bottom)); y++)
+    {
+        float* line = &acc[intptr_t(stride) * y];
+        const float dy = min(float(y + 1), bottom) - max(float(y), top);
+        const float xnext = min(max(x + dxdy * dy, xmin), xmax);
+        const float d = dy * dir;
+        const float xa = min(x, xnext);
+        const float xb = max(x, xnext);
+        const float xafloor = floorf(xa);
+        const int32_t xai = int32_t(xafloor);
+        const int32_t xbi = int32_t(ceilf(xb));
+
+        //line inside one cell
+        if (xbi <= xai + 1)
+        {
+            const float xmf = 0.5f * (x + xnext) - xafloor;
+            line[xai] += d - d * xmf;
+            line[xai + 1] += d * xmf;
+        }
+        else
+        {
+            //line cross many cells, area grow linear between first and last cells
+            const float sx = 1.0f / (xb - xa);
+            const float xaf = xa - xafloor;
+            const float a0 = 0.5f * sx * (1.0f - xaf) * (1.0f - xaf);
+            const float xbf = xb - xbi + 1.0f;
+            const float am = 0.5f * sx * xbf * xbf;
+            line[xai] += d * a0;
+            if (xbi == xai + 2) line[xai + 1] += d * (1.0f - a0 - am);
+            else
+            {
+                const float a1 = sx * (1.5f - xaf);
+                line[xai + 1] += d * (a1 - a0);
+                for (int32_t xi = xai + 2; xi < xbi - 1; xi++) line[xi] += d * sx;
+                const float a2 = a1 + (xbi - xai - 3) * sx;
+                line[xbi - 1] += d * (1.0f - a2 - am);
+            }
+            line[xbi] += d * am;
+        }
+
+        x = xnext;
+    }
+}
+
+//clip segment to accumulation box then accumulate it
+//parts above or below box are dropped, parts on the left or right are moved to the border as vertical lines
+static void accumulateSegment(float* acc, int32_t width, int32_t height, double x0, double y0, double x1, double y1)
+{
+    if (y0 == y1 || (y0 <= 0 && y1 <= 0) || (y0 >= height && y1 >= height)) return;
+
+    //clip rows
+    const double dxdy = (x1 - x0) / (y1 - y0);
+    const double ya = min(max(y0, 0.0), double(height));
+    const double yb = min(max(y1, 0.0), double(height));
+    x0 += (ya - y0) * dxdy;
+    x1 += (yb - y1) * dxdy;
+    y0 = ya;
+    y1 = yb;
+
+    //split where segment cross left and right borders
+    double ts[4] = { 0, 0, 0, 1 };
+    int32_t count = 1;
+    const double borders[2] = { 0, double(width) };
+    for (int32_t i = 0; i < 2; i++)
+    {
+        if ((x0 - borders[i]) * (x1 - borders[i]) < 0) ts[count++] = (borders[i] - x0) / (x1 - x0);
+    }
+
+    //keep split points in segment order
+    if (count == 3 && ts[2] < ts[1])
+    {
+        ts[3] = ts[1];
+        ts[1] = ts[2];
+        ts[2] = ts[3];
+    }
+
+    ts[count] = 1;
+    for (int32_t i = 0; i < count; i++)
+    {
+        const double xa = x0 + ts[i] * (x1 - x0);
+        const double xb = x0 + ts[i + 1] * (x1 - x0);
+        accumulateLine(acc, width + 2, float(min(max(xa, 0.0), double(width))), float(y0 + ts[i] * (y1 - y0)), float(min(max(xb, 0.0), double(width))), float(y0 + ts[i + 1] * (y1 - y0)));
+    }
+}
+
+//anti-aliased fill polygon contours with exact area coverage
+//signed areas are accumulated per cell, each row is resolved by prefix sum to coverage and alpha-blended
+//color alpha is replaced by coverage (full coverage is opaque)
+//coverage is exact unless edges cross each other inside a pixel
+//8 bits mode has no alpha-blending, so polygon is filled without anti-aliasing
+static void fillContoursAA(GFX_CONTEXT* ctx, const POINT2D* points, const int32_t* counts, int32_t contours, uint32_t col, int32_t rule)
+{
+    if (ctx->bitsPerPixel == 8)
+    {
+        fillContours(ctx, points, counts, contours, col, BLEND_MODE_NORMAL, rule);
+        return;
+    }
+
+    //bounding box of polygon (clipped)
+    int32_t total = 0;
+    double xmin = DBL_MAX, ymin = DBL_MAX, xmax = -DBL_MAX, ymax = -DBL_MAX;
+    for (int32_t c = 0; c < contours; c++)
+    {
+        for (int32_t i = 0; i < counts[c]; i++)
+        {
+            xmin = min(xmin, points[total + i].x);
+            ymin = min(ymin, points[total + i].y);
+            xmax = max(xmax, points[total + i].x);
+            ymax = max(ymax, points[total + i].y);
+        }
+        total += counts[c];
+    }
+
+    if (total < 3) return;
+    const int32_t left = int32_t(max(floor(xmin), double(ctx->cminX)));
+    const int32_t top = int32_t(max(floor(ymin), double(ctx->cminY)));
+    const int32_t right = int32_t(min(ceil(xmax), double(ctx->cmaxX) + 1));
+    const int32_t bottom = int32_t(min(ceil(ymax), double(ctx->cmaxY) + 1));
+    if (left >= right || top >= bottom) return;
+
+    //accumulation cells have 2 extra columns for lines on the right border
+    const int32_t width = right - left;
+    const int32_t height = bottom - top;
+    float* acc = (float*)calloc(intptr_t(width + 2) * height, sizeof(float));
+    uint8_t* cover = (uint8_t*)malloc(width);
+    uint32_t* colors = (uint32_t*)malloc(intptr_t(width) * sizeof(uint32_t));
+    if (!acc || !cover || !colors)
+    {
+        if (acc) free(acc);
+        if (cover) free(cover);
+        if (colors) free(colors);
+        messageBox(GFX_ERROR, "Error alloc memory!");
+        return;
+    }
+
+    //accumulate edges relative to box
+    const POINT2D* contour = points;
+    for (int32_t c = 0; c < contours; c++)
+    {
+        for (int32_t i = 0, j = counts[c] - 1; i < counts[c]; j = i++) accumulateSegment(acc, width, height, contour[j].x - left, contour[j].y - top, contour[i].x - left, contour[i].y - top);
+        contour += counts[c];
+    }
+
+    //blend mode kernels: full coverage runs are filled, partial runs are alpha-blended
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(BLEND_MODE_ALPHA);
+    void (*fullSpan)(uint32_t*, uint32_t, int32_t) = getBlendKernels(BLEND_MODE_NORMAL)->colorSpan;
+    const uint32_t rgbCol = col & 0x00ffffff;
+
+    //resolve rows, full coverage runs are filled, partial runs blend color with coverage as alpha
+    for (int32_t y = 0; y < height; y++)
+    {
+        gfxKernels.coverSpan(cover, &acc[intptr_t(width + 2) * y], width, rule);
+
+        uint32_t* dstPixels = (uint32_t*)ctx->drawBuff + (intptr_t(ctx->texWidth) * (top + y) + left);
+        int32_t x = 0;
+        while (x < width)
+        {
+            const uint8_t coverage = cover[x];
+            int32_t end = x + 1;
+            if (coverage == 0 || coverage == 255)
+            {
+                while (end < width && cover[end] == coverage) end++;
+                if (coverage) fullSpan(&dstPixels[x], rgba(rgbCol, 255), end - x);
+            }
+            else
+            {
+                colors[x] = rgba(rgbCol, coverage);
+                while (end < width && cover[end] && cover[end] < 255)
+                {
+                    colors[end] = rgba(rgbCol, cover[end]);
+                    end++;
+                }
+                blend->imageSpan(&dstPixels[x], &colors[x], end - x);
+            }
+            x = end;
+        }
+    }
+
+    damageRect(ctx, left, top, width, height);
+    free(acc);
+    free(cover);
+    free(colors);
+}
+
+//anti-aliased fill polygon with even-odd or non-zero winding rule, color alpha is replaced by coverage
+void fillPolygonAA(GFX_CONTEXT* ctx, const POINT2D* points, int32_t num, uint32_t col, int32_t rule)
+{
+    fillContoursAA(ctx, points, &num, 1, col, rule);
+}
+
+//anti-aliased fill polygon with even-odd or non-zero winding rule
+void fillPolygonAA(const POINT2D* points, int32_t num, uint32_t col, int32_t rule /* = FILL_RULE_EVEN_ODD */)
+{
+    fillPolygonAA(&gfxContext, points, num, col, rule);
+}
+
+//anti-aliased filled ellipse, outline is flattened to segments within 1/4 pixel of the curve
+void fillEllipseAA(GFX_CONTEXT* ctx, int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t col)
+{
+    //range limited
+    if (ra <= 0 || rb <= 0) return;
+
+    //sagitta of segment on the larger radius r is r * (1 - cos(pi / n))
+    const double rad = max(ra, rb);
+    const int32_t num = max(int32_t(ceil(M_PI / acos(max(1.0 - 0.25 / rad, -1.0)))), 8);
+    POINT2D* points = (POINT2D*)malloc(intptr_t(num) * sizeof(POINT2D));
+    if (!points)
+    {
+        messageBox(GFX_ERROR, "Error alloc memory!");
+        return;
+    }
+
+    for (int32_t i = 0; i < num; i++)
+    {
+        const double angle = 2 * M_PI * i / num;
+        points[i].x = xc + ra * cos(angle);
+        points[i].y = yc + rb * sin(angle);
+    }
+
+    fillContoursAA(ctx, points, &num, 1, col, FILL_RULE_NON_ZERO);
+    free(points);
+}
+
+//anti-aliased filled ellipse
+void fillEllipseAA(int32_t xc, int32_t yc, int32_t ra, int32_t rb, uint32_t col)
+{
+    fillEllipseAA(&gfxContext, xc, yc, ra, rb, col);
+}
+
+//anti-aliased filled circle
+void fillCircleAA(GFX_CONTEXT* ctx, int32_t xc, int32_t yc, int32_t radius, uint32_t col)
+{
+    fillEllipseAA(ctx, xc, yc, radius, radius, col);
+}
+
+//anti-aliased filled circle
+void fillCircleAA(int32_t xc, int32_t yc, int32_t radius, uint32_t col)
+{
+    fillEllipseAA(&gfxContext, xc, yc, radius, radius, col);
+}
+
+//initialize empty path, curves are flattened within tolerance pixels
+int32_t initPath(GFX_PATH* path, double tolerance /* = PATH_TOLERANCE */)
+{
+    memset(path, 0, sizeof(GFX_PATH));
+    if (tolerance <= 0)
+    {
+        messageBox(GFX_ERROR, "initPath: tolerance must be greater than 0!");
+        return 0;
+    }
+
+    path->mTolerance = tolerance;
+    return 1;
+}
+
+//flatten tolerance of path (zero-initialized path without initPath use the default tolerance)
+static must_inline double pathTolerance(const GFX_PATH* path)
+{
+    return (path->mTolerance > 0) ? path->mTolerance : PATH_TOLERANCE;
+}
+
+//remove all contours, buffers are kept for the next use
+void clearPath(GFX_PATH* path)
+{
+    path->mNumPoints = 0;
+    path->mNumContours = 0;
+    path->mLast.x = 0;
+    path->mLast.y = 0;
+}
+
+//release path buffers
+void freePath(GFX_PATH* path)
+{
+    if (path->mPoints) free(path->mPoints);
+    if (path->mCounts) free(path->mCounts);
+    if (path->mClosed) free(path->mClosed);
+    const double tolerance = path->mTolerance;
+    memset(path, 0, sizeof(GFX_PATH));
+    path->mTolerance = tolerance;
+}
+
+//grow path buffers for more points and contours
+static int32_t reservePath(GFX_PATH* path, int32_t points, int32_t contours)
+{
+    if (path->mNumPoints + points > path->mMaxPoints)
+    {
+        const int32_t size = max(path->mMaxPoints << 1, path->mNumPoints + points + 64);
+        POINT2D* newPoints = (POINT2D*)realloc(path->mPoints, intptr_t(size) * sizeof(POINT2D));
+        if (!newPoints)
+        {
+            messageBox(GFX_ERROR, "Error alloc memory!");
+            return 0;
+        }
+
+        path->mPoints = newPoints;
+        path->mMaxPoints = size;
+    }
+
+    if (path->mNumContours + contours > path->mMaxContours)
+    {
+        const int32_t size = max(path->mMaxContours << 1, path->mNumContours + contours + 8);
+        int32_t* newCounts = (int32_t*)realloc(path->mCounts, intptr_t(size) * sizeof(int32_t));
+        if (newCounts) path->mCounts = newCounts;
+        uint8_t* newClosed = (uint8_t*)realloc(path->mClosed, size);
+        if (newClosed) path->mClosed = newClosed;
+        if (!newCounts || !newClosed)
+        {
+            messageBox(GFX_ERROR, "Error alloc memory!");
+            return 0;
+        }
+
+        path->mMaxContours = size;
+    }
+
+    return 1;
+}
+
+//start a new contour at point(x, y), a contour with only the start point is reused
+static int32_t beginContour(GFX_PATH* path, double x, double y)
+{
+    const int32_t last = path->mNumContours - 1;
+    if (last < 0 || path->mCounts[last] > 1 || path->mClosed[last])
+    {
+        if (!reservePath(path, 1, 1)) return 0;
+        path->mCounts[path->mNumContours] = 0;
+        path->mClosed[path->mNumContours] = 0;
+        path->mNumContours++;
+        path->mNumPoints++;
+    }
+
+    path->mCounts[path->mNumContours - 1] = 1;
+    path->mPoints[path->mNumPoints - 1].x = x;
+    path->mPoints[path->mNumPoints - 1].y = y;
+    path->mLast = path->mPoints[path->mNumPoints - 1];
+    return 1;
+}
+
+//append point to current contour, a closed path start new contour at current point
+//repeated points are dropped so contours have no zero length segments
+static void addPathPoint(GFX_PATH* path, double x, double y)
+{
+    if (!path->mNumContours || path->mClosed[path->mNumContours - 1])
+    {
+        if (!beginContour(path, path->mLast.x, path->mLast.y)) return;
+    }
+
+    if (x == path->mLast.x && y == path->mLast.y) return;
+    if (!reservePath(path, 1, 0)) return;
+
+    path->mPoints[path->mNumPoints].x = x;
+    path->mPoints[path->mNumPoints].y = y;
+    path->mLast = path->mPoints[path->mNumPoints];
+    path->mNumPoints++;
+    path->mCounts[path->mNumContours - 1]++;
+}
+
+//start new contour at point(x, y)
+void pathMoveTo(GFX_PATH* path, double x, double y)
+{
+    beginContour(path, x, y);
+}
+
+//line from current point to point(x, y)
+void pathLineTo(GFX_PATH* path, double x, double y)
+{
+    addPathPoint(path, x, y);
+}
+
+//flatten rational quadratic curve by subdivision until the middle of curve is close to the chord
+static void flattenConic(GFX_PATH* path, POINT2D p0, POINT2D p1, POINT2D p2, double w, int32_t depth)
+{
+    //distance from curve middle to chord middle is w * |p0 - 2p1 + p2| / (2 * (1 + w))
+    const double dx = p0.x - 2 * p1.x + p2.x;
+    const double dy = p0.y - 2 * p1.y + p2.y;
+    if (depth >= 16 || w * sqrt(dx * dx + dy * dy) <= 2 * (1 + w) * pathTolerance(path))
+    {
+        addPathPoint(path, p2.x, p2.y);
+        return;
+    }
+
+    //split at t = 0.5, both halves have weight sqrt((1 + w) / 2)
+    const double sw = 1 + w;
+    const POINT2D q0 = { (p0.x + w * p1.x) / sw, (p0.y + w * p1.y) / sw };
+    const POINT2D q2 = { (w * p1.x + p2.x) / sw, (w * p1.y + p2.y) / sw };
+    const POINT2D mid = { (q0.x + q2.x) * 0.5, (q0.y + q2.y) * 0.5 };
+    const double hw = sqrt(sw * 0.5);
+    flattenConic(path, p0, q0, mid, hw, depth + 1);
+    flattenConic(path, mid, q2, p2, hw, depth + 1);
+}
+
+//quadratic Bezier curve from current point to point(x, y) with control point(cx, cy)
+void pathQuadTo(GFX_PATH* path, double cx, double cy, double x, double y)
+{
+    pathConicTo(path, cx, cy, x, y, 1.0);
+}
+
+//rational quadratic curve (conic) with weight w: w < 1 ellipse, w = 1 parabola, w > 1 hyperbola
+void pathConicTo(GFX_PATH* path, double cx, double cy, double x, double y, double w)
+{
+    if (w <= 0)
+    {
+        pathLineTo(path, x, y);
+        return;
+    }
+
+    const POINT2D p0 = path->mLast;
+    const POINT2D p1 = { cx, cy };
+    const POINT2D p2 = { x, y };
+    flattenConic(path, p0, p1, p2, w, 0);
+}
+
+//cubic Bezier curve from current point to point(x, y) with control points (cx1, cy1), (cx2, cy2)
+//distance to curve of n uniform segments is at most 3/4 * max(|p0 - 2p1 + p2|, |p1 - 2p2 + p3|) / n^2
+void pathCubicTo(GFX_PATH* path, double cx1, double cy1, double cx2, double cy2, double x, double y)
+{
+    const double x0 = path->mLast.x;
+    const double y0 = path->mLast.y;
+    const double d1 = sqr(x0 - 2 * cx1 + cx2) + sqr(y0 - 2 * cy1 + cy2);
+    const double d2 = sqr(cx1 - 2 * cx2 + x) + sqr(cy1 - 2 * cy2 + y);
+    const int32_t num = min(max(int32_t(ceil(sqrt(0.75 * sqrt(max(d1, d2)) / pathTolerance(path)))), 1), 1024);
+
+    for (int32_t i = 1; i < num; i++)
+    {
+        const double t = double(i) / num;
+        const double u = 1 - t;
+        const double b0 = u * u * u;
+        const double b1 = 3 * u * u * t;
+        const double b2 = 3 * u * t * t;
+        const double b3 = t * t * t;
+        addPathPoint(path, b0 * x0 + b1 * cx1 + b2 * cx2 + b3 * x, b0 * y0 + b1 * cy1 + b2 * cy2 + b3 * y);
+    }
+
+    addPathPoint(path, x, y);
+}
+
+//number of segments for arc with radius and sweep angle within tolerance
+static must_inline int32_t arcSegments(double radius, double sweep, double tolerance)
+{
+    const double step = 2 * acos(max(1.0 - tolerance / max(radius, tolerance), -1.0));
+    return min(max(int32_t(ceil(fabs(sweep) / max(step, 1e-3))), 1), 4096);
+}
+
+//elliptical arc with center (cx, cy), radius (rx, ry) rotated by angle, from start angle by sweep (radians)
+//a line is added from current point to the start of arc, the arc start a new contour when no contour is open
+void pathArc(GFX_PATH* path, double cx, double cy, double rx, double ry, double angle, double start, double sweep)
+{
+    const double ca = cos(angle);
+    const double sa = sin(angle);
+    const int32_t num = arcSegments(max(rx, ry), sweep, pathTolerance(path));
+
+    for (int32_t i = 0; i <= num; i++)
+    {
+        const double t = start + sweep * i / num;
+        const double ex = rx * cos(t);
+        const double ey = ry * sin(t);
+        const double x = cx + ex * ca - ey * sa;
+        const double y = cy + ex * sa + ey * ca;
+        if (!i && (!path->mNumContours || path->mClosed[path->mNumContours - 1])) beginContour(path, x, y);
+        else addPathPoint(path, x, y);
+    }
+}
+
+//close current contour, next command start from first point of the contour
+void pathClose(GFX_PATH* path)
+{
+    const int32_t last = path->mNumContours - 1;
+    if (last < 0 || path->mClosed[last]) return;
+
+    //drop end point that is the same as the start point
+    const POINT2D* first = &path->mPoints[path->mNumPoints - path->mCounts[last]];
+    const POINT2D* end = &path->mPoints[path->mNumPoints - 1];
+    if (path->mCounts[last] > 1 && first->x == end->x && first->y == end->y)
+    {
+        path->mNumPoints--;
+        path->mCounts[last]--;
+    }
+
+    path->mClosed[last] = 1;
+    path->mLast = *first;
+}
+
+//add round arc points around center from offset vector by sweep angle (end points are not added)
+static void addRoundPoints(GFX_PATH* outline, const POINT2D* center, double vx, double vy, double sweep, double radius, double tolerance)
+{
+    const int32_t num = arcSegments(radius, sweep, tolerance);
+    for (int32_t i = 1; i < num; i++)
+    {
+        const double t = sweep * i / num;
+        const double ct = cos(t);
+        const double st = sin(t);
+        addPathPoint(outline, center->x + vx * ct - vy * st, center->y + vx * st + vy * ct);
+    }
+}
+
+//join between segment directions (dx0, dy0) and (dx1, dy1) at point on the left side
+//inner side go through the point itself, so the outline is filled correctly by non-zero rule
+static void addStrokeJoin(GFX_PATH* outline, const POINT2D* pt, double dx0, double dy0, double dx1, double dy1, double hw, int32_t join, double tolerance)
+{
+    const double ax = -dy0 * hw, ay = dx0 * hw;
+    const double bx = -dy1 * hw, by = dx1 * hw;
+    const double cross = dx0 * dy1 - dy0 * dx1;
+    const double cosa = dx0 * dx1 + dy0 * dy1;
+
+    //almost straight
+    if (fabs(cross) < 1e-9 && cosa > 0)
+    {
+        addPathPoint(outline, pt->x + ax, pt->y + ay);
+        return;
+    }
+
+    //path turn to the left, left side is inner
+    addPathPoint(outline, pt->x + ax, pt->y + ay);
+    if (cross > 0) addPathPoint(outline, pt->x, pt->y);
+    else if (join == STROKE_JOIN_ROUND) addRoundPoints(outline, pt, ax, ay, -acos(max(min(cosa, 1.0), -1.0)), hw, tolerance);
+    else if (join == STROKE_JOIN_MITER && 1 + cosa >= 2.0 / (MITER_LIMIT * MITER_LIMIT))
+    {
+        //miter point is on the bisector, its projection to offset vector is hw^2
+        const double k = 1 / (1 + cosa);
+        addPathPoint(outline, pt->x + (ax + bx) * k, pt->y + (ay + by) * k);
+    }
+    addPathPoint(outline, pt->x + bx, pt->y + by);
+}
+
+//cap at end point of direction (dx, dy) from left side to right side
+static void addStrokeCap(GFX_PATH* outline, const POINT2D* pt, double dx, double dy, double hw, int32_t cap, double tolerance)
+{
+    const double ax = -dy * hw, ay = dx * hw;
+    if (cap == STROKE_CAP_ROUND) addRoundPoints(outline, pt, ax, ay, -M_PI, hw, tolerance);
+    else if (cap == STROKE_CAP_SQUARE)
+    {
+        addPathPoint(outline, pt->x + ax + dx * hw, pt->y + ay + dy * hw);
+        addPathPoint(outline, pt->x - ax + dx * hw, pt->y - ay + dy * hw);
+    }
+}
+
+//unit direction from point p0 to p1
+static must_inline void strokeDirection(const POINT2D* p0, const POINT2D* p1, double* dx, double* dy)
+{
+    const double len = sqrt(sqr(p1->x - p0->x) + sqr(p1->y - p0->y));
+    *dx = (p1->x - p0->x) / len;
+    *dy = (p1->y - p0->y) / len;
+}
+
+//left side of contour walking in step direction (1 forward, -1 backward, right side of forward walk)
+static void addStrokeSide(GFX_PATH* outline, const POINT2D* points, int32_t num, int32_t step, int32_t closed, double hw, int32_t join, int32_t cap, double tolerance)
+{
+    const int32_t first = (step > 0) ? 0 : num - 1;
+    double dx0 = 0, dy0 = 0, dx1 = 0, dy1 = 0;
+
+    if (closed)
+    {
+        //contour is a loop, every point has a join
+        strokeDirection(&points[first + (num - 1) * step], &points[first], &dx0, &dy0);
+        beginContour(outline, points[first].x - dy0 * hw, points[first].y + dx0 * hw);
+        for (int32_t i = 0; i < num; i++)
+        {
+            const POINT2D* pt = &points[first + i * step];
+            const POINT2D* next = &points[first + ((i + 1) % num) * step];
+            strokeDirection(pt, next, &dx1, &dy1);
+            addStrokeJoin(outline, pt, dx0, dy0, dx1, dy1, hw, join, tolerance);
+            dx0 = dx1;
+            dy0 = dy1;
+        }
+        return;
+    }
+
+    //open contour: side from first to last point, then cap over the last point
+    strokeDirection(&points[first], &points[first + step], &dx0, &dy0);
+    if (step > 0) beginContour(outline, points[first].x - dy0 * hw, points[first].y + dx0 * hw);
+    else addPathPoint(outline, points[first].x - dy0 * hw, points[first].y + dx0 * hw);
+
+    for (int32_t i = 1; i < num - 1; i++)
+    {
+        const POINT2D* pt = &points[first + i * step];
+        strokeDirection(pt, &points[first + (i + 1) * step], &dx1, &dy1);
+        addStrokeJoin(outline, pt, dx0, dy0, dx1, dy1, hw, join, tolerance);
+        dx0 = dx1;
+        dy0 = dy1;
+    }
+
+    const POINT2D* last = &points[first + (num - 1) * step];
+    addPathPoint(outline, last->x - dy0 * hw, last->y + dx0 * hw);
+    addStrokeCap(outline, last, dx0, dy0, hw, cap, tolerance);
+}
+
+//stroke one contour to outline: open contour is one loop (left side, end cap, right side, start cap)
+//closed contour is two loops of opposite direction (the hole is left by non-zero rule)
+static void strokeContour(GFX_PATH* outline, const POINT2D* points, int32_t num, int32_t closed, double hw, int32_t join, int32_t cap, double tolerance)
+{
+    //a single point is a dot of round or square cap
+    if (num == 1)
+    {
+        if (cap == STROKE_CAP_ROUND)
+        {
+            beginContour(outline, points->x + hw, points->y);
+            addRoundPoints(outline, points, hw, 0, 2 * M_PI, hw, tolerance);
+        }
+        else if (cap == STROKE_CAP_SQUARE)
+        {
+            beginContour(outline, points->x - hw, points->y - hw);
+            addPathPoint(outline, points->x + hw, points->y - hw);
+            addPathPoint(outline, points->x + hw, points->y + hw);
+            addPathPoint(outline, points->x - hw, points->y + hw);
+        }
+        return;
+    }
+
+    if (num < 3) closed = 0;
+    addStrokeSide(outline, points, num, 1, closed, hw, join, cap, tolerance);
+    addStrokeSide(outline, points, num, -1, closed, hw, join, cap, tolerance);
+}
+
+//stroke path to outline path (fill it with non-zero rule), outline can be cached and filled many times
+int32_t strokeOutline(const GFX_PATH* path, double width, int32_t join, int32_t cap, GFX_PATH* outline)
+{
+    clearPath(outline);
+    if (width <= 0) return 0;
+
+    const POINT2D* points = path->mPoints;
+    for (int32_t i = 0; i < path->mNumContours; i++)
+    {
+        strokeContour(outline, points, path->mCounts[i], path->mClosed[i], width * 0.5, join, cap, pathTolerance(path));
+        points += path->mCounts[i];
+    }
+
+    return outline->mNumContours > 0;
+}
+
+//fill path in one scanline pass, open contours are closed by a line
+void fillPath(GFX_CONTEXT* ctx, const GFX_PATH* path, uint32_t col, int32_t mode, int32_t rule)
+{
+    fillContours(ctx, path->mPoints, path->mCounts, path->mNumContours, col, mode, rule);
+}
+
+//fill path in one scanline pass
+void fillPath(const GFX_PATH* path, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */, int32_t rule /* = FILL_RULE_NON_ZERO */)
+{
+    fillPath(&gfxContext, path, col, mode, rule);
+}
+
+//anti-aliased fill path, color alpha is replaced by coverage
+void fillPathAA(GFX_CONTEXT* ctx, const GFX_PATH* path, uint32_t col, int32_t rule)
+{
+    fillContoursAA(ctx, path->mPoints, path->mCounts, path->mNumContours, col, rule);
+}
+
+//anti-aliased fill path
+void fillPathAA(const GFX_PATH* path, uint32_t col, int32_t rule /* = FILL_RULE_NON_ZERO */)
+{
+    fillPathAA(&gfxContext, path, col, rule);
+}
+
+//stroke path with width, joins and caps, the whole stroke is filled once (no overdraw at joins)
+void strokePath(GFX_CONTEXT* ctx, const GFX_PATH* path, double width, int32_t join, int32_t cap, uint32_t col, int32_t mode)
+{
+    GFX_PATH outline = { 0 };
+    outline.mTolerance = path->mTolerance;
+    if (strokeOutline(path, width, join, cap, &outline)) fillContours(ctx, outline.mPoints, outline.mCounts, outline.mNumContours, col, mode, FILL_RULE_NON_ZERO);
+    freePath(&outline);
+}
+
+//stroke path with width, joins and caps
+void strokePath(const GFX_PATH* path, double width, int32_t join, int32_t cap, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    strokePath(&gfxContext, path, width, join, cap, col, mode);
+}
+
+//anti-aliased stroke path, color alpha is replaced by coverage
+void strokePathAA(GFX_CONTEXT* ctx, const GFX_PATH* path, double width, int32_t join, int32_t cap, uint32_t col)
+{
+    GFX_PATH outline = { 0 };
+    outline.mTolerance = path->mTolerance;
+    if (strokeOutline(path, width, join, cap, &outline)) fillContoursAA(ctx, outline.mPoints, outline.mCounts, outline.mNumContours, col, FILL_RULE_NON_ZERO);
+    freePath(&outline);
+}
+
+//anti-aliased stroke path
+void strokePathAA(const GFX_PATH* path, double width, int32_t join, int32_t cap, uint32_t col)
+{
+    strokePathAA(&gfxContext, path, width, join, cap, col);
+}
+
+//draw thick polyline: the stroke with joins and caps is one outline filled once, so joints have no seams or overdraw
+//BLEND_MODE_ANTIALIASED fill the outline with area coverage
+void drawPolyline(GFX_CONTEXT* ctx, const POINT2D* points, int32_t num, double width, int32_t join, int32_t cap, uint32_t col, int32_t mode)
+{
+    if (num <= 0 || width <= 0) return;
+
+    //outline has about 2 points per vertex on each side, reserve once for long traces
+    GFX_PATH line = { 0 };
+    GFX_PATH outline = { 0 };
+    line.mTolerance = PATH_TOLERANCE;
+    outline.mTolerance = PATH_TOLERANCE;
+    if (reservePath(&line, num, 1) && reservePath(&outline, 4 * num + 64, 2))
+    {
+        pathMoveTo(&line, points[0].x, points[0].y);
+        for (int32_t i = 1; i < num; i++) pathLineTo(&line, points[i].x, points[i].y);
+
+        if (strokeOutline(&line, width, join, cap, &outline))
+        {
+            if (mode == BLEND_MODE_ANTIALIASED) fillContoursAA(ctx, outline.mPoints, outline.mCounts, outline.mNumContours, col, FILL_RULE_NON_ZERO);
+            else fillContours(ctx, outline.mPoints, outline.mCounts, outline.mNumContours, col, mode, FILL_RULE_NON_ZERO);
+        }
+    }
+
+    freePath(&line);
+    freePath(&outline);
+}
+
+//draw thick polyline with joins and caps
+void drawPolyline(const POINT2D* points, int32_t num, double width, int32_t join, int32_t cap, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    drawPolyline(&gfxContext, points, num, width, join, cap, col, mode);
+}
+
+//generate random polygon
+void randomPolygon(const int32_t cx, const int32_t cy, const int32_t avgRadius, double irregularity, double spikeyness, const int32_t numVerts, POINT2D* points)
+{
+    //valid params
+    spikeyness = clamp(spikeyness, 0, 1) * avgRadius;
+    irregularity = clamp(irregularity, 0, 1) * 2 * M_PI / numVerts;
+    
+    //generate n angle steps
+    double angleSteps[1024] = { 0 };
+    const double lower = (2 * M_PI / numVerts) - irregularity;
+    const double upper = (2 * M_PI / numVerts) + irregularity;
+    double sum = 0;
+
+    for (int32_t i = 0; i < numVerts; i++)
+    {
+        const double tmp = uniformRand(lower, upper);
+        angleSteps[i] = tmp;
+        sum += tmp;
+    }
+
+    //normalize the steps so that points 0 and points n+1 are the same
+    const double koef = sum / (2 * M_PI);
+    for (int32_t i = 0; i < numVerts; i++) angleSteps[i] /= koef;
+
+    //now generate the points
+    double angle = uniformRand(0, 2 * M_PI);
+    const double radius = 2.0 * avgRadius;
+
+    for (int32_t i = 0; i < numVerts; i++)
+    {
+        const double gaussValue = gaussianRand(avgRadius, spikeyness);
+        const double rad = clamp(gaussValue, 0, radius);
+        points[i].x = cx + rad * cos(angle);
+        points[i].y = cy + rad * sin(angle);
+        angle += angleSteps[i];
+    }
+}
+
+//FX-effect: fade circle
+void fadeCircle(int32_t dir, uint32_t col, uint32_t mswait)
+{
+    int32_t i = 0, x = 0, y = 0;
+
+    switch (dir)
+    {
+    case 0:
+        for (i = 0; i < 29; i++)
+        {
+            for (y = 0; y <= gfxContext.cmaxY / 40; y++)
+            {
+                for (x = 0; x <= gfxContext.cmaxX / 40; x++) fillCircle(x * 40 + 20, y * 40 + 20, i, col);
+            }
+            render();
+            delay(mswait);
+        }
+        break;
+
+    case 1:
+        for (i = -gfxContext.cmaxY / 40; i < 29; i++)
+        {
+            for (y = 0; y <= gfxContext.cmaxY / 40; y++)
+            {
+                for (x = 0; x <= gfxContext.cmaxX / 40; x++)
+                {
+                    if (gfxContext.cmaxY / 40 - y + i < 29) fillCircle(x * 40 + 20, y * 40 + 20, gfxContext.cmaxY / 40 - y + i, col);
+                }
+            }
+            render();
+            delay(mswait);
+        }
+        break;
+
+    case 2:
+        for (i = -gfxContext.cmaxX / 40; i < 29; i++)
+        {
+            for (y = 0; y <= gfxContext.cmaxY / 40; y++)
+            {
+                for (x = 0; x <= gfxContext.cmaxX / 40; x++)
+                {
+                    if (gfxContext.cmaxX / 40 - x + i < 29) fillCircle(x * 40 + 20, y * 40 + 20, gfxContext.cmaxX / 40 - x + i, col);
+                }
+            }
+            render();
+            delay(mswait);
+        }
+        break;
+
+    case 3:
+        for (i = -gfxContext.cmaxX / 40; i < 60; i++)
+        {
+            for (y = 0; y <= gfxContext.cmaxY / 40; y++)
+            {
+                for (x = 0; x <= gfxContext.cmaxX / 40; x++)
+                {
+                    if (gfxContext.cmaxX / 40 - x - y + i < 29) fillCircle(x * 40 + 20, y * 40 + 20, gfxContext.cmaxX / 40 - x - y + i, col);
+                }
+            }
+            render();
+            delay(mswait);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+//FX-effect: fade Rollo
+void fadeRollo(int32_t dir, uint32_t col, uint32_t mswait)
+{
+    int32_t i = 0, j = 0;
+
+    switch (dir)
+    {
+    case 0:
+        for (i = 0; i < 20; i++)
+        {
+            for (j = 0; j <= gfxContext.cmaxY / 10; j++) horizLine(0, j * 20 + i, gfxContext.cmaxX, col);
+            render();
+            delay(mswait);
+        }
+        break;
+
+    case 1:
+        for (i = 0; i < 20; i++)
+        {
+            for (j = 0; j <= gfxContext.cmaxX / 10; j++) vertLine(j * 20 + i, 0, gfxContext.cmaxY, col);
+            render();
+            delay(mswait);
+        }
+        break;
+
+    case 2:
+        for (i = 0; i < 20; i++)
+        {
+            for (j = 0; j <= gfxContext.cmaxX / 10; j++)
+            {
+                vertLine(j * 20 + i, 0, gfxContext.cmaxY, col);
+                if (j * 10 < gfxContext.cmaxY) horizLine(0, j * 20 + i, gfxContext.cmaxX, col);
+            }
+            render();
+            delay(mswait);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+//simulation visual page in VGA mode for compatible code
+//setActivePage and setVisualPage must be a paired function
+void setActivePage(GFX_IMAGE* page)
+{
+    changeDrawBuffer(page->mData, page->mWidth, page->mHeight);
+}
+
+//set render page to current page
+//setActivePage and setVisualPage must be a paired function
+void setVisualPage(GFX_IMAGE* page)
+{
+    changeDrawBuffer(page->mData, page->mWidth, page->mHeight);
+    render();
+    restoreDrawBuffer();
+}
+
+//create a new GFX image
+int32_t newImage(int32_t width, int32_t height, GFX_IMAGE* img)
+{
+    //calculate buffer size (should be 32-bytes alignment)
+    const uint32_t rowBytes = width * gfxContext.bytesPerPixel;
+    
+    //check for 32-bytes alignment
+    if (rowBytes % 32)
+    {
+        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
+        return 0;
+    }
+
+    //check size
+    const uint32_t memSize = height * rowBytes;
+    if (!memSize)
+    {
+        messageBox(GFX_ERROR, "Error create image, size = 0!");
+        return 0;
+    }
+
+    //32-bytes alignment for SIMD optimize
+    img->mData = SDL_aligned_alloc(32, memSize);
+    if (!img->mData)
+    {
+        messageBox(GFX_ERROR, "Error alloc memory, size:%lu", memSize);
+        return 0;
+    }
+
+    //store image info
+    img->mWidth         = width;
+    img->mHeight        = height;
+    img->mSize          = memSize;
+    img->mRowBytes      = rowBytes;
+    img->mPremultiplied = 0;
+    memset(img->mData, 0, memSize);
+    return 1;
+}
+
+//update GFX image with new width, new height
+int32_t updateImage(int32_t width, int32_t height, GFX_IMAGE* img)
+{
+    //no need update
+    if (img->mWidth == width && img->mHeight == height) return 1;
+
+    //calculate new buffer size (should be 32-bytes alignment)
+    const uint32_t rowBytes = width * gfxContext.bytesPerPixel;
+
+    //check for 32-bytes alignment
+    if (rowBytes % 32)
+    {
+        messageBox(GFX_ERROR, "GFXLIB required 32-bytes alignment:%d", width);
+        return 0;
+    }
+
+    //check size
+    const uint32_t msize = height * rowBytes;
+    if (!msize)
+    {
+        messageBox(GFX_ERROR, "Error update image size = 0!");
+        return 0;
+    }
+
+    //reallocate new memory with new size (32-bytes alignment)
+    if (img->mData) SDL_aligned_free(img->mData);
+    img->mData = SDL_aligned_alloc(32, msize);
+    if (!img->mData)
+    {
+        messageBox(GFX_ERROR, "Error alloc memory with size: %lu", msize);
+        return 0;
+    }
+
+    //store image width and height
+    img->mWidth         = width;
+    img->mHeight        = height;
+    img->mSize          = msize;
+    img->mRowBytes      = rowBytes;
+    img->mPremultiplied = 0;
+    memset(img->mData, 0, msize);
+    return 1;
+}
+
+//cleanup image buffer
+void freeImage(GFX_IMAGE* img)
+{
+    if (img && img->mData)
+    {
+        SDL_aligned_free(img->mData);
+        img->mData          = NULL;
+        img->mWidth         = 0;
+        img->mHeight        = 0;
+        img->mSize          = 0;
+        img->mRowBytes      = 0;
+        img->mPremultiplied = 0;
+    }
+}
+
+//clear image data buffer
+void clearImage(GFX_IMAGE* img)
+{
+    if (img && img->mData) memset(img->mData, 0, img->mSize);
+}
+
+//convert 32 bits image colors to pre-multiplied alpha (C = C * A >> 8) once, alpha channel is kept
+//putImage and putSprite then alpha-blend it with D = S + (D * (256 - A)) >> 8 (sprite key color must be pre-multiplied too)
+void premultiplyImage(GFX_IMAGE* img)
+{
+    if (gfxContext.bitsPerPixel <= 8 || !img || !img->mData || img->mPremultiplied) return;
+
+    uint32_t* pixels = (uint32_t*)img->mData;
+    const uint32_t msize = img->mSize >> 2;
+    for (uint32_t i = 0; i < msize; i++)
+    {
+        const uint32_t col = pixels[i];
+        const uint32_t cover = col >> 24;
+        const uint32_t rb = (((col & 0x00ff00ff) * cover) >> 8) & 0x00ff00ff;
+        const uint32_t g = (((col & 0x0000ff00) * cover) >> 8) & 0x0000ff00;
+        pixels[i] = (col & 0xff000000) | rb | g;
+    }
+
+    img->mPremultiplied = 1;
+}
+
+//get GFX image buffer functions
+void getImageMix(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    void *imgData = img->mData;
+    __asm {
+        mov     edi, imgData
+        mov     esi, drawBuff
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        add     esi, eax
+        mov     edx, texWidth
+        sub     edx, width
+        mov     eax, width
+        shr     eax, 2
+        mov     ebx, width
+        and     ebx, 3
+    next:
+        mov     ecx, eax
+        rep     movsd
+        mov     ecx, ebx
+        rep     movsb
+        add     esi, edx
+        dec     height
+        jnz     next
+    }
+#else
+    //calculate starting address
+    uint8_t* srcPixels = (uint8_t*)img->mData;
+    const uint8_t* dstPixels = (const uint8_t*)drawBuff + (texWidth * y + x);
+
+    //lines-by-lines, rows of image and draw buffer have no alignment guarantee
+    for (int32_t i = 0; i < height; i++)
+    {
+        memcpy(srcPixels, dstPixels, width);
+        srcPixels += img->mWidth;
+        dstPixels += texWidth;
+    }
+#endif
+}
+
+//get GFX image buffer functions
+void getImageNormal(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    void *imgData = img->mData;
+    __asm {
+        mov     edi, imgData
+        mov     esi, drawBuff
+        mov     eax, y
+        mul     texWidth
+        add     eax, x
+        shl     eax, 2
+        add     esi, eax
+        mov     edx, texWidth
+        sub     edx, width
+        shl     edx, 2
+    next:
+        mov     ecx, width
+        shr     ecx, 1
+        jz      once
+    plot:
+        movq    mm0, [esi]
+        movq    [edi], mm0
+        add     edi, 8
+        add     esi, 8
+        dec     ecx
+        jnz     plot
+    once:
+        test    width, 1
+        jz      end
+        movd    mm0, [esi]
+        movd    [edi], mm0
+        add     edi, 4
+        add     esi, 4
+    end:
+        add     esi, edx
+        dec     height
+        jnz     next
+        emms
+    }
+#else
+    //calculate starting address
+    uint32_t* srcPixels = (uint32_t*)img->mData;
+    const uint32_t* dstPixels = (const uint32_t*)drawBuff + (texWidth * y + x);
+
+    //lines-by-lines
+    for (int32_t i = 0; i < height; i++)
+    {
+        gfxKernels.copySpan(srcPixels, dstPixels, width);
+        srcPixels += img->mWidth;
+        dstPixels += texWidth;
+    }
+#endif
+}
+
+//get GFX image buffer (export function)
+void getImage(GFX_CONTEXT* ctx, int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
+{
+    //calculate new position
+    const int32_t x1 = x + (width - 1);
+    const int32_t y1 = y + (height - 1);
+
+    //clip image to context boundaries
+    const int32_t lx = max(x, ctx->cminX);
+    const int32_t ly = max(y, ctx->cminY);
+    const int32_t lx1 = min(x1, ctx->cmaxX);
+    const int32_t ly1 = min(y1, ctx->cmaxY);
+
+    //initialize loop variables
+    const int32_t lwidth = (lx1 - lx) + 1;
+    const int32_t lheight = (ly1 - ly) + 1;
+
+    //check for loop
+    if (lwidth <= 0|| lheight <= 0) return;
+
+    //none image pointer?
+    if (!img->mData)
+    {
+        //create new image
+        if (!newImage(lwidth, lheight, img)) return;
+    }
+    else
+    {
+        //update an existing image
+        if (!updateImage(lwidth, lheight, img)) return;
+    }
+
+    //screen pixels are not pre-multiplied
+    img->mPremultiplied = 0;
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        getImageMix(ctx, lx, ly, lwidth, lheight, img);
+        return;
+    }
+
+    //height color mode
+    getImageNormal(ctx, lx, ly, lwidth, lheight, img);
+}
+
+//get GFX image buffer (export function)
+void getImage(int32_t x, int32_t y, int32_t width, int32_t height, GFX_IMAGE* img)
+{
+    getImage(&gfxContext, x, y, width, height, img);
+}
+
+//put GFX image to points (x1, y1)
+void putImageMix(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        push    ebx
+        mov     edx, imgWidth
+        sub     edx, width
+        mov     eax, width
+        shr     eax, 2
+        mov     ebx, width
+        and     ebx, 3
+    next:
+        mov     ecx, eax
+        rep     movsd
+        mov     ecx, ebx
+        rep     movsb
+        add     edi, [esp]
+        add     esi, edx
+        dec     height
+        jnz     next
+        pop     ebx
+    }
+#else
+    //calculate starting address
+    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * ly + lx);
+    const uint8_t* srcPixels = (const uint8_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
+
+    //lines-by-lines, rows of image and draw buffer have no alignment guarantee
+    for (int32_t i = 0; i < height; i++)
+    {
+        memcpy(dstPixels, srcPixels, width);
+        dstPixels += texWidth;
+        srcPixels += img->mWidth;
+    }
+#endif
+}
+
+#ifdef _USE_ASM
+//put GFX image to points (x1, y1)
+void putImageNormal(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        shl     eax, 2
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        shl     eax, 2
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        shl     ebx, 2
+        mov     edx, imgWidth
+        sub     edx, width
+        shl     edx, 2
+    next:
+        mov     ecx, width
+        shr     ecx, 1
+        jz      once
+    plot:
+        movq    mm0, [esi]
+        movq    [edi], mm0
+        add     edi, 8
+        add     esi, 8
+        dec     ecx
+        jnz     plot
+    once:
+        test    width, 1
+        jz      end
+        movd    mm0, [esi]
+        movd    [edi], mm0
+        add     edi, 4
+        add     esi, 4
+    end:
+        add     edi, ebx
+        add     esi, edx
+        dec     height
+        jnz     next
+        emms
+    }
+}
+
+//put GFX image with add background color
+void putImageAdd(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        shl     eax, 2
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        shl     eax, 2
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        shl     ebx, 2
+        mov     edx, imgWidth
+        sub     edx, width
+        shl     edx, 2
+    again:
+        mov     ecx, width
+        shr     ecx, 1
+        jz      once
+    plot:
+        movq    mm0, [esi]
+        paddusb mm0, [edi]
+        movq    [edi], mm0
+        add     esi, 8
+        add     edi, 8
+        dec     ecx
+        jnz     plot
+    once:
+        test    width, 1
+        jz      end
+        movd    mm0, [esi]
+        paddusb mm0, [edi]
+        movd    [edi], mm0
+        add     esi, 4
+        add     edi, 4
+    end:
+        add     edi, ebx
+        add     esi, edx
+        dec     height
+        jnz     again
+        emms
+    }
+}
+
+//put GFX image with sub background color
+void putImageSub(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        shl     eax, 2
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        shl     eax, 2
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        shl     ebx, 2
+        mov     edx, imgWidth
+        sub     edx, width
+        shl     edx, 2
+    again:
+        mov     ecx, width
+        shr     ecx, 1
+        jz      once
+    plot:
+        movq    mm0, [esi]
+        psubusb mm0, [edi]
+        movq    [edi], mm0
+        add     esi, 8
+        add     edi, 8
+        dec     ecx
+        jnz     plot
+    once:
+        test    width, 1
+        jz      end
+        movd    mm0, [esi]
+        psubusb mm0, [edi]
+        movd    [edi], mm0
+        add     esi, 4
+        add     edi, 4
+    end:
+        add     edi, ebx
+        add     esi, edx
+        dec     height
+        jnz     again
+        emms
+    }
+}
+
+//put GFX image with logical and background color
+void putImageAnd(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        shl     eax, 2
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        shl     eax, 2
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        shl     ebx, 2
+        mov     edx, imgWidth
+        sub     edx, width
+        shl     edx, 2
+    again:
+        mov     ecx, width
+        shr     ecx, 1
+        jz      once
+    plot:
+        movq    mm0, [esi]
+        pand    mm0, [edi]
+        movq    [edi], mm0
+        add     esi, 8
+        add     edi, 8
+        dec     ecx
+        jnz     plot
+    once:
+        test    width, 1
+        jz      end
+        movd    mm0, [esi]
+        pand    mm0, [edi]
+        movd    [edi], mm0
+        add     esi, 4
+        add     edi, 4
+    end:
+        add     edi, ebx
+        add     esi, edx
+        dec     height
+        jnz     again
+        emms
+    }
+}
+
+//put GFX image with logical x-or background color
+void putImageXor(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        shl     eax, 2
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        shl     eax, 2
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        shl     ebx, 2
+        mov     edx, imgWidth
+        sub     edx, width
+        shl     edx, 2
+    again:
+        mov     ecx, width
+        shr     ecx, 1
+        jz      once
+    plot:
+        movq    mm0, [esi]
+        pxor    mm0, [edi]
+        movq    [edi], mm0
+        add     esi, 8
+        add     edi, 8
+        dec     ecx
+        jnz     plot
+    once:
+        test    width, 1
+        jz      end
+        movd    mm0, [esi]
+        pxor    mm0, [edi]
+        movd    [edi], mm0
+        add     esi, 4
+        add     edi, 4
+    end:
+        add     edi, ebx
+        add     esi, edx
+        dec     height
+        jnz     again
+        emms
+    }
+}
+
+//put GFX image with transparent color (must be RGBA format)
+void putImageAlpha(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, ly
+        mul         texWidth
+        add         eax, lx
+        shl         eax, 2
+        add         edi, eax
+        mov         esi, imgData
+        mov         eax, ly
+        sub         eax, y
+        mul         imgWidth
+        mov         ebx, lx
+        sub         ebx, x
+        add         eax, ebx
+        shl         eax, 2
+        add         esi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        mov         edx, imgWidth
+        sub         edx, width
+        shl         edx, 2
+    again:
+        mov         ecx, width
+    plot:
+        mov         eax, [esi]
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+        movd        mm0, [edi]
+        movd        mm1, [esi]
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+        add         edi, 4
+        add         esi, 4
+        dec         ecx
+        jnz         plot
+        add         edi, ebx
+        add         esi, edx
+        dec         height
+        jnz         again
+        emms
+    }
+}
+#endif
+
+//put GFX image to draw buffer (export function)
+void putImage(GFX_CONTEXT* ctx, int32_t x, int32_t y, const GFX_IMAGE* img, int32_t mode)
+{
+    //calculate new position
+    const int32_t x1 = x + (img->mWidth - 1);
+    const int32_t y1 = y + (img->mHeight - 1);
+
+    //clip image to context boundaries
+    const int32_t lx = max(x, ctx->cminX);
+    const int32_t ly = max(y, ctx->cminY);
+    const int32_t lx1 = min(x1, ctx->cmaxX);
+    const int32_t ly1 = min(y1, ctx->cmaxY);
+
+    //initialize loop variables
+    const int32_t width = (lx1 - lx) + 1;
+    const int32_t height = (ly1 - ly) + 1;
+
+    //check for loop
+    if (width <= 0 || height <= 0) return;
+    damageRect(ctx, lx, ly, width, height);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        putImageMix(ctx, x, y, lx, ly, width, height, img);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        putImageNormal(ctx, x, y, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_ADD:
+        putImageAdd(ctx, x, y, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_SUB:
+        putImageSub(ctx, x, y, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_AND:
+        putImageAnd(ctx, x, y, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_XOR:
+        putImageXor(ctx, x, y, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        if (img->mPremultiplied) break;
+        putImageAlpha(ctx, x, y, lx, ly, width, height, img);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getImageKernels(img, mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    //lines-by-lines
+    uint32_t* dstPixels = (uint32_t*)ctx->drawBuff + (ctx->texWidth * ly + lx);
+    const uint32_t* srcPixels = (const uint32_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
+    for (int32_t i = 0; i < height; i++)
+    {
+        blend->imageSpan(dstPixels, srcPixels, width);
+        dstPixels += ctx->texWidth;
+        srcPixels += img->mWidth;
+    }
+}
+
+//put GFX image to draw buffer (export function)
+void putImage(int32_t x, int32_t y, const GFX_IMAGE* img, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    putImage(&gfxContext, x, y, img, mode);
+}
+
+//copy 8 bits span, skip key color pixels (AVX2 version compare and blendv 32 pixels per loop, count >= 32)
+//tail overlap last 32 pixels, copying a visible pixel twice gives the same result
+static target_avx2 void spriteSpanMixAVX2(uint8_t* dst, const uint8_t* src, const uint8_t keyColor, const int32_t count)
+{
+    const __m256i key = _mm256_set1_epi8(keyColor);
+    for (int32_t i = 0; i < count; i += 32)
+    {
+        const int32_t pos = min(i, count - 32);
+        const __m256i col = _mm256_loadu_si256((const __m256i*)&src[pos]);
+        const __m256i mask = _mm256_cmpeq_epi8(col, key);
+        _mm256_storeu_si256((__m256i*)&dst[pos], _mm256_blendv_epi8(col, _mm256_loadu_si256((const __m256i*)&dst[pos]), mask));
+    }
+}
+
+//copy 8 bits span, skip key color pixels
+static must_inline void spriteSpanMix(uint8_t* dst, const uint8_t* src, const uint8_t keyColor, const int32_t count)
+{
+    if (kernelLevel >= KERNEL_LEVEL_AVX2 && count >= 32)
+    {
+        spriteSpanMixAVX2(dst, src, keyColor, count);
+        return;
+    }
+
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] != keyColor) dst[i] = src[i];
+    }
+}
+
+//put a sprite at points(x1, y1) with key color (don't render key color)
+void putSpriteMix(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+#ifdef _USE_ASM
+    void* imgData = img->mData;
+    const int32_t imgWidth  = img->mWidth;
+
+    __asm {
+        mov     edi, drawBuff
+        mov     eax, ly
+        mul     texWidth
+        add     eax, lx
+        add     edi, eax
+        mov     esi, imgData
+        mov     eax, ly
+        sub     eax, y
+        mul     imgWidth
+        mov     ebx, lx
+        sub     ebx, x
+        add     eax, ebx
+        add     esi, eax
+        mov     ebx, texWidth
+        sub     ebx, width
+        mov     edx, imgWidth
+        sub     edx, width
+    next:
+        mov     ecx, width
+    plot:
+        lodsb
+        cmp     al, byte ptr[keyColor]
+        je      skip
+        mov     [edi], al
+    skip:
+        inc     edi
+        dec     ecx
+        jnz     plot
+        add     edi, ebx
+        add     esi, edx
+        dec     height
+        jnz     next
+    }
+#else
+    //calculate starting address
+    uint8_t* dstPixels = (uint8_t*)drawBuff + (texWidth * ly + lx);
+    const uint8_t* srcPixels = (const uint8_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
+
+    //lines-by-lines
+    for (int32_t i = 0; i < height; i++)
+    {
+        spriteSpanMix(dstPixels, srcPixels, uint8_t(keyColor), width);
+        dstPixels += texWidth;
+        srcPixels += img->mWidth;
+    }
+#endif
+}
+
+#ifdef _USE_ASM
+//put a sprite at points(x1, y1) with key color (don't render key color)
+void putSpriteNormal(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, ly
+        mul         texWidth
+        add         eax, lx
+        shl         eax, 2
+        add         edi, eax
+        mov         esi, imgData
+        mov         eax, ly
+        sub         eax, y
+        mul         imgWidth
+        mov         ebx, lx
+        sub         ebx, x
+        add         eax, ebx
+        shl         eax, 2
+        add         esi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        mov         edx, imgWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm4, keyColor
+        punpckldq   mm4, mm4
+        mov         eax, 0ffffffffh
+        movd        mm5, eax
+        punpckldq   mm5, mm5
+        mov         eax, 0ffffffh
+        movd        mm6, eax
+        punpckldq   mm6, mm6
+    next:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+    plot:
+        movq        mm0, [esi]
+        movq        mm2, mm4
+        pand        mm0, mm6
+        pcmpeqd     mm2, mm0
+        movq        mm1, [edi]
+        pand        mm1, mm2
+        pxor        mm2, mm5
+        pand        mm0, mm2
+        por         mm1, mm0
+        movq        [edi], mm1
+        add         esi, 8
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          skip
+        add         esi, 4
+        add         edi, 4
+        mov         eax, [esi]
+        cmp         eax, keyColor
+        je          skip
+        mov         [edi - 4], eax
+    skip:
+        add         edi, ebx
+        add         esi, edx
+        dec         height
+        jnz         next
+        emms
+    }
+}
+
+//put a sprite at points(x1, y1) with key color (don't render key color), add with background color
+void putSpriteAdd(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, ly
+        mul         texWidth
+        add         eax, lx
+        shl         eax, 2
+        add         edi, eax
+        mov         esi, imgData
+        mov         eax, ly
+        sub         eax, y
+        mul         imgWidth
+        mov         ebx, lx
+        sub         ebx, x
+        add         eax, ebx
+        shl         eax, 2
+        add         esi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        mov         edx, imgWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm4, keyColor
+        punpckldq   mm4, mm4
+        mov         eax, 0ffffffffh
+        movd        mm5, eax
+        punpckldq   mm5, mm5
+        mov         eax, 0ffffffh
+        movd        mm6, eax
+        punpckldq   mm6, mm6
+    next:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+    plot:
+        movq        mm0, [esi]
+        movq        mm2, mm4
+        pand        mm0, mm6
+        pcmpeqd     mm2, mm0
+        pxor        mm2, mm5
+        pand        mm0, mm2
+        paddusb     mm0, [edi]
+        movq        [edi], mm0
+        add         esi, 8
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          skip
+        add         esi, 4
+        add         edi, 4
+        mov         eax, [esi]
+        cmp         eax, keyColor
+        je          skip
+        movd        mm3, eax
+        paddusb     mm3, [edi - 4]
+        movd        [edi - 4], mm3
+    skip:
+        add         edi, ebx
+        add         esi, edx
+        dec         height
+        jnz         next
+        emms
+    }
+}
+
+//put a sprite at points(x1, y1) with key color (don't render key color), sub with background color
+void putSpriteSub(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, ly
+        mul         texWidth
+        add         eax, lx
+        shl         eax, 2
+        add         edi, eax
+        mov         esi, imgData
+        mov         eax, ly
+        sub         eax, y
+        mul         imgWidth
+        mov         ebx, lx
+        sub         ebx, x
+        add         eax, ebx
+        shl         eax, 2
+        add         esi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        mov         edx, imgWidth
+        sub         edx, width
+        shl         edx, 2
+        movd        mm4, keyColor
+        punpckldq   mm4, mm4
+        mov         eax, 0ffffffffh
+        movd        mm5, eax
+        punpckldq   mm5, mm5
+        mov         eax, 0ffffffh
+        movd        mm6, eax
+        punpckldq   mm6, mm6
+    next:
+        mov         ecx, width
+        shr         ecx, 1
+        jz          once
+    plot:
+        movq        mm0, [esi]
+        movq        mm2, mm4
+        pand        mm0, mm6
+        pcmpeqd     mm2, mm0
+        movq        mm1, [edi]
+        pand        mm1, mm2
+        pxor        mm2, mm5
+        pand        mm0, mm2
+        psubusb     mm0, [edi]
+        por         mm0, mm1
+        movq        [edi], mm0
+        add         esi, 8
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        width, 1
+        jz          skip
+        add         esi, 4
+        add         edi, 4
+        mov         eax, [esi]
+        cmp         eax, keyColor
+        je          skip
+        movd        mm3, eax
+        psubusb     mm3, [edi - 4]
+        movd        [edi - 4], mm3
+    skip:
+        add         edi, ebx
+        add         esi, edx
+        dec         height
+        jnz         next
+        emms
+    }
+}
+
+//put a sprite at points(x1, y1) with key color (don't render key color) and blending color
+void putSpriteAlpha(GFX_CONTEXT* ctx, const int32_t x, const int32_t y, const uint32_t keyColor, const int32_t lx, const int32_t ly, const int32_t width, const int32_t height, const GFX_IMAGE* img)
+{
+    void* drawBuff = ctx->drawBuff;
+    const int32_t texWidth = ctx->texWidth;
+    void* imgData = img->mData;
+    const int32_t imgWidth = img->mWidth;
+
+    __asm {
+        mov         edi, drawBuff
+        mov         eax, ly
+        mul         texWidth
+        add         eax, lx
+        shl         eax, 2
+        add         edi, eax
+        mov         esi, imgData
+        mov         eax, ly
+        sub         eax, y
+        mul         imgWidth
+        mov         ebx, lx
+        sub         ebx, x
+        add         eax, ebx
+        shl         eax, 2
+        add         esi, eax
+        mov         ebx, texWidth
+        sub         ebx, width
+        shl         ebx, 2
+        mov         edx, imgWidth
+        sub         edx, width
+        shl         edx, 2
+    next:
+        mov         ecx, width
+    plot:
+        mov         eax, [esi]
+        and         eax, 00ffffffh
+        cmp         eax, keyColor
+        je          skip
+        mov         eax, [esi]
+        shr         eax, 24
+        pxor        mm5, mm5
+        movd        mm7, eax
+        pshufw	    mm7, mm7, 0
+        neg	        eax
+        add	        eax, 256
+        movd	    mm6, eax
+        pshufw	    mm6, mm6, 0
+        movd        mm0, [edi]
+        movd        mm1, [esi]
+        punpcklbw   mm0, mm5
+        punpcklbw   mm1, mm5
+        pmullw      mm0, mm6
+        pmullw      mm1, mm7
+        paddusw     mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm0
+        movd        [edi], mm0
+    skip:
+        add         edi, 4
+        add         esi, 4
+        dec         ecx
+        jnz         plot
+        add         edi, ebx
+        add         esi, edx
+        dec         height
+        jnz         next
+        emms
+    }
+}
+#endif
+
+//put a sprite at points(x1, y1) with key color (don't render key color), sub with background color
+void putSprite(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t keyColor, const GFX_IMAGE* img, int32_t mode)
+{
+    //calculate new position
+    const int32_t x1 = x + (img->mWidth - 1);
+    const int32_t y1 = y + (img->mHeight - 1);
+
+    //clip image to context boundaries
+    const int32_t lx = max(x, ctx->cminX);
+    const int32_t ly = max(y, ctx->cminY);
+    const int32_t lx1 = min(x1, ctx->cmaxX);
+    const int32_t ly1 = min(y1, ctx->cmaxY);
+
+    //initialize loop variables
+    const int32_t width = (lx1 - lx) + 1;
+    const int32_t height = (ly1 - ly) + 1;
+
+    //check for loop
+    if (width <= 0 || height <= 0) return;
+    damageRect(ctx, lx, ly, width, height);
+
+    //mixed mode?
+    if (ctx->bitsPerPixel == 8)
+    {
+        putSpriteMix(ctx, x, y, keyColor, lx, ly, width, height, img);
+        return;
+    }
+
+#ifdef _USE_ASM
+    //height color mode (MMX version)
+    switch (mode)
+    {
+    case BLEND_MODE_NORMAL:
+        putSpriteNormal(ctx, x, y, keyColor, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_ADD:
+        putSpriteAdd(ctx, x, y, keyColor, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_SUB:
+        putSpriteSub(ctx, x, y, keyColor, lx, ly, width, height, img);
+        return;
+
+    case BLEND_MODE_ALPHA:
+        if (img->mPremultiplied) break;
+        putSpriteAlpha(ctx, x, y, keyColor, lx, ly, width, height, img);
+        return;
+
+    default:
+        break;
+    }
+#endif
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getImageKernels(img, mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    //lines-by-lines
+    uint32_t* dstPixels = (uint32_t*)ctx->drawBuff + (ctx->texWidth * ly + lx);
+    const uint32_t* srcPixels = (const uint32_t*)img->mData + (img->mWidth * (ly - y) + (lx - x));
+    for (int32_t i = 0; i < height; i++)
+    {
+        blend->spriteSpan(dstPixels, srcPixels, keyColor, width);
+        dstPixels += ctx->texWidth;
+        srcPixels += img->mWidth;
+    }
+}
+
+//put a sprite at points(x1, y1) with key color (don't render key color), sub with background color
+void putSprite(int32_t x, int32_t y, uint32_t keyColor, const GFX_IMAGE* img, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    putSprite(&gfxContext, x, y, keyColor, img, mode);
+}
+
+//type of sprite pixel: 0 = key color, 1 = opaque, 2 = translucent (alpha < 255, 32 bits only)
+static must_inline int32_t spritePixelType(const GFX_IMAGE* img, const int32_t bytesPerPixel, const uint32_t keyColor, const int32_t x, const int32_t y)
+{
+    const uint8_t* row = (const uint8_t*)img->mData + intptr_t(img->mRowBytes) * y;
+    if (bytesPerPixel == 1) return row[x] != uint8_t(keyColor);
+
+    const uint32_t col = ((const uint32_t*)row)[x];
+    if ((col & 0x00ffffff) == keyColor) return 0;
+    return (col >> 24) == 0xff ? 1 : 2;
+}
+
+//compile sprite: convert image and key color to run-length list of visible runs (key color pixels are removed)
+//runs are split where alpha changes, so putSprite can copy opaque runs and blend translucent ones only
+int32_t compileSprite(const GFX_IMAGE* img, uint32_t keyColor, GFX_SPRITE* spr)
+{
+    if (!img || !img->mData || img->mWidth <= 0 || img->mHeight <= 0 || !spr)
+    {
+        messageBox(GFX_ERROR, "compileSprite: invalid image!");
+        return 0;
+    }
+
+    const int32_t width = img->mWidth;
+    const int32_t height = img->mHeight;
+    const int32_t bytesPerPixel = img->mRowBytes / width;
+    if (bytesPerPixel != 1 && bytesPerPixel != 4)
+    {
+        messageBox(GFX_ERROR, "compileSprite: wrong pixel format:%d", bytesPerPixel);
+        return 0;
+    }
+
+    //first pass: count runs and visible pixels
+    int32_t runs = 0, pixels = 0;
+    for (int32_t y = 0; y < height; y++)
+    {
+        int32_t last = 0;
+        for (int32_t x = 0; x < width; x++)
+        {
+            const int32_t type = spritePixelType(img, bytesPerPixel, keyColor, x, y);
+            if (type && type != last) runs++;
+            if (type) pixels++;
+            last = type;
+        }
+    }
+
+    //allocate run tables and packed pixels
+    memset(spr, 0, sizeof(GFX_SPRITE));
+    spr->mRows = (int32_t*)calloc(intptr_t(height) + 1, sizeof(int32_t));
+    spr->mRuns = (GFX_SPRITE_RUN*)calloc(max(runs, 1), sizeof(GFX_SPRITE_RUN));
+    spr->mPixels = calloc(max(pixels, 1), bytesPerPixel);
+    if (!spr->mRows || !spr->mRuns || !spr->mPixels)
+    {
+        freeSprite(spr);
+        messageBox(GFX_ERROR, "Error alloc memory!");
+        return 0;
+    }
+
+    spr->mWidth         = width;
+    spr->mHeight        = height;
+    spr->mBytesPerPixel = bytesPerPixel;
+    spr->mPremultiplied = img->mPremultiplied;
+
+    //second pass: store runs and copy their pixels
+    uint8_t* dst = (uint8_t*)spr->mPixels;
+    GFX_SPRITE_RUN* run = spr->mRuns;
+    int32_t offset = 0;
+    for (int32_t y = 0; y < height; y++)
+    {
+        spr->mRows[y] = int32_t(run - spr->mRuns);
+        const uint8_t* src = (const uint8_t*)img->mData + intptr_t(img->mRowBytes) * y;
+
+        int32_t x = 0;
+        while (x < width)
+        {
+            const int32_t type = spritePixelType(img, bytesPerPixel, keyColor, x, y);
+            if (!type)
+            {
+                x++;
+                continue;
+            }
+
+            //extend run while pixel type is the same
+            int32_t count = 1;
+            while (x + count < width && spritePixelType(img, bytesPerPixel, keyColor, x + count, y) == type) count++;
+
+            run->mX         = x;
+            run->mCount     = count;
+            run->mOffset    = offset;
+            run->mAlpha     = (type == 2);
+            memcpy(&dst[intptr_t(offset) * bytesPerPixel], &src[intptr_t(x) * bytesPerPixel], intptr_t(count) * bytesPerPixel);
+
+            offset += count;
+            x += count;
+            run++;
+        }
+    }
+
+    spr->mRows[height] = runs;
+    return 1;
+}
+
+//release compiled sprite
+void freeSprite(GFX_SPRITE* spr)
+{
+    if (!spr) return;
+    if (spr->mRows) free(spr->mRows);
+    if (spr->mRuns) free(spr->mRuns);
+    if (spr->mPixels) free(spr->mPixels);
+    memset(spr, 0, sizeof(GFX_SPRITE));
+}
+
+//draw one row of compiled sprite, dst point to sprite column 0, clip to sprite columns [lx, rx)
+//opaque runs use opaqueSpan(dst, src, count), translucent runs use alphaSpan(dst, src, count)
+template<typename OPAQUE_SPAN, typename ALPHA_SPAN>
+static must_inline void putSpriteRuns(uint32_t* dst, const GFX_SPRITE* spr, const int32_t row, const int32_t lx, const int32_t rx, OPAQUE_SPAN opaqueSpan, ALPHA_SPAN alphaSpan)
+{
+    const uint32_t* pixels = (const uint32_t*)spr->mPixels;
+    for (int32_t i = spr->mRows[row]; i < spr->mRows[row + 1]; i++)
+    {
+        const GFX_SPRITE_RUN* run = &spr->mRuns[i];
+        if (run->mX >= rx) break;
+
+        const int32_t sx = max(run->mX, lx);
+        const int32_t ex = min(run->mX + run->mCount, rx);
+        if (sx >= ex) continue;
+        if (run->mAlpha) alphaSpan(&dst[sx], &pixels[run->mOffset + sx - run->mX], ex - sx);
+        else opaqueSpan(&dst[sx], &pixels[run->mOffset + sx - run->mX], ex - sx);
+    }
+}
+
+//put a compiled sprite at points(x, y), key color runs are skipped without testing pixels
+//NORMAL and ALPHA modes copy opaque runs, translucent runs and other modes use the sprite span of blend mode
+void putSprite(GFX_CONTEXT* ctx, int32_t x, int32_t y, const GFX_SPRITE* spr, int32_t mode)
+{
+    if (!spr->mRows) return;
+
+    //clip sprite to context boundaries
+    const int32_t lx = max(x, ctx->cminX);
+    const int32_t ly = max(y, ctx->cminY);
+    const int32_t lx1 = min(x + spr->mWidth - 1, ctx->cmaxX);
+    const int32_t ly1 = min(y + spr->mHeight - 1, ctx->cmaxY);
+
+    //check for loop
+    if (lx1 < lx || ly1 < ly) return;
+
+    //sprite and context must have the same pixel format
+    if (spr->mBytesPerPixel != ctx->bytesPerPixel)
+    {
+        messageBox(GFX_WARNING, "putSprite: sprite pixel format (%d) differ from context!", spr->mBytesPerPixel);
+        return;
+    }
+
+    damageRect(ctx, lx, ly, (lx1 - lx) + 1, (ly1 - ly) + 1);
+
+    //mixed mode: just copy visible runs
+    if (ctx->bitsPerPixel == 8)
+    {
+        const uint8_t* pixels = (const uint8_t*)spr->mPixels;
+        uint8_t* dstPixels = (uint8_t*)ctx->drawBuff + intptr_t(ctx->texWidth) * ly;
+        for (int32_t row = ly - y; row <= ly1 - y; row++)
+        {
+            for (int32_t i = spr->mRows[row]; i < spr->mRows[row + 1]; i++)
+            {
+                const GFX_SPRITE_RUN* run = &spr->mRuns[i];
+                const int32_t sx = max(run->mX, lx - x);
+                const int32_t ex = min(run->mX + run->mCount, lx1 - x + 1);
+                if (sx < ex) memcpy(&dstPixels[x + sx], &pixels[run->mOffset + sx - run->mX], intptr_t(ex) - sx);
+            }
+            dstPixels += ctx->texWidth;
+        }
+        return;
+    }
+
+    //blend mode span kernels
+    const GFX_BLEND_KERNELS* blend = getBlendKernels(mode);
+    if (!blend)
+    {
+        messageBox(GFX_WARNING, "Unknown blend mode:%d", mode);
+        return;
+    }
+
+    //pre-multiplied sprites have their own alpha-blending
+    if (mode == BLEND_MODE_ALPHA && spr->mPremultiplied) blend = &premultipliedKernels;
+
+    //key color is already removed, a key with alpha bits never match rgb channels
+    void (*spriteSpan)(uint32_t*, const uint32_t*, uint32_t, int32_t) = blend->spriteSpan;
+    const auto alphaSpan = [spriteSpan](uint32_t* dst, const uint32_t* src, int32_t count) { spriteSpan(dst, src, 0xff000000, count); };
+
+    //opaque pixels blend to source color in ALPHA mode, so they are copied too
+    const int32_t copyOpaque = (mode == BLEND_MODE_NORMAL || mode == BLEND_MODE_ALPHA);
+
+    //lines-by-lines
+    uint32_t* dstPixels = (uint32_t*)ctx->drawBuff + (intptr_t(ctx->texWidth) * ly + x);
+    for (int32_t row = ly - y; row <= ly1 - y; row++)
+    {
+        if (copyOpaque) putSpriteRuns(dstPixels, spr, row, lx - x, lx1 - x + 1, gfxKernels.copySpan, alphaSpan);
+        else putSpriteRuns(dstPixels, spr, row, lx - x, lx1 - x + 1, alphaSpan, alphaSpan);
+        dstPixels += ctx->texWidth;
+    }
+}
+
+//put a compiled sprite at points(x, y)
+void putSprite(int32_t x, int32_t y, const GFX_SPRITE* spr, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    putSprite(&gfxContext, x, y, spr, mode);
+}
+
+//boundary clip points at (x,y)
+must_inline int32_t clampPoint(const int32_t width, const int32_t height, int32_t* x, int32_t* y)
+{
+    int32_t ret = 1;
+
+    if (*x < 0)
+    { 
+        *x = 0;
+        ret = 0;
+    }
+    else if (*x >= width)
+    { 
+        *x = width - 1;
+        ret = 0;
+    }
+
+    if (*y < 0)
+    {
+        *y = 0;
+        ret = 0;
+    }
+    else if (*y >= height)
+    {
+        *y = height - 1;
+        ret = 0;
+    }
+
+    return ret;
+}
+
+//get source pixel
+must_inline uint32_t clampOffset(const int32_t width, const int32_t height, const int32_t x, const int32_t y)
+{
+    //x-range check
+    const int32_t xx = clamp(x, 0, width - 1);
+    const int32_t yy = clamp(y, 0, height - 1);
+
+    //return offset at (x,y)
+    return yy * width + xx;
+}
+
+//clamp pixels at offset (x,y)
+must_inline uint32_t clampPixels(const GFX_IMAGE* img, int32_t x, int32_t y)
+{
+    const uint32_t* psrc = (const uint32_t*)img->mData;
+    const int32_t insrc = clampPoint(img->mWidth, img->mHeight, &x, &y);
+    uint32_t result = psrc[y * img->mWidth + x];
+    if (!insrc)
+    {
+        ARGB* pcol = (ARGB*)&result;
+        pcol->a = 0;
+    }
+    return result;
+}
+
+//alpha-blending pixel
+must_inline uint32_t alphaBlend(const uint32_t dstCol, const uint32_t srcCol)
+{
+#ifdef _USE_ASM
+    __asm {
+        pxor        mm7, mm7
+        movd        mm0, srcCol
+        movd        mm2, dstCol
+        punpcklbw   mm0, mm7
+        punpcklbw   mm2, mm7
+        movq        mm1, mm0
+        punpckhwd   mm1, mm1
+        psubw       mm0, mm2
+        punpckhdq   mm1, mm1
+        psllw       mm2, 8
+        pmullw      mm0, mm1
+        paddw       mm2, mm0
+        psrlw       mm2, 8
+        packuswb    mm2, mm7
+        movd        eax, mm2
+        emms
+    }
+#else
+    const uint8_t cover = srcCol >> 24;
+    const uint8_t rcover = 255 - cover;
+    const uint32_t rb = ((dstCol & 0x00ff00ff) * rcover + (srcCol & 0x00ff00ff) * cover);
+    const uint32_t ag = (((dstCol & 0xff00ff00) >> 8) * rcover + ((srcCol & 0xff00ff00) >> 8) * cover);
+    return ((rb & 0xff00ff00) >> 8) | (ag & 0xff00ff00);
+#endif
+}
+
+//smooth get pixel (average pixel calculation)
+must_inline uint32_t smoothGetPixel(const GFX_IMAGE* img, const int32_t sx, const int32_t sy)
+{
+    const int32_t lx = sx >> 16;
+    const int32_t ly = sy >> 16;
+    const ARGB* psrc = (const ARGB*)img->mData;
+    const ARGB* p0 = (const ARGB*)&psrc[clampOffset(img->mWidth, img->mHeight, lx, ly)];
+    const ARGB* p1 = (const ARGB*)&psrc[clampOffset(img->mWidth, img->mHeight, lx + 1, ly)];
+
+    uint32_t col = 0;
+    ARGB* pcol = (ARGB*)&col;
+    pcol->a = (p0->a + p1->a) >> 1;
+    pcol->r = (p0->r + p1->r) >> 1;
+    pcol->g = (p0->g + p1->g) >> 1;
+    pcol->b = (p0->b + p1->b) >> 1;
+    return col;
+}
+
+//bilinear get pixel with FIXED-POINT (signed 16.16)
+must_inline target_sse41 uint32_t bilinearGetPixelCenter(const GFX_IMAGE* psrc, const int32_t sx, const int32_t sy)
+{
+    const int32_t width = psrc->mWidth;
+    const uint32_t* pixels = (const uint32_t*)psrc->mData;
+
+#ifdef _USE_ASM
+    __asm {
+        mov         eax, sx
+        mov         edx, sy
+        pxor        mm7, mm7
+        shl         edx, 16
+        shl         eax, 16
+        shr         edx, 24
+        shr         eax, 24
+        movd        mm6, edx
+        movd        mm5, eax
+        mov         edx, sy
+        mov         eax, width
+        shl         eax, 2
+        sar         edx, 16
+        imul        edx, eax
+        add         edx, pixels
+        add         eax, edx
+        mov         ecx, sx
+        sar         ecx, 16
+        movd        mm2, dword ptr[eax + ecx * 4]
+        movd        mm0, dword ptr[eax + ecx * 4 + 4]
+        punpcklwd   mm5, mm5
+        punpcklwd   mm6, mm6
+        movd        mm3, dword ptr[edx + ecx * 4]
+        movd        mm1, dword ptr[edx + ecx * 4 + 4]
+        punpckldq   mm5, mm5
+        punpcklbw   mm0, mm7
+        punpcklbw   mm1, mm7
+        punpcklbw   mm2, mm7
+        punpcklbw   mm3, mm7
+        psubw       mm0, mm2
+        psubw       mm1, mm3
+        psllw       mm2, 8
+        psllw       mm3, 8
+        pmullw      mm0, mm5
+        pmullw      mm1, mm5
+        punpckldq   mm6, mm6
+        paddw       mm0, mm2
+        paddw       mm1, mm3
+        psrlw       mm0, 8
+        psrlw       mm1, 8
+        psubw       mm0, mm1
+        psllw       mm1, 8
+        pmullw      mm0, mm6
+        paddw       mm0, mm1
+        psrlw       mm0, 8
+        packuswb    mm0, mm7
+        movd        eax, mm0
+        emms
+    }
+#else
+    const uint32_t* pixel0 = &pixels[(sy >> 16) * width + (sx >> 16)];
+    const uint32_t* pixel1 = &pixel0[width];
+
+    const uint32_t pu = uint8_t(sx >> 8);
+    const uint32_t pv = uint8_t(sy >> 8);
+    const uint32_t w3 = (pu * pv) >> 8;
+    const uint32_t w2 = pu - w3;
+    const uint32_t w1 = pv - w3;
+    const uint32_t w0 = 256 - w1 - w2 - w3;
+
+    //zero all
+    const __m128i zero = _mm_setzero_si128();
+
+    //load 4 pixels [(x, y),(x + 1, y),(x, y + 1),(x + 1, y + 1)]
+    __m128i p12 = _mm_loadl_epi64((const __m128i*)pixel0);
+    __m128i p34 = _mm_loadl_epi64((const __m128i*)pixel1);
+
+    //convert RGBA RGBA RGBA RGAB to RRRR GGGG BBBB AAAA
+    p12 = _mm_unpacklo_epi8(p12, p34);
+    p34 = _mm_unpackhi_epi64(p12, zero);
+    p12 = _mm_unpacklo_epi8(p12, p34);
+
+    //extend to 16bits
+    __m128i rg = _mm_unpacklo_epi8(p12, zero);
+    __m128i ba = _mm_unpackhi_epi8(p12, zero);
+
+    //initialize pixel weights to 16bits integer w4 w3 w2 w1
+    __m128i weight = _mm_set_epi32(w3, w1, w2, w0);
+
+    //make 32bit -> 2 x 16bits
+    weight = _mm_packs_epi32(weight, weight);
+
+    //rg = [w1*r1 + w2*r2 | w3*r3 + w4*r4 | w1*g1 + w2*g2 | w3*g3 + w4*g4]
+    rg = _mm_madd_epi16(rg, weight);
+
+    //ba = [w1*b1 + w2*b2 | w3*b3 + w4*b4 | w1*a1 + w2*a2 | w3*a3 + w4*a4]
+    ba = _mm_madd_epi16(ba, weight);
+
+    //horizontal add that will produce the output values (in 32bit)
+    weight = _mm_hadd_epi32(rg, ba);
+    weight = _mm_srli_epi32(weight, 8);
+
+    //convert 32bit->8bit
+    weight = _mm_packus_epi32(weight, zero);
+    weight = _mm_packus_epi16(weight, zero);
+    return _mm_cvtsi128_si32(weight);
+#endif
+}
+
+//bilinear get pixel with FIXED-POINT (signed 16.16)
+must_inline target_sse41 uint32_t bilinearGetPixelBorder(const GFX_IMAGE* psrc, const int32_t sx, const int32_t sy)
+{
+    //convert to fixed points
+    const int32_t lx = sx >> 16;
+    const int32_t ly = sy >> 16;
+
+    //load the 4 neighboring pixels
+    uint32_t pixels[4] = { 0 };
+    pixels[0] = clampPixels(psrc, lx    , ly    );
+    pixels[1] = clampPixels(psrc, lx + 1, ly    );
+    pixels[2] = clampPixels(psrc, lx    , ly + 1);
+    pixels[3] = clampPixels(psrc, lx + 1, ly + 1);
+
+    GFX_IMAGE img = { 0 };
+    img.mData = pixels;
+    img.mWidth = 2;
+    img.mHeight = 2;
+    img.mRowBytes = 8;
+    return bilinearGetPixelCenter(&img, sx & 0xffff, sy & 0xffff);
+}
+
+//bilinear get pixel with FIXED-POINT (signed 16.16)
+//general optimize version, fast speed
+must_inline uint32_t bilinearGetPixelFixed(const GFX_IMAGE* psrc, const int32_t sx, const int32_t sy)
+{
+    //convert to fixed points
+    const int32_t lx = sx >> 16;
+    const int32_t ly = sy >> 16;
+    const uint32_t u = uint8_t((sx & 0xffff) >> 8);
+    const uint32_t v = uint8_t((sy & 0xffff) >> 8);
+
+    //load the 4 neighboring pixels
+    const uint32_t p0 = clampPixels(psrc, lx    , ly    );
+    const uint32_t p1 = clampPixels(psrc, lx + 1, ly    );
+    const uint32_t p2 = clampPixels(psrc, lx    , ly + 1);
+    const uint32_t p3 = clampPixels(psrc, lx + 1, ly + 1);
+
+    //calculate the weights for each pixel
+    const uint32_t w3 = (u * v) >> 8;
+    const uint32_t w2 = u - w3;
+    const uint32_t w1 = v - w3;
+    const uint32_t w0 = 256 - w1 - w2 - w3;
+
+    uint32_t rb = ( p0 & 0x00ff00ff) * w0;
+    uint32_t ag = ((p0 & 0xff00ff00) >> 8) * w0;
+    rb += ( p1 & 0x00ff00ff) * w2;
+    ag += ((p1 & 0xff00ff00) >> 8) * w2;
+    rb += ( p2 & 0x00ff00ff) * w1;
+    ag += ((p2 & 0xff00ff00) >> 8) * w1;
+    rb += ( p3 & 0x00ff00ff) * w3;
+    ag += ((p3 & 0xff00ff00) >> 8) * w3;
+    return (ag & 0xff00ff00) | ((rb & 0xff00ff00) >> 8);
+}
+
+//AVX2 calculate the weights of pixel
+must_inline target_avx2 __m256d calcWeights(const double x, const double y)
+{
+    __m256d ymm0 = _mm256_set1_pd(x);
+    __m256d ymm1 = _mm256_set1_pd(y);
+    __m256d ymm2 = _mm256_unpacklo_pd(ymm0, ymm1);
+
+    ymm0 = _mm256_floor_pd(ymm2);
+    ymm1 = _mm256_sub_pd(ymm2, ymm0);
+    ymm2 = _mm256_sub_pd(_mm256_set1_pd(1), ymm1);
+
+    __m256d ymm3 = _mm256_unpacklo_pd(ymm2, ymm1);
+    ymm3 = _mm256_permute4x64_pd(ymm3, _MM_SHUFFLE(1, 0, 1, 0));
+
+    __m256d ymm4 = _mm256_permute2f128_pd(ymm2, ymm1, _MM_SHUFFLE2(16, 1));
+    ymm4 = _mm256_mul_pd(ymm3, ymm4);
+
+    return _mm256_mul_pd(ymm4, _mm256_set1_pd(256));
+}
+
+//get pixels bilinear with AVX2
+must_inline target_avx2 uint32_t bilinearGetPixelAVX2(const GFX_IMAGE* psrc, const double x, const double y)
+{
+    //calculate offset at (x,y)
+    const int32_t lx = int32_t(x);
+    const int32_t ly = int32_t(y);
+
+    //clamp 4 neighboring pixels
+    uint32_t pixels[4] = { 0 };
+    pixels[0] = clampPixels(psrc, lx    , ly    );
+    pixels[1] = clampPixels(psrc, lx + 1, ly    );
+    pixels[2] = clampPixels(psrc, lx    , ly + 1);
+    pixels[3] = clampPixels(psrc, lx + 1, ly + 1);
+
+    //load 4 pixels [(x, y),(x + 1, y),(x, y + 1),(x + 1, y + 1)]
+    __m128i p12 = _mm_loadl_epi64((const __m128i*)&pixels[0]);
+    __m128i p34 = _mm_loadl_epi64((const __m128i*)&pixels[2]);
+
+    //convert RGBA RGBA RGBA RGBA to RRRR GGGG BBBB AAAA
+    p12 = _mm_unpacklo_epi8(p12, p34);
+    p34 = _mm_unpackhi_epi64(p12, _mm_setzero_si128());
+    p12 = _mm_unpacklo_epi8(p12, p34);
+
+    //extend to 16bits
+    __m128i rg = _mm_unpacklo_epi8(p12, _mm_setzero_si128());
+    __m128i ba = _mm_unpackhi_epi8(p12, _mm_setzero_si128());
+
+    //convert floating points weights to 16bits integer w4 w3 w2 w1
+    __m128i weight = _mm256_cvtpd_epi32(calcWeights(x, y));
+
+    //make 32bit -> 2 x 16bits
+    weight = _mm_packs_epi32(weight, weight);
+
+    //rg = [w1*r1 + w2*r2 | w3*r3 + w4*r4 | w1*g1 + w2*g2 | w3*g3 + w4*g4]
+    rg = _mm_madd_epi16(rg, weight);
+
+    //ba = [w1*b1 + w2*b2 | w3*b3 + w4*b4 | w1*a1 + w2*a2 | w3*a3 + w4*a4]
+    ba = _mm_madd_epi16(ba, weight);
+
+    //horizontal add that will produce the output values (in 32bit)
+    weight = _mm_hadd_epi32(rg, ba);
+    weight = _mm_srli_epi32(weight, 8);
+
+    //convert 32bit->8bit
+    weight = _mm_packus_epi32(weight, _mm_setzero_si128());
+    weight = _mm_packus_epi16(weight, _mm_setzero_si128());
+    return _mm_cvtsi128_si32(weight);
+}
+
+//calculate sin-cos of an angle (merge sin/cos functions)
+must_inline void sincos(const double angle, double* sina, double* cosa)
+{
+#ifdef _USE_ASM
+    __asm {
+        fld     angle
+        mov     eax, sina
+        mov     edx, cosa
+        fsincos
+        fstp    qword ptr[edx]
+        fstp    qword ptr[eax]
+    }
+#else
+    *sina = sin(angle);
+    *cosa = cos(angle);
+#endif
+}
+
+//bi-cubic helper (this function will be replaced by sin(x)/x for optimize
+must_inline double cubicHermite(const double a, const double b, const double c, const double d, const double fract)
+{
+    const double aa = -a / 2.0 + 1.5 * b - 1.5 * c + d / 2.0;
+    const double bb = a - 2.5 * b + 2.0 * c - d / 2.0;
+    const double cc = -a / 2.0 + c / 2.0;
+    return aa * fract * fract * fract + bb * fract * fract + cc * fract + b;
+}
+
+//calculate function sin(x)/x replacement for cubicHermite
+//so this will add to lookup table for speedup improvement
+must_inline double sinXDivX(const double b)
+{
+    //control constant, i.e: -2,-1,-0.75,-0.5
+    const double ctl = -1;
+    const double x = (b < 0) ? -b : b;
+    const double x2 = x * x, x3 = x2 * x;
+
+    if (x <= 1) return (ctl + 2) * x3 - (ctl + 3) * x2 + 1;
+    else if (x <= 2) return ctl * x3 - (5 * ctl) * x2 + (8 * ctl) * x - (4 * ctl);
+    return 0;
+}
+
+//4 signed 32bits sum of bits of data (simulation for _mm_madd_epi32)
+must_inline target_sse41 int32_t _mm_hsum_epi32(const __m128i val)
+{
+    //_mm_extract_epi32 is slower
+    __m128i result = _mm_add_epi32(val, _mm_srli_si128(val, 8));
+    result = _mm_add_epi32(result, _mm_srli_si128(result, 4));
+    return _mm_cvtsi128_si32(result);
+}
+
+//calculate pixel by bi-cubic interpolation (original version)
+//this is show how to bi-cubic interpolation works, don't use for production
+must_inline uint32_t bicubicGetPixel(const GFX_IMAGE* img, const double sx, const double sy)
+{
+    const int32_t px = int32_t(sx);
+    const double fx = sx - int32_t(sx);
+
+    const int32_t py = int32_t(sy);
+    const double fy = sy - int32_t(sy);
+
+    const uint32_t width = img->mWidth;
+    const uint32_t height = img->mHeight;
+    const uint32_t* psrc = (const uint32_t*)img->mData;
+
+    //clamp 16 pixels at center and border
+    const uint8_t* p00 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py - 1)];
+    const uint8_t* p10 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py - 1)];
+    const uint8_t* p20 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py - 1)];
+    const uint8_t* p30 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py - 1)];
+    const uint8_t* p01 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py    )];
+    const uint8_t* p11 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py    )];
+    const uint8_t* p21 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py    )];
+    const uint8_t* p31 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py    )];
+    const uint8_t* p02 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 1)];
+    const uint8_t* p12 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 1)];
+    const uint8_t* p22 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 1)];
+    const uint8_t* p32 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 1)];
+    const uint8_t* p03 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 2)];
+    const uint8_t* p13 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 2)];
+    const uint8_t* p23 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 2)];
+    const uint8_t* p33 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 2)];
+
+    //mapping destination pointer
+    uint32_t dst = 0;
+    uint8_t* pdst = (uint8_t*)&dst;
+
+    //start interpolate bi-cubically for each pixel channel
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const double col0 = cubicHermite(p00[i], p10[i], p20[i], p30[i], fx);
+        const double col1 = cubicHermite(p01[i], p11[i], p21[i], p31[i], fx);
+        const double col2 = cubicHermite(p02[i], p12[i], p22[i], p32[i], fx);
+        const double col3 = cubicHermite(p03[i], p13[i], p23[i], p33[i], fx);
+        const double pcol = cubicHermite(col0, col1, col2, col3, fy);
+
+        //saturation check
+        pdst[i] = uint8_t(clamp(pcol, 0.0, 255.0));
+    }
+
+    return dst;
+}
+
+//this calculate pixel with boundary so quite slowly (using fixed points)
+must_inline uint32_t bicubicGetPixelFixed(const GFX_IMAGE* img, const int16_t *sintab, const int32_t sx, const int32_t sy)
+{
+    //peek offset at (px,py)
+    const int32_t px = sx >> 16, py = sy >> 16;
+
+    const uint32_t width = img->mWidth;
+    const uint32_t height = img->mHeight;
+    const uint32_t* psrc = (const uint32_t*)img->mData;
+
+    //calculate 16 around pixels
+    const uint8_t *p00 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py - 1)];
+    const uint8_t *p01 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py - 1)];
+    const uint8_t *p02 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py - 1)];
+    const uint8_t *p03 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py - 1)];
+    const uint8_t *p10 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py    )];
+    const uint8_t *p11 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py    )];
+    const uint8_t *p12 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py    )];
+    const uint8_t *p13 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py    )];
+    const uint8_t *p20 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 1)];
+    const uint8_t *p21 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 1)];
+    const uint8_t *p22 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 1)];
+    const uint8_t *p23 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 1)];
+    const uint8_t *p30 = (const uint8_t*)&psrc[clampOffset(width, height, px - 1, py + 2)];
+    const uint8_t *p31 = (const uint8_t*)&psrc[clampOffset(width, height, px    , py + 2)];
+    const uint8_t *p32 = (const uint8_t*)&psrc[clampOffset(width, height, px + 1, py + 2)];
+    const uint8_t *p33 = (const uint8_t*)&psrc[clampOffset(width, height, px + 2, py + 2)];
+
+    //4 pixels weights
+    const int32_t u = uint8_t(sx >> 8), v = uint8_t(sy >> 8);
+    const int32_t u0 = sintab[256 + u], u1 = sintab[u];
+    const int32_t u2 = sintab[256 - u], u3 = sintab[512 - u];
+    const int32_t v0 = sintab[256 + v], v1 = sintab[v];
+    const int32_t v2 = sintab[256 - v], v3 = sintab[512 - v];
+
+    uint32_t color = 0;
+    uint8_t* pcol = (uint8_t*)&color;
+
+    //a,r,g,b channel
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const int32_t s1 = (p00[i] * u0 + p01[i] * u1 + p02[i] * u2 + p03[i] * u3) * v0;
+        const int32_t s2 = (p10[i] * u0 + p11[i] * u1 + p12[i] * u2 + p13[i] * u3) * v1;
+        const int32_t s3 = (p20[i] * u0 + p21[i] * u1 + p22[i] * u2 + p23[i] * u3) * v2;
+        const int32_t s4 = (p30[i] * u0 + p31[i] * u1 + p32[i] * u2 + p33[i] * u3) * v3;
+        pcol[i] = clamp((s1 + s2 + s3 + s4) >> 16, 0, 255);
+    }
+
+    return color;
+}
+
+//fast calculate pixel at center, don't care boundary
+must_inline target_sse41 uint32_t bicubicGetPixelCenter(const GFX_IMAGE* img, const int16_t* stable, const int32_t sx, const int32_t sy)
+{
+    const int32_t pu = uint8_t(sx >> 8), pv = uint8_t(sy >> 8);
+    const int16_t u0 = stable[256 + pu], u1 = stable[pu];
+    const int16_t u2 = stable[256 - pu], u3 = stable[512 - pu];
+
+    const __m128i xpart = _mm_setr_epi16(u0, u1, u2, u3, u0, u1, u2, u3); //U0 U1 U2 U3 U0 U1 U2 U3
+    const __m128i ypart = _mm_setr_epi32(stable[256 + pv], stable[pv], stable[256 - pv], stable[512 - pv]);
+
+    const uint32_t* psrc = (const uint32_t*)img->mData;
+    const uint32_t *pixel0 = (const uint32_t*)&psrc[((sy >> 16) - 1) * img->mWidth + ((sx >> 16) - 1)];
+    const uint32_t *pixel1 = &pixel0[img->mWidth];
+    const uint32_t *pixel2 = &pixel1[img->mWidth];
+    const uint32_t *pixel3 = &pixel2[img->mWidth];
+
+    //load 16 pixels for calculation
+    __m128i p0 = _mm_lddqu_si128((const __m128i*)pixel0); //P00 P01 P02 P03
+    __m128i p1 = _mm_lddqu_si128((const __m128i*)pixel1); //P10 P11 P12 P13
+    __m128i p2 = _mm_lddqu_si128((const __m128i*)pixel2); //P20 P21 P22 P23
+    __m128i p3 = _mm_lddqu_si128((const __m128i*)pixel3); //P30 P31 P32 P33
+
+    p0 = _mm_shuffle_epi8(p0, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B0 G0 R0 A0
+    p1 = _mm_shuffle_epi8(p1, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B1 G1 R1 A1
+    p2 = _mm_shuffle_epi8(p2, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B2 G2 R2 A2
+    p3 = _mm_shuffle_epi8(p3, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15)); //B3 G3 R3 A3
+
+    const __m128i bg01 = _mm_unpacklo_epi32(p0, p1); //B0 B1 G0 G1
+    const __m128i ra01 = _mm_unpackhi_epi32(p0, p1); //R0 R1 A0 A1
+    const __m128i bg23 = _mm_unpacklo_epi32(p2, p3); //B2 B3 G2 G3
+    const __m128i ra23 = _mm_unpackhi_epi32(p2, p3); //R2 R3 A2 A3
+
+    const __m128i b01 = _mm_unpacklo_epi8(bg01, _mm_setzero_si128());
+    const __m128i b23 = _mm_unpacklo_epi8(bg23, _mm_setzero_si128());
+
+    //P00 * U0 + P01 * U1 + P02 * U2 + P03 * U3
+    const __m128i sb = _mm_hadd_epi32(_mm_madd_epi16(b01, xpart), _mm_madd_epi16(b23, xpart));
+
+    const __m128i g01 = _mm_unpackhi_epi8(bg01, _mm_setzero_si128());
+    const __m128i g23 = _mm_unpackhi_epi8(bg23, _mm_setzero_si128());
+
+    //P10 * U0 + P11 * U1 + P12 * U2 + P13 * U3
+    const __m128i sg = _mm_hadd_epi32(_mm_madd_epi16(g01, xpart), _mm_madd_epi16(g23, xpart));
+
+    const __m128i r01 = _mm_unpacklo_epi8(ra01, _mm_setzero_si128());
+    const __m128i r23 = _mm_unpacklo_epi8(ra23, _mm_setzero_si128());
+
+    //P20 * U0 + P21 * U1 + P22 * U2 + P23 * U3
+    const __m128i sr = _mm_hadd_epi32(_mm_madd_epi16(r01, xpart), _mm_madd_epi16(r23, xpart));
+
+    const __m128i a01 = _mm_unpackhi_epi8(ra01, _mm_setzero_si128());
+    const __m128i a23 = _mm_unpackhi_epi8(ra23, _mm_setzero_si128());
+
+    //P30 * U0 + P31 * U1 + P32 * U2 + P33 * U3
+    const __m128i sa = _mm_hadd_epi32(_mm_madd_epi16(a01, xpart), _mm_madd_epi16(a23, xpart));
+
+    //P00 * U0 + P01 * U1 + P02 * U2 + P03 * U3 
+    //P10 * U0 + P11 * U1 + P12 * U2 + P13 * U3 
+    //P20 * U0 + P21 * U1 + P22 * U2 + P23 * U3 
+    //P30 * U0 + P31 * U1 + P32 * U2 + P33 * U3 
+    __m128i result = _mm_setr_epi32(
+        _mm_hsum_epi32(_mm_mullo_epi32(sb, ypart)), //SB * V0
+        _mm_hsum_epi32(_mm_mullo_epi32(sg, ypart)), //SG * V1
+        _mm_hsum_epi32(_mm_mullo_epi32(sr, ypart)), //SR * V2
+        _mm_hsum_epi32(_mm_mullo_epi32(sa, ypart))  //SA * V3
+    );
+
+    //SUM >> 16
+    result = _mm_srai_epi32(result, 16);
+
+    //CLAMP 0, 255
+    return _mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(result, result), result));
+}
+
+//this calculate pixel with boundary so quite slowly
+must_inline target_sse41 uint32_t bicubicGetPixelBorder(const GFX_IMAGE* img, const int16_t *sintab, const int32_t sx, const int32_t sy)
+{
+    //peek offset at (px,py)
+    const int32_t px = (sx >> 16) - 1, py = (sy >> 16) - 1;
+
+    //calculate 16 pixels start (px-1, py-1), (px+2, py+2)
+    uint32_t pixels[16] = { 0 };
+    for (int32_t i = 0; i < 4; i++)
+    {
+        const int32_t y = py + i;
+        for (int32_t j = 0; j < 4; j++)
+        {
+            const int32_t x = px + j;
+            pixels[(i << 2) + j] = clampPixels(img, x, y);
+        }
+    }
+
+    //construct matrix 16x16 pixels data
+    GFX_IMAGE mpic = { 0 };
+    mpic.mData = pixels;
+    mpic.mWidth = 4;
+    mpic.mHeight = 4;
+    mpic.mRowBytes = 16;
+
+    //optimize function
+    return bicubicGetPixelCenter(&mpic, sintab, (sx & 0xffff) + 0x10000, (sy & 0xffff) + 0x10000);
+}
+
+//smooth scaling with Bresenham (internal function)
+//because of several simplifications of the algorithm,
+//the zoom range is restricted between 0.5 and 2. That
+//is: dstwidth must be >= srcwidth/2 and <= 2*srcwidth.
+//smooth is used to calculate average pixel and mid-points
+void scaleLineMix(uint8_t* dst, uint8_t* src, int32_t dw, int32_t sw, int32_t type)
+{
+    if (type == INTERPOLATION_TYPE_SMOOTH)
+    {
+#ifdef _USE_ASM
+        uint16_t val = 0;
+        __asm {
+            mov     ebx, dw
+            mov     eax, dw
+            cmp     eax, sw
+            jna     start
+            dec     ebx
+        start:
+            mov     esi, src
+            mov     edi, dst
+            mov     ecx, ebx
+            xor     ebx, ebx
+            mov     edx, dw
+            shr     edx, 1
+        next:
+            cmp     ebx, edx
+            jnae    done
+            mov     al, [esi]
+            mov     val, ax
+            mov     al, [esi + 1]
+            add     ax, val
+            shr     ax, 1
+            stosb
+            jmp     skip
+        done:
+            mov     al, [esi]
+            stosb
+        skip:
+            add     ebx, sw
+            cmp     ebx, dw
+            jnae    cycle
+            sub     ebx, dw
+            inc     esi
+        cycle:
+            dec     ecx
+            jnz     next
+            mov     eax, dw
+            cmp     eax, sw
+            jna     end
+            movsb
+        end:
+        }
+#else
+        int32_t error = 0;
+        int32_t numPixels = dw;
+        const int32_t midPixel = dw >> 1;
+
+        if (dw > sw) numPixels--;
+        while (numPixels-- > 0)
+        {
+            if (error >= midPixel) *dst++ = (*src + *(src + 1)) >> 1;
+            else *dst++ = *src;
+            error += sw;
+            if (error >= dw)
+            {
+                error -= dw;
+                src++;
+            }
+        }
+        if (dw > sw) *dst = *src;
+#endif
+    }
+    else if (type == INTERPOLATION_TYPE_NEAREST)
+    {
+#ifdef _USE_ASM
+        __asm {
+            xor     edx, edx
+            mov     esi, src
+            mov     edi, dst
+            mov     eax, sw
+            mov     ebx, dw
+            div     ebx
+            xor     ebx, ebx
+            mov     ecx, dw
+        next1:
+            movsb
+            dec     esi
+            add     esi, eax
+            add     ebx, edx
+            cmp     ebx, dw
+            jnae    done1
+            sub     ebx, dw
+            inc     esi
+        done1:
+            dec     ecx
+            jnz     next1
+        }
+#else
+        int32_t error = 0;
+        int32_t numPixels = dw;
+        const int32_t intPart = sw / dw;
+        const int32_t fractPart = sw % dw;
+        
+        while (numPixels-- > 0)
+        {
+            *dst++ = *src;
+            src += intPart;
+            error += fractPart;
+            if (error >= dw)
+            {
+                error -= dw;
+                src++;
+            }
+        }
+#endif
+    }
+    else
+    {
+        messageBox(GFX_ERROR, "Unknown interpolation type!");
+        return;
+    }
+}
+
+//Bresenham scale line with rgb color
+void scaleLineNormal(uint32_t* dst, uint32_t* src, int32_t dw, int32_t sw, int32_t type)
+{
+    if (type == INTERPOLATION_TYPE_SMOOTH)
+    {
+#ifdef _USE_ASM
+        uint16_t val = 0;
+        __asm {
+            mov     ebx, dw
+            mov     eax, dw
+            cmp     eax, sw
+            jna     start
+            dec     ebx
+        start:
+            mov     esi, src
+            mov     edi, dst
+            mov     ecx, ebx
+            xor     ebx, ebx
+            mov     edx, dw
+            shr     edx, 1
+        next:
+            cmp     ebx, edx
+            jnae    done
+            mov     al, [esi]
+            mov     val, ax
+            mov     al, [esi + 4]
+            add     ax, val
+            shr     ax, 1
+            stosb
+            mov     al, [esi + 1]
+            mov     val, ax
+            mov     al, [esi + 5]
+            add     ax, val
+            shr     ax, 1
+            stosb
+            mov     al, [esi + 2]
+            mov     val, ax
+            mov     al, [esi + 6]
+            add     ax, val
+            shr     ax, 1
+            stosb
+            inc     edi
+            jmp     skip
+        done:
+            mov     eax, [esi]
+            stosd
+        skip:
+            add     ebx, sw
+            cmp     ebx, dw
+            jnae    cycle
+            sub     ebx, dw
+            add     esi, 4
+        cycle:
+            dec     ecx
+            jnz     next
+            mov     eax, dw
+            cmp     eax, sw
+            jna     end
+            movsd
+        end:
+        }
+#else
+        int32_t error = 0;
+        int32_t numPixels = dw;
+        const int32_t midPixel = dw >> 1;
+        
+        if (dw > sw) numPixels--;
+
+        while (numPixels-- > 0)
+        {
+            //copy source pixel to destination pixel
+            if (error < midPixel) *dst = *src;
+            else
+            {
+                //calculate average pixel pd = (p0 + p1) / 2
+                ARGB* pd = (ARGB*)dst;
+                const ARGB* p0 = (ARGB*)src;
+                const ARGB* p1 = (ARGB*)&src[1];
+                pd->r = (p0->r + p1->r) >> 1;
+                pd->g = (p0->g + p1->g) >> 1;
+                pd->b = (p0->b + p1->b) >> 1;
+            }
+
+            dst++;
+            error += sw;
+
+            if (error >= dw)
+            {
+                error -= dw;
+                src++;
+            }
+        }
+
+        if (dw > sw) *dst = *src;
+#endif
+    }
+    else if (type == INTERPOLATION_TYPE_NEAREST)
+    {
+#ifdef _USE_ASM
+        __asm {
+            xor     edx, edx
+            mov     esi, src
+            mov     edi, dst
+            mov     eax, sw
+            mov     ebx, dw
+            div     ebx
+            shl     eax, 2
+            xor     ebx, ebx
+            mov     ecx, dw
+        begin:
+            movsd
+            sub     esi, 4
+            add     esi, eax
+            add     ebx, edx
+            cmp     ebx, dw
+            jnae    step
+            sub     ebx, dw
+            add     esi, 4
+        step:
+            dec     ecx
+            jnz     begin
+        }        
+#else
+        int32_t error = 0;
+        int32_t numPixels = dw;
+        const int32_t intPart = sw / dw;
+        const int32_t fractPart = sw % dw;
+        
+        while (numPixels-- > 0)
+        {
+            *dst++ = *src;
+            src += intPart;
+            error += fractPart;
+            if (error >= dw)
+            {
+                error -= dw;
+                src++;
+            }
+        }
+#endif
+    }
+    else
+    {
+        messageBox(GFX_ERROR, "Unknown interpolation type!");
+        return;
+    }
+}
+
+//Bresenham scale image buffer
+void scaleImageMix(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t mode)
+{
+#ifdef _USE_ASM
+    //save local value
+    const uint32_t dstWidth  = dst->mWidth;
+    const uint32_t srcWidth  = src->mWidth;
+    const uint32_t dstHeight = dst->mHeight;
+    const uint32_t srcHeight = src->mHeight;
+
+    uint32_t intp = 0, modp = 0;
+
+    //make pointer to call in asm mode
+    void *copier = memcpy;
+    void *scaler = scaleLineMix;
+
+    //save local address
+    void *oldPtr = NULL;
+    void *dstPtr = dst->mData;
+    void *srcPtr = src->mData;
+
+    __asm {
+        mov     edi, dstPtr
+        mov     esi, srcPtr
+        xor     edx, edx
+        mov     eax, srcHeight
+        div     dstHeight
+        mov     modp, edx
+        mul     srcWidth
+        mov     intp, eax
+        xor     ebx, ebx
+        mov     ecx, dstHeight
+    next:
+        push    ecx
+        cmp     esi, oldPtr
+        jne     skip
+        mov     eax, edi
+        sub     eax, dstWidth
+        push    dstWidth
+        push    eax
+        push    edi
+        call    copier
+        add     esp, 12
+        jmp     done
+    skip:
+        mov     edx, mode
+        and     edx, 0Fh
+        push    edx
+        push    srcWidth
+        push    dstWidth
+        push    esi
+        push    edi
+        call    scaler
+        add     esp, 20
+        mov     oldPtr, esi
+    done:
+        add     edi, dstWidth
+        add     esi, intp
+        add     ebx, modp
+        cmp     ebx, dstHeight
+        jnae    cycle
+        sub     ebx, dstHeight
+        add     esi, srcWidth
+    cycle:
+        pop     ecx
+        dec     ecx
+        jnz     next
+    }
+#else    
+    int32_t error = 0;
+    int32_t numPixels = dst->mHeight;
+    const int32_t intPart = (src->mHeight / dst->mHeight) * src->mWidth;
+    const int32_t fractPart = src->mHeight % dst->mHeight;
+    
+    uint8_t* srcPrev = NULL;
+    uint8_t* srcPtr = (uint8_t*)src->mData;
+    uint8_t* dstPtr = (uint8_t*)dst->mData;
+
+    while (numPixels-- > 0)
+    {
+        if (srcPtr == srcPrev)
+        {
+            memcpy(dstPtr, dstPtr - dst->mWidth, dst->mWidth * sizeof(dstPtr[0]));
+        }
+        else
+        {
+            scaleLineMix(dstPtr, srcPtr, dst->mWidth, src->mWidth, mode);
+            srcPrev = srcPtr;
+        }
+
+        dstPtr += dst->mWidth;
+        srcPtr += intPart;
+        error += fractPart;
+
+        if (error >= dst->mHeight)
+        {
+            error -= dst->mHeight;
+            srcPtr += src->mWidth;
+        }
+    }
+#endif
+}
+
+//Bresenham scale line with rgb color
+void scaleLine(void* dst, void* src, int32_t dw, int32_t sw, int32_t type)
+{
+    //mixed mode
+    if (gfxContext.bitsPerPixel == 8)
+    {
+        scaleLineMix((uint8_t*)dst, (uint8_t*)src, dw, sw, type);
+        return;
+    }
+
+    //height color mode
+    scaleLineNormal((uint32_t*)dst, (uint32_t*)src, dw, sw, type);
+}
+
+//Bresenham scale image buffer
+void scaleImageNormal(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t mode)
+{
+#ifdef _USE_ASM
+    //save local value
+    const uint32_t dstWidth  = dst->mWidth;
+    const uint32_t srcWidth  = src->mWidth;
+    const uint32_t dstHeight = dst->mHeight;
+    const uint32_t srcHeight = src->mHeight;
+
+    uint32_t dsi = 0, ddi = 0;
+    uint32_t intp = 0, modp = 0;
+
+    //make pointer to call in asm mode
+    void *copier = memcpy;
+    void *scaler = scaleLine;
+
+    //save local address
+    void *oldPtr = NULL;
+    void *dstPtr = dst->mData;
+    void *srcPtr = src->mData;
+
+    __asm {
+        mov     edi, dstPtr
+        mov     esi, srcPtr
+        xor     edx, edx
+        mov     eax, srcHeight
+        div     dstHeight
+        mov     modp, edx
+        mul     srcWidth
+        shl     eax, 2
+        mov     intp, eax
+        mov     eax, dstWidth
+        shl     eax, 2
+        mov     ddi, eax
+        mov     eax, srcWidth
+        shl     eax, 2
+        mov     dsi, eax
+        xor     ebx, ebx
+        mov     ecx, dstHeight
+    next:
+        push    ecx
+        cmp     esi, oldPtr
+        jne     skip
+        mov     eax, edi
+        sub     eax, ddi
+        push    ddi
+        push    eax
+        push    edi
+        call    copier
+        add     esp, 12
+        jmp     done
+    skip:
+        push    mode
+        push    srcWidth
+        push    dstWidth
+        push    esi
+        push    edi
+        call    scaler
+        add     esp, 20
+        mov     oldPtr, esi
+    done:
+        add     edi, ddi
+        add     esi, intp
+        add     ebx, modp
+        cmp     ebx, dstHeight
+        jnae    cycle
+        sub     ebx, dstHeight
+        add     esi, dsi
+    cycle:
+        pop     ecx
+        dec     ecx
+        jnz     next
+    }
+#else    
+    int32_t error = 0;
+    int32_t numPixels = dst->mHeight;
+    const int32_t intPart = (src->mHeight / dst->mHeight) * src->mWidth;
+    const int32_t fractPart = src->mHeight % dst->mHeight;
+    
+    uint32_t* srcPrev = NULL;
+    uint32_t* srcPtr = (uint32_t*)src->mData;
+    uint32_t* dstPtr = (uint32_t*)dst->mData;
+
+    while (numPixels-- > 0)
+    {
+        if (srcPtr == srcPrev)
+        {
+            memcpy(dstPtr, dstPtr - dst->mWidth, dst->mWidth * sizeof(dstPtr[0]));
+        }
+        else
+        {
+            scaleLine(dstPtr, srcPtr, dst->mWidth, src->mWidth, mode);
+            srcPrev = srcPtr;
+        }
+
+        dstPtr += dst->mWidth;
+        srcPtr += intPart;
+        error += fractPart;
+
+        if (error >= dst->mHeight)
+        {
+            error -= dst->mHeight;
+            srcPtr += src->mWidth;
+        }
+    }
+#endif
+}
+
+//nearest neighbor image scaling (using fixed-points)
+void nearestScaleImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //mapping pointer
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    const uint32_t* psrc = (const uint32_t*)src->mData;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+
+    //calculate scale ratio
+    const int32_t scalex = (srcw << 16) / dstw + 1;
+    const int32_t scaley = (srch << 16) / dsth + 1;
+    
+    //very slow loop
+    int32_t sy = 0;
+    for (int32_t y = 0; y < dsth; y++, sy += scaley)
+    {
+        int32_t sx = 0;
+        const uint32_t* msrc = &psrc[(sy >> 16) * srcw];
+        for (int32_t x = 0; x < dstw; x++, sx += scalex) *pdst++ = msrc[sx >> 16];
+    }
+}
+
+//average pixels (smooth) image scaling (using fixed-points)
+void smoothScaleImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //mapping pointer
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+
+    //calculate scale ratio
+    const int32_t scalex = (srcw << 16) / dstw + 1;
+    const int32_t scaley = (srch << 16) / dsth + 1;
+    const int32_t errorx = (scalex >> 1) - 32768;
+    const int32_t errory = (scaley >> 1) - 32768;
+
+    //very slow loop
+    for (int32_t y = 0, sy = errory; y < dsth; y++, sy += scaley)
+    {
+        for (int32_t x = 0, sx = errorx; x < dstw; x++, sx += scalex) *pdst++ = smoothGetPixel(src, sx, sy);
+    }
+}
+
+//bilinear scale image with fixed-points
+void bilinearScaleImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //mapping pointer
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+
+    //calculate scale ratio
+    const int32_t scalex = (srcw << 16) / dstw + 1;
+    const int32_t scaley = (srch << 16) / dsth + 1;
+    const int32_t errorx = (scalex >> 1) - 32768;
+    const int32_t errory = (scaley >> 1) - 32768;
+
+    //very slow loop
+    for (int32_t y = 0, sy = errory; y < dsth; y++, sy += scaley)
+    {
+        for (int32_t x = 0, sx = errorx; x < dstw; x++, sx += scalex) *pdst++ = bilinearGetPixelFixed(src, sx, sy);
+    }
+}
+
+//maximize optimize version (extremely fast)
+//using sticks:
+//1. FIXED-POINT
+//2. separate inbound and outbound pixels calculation
+//3. SSE2 instructions
+target_sse41 void bilinearScaleImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cache local data pointer
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+    const int32_t scalex = (srcw << 16) / dstw + 1;
+    const int32_t scaley = (srch << 16) / dsth + 1;
+    const int32_t errorx = (scalex >> 1) - 32768;
+    const int32_t errory = (scaley >> 1) - 32768;
+
+    int32_t startx = (65536 - errorx) / scalex + 1;
+    if (startx >= dstw) startx = dstw;
+
+    int32_t starty = (65536 - errory) / scaley + 1;
+    if (starty >= dsth) starty = dsth;
+
+    int32_t endx = (((srcw - 2) << 16) - errorx) / scalex + 1;
+    if (endx < startx) endx = startx;
+
+    int32_t endy = (((srch - 2) << 16) - errory) / scaley + 1;
+    if (endy < starty) endy = starty;
+
+    int32_t srcy = errory;
+    for (int32_t y = 0; y < starty; y++, srcy += scaley)
+    {
+        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += scalex) *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
+    }
+
+    for (int32_t y = starty; y < endy; y++, srcy += scaley)
+    {
+        int32_t srcx = errorx;
+        for (int32_t x = 0; x < startx; x++, srcx += scalex)    *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
+        for (int32_t x = startx; x < endx; x++, srcx += scalex) *pdst++ = bilinearGetPixelCenter(src, srcx, srcy);
+        for (int32_t x = endx; x < dstw; x++, srcx += scalex)   *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
+    }
+
+    for (int32_t y = endy; y < dsth; y++, srcy += scaley)
+    {
+        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += scalex) *pdst++ = bilinearGetPixelBorder(src, srcx, srcy);
+    }
+}
+
+//normal optimize version (very fast)
+//use hardware acceleration with AVX2, seem no faster than FIXED-POINT
+//benchmark for 5000 iterations
+//CPU: Intel(R) Core(TM) i7-4770K CPU @ 3.50GHz
+//RAM: 32GB
+//OS: Windows 10 Pro x64
+//Compiler: VC++ 2019
+//x64 release build
+//FIXED-POINT: about 8.649s
+//AVX2: about 8.617s --> no much faster than FIXED-POINT
+//x32 release build
+//FIXED-POINT: about 14.658s
+//AVX2: about 9.043s --> seem faster than FIXED-POINT
+//use hardware acceleration will get constantly speed
+//in modern system (64bits) integer will be operated fastest
+target_avx2 void bilinearScaleImageAVX2(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cache local data pointer
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    //cache local dimension
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+
+    //calculate ratio
+    const double xratio = double(intmax_t(srcw) - 1) / dstw;
+    const double yratio = double(intmax_t(srch) - 1) / dsth;
+
+    //very slow loop
+    for (int32_t y = 0; y < dsth; y++)
+    {
+        const double sy = y * yratio;
+        for (int32_t x = 0; x < dstw; x++)
+        {
+            const double sx = x * xratio;
+            *pdst++ = bilinearGetPixelAVX2(src, sx, sy);
+        }
+    }
+}
+
+//bi-cubic scale image
+//original version, very slow
+//this is show bi-cubic interpolation only, don't use in production
+void bicubicScaleImage(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cache local data pointer
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    //cache local dimension
+    const int32_t swidth = src->mWidth;
+    const int32_t sheight = src->mHeight;
+    const int32_t dwidth = dst->mWidth;
+    const int32_t dheight = dst->mHeight;
+
+    //calculate ratio
+    const double xratio = double(intmax_t(swidth) - 1) / dwidth;
+    const double yratio = double(intmax_t(sheight) - 1) / dheight;
+
+    //very slow loop
+    for (int32_t y = 0; y < dheight; y++)
+    {
+        const double sy = y * yratio;
+        for (int32_t x = 0; x < dwidth; x++)
+        {
+            const double sx = x * xratio;
+            *pdst++ = bicubicGetPixel(src, sx, sy);
+        }
+    }
+}
+
+//maximize optimized version (extremely fast)
+//the tricks we're used:
+//1. lookup table
+//2. fixed-points
+//3. SSE2 instructions
+//4. separate calculate pixels (inbound and outbound)
+target_sse41 void bicubicScaleImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+    
+    const int32_t addx = (srcw << 16) / dstw + 1;
+    const int32_t addy = (srch << 16) / dsth + 1;
+    const int32_t errorx = (addx >> 1) - 32768;
+    const int32_t errory = (addy >> 1) - 32768;
+
+    int16_t stable[513] = { 0 };
+    for (int32_t i = 0; i < 513; i++) stable[i] = fround(256.0 * sinXDivX(i / 256.0));
+
+    int32_t sx = (65536 - errorx) / addx + 1;
+    if (sx >= dstw) sx = dstw;
+    int32_t sy = (65536 - errory) / addy + 1;
+    if (sy >= dsth) sy = dsth;
+    int32_t ex = (((srcw - 3) << 16) - errorx) / addx + 1;
+    if (ex < sx) ex = sx;
+    int32_t ey = (((srch - 3) << 16) - errory) / addy + 1;
+    if (ey < sy) ey = sy;
+
+    int32_t srcy = errory;
+    for (int32_t y = 0; y < sy; y++, srcy += addy)
+    {
+        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += addx) *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
+    }
+
+    for (int32_t y = sy; y < ey; y++, srcy += addy)
+    {
+        int32_t srcx = errorx;
+        for (int32_t x = 0; x < sx; x++, srcx += addx)      *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
+        for (int32_t x = sx; x < ex; x++, srcx += addx)     *pdst++ = bicubicGetPixelCenter(src, stable, srcx, srcy);
+        for (int32_t x = ex; x < dstw; x++, srcx += addx)   *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
+    }
+
+    for (int32_t y = ey; y < dsth; y++, srcy += addy)
+    {
+        for (int32_t x = 0, srcx = errorx; x < dstw; x++, srcx += addx) *pdst++ = bicubicGetPixelBorder(src, stable, srcx, srcy);
+    }
+}
+
+//nearest neighbor image rotation for mixed mode (optimize version using FIXED-POINT)
+void rotateImageMix(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel != 8) return;
+
+    //cast to image data
+    uint8_t* pdst = (uint8_t*)dst->mData;
+    const uint8_t* psrc = (const uint8_t*)src->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dcx = dstw >> 1;
+    const int32_t dsth = dst->mHeight;
+    const int32_t dcy = dsth >> 1;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t scx = srcw << 15;
+    const int32_t srch = src->mHeight;
+    const int32_t scy = srch << 15;
+    const int32_t scw = (srcw - 1) << 16;
+    const int32_t sch = (srch - 1) << 16;
+
+    const double alpha = (angle * M_PI) / 180;
+    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
+    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
+
+    int32_t xs = scx - (dcx * dy + dcy * dx);
+    int32_t ys = scy - (dcy * dy - dcx * dx);
+
+    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
+    {
+        uint8_t* pline = pdst;
+        int32_t sx = xs, sy = ys;
+        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
+        {
+            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = psrc[(sy >> 16) * srcw + (sx >> 16)];
+            pline++;
+        }
+    }
+}
+
+//nearest neighbor pixel image rotation (optimize version using FIXED-POINT)
+void nearestRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cast to image data
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    const uint32_t* psrc = (const uint32_t*)src->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dcx = dstw >> 1;
+    const int32_t dsth = dst->mHeight;
+    const int32_t dcy = dsth >> 1;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t scx = srcw << 15;
+    const int32_t srch = src->mHeight;
+    const int32_t scy = srch << 15;
+    const int32_t scw = (srcw - 1) << 16;
+    const int32_t sch = (srch - 1) << 16;
+
+    const double alpha = (angle * M_PI) / 180;
+    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
+    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
+
+    int32_t xs = scx - (dcx * dy + dcy * dx);
+    int32_t ys = scy - (dcy * dy - dcx * dx);
+
+    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
+    {
+        int32_t sx = xs, sy = ys;
+        uint32_t* pline = pdst;
+        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
+        {
+            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = psrc[(sy >> 16) * srcw + (sx >> 16)];
+            pline++;
+        }
+    }
+}
+
+//average (smooth) pixel image rotation (optimize version using FIXED-POINT)
+void smoothRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cast to image data
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dcx = dstw >> 1;
+    const int32_t dsth = dst->mHeight;
+    const int32_t dcy = dsth >> 1;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t scx = srcw << 15;
+    const int32_t srch = src->mHeight;
+    const int32_t scy = srch << 15;
+    const int32_t scw = (srcw - 1) << 16;
+    const int32_t sch = (srch - 1) << 16;
+
+    const double alpha = (angle * M_PI) / 180;
+    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
+    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
+
+    int32_t xs = scx - (dcx * dy + dcy * dx);
+    int32_t ys = scy - (dcy * dy - dcx * dx);
+
+    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
+    {
+        int32_t sx = xs, sy = ys;
+        uint32_t* pline = pdst;
+        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
+        {
+            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = smoothGetPixel(src, sx, sy);
+            pline++;
+        }
+    }
+}
+
+//use hardware acceleration with AVX2, seem no faster than FIXED-POINT
+//benchmark for 5000 iterations
+//CPU: Intel(R) Core(TM) i7-4770K CPU @ 3.50GHz
+//RAM: 32GB
+//OS: Windows 10 Pro x64
+//Compiler: VC++ 2019
+//x64 release build
+//FIXED-POINT: about 9.486s
+//AVX2: about 10.250s --> no faster than FIXED-POINT
+//x32 release build
+//FIXED-POINT: about 14.768s
+//AVX2: about 10.422s --> seem faster than FIXED-POINT
+//use hardware acceleration will get constantly speed
+//in modern system (64bits) integer will be operated fastest
+target_avx2 void bilinearRotateImageAVX2(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cast to image data
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dcx = dstw >> 1;
+    const int32_t dsth = dst->mHeight;
+    const int32_t dcy = dsth >> 1;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t scx = srcw >> 1;
+    const int32_t srch = src->mHeight;
+    const int32_t scy = srch >> 1;
+
+    const double alpha = (angle * M_PI) / 180;
+    const double dx = sin(alpha) / scalex;
+    const double dy = cos(alpha) / scaley;
+
+    double xs = scx - (dcx * dy + dcy * dx);
+    double ys = scy - (dcy * dy - dcx * dx);
+
+    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
+    {
+        double sx = xs, sy = ys;
+        uint32_t* pline = pdst;
+        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
+        {
+            if (sx >= 0 && sy >= 0 && sx < srcw && sy < srch) *pline = bilinearGetPixelAVX2(src, sx, sy);
+            pline++;
+        }
+    }
+}
+
+//bilinear image rotation (single optimize version)
+//this version will faster than SSE2 version, in modern CPU, operating
+//on integer will always give lower cost because it aligned memory
+void bilinearRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cast to image data
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dcx = dstw >> 1;
+    const int32_t dsth = dst->mHeight;
+    const int32_t dcy = dsth >> 1;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t scx = srcw << 15;
+    const int32_t srch = src->mHeight;
+    const int32_t scy = srch << 15;
+
+    const int32_t scw = (srcw - 1) << 16;
+    const int32_t sch = (srch - 1) << 16;
+
+    const double alpha = (angle * M_PI) / 180;
+    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
+    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
+
+    int32_t xs = scx - (dcx * dy + dcy * dx);
+    int32_t ys = scy - (dcy * dy - dcx * dx);
+
+    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
+    {
+        int32_t sx = xs, sy = ys;
+        uint32_t* pline = pdst;
+        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
+        {
+            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = bilinearGetPixelFixed(src, sx, sy);
+            pline++;
+        }
+    }
+}
+
+//bilinear rotate scan line (sub-routine of full optimize version)
+//improve smooth border when rotating will make image look better
+target_sse41 void bilinearRotateLine(uint32_t* pdst, const int32_t boundx0, const int32_t inx0, const int32_t inx1, const int32_t boundx1, const GFX_IMAGE* psrc, int32_t sx, int32_t sy, const int32_t addx, const int32_t addy)
+{
+    int32_t x = 0;
+    for (x = boundx0; x < inx0; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bilinearGetPixelBorder(psrc, sx, sy));
+    for (x = inx0; x < inx1; x++, sx += addx, sy += addy)       pdst[x] = bilinearGetPixelCenter(psrc, sx, sy);
+    for (x = inx1; x < boundx1; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bilinearGetPixelBorder(psrc, sx, sy));
+}
+
+//maximize optimize version (extremely fast)
+//use sticks:
+//1. fixed-points
+//2. separate inbound and outbound pixel calculation
+//3. SSE2 instructions
+//4. clipping data
+void bilinearRotateImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    const double scalexy = 1.0 / (scalex * scaley);  
+    const double rscalex = scalexy * scaley;
+    const double rscaley = scalexy * scalex;
+
+    double sina = 0, cosa = 0;
+    sincos(-(angle * M_PI) / 180, &sina, &cosa);
+    const int32_t sini = fround(sina * 65536); //convert to fixed points (no truncated)
+    const int32_t cosi = fround(cosa * 65536); //convert to fixed points (no truncated)
+
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    
+    const int32_t ax = int32_t(rscalex * cosi);
+    const int32_t ay = int32_t(rscalex * sini);
+    const int32_t bx = int32_t(-rscaley * sini);
+    const int32_t by = int32_t(rscaley * cosi);
+
+    const int32_t dcx = dstw >> 1;
+    const int32_t dcy = dsth >> 1;
+    const int32_t scx = srcw << 15; //(srcw >> 1) << 16 convert to fixed points
+    const int32_t scy = srch << 15; //(srch >> 1) << 16 convert to fixed points
+
+    //rotation points
+    const int32_t cx = scx - int32_t(dcx * rscalex * cosi - dcy * rscaley * sini);
+    const int32_t cy = scy - int32_t(dcx * rscalex * sini + dcy * rscaley * cosi); 
+
+    ROTATE_CLIP clip;
+    clip.ax = ax;
+    clip.bx = bx;
+    clip.ay = ay;
+    clip.by = by;
+    clip.cx = cx;
+    clip.cy = cy;
+    clip.dstw = dstw;
+    clip.dsth = dsth;
+    clip.srcw = srcw;
+    clip.srch = srch;
+    
+    //clipping data
+    if (!initClip(&clip, dcx, dcy, 1)) return;
+
+    uint32_t* yline = &pdst[dstw * clip.yDown];
+    while (true)
+    {
+        if (clip.yDown >= dsth) break;
+        if (clip.yDown >= 0) bilinearRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay);
+        if (!nextLineDown(&clip)) break;
+        yline += dstw;
+    }
+
+    yline = &pdst[dstw * clip.yUp];
+    while (nextLineUp(&clip))
+    {
+        if (clip.yUp < 0) break;
+        yline -= dstw;
+        if (clip.yUp < dsth) bilinearRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay);
+    }
+}
+
+//bi-cubic rotate image (original version, very slow)
+//use maximize optimize version below
+void bicubicRotateImage(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cast to image data
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    //calculate haft dimension
+    const int32_t width = src->mWidth;
+    const int32_t height = src->mHeight;
+    const int32_t cx = (width >> 1) - 1;
+    const int32_t cy = (height >> 1) - 1;
+
+    //convert to radian
+    const double alpha = double(angle * M_PI) / 180;
+    const double sina = sin(-alpha) / scalex;
+    const double cosa = cos(-alpha) / scaley;
+    const double mx = -cx * cosa + cx;
+    const double my = -cx * sina + cy;
+    double px = -cy * sina;
+    double py = -cy * cosa;
+    
+    //start pixel manipulation
+    for (int32_t y = 0; y < height; y++, px += sina, py += cosa)
+    {
+        double sx = mx - px;
+        double sy = my + py;
+        for (int32_t x = 0; x < width; x++, sx += cosa, sy += sina)
+        {
+            if (sx >= 0.0 && sx <= width - 1.0 && sy >= 0 && sy <= height - 1.0) *pdst = bicubicGetPixel(src, sx, sy);
+            pdst++;
+        }
+    }
+}
+
+//single optimize version
+//sticks used:
+//1. fixed-points
+//2. lookup table
+void bicubicRotateImageFixed(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    //only works with rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //cast to image data
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t dstw = dst->mWidth;
+    const int32_t dcx = dstw >> 1;
+    const int32_t dsth = dst->mHeight;
+    const int32_t dcy = dsth >> 1;
+
+    const int32_t srcw = src->mWidth;
+    const int32_t scx = srcw << 15;
+    const int32_t srch = src->mHeight;
+    const int32_t scy = srch << 15;
+    const int32_t scw = (srcw - 1) << 16;
+    const int32_t sch = (srch - 1) << 16;
+
+    const double alpha = (angle * M_PI) / 180;
+    const int32_t dx = fround((sin(alpha) / scalex) * 65536);
+    const int32_t dy = fround((cos(alpha) / scaley) * 65536);
+
+    int16_t stable[513] = { 0 };
+    for (int32_t i = 0; i < 513; i++) stable[i] = fround(256.0 * sinXDivX(i / 256.0));
+
+    int32_t xs = scx - (dcx * dy + dcy * dx);
+    int32_t ys = scy - (dcy * dy - dcx * dx);
+
+    for (int32_t y = 0; y < dsth; y++, xs += dx, ys += dy, pdst += dstw)
+    {
+        int32_t sx = xs, sy = ys;
+        uint32_t* pline = pdst;
+        for (int32_t x = 0; x < dstw; x++, sx += dy, sy -= dx)
+        {
+            if (sx >= 0 && sy >= 0 && sx <= scw && sy <= sch) *pline = bicubicGetPixelFixed(src, stable, sx, sy);
+            pline++;
+        }
+    }
+}
+
+//bi-cubic rotate scan line (sub-routine for maximize optimize version)
+//this use smooth border when rotating to keep image looked
+target_sse41 void bicubicRotateLine(uint32_t* pdst, const int32_t boundx0, const int32_t inx0, const int32_t inx1, const int32_t boundx1, const GFX_IMAGE* psrc, int32_t sx, int32_t sy, const int32_t addx, const int32_t addy, const int16_t* stable)
+{
+    int32_t x = 0;
+
+    for (x = boundx0; x < inx0; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bicubicGetPixelBorder(psrc, stable, sx, sy));
+    for (x = inx0; x < inx1; x++, sx += addx, sy += addy)       pdst[x] = bicubicGetPixelCenter(psrc, stable, sx, sy);
+    for (x = inx1; x < boundx1; x++, sx += addx, sy += addy)    pdst[x] = alphaBlend(pdst[x], bicubicGetPixelBorder(psrc, stable, sx, sy));
+}
+
+//maximize optimize version (extremely fast)
+//use sticks:
+//1. fixed-points
+//2. separate get pixel inbound and outbound of source image
+//3. SSE2 instructions
+//4. lookup table
+//5. clipping data
+void bicubicRotateImageMax(const GFX_IMAGE* dst, const GFX_IMAGE* src, const double angle, const double scalex, const double scaley)
+{
+    const double scalexy = 1.0 / (scalex * scaley);  
+    const double rscalex = scalexy * scaley;
+    const double rscaley = scalexy * scalex;
+
+    double sina = 0, cosa = 0;
+    sincos(-(angle * M_PI) / 180, &sina, &cosa);
+    const int32_t sini = fround(sina * 65536); //convert to fixed points (no truncated)
+    const int32_t cosi = fround(cosa * 65536); //convert to fixed points (no truncated)
+
+    const int32_t srcw = src->mWidth;
+    const int32_t srch = src->mHeight;
+    const int32_t dstw = dst->mWidth;
+    const int32_t dsth = dst->mHeight;
+
+    uint32_t* pdst = (uint32_t*)dst->mData;
+
+    const int32_t ax = int32_t(rscalex * cosi);
+    const int32_t ay = int32_t(rscalex * sini);
+    const int32_t bx = -int32_t(rscaley * sini);
+    const int32_t by = int32_t(rscaley * cosi);
+
+    const int32_t dcx = dstw >> 1;
+    const int32_t dcy = dsth >> 1;
+    const int32_t scx = srcw << 15; //(srcw >> 1) << 16 convert to fixed points
+    const int32_t scy = srch << 15; //(srch >> 1) << 16 convert to fixed points
+
+    //rotation points
+    const int32_t cx = scx - int32_t(dcx * rscalex * cosi - dcy * rscaley * sini);
+    const int32_t cy = scy - int32_t(dcx * rscalex * sini + dcy * rscaley * cosi); 
+
+    ROTATE_CLIP clip;
+    clip.ax = ax;
+    clip.bx = bx;
+    clip.ay = ay;
+    clip.by = by;
+    clip.cx = cx;
+    clip.cy = cy;
+    clip.dstw = dstw;
+    clip.dsth = dsth;
+    clip.srcw = srcw;
+    clip.srch = srch;
+
+    //clipping data
+    if (!initClip(&clip, dcx, dcy, 2)) return;
+
+    int16_t stable[513] = { 0 };
+    for (int32_t i = 0; i < 513; i++) stable[i] = fround(256.0 * sinXDivX(i / 256.0));
+
+    uint32_t* yline = &pdst[dstw * clip.yDown];
+    while (true)
+    {
+        if (clip.yDown >= dsth) break;
+        if (clip.yDown >= 0) bicubicRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay, stable);
+        if (!nextLineDown(&clip)) break;
+        yline += dstw;
+    }
+
+    yline = &pdst[dstw * clip.yUp];
+    while (nextLineUp(&clip))
+    {
+        if (clip.yUp < 0) break;
+        yline -= dstw;
+        if (clip.yUp < dsth) bicubicRotateLine(yline, clip.outBound0, clip.inBound0, clip.inBound1, clip.outBound1, src, clip.srcx, clip.srcy, ax, ay, stable);
+    }
+}
+
+//scale image buffer (export function)
+void scaleImage(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t type /* = INTERPOLATION_TYPE_SMOOTH */)
+{
+    //mixed mode
+    if (gfxContext.bitsPerPixel == 8)
+    {
+        scaleImageMix(dst, src, type);
+        return;
+    }
+
+    //SSE4.1 interpolation needs CPU features
+    if (maxKernelLevel < 0) initKernels();
+
+    //which type?
+    switch (type)
+    {
+    case INTERPOLATION_TYPE_NORMAL:
+        scaleImageNormal(dst, src, 1);
+        break;
+
+    case INTERPOLATION_TYPE_NEAREST:
+        nearestScaleImageFixed(dst, src);
+        break;
+
+    case INTERPOLATION_TYPE_SMOOTH:
+        smoothScaleImageFixed(dst, src);
+        break;
+
+    case INTERPOLATION_TYPE_BILINEAR:
+        if (haveSSE41) bilinearScaleImageMax(dst, src);
+        else bilinearScaleImageFixed(dst, src);
+        break;
+
+    case INTERPOLATION_TYPE_BICUBIC:
+        if (haveSSE41) bicubicScaleImageMax(dst, src);
+        else bicubicScaleImage(dst, src);
+        break;
+
+    default:
+        messageBox(GFX_WARNING, "Unknown scale type:%d", type);
+        break;
+    }
+}
+
+//rotate image buffer (export function)
+void rotateImage(const GFX_IMAGE* dst, const GFX_IMAGE* src, double degree, int32_t type /* = INTERPOLATION_TYPE_SMOOTH */)
+{
+    //mixed mode
+    if (gfxContext.bitsPerPixel == 8)
+    {
+        rotateImageMix(dst, src, degree, 1, 1);
+        return;
+    }
+
+    //SSE4.1 interpolation needs CPU features
+    if (maxKernelLevel < 0) initKernels();
+
+    //which type?
+    switch (type)
+    {
+    case INTERPOLATION_TYPE_NEAREST:
+        nearestRotateImageFixed(dst, src, degree, 1, 1);
+        break;
+
+    case INTERPOLATION_TYPE_SMOOTH:
+        smoothRotateImageFixed(dst, src, degree, 1, 1);
+        break;
+
+    case INTERPOLATION_TYPE_BILINEAR:
+        if (haveSSE41) bilinearRotateImageMax(dst, src, degree, 1, 1);
+        else bilinearRotateImageFixed(dst, src, degree, 1, 1);
+        break;
+
+    case INTERPOLATION_TYPE_BICUBIC:
+        if (haveSSE41) bicubicRotateImageMax(dst, src, degree, 1, 1);
+        else bicubicRotateImageFixed(dst, src, degree, 1, 1);
+        break;
+
+    default:
+        messageBox(GFX_WARNING, "Unknown rotate type:%d", type);
+        break;
+    }
+}
+
+//initialize 3D projection params
+void initProjection(GFX_CONTEXT* ctx, double theta, double phi, double de, double rho)
+{
+    const double ph = (M_PI * phi) / 180;
+    const double th = (M_PI * theta) / 180;
+    
+    ctx->sinth = sin(th);
+    ctx->sinph = sin(ph);
+    ctx->costh = cos(th);
+    ctx->cosph = cos(ph);
+
+    ctx->sincosx = ctx->sinph * ctx->costh;
+    ctx->sinsinx = ctx->sinth * ctx->sinph;
+    ctx->coscosx = ctx->costh * ctx->cosph;
+    ctx->sincosy = ctx->sinth * ctx->cosph;
+
+    ctx->DE = de;
+    ctx->RHO = rho;
+}
+
+//initialize 3D projection params
+void initProjection(double theta, double phi, double de, double rho /* = 0 */)
+{
+    initProjection(&gfxContext, theta, phi, de, rho);
+}
+
+//projection points (x,y,z)
+void projette(GFX_CONTEXT* ctx, double x, double y, double z, double *px, double *py)
+{
+    const double obsX = -x * ctx->sinth + y * ctx->costh;
+    const double obsY = -x * ctx->sincosx - y * ctx->sinsinx + z * ctx->cosph;
+
+    if (ctx->projectionType == PROJECTION_TYPE_PERSPECTIVE)
+    {
+        double obsZ = -x * ctx->coscosx - y * ctx->sincosy - z * ctx->sinph + ctx->RHO;
+        if (obsZ == 0.0) obsZ = DBL_MIN;
+        if (px) *px = (ctx->DE * obsX) / obsZ;
+        if (py) *py = (ctx->DE * obsY) / obsZ;
+    }
+    else if (ctx->projectionType == PROJECTION_TYPE_PARALLELE)
+    {
+        if (px) *px = ctx->DE * obsX;
+        if (py) *py = ctx->DE * obsY;
+    }
+    else
+    {
+        if (px) *px = 0;
+        if (py) *py = 0;
+        messageBox(GFX_WARNING, "Unknown projection type!");
+    }
+}
+
+//projection points (x,y,z)
+void projette(double x, double y, double z, double *px, double *py)
+{
+    projette(&gfxContext, x, y, z, px, py);
+}
+
+//reset projection parameters
+void resetProjection(GFX_CONTEXT* ctx)
+{
+    ctx->RHO = ctx->DE = 0;
+    ctx->sinth = ctx->sinph = ctx->costh = ctx->cosph = 0;
+    ctx->sincosx = ctx->sinsinx = ctx->coscosx = ctx->sincosy = 0;
+}
+
+//reset projection parameters
+void resetProjection()
+{
+    resetProjection(&gfxContext);
+}
+
+//set current projection type
+void setProjection(GFX_CONTEXT* ctx, PROJECTION_TYPE type)
+{
+    ctx->projectionType = type;
+}
+
+//set current projection type
+void setProjection(PROJECTION_TYPE type)
+{
+    setProjection(&gfxContext, type);
+}
+
+//move current cursor in 3D mode
+void deplaceEn(GFX_CONTEXT* ctx, double x, double y, double z)
+{
+    double px = 0, py = 0;
+    projette(ctx, x, y, z, &px, &py);
+    ctx->cranX = int32_t(ctx->centerX + px * ECHE);
+    ctx->cranY = int32_t(ctx->centerY - py);
+    moveTo(ctx, ctx->cranX, ctx->cranY);
+}
+
+//move current cursor in 3D mode
+void deplaceEn(double x, double y, double z)
+{
+    deplaceEn(&gfxContext, x, y, z);
+}
+
+//draw line from current cursor in 3D mode
+void traceVers(GFX_CONTEXT* ctx, double x, double y, double z, uint32_t col, int32_t mode)
+{
+    double px = 0, py = 0;
+    projette(ctx, x, y, z, &px, &py);
+    ctx->cranX = int32_t(ctx->centerX + px * ECHE);
+    ctx->cranY = int32_t(ctx->centerY - py);
+    lineTo(ctx, ctx->cranX, ctx->cranY, col, mode);
+}
+
+//draw line from current cursor in 3D mode
+void traceVers(double x, double y, double z, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    traceVers(&gfxContext, x, y, z, col, mode);
+}
+
+//move to drawing pointer
+void moveTo(GFX_CONTEXT* ctx, int32_t x, int32_t y)
+{
+    ctx->currX = x;
+    ctx->currY = y;
+}
+
+//move to drawing pointer
+void moveTo(int32_t x, int32_t y)
+{
+    moveTo(&gfxContext, x, y);
+}
+
+//draw line from current to (x,y)
+void lineTo(GFX_CONTEXT* ctx, int32_t x, int32_t y, uint32_t col, int32_t mode)
+{
+    drawLine(ctx, ctx->currX, ctx->currY, x, y, col, mode);
+    moveTo(ctx, x, y);
+}
+
+//draw line from current to (x,y)
+void lineTo(int32_t x, int32_t y, uint32_t col, int32_t mode /* = BLEND_MODE_NORMAL */)
+{
+    lineTo(&gfxContext, x, y, col, mode);
+}
+
+//set palette color to render palette table
+void setPalette(const RGBA* pal)
+{
+    SDL_Palette* palette = SDL_GetSurfacePalette(sdlSurface);
+    if (palette) SDL_SetPaletteColors(palette, pal, 0, 256);
+    initPaletteTable(pal);
+    markDirtyScreen();
+}
+
+//get current palette table
+void getPalette(RGBA* pal)
+{
+    const SDL_Palette* palette = SDL_GetSurfacePalette(sdlSurface);
+    if (palette) memcpy(pal, palette->colors, palette->ncolors * sizeof(RGBA));
+}
+
+//FX-effect: palette rotation
+void rotatePalette(int32_t from, int32_t to, int32_t loop, int32_t ms)
+{
+    RGBA tmp = { 0 };
+
+    RGBA pal[256] = { 0 };
+    getPalette(pal);
+
+    //how many steps to rotated
+    const uint32_t steps = (to - from) * sizeof(RGBA);
+
+    if (loop > 0)
+    {
+        while (loop--)
+        {
+            memcpy(&tmp, &pal[from], sizeof(RGBA));
+            memcpy(&pal[from], &pal[from + 1], steps);
+            memcpy(&pal[to], &tmp, sizeof(RGBA));
+            setPalette(pal);
+            render();
+            delay(ms);
+            readKeys();
+            if (keyDown(SDL_SCANCODE_RETURN)) break;
+            if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+        }
+    }
+    else
+    {
+        while (true)
+        {
+            memcpy(&tmp, &pal[from], sizeof(RGBA));
+            memcpy(&pal[from], &pal[from + 1], steps);
+            memcpy(&pal[to], &tmp, sizeof(RGBA));
+            setPalette(pal);
+            render();
+            delay(ms);
+            readKeys();
+            if (keyDown(SDL_SCANCODE_RETURN)) break;
+            if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+        }
+    }
+}
+
+//FX-effect: palette fade-in
+void fadeIn(const RGBA* dest, uint32_t ms)
+{
+    RGBA src[256] = { 0 };
+    getPalette(src);
+
+    for (int32_t i = 63; i >= 0; i--)
+    {
+        for (int32_t j = 0; j < 256; j++)
+        {
+            const int32_t k = i << 2;
+            if (dest[j].r > k && src[j].r < 252) src[j].r += 4;
+            if (dest[j].g > k && src[j].g < 252) src[j].g += 4;
+            if (dest[j].b > k && src[j].b < 252) src[j].b += 4;
+        }
+        setPalette(src);
+        render();
+        delay(ms);
+        readKeys();
+        if (keyDown(SDL_SCANCODE_RETURN)) break;
+        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+    }
+}
+
+//FX-effect: palette fade-out
+void fadeOut(const RGBA* dest, uint32_t ms)
+{
+    RGBA src[256] = { 0 };
+    getPalette(src);
+
+    for (int32_t i = 63; i >= 0; i--)
+    {
+        for (int32_t j = 0; j < 256; j++)
+        {
+            const int32_t k = i << 2;
+            if (dest[j].r < k && src[j].r > 4) src[j].r -= 4;
+            if (dest[j].g < k && src[j].g > 4) src[j].g -= 4;
+            if (dest[j].b < k && src[j].b > 4) src[j].b -= 4;
+        }
+        setPalette(src);
+        render();
+        delay(ms);
+        readKeys();
+        if (keyDown(SDL_SCANCODE_RETURN)) break;
+        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+    }
+}
+
+//FX-effect: palette fade-max
+void fadeMax(uint32_t ms)
+{
+    RGBA src[256] = { 0 };
+    getPalette(src);
+
+    for (int32_t i = 0; i < 64; i++)
+    {
+        for (int32_t j = 0; j < 256; j++)
+        {
+            if (src[j].r < 252) src[j].r += 4; else src[j].r = 255;
+            if (src[j].g < 252) src[j].g += 4; else src[j].g = 255;
+            if (src[j].b < 252) src[j].b += 4; else src[j].b = 255;
+        }
+        setPalette(src);
+        render();
+        delay(ms);
+        readKeys();
+        if (keyDown(SDL_SCANCODE_RETURN)) break;
+        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+    }
+}
+
+//FX-effect: palette fade-min
+void fadeMin(uint32_t ms)
+{
+    RGBA src[256] = { 0 };
+    getPalette(src);
+
+    for (int32_t i = 0; i < 64; i++)
+    {
+        for (int32_t j = 0; j < 256; j++)
+        {
+            if (src[j].r > 4) src[j].r -= 4; else src[j].r = 0;
+            if (src[j].g > 4) src[j].g -= 4; else src[j].g = 0;
+            if (src[j].b > 4) src[j].b -= 4; else src[j].b = 0;
+        }
+        setPalette(src);
+        render();
+        delay(ms);
+        readKeys();
+        if (keyDown(SDL_SCANCODE_RETURN)) break;
+        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+    }
+}
+
+//FX-effect: palette fade-down
+void fadeDown(RGBA* pal)
+{
+    for (int32_t i = 0; i < 256; i++)
+    {
+        if (pal[i].r > 4) pal[i].r -= 2; else pal[i].r = 0;
+        if (pal[i].g > 4) pal[i].g -= 2; else pal[i].g = 0;
+        if (pal[i].b > 4) pal[i].b -= 2; else pal[i].b = 0;
+    }
+    setPalette(pal);
+    render();
+}
+
+//convert mixed palette buffer to RGB buffer
+void convertPalette(const uint8_t* palette, RGBA* color)
+{
+    uint8_t* rgb = (uint8_t*)color;
+    uint8_t* pal = (uint8_t*)palette;
+    for (int32_t i = 0; i < 256; i++)
+    {
+        rgb[0] = pal[0] << 2;
+        rgb[1] = pal[1] << 2;
+        rgb[2] = pal[2] << 2;
+        rgb += 4;
+        pal += 3;
+    }
+}
+
+//convert current RGB palette to RGB32
+void shiftPalette(RGBA* pal)
+{
+    RGBA* rgb = (RGBA*)pal;
+    for (int32_t i = 0; i < 256; i++)
+    {
+        rgb->r <<= 2;
+        rgb->g <<= 2;
+        rgb->b <<= 2;
+        rgb++;
+    }
+}
+
+//make a black palette
+void clearPalette()
+{
+    RGBA pal[256] = { 0 };
+    memset(pal, 0, sizeof(pal));
+    setPalette(pal);
+    render();
+}
+
+//make white palette
+void whitePalette()
+{
+    RGBA pal[256] = { 0 };
+    memset(pal, 255, sizeof(pal));
+    setPalette(pal);
+    render();
+}
+
+//build default 256 colors palette
+void getBasePalette(RGBA* pal)
+{
+    memcpy(pal, basePalette, sizeof(basePalette));
+}
+
+//make linear palette (7 circles color)
+void makeLinearPalette()
+{
+    RGBA pal[256] = { 0 };
+    memset(pal, 0, sizeof(pal));
+
+    for (int16_t i = 0; i < 32; i++)
+    {
+        int16_t j = 16 + i;
+        pal[j].r = 63;
+        pal[j].g = 0;
+        pal[j].b = 63 - (i << 1);
+
+        j = 48 + i;
+        pal[j].r = 63;
+        pal[j].g = i << 1;
+        pal[j].b = 0;
+
+        j = 80 + i;
+        pal[j].r = 63 - (i << 1);
+        pal[j].g = 63;
+        pal[j].b = 0;
+
+        j = 112 + i;
+        pal[j].r = 0;
+        pal[j].g = 63;
+        pal[j].b = i << 1;
+
+        j = 144 + i;
+        pal[j].r = 0;
+        pal[j].g = 63 - (i << 1);
+        pal[j].b = 63;
+
+        j = 176 + i;
+        pal[j].r = i << 1;
+        pal[j].g = 0;
+        pal[j].b = 63;
+    }
+
+    shiftPalette(pal);
+    setPalette(pal);
+}
+
+//yet another funky palette
+void makeFunkyPalette()
+{
+    RGBA pal[256] = { 0 };
+
+    int32_t r = 0, g = 0, b = 0;
+    bool ry = true, gy = true, by = true;
+
+    srand(getRandomSeed());
+
+    int32_t rx = (rand() % 5) + 1;
+    int32_t gx = (rand() % 5) + 1;
+    int32_t bx = (rand() % 5) + 1;
+    
+    memset(pal, 0, sizeof(pal));
+
+    for (int32_t i = 0; i < 256; i++)
+    {
+        pal[i].r = r;
+        pal[i].g = g;
+        pal[i].b = b;
+
+        if (ry) r += rx; else r -= rx;
+        if (gy) g += gx; else g -= gx;
+        if (by) b += bx; else b -= bx;
+
+        if ((r + rx > 63) || (r - rx < 0))
+        {
+            ry = !ry;
+            rx = (rand() % 5) + 1;
+        }
+
+        if ((g + gx > 63) || (g - gx < 0))
+        {
+            gy = !gy;
+            gx = (rand() % 5) + 1;
+        }
+
+        if ((b + bx > 63) || (b - bx < 0))
+        {
+            by = !by;
+            bx = (rand() % 5) + 1;
+        }
+    }
+
+    shiftPalette(pal);
+    setPalette(pal);
+}
+
+//make rainbow palette
+void makeRainbowPalette()
+{
+    RGBA pal[256] = { 0 };
+    memset(pal, 0, sizeof(pal));
+
+    for (int32_t i = 0; i < 32; i++)
+    {
+        pal[i      ].r = i << 1;
+        pal[63 - i ].r = i << 1;
+        pal[i + 64 ].g = i << 1;
+        pal[127 - i].g = i << 1;
+        pal[i + 128].b = i << 1;
+        pal[191 - i].b = i << 1;
+        pal[i + 192].r = i << 1;
+        pal[i + 192].g = i << 1;
+        pal[i + 192].b = i << 1;
+        pal[255 - i].r = i << 1;
+        pal[255 - i].g = i << 1;
+        pal[255 - i].b = i << 1;
+    }
+
+    shiftPalette(pal);
+    setPalette(pal);
+}
+
+//scrolling current palette
+void scrollPalette(int32_t from, int32_t to, int32_t step)
+{
+    RGBA tmp = { 0 };
+    RGBA pal[256] = { 0 };
+
+    memset(pal, 0, sizeof(pal));
+    getPalette(pal);
+
+    //how many steps to rotated
+    const uint32_t steps = (to - from) * sizeof(RGBA);
+
+    while (step--)
+    {
+        memcpy(&tmp, &pal[from], sizeof(tmp));
+        memcpy(&pal[from], &pal[from + 1], steps);
+        memcpy(&pal[to], &tmp, sizeof(tmp));
+        readKeys();
+        if (keyDown(SDL_SCANCODE_RETURN)) break;;
+        if (keyDown(SDL_SCANCODE_ESCAPE)) quit();
+    }
+
+    setPalette(pal);
+}
+
+//string position
+int32_t strPos(char* str, const char* sub)
+{
+    const char* ptr = strstr(str, sub);
+    return ptr ? int32_t(ptr - str) : -1;
+}
+
+//insert character to current string
+void insertChar(char* str, uint8_t chr, int32_t pos)
+{
+    if (pos < 0 || pos >= int32_t(strlen(str))) return;
+    str[pos] = chr;
+}
+
+//delete character of string
+void strDelete(char* str, int32_t i, uint32_t num)
+{
+    if (i < 0 || i >= int32_t(strlen(str))) return;
+    memmove(&str[i + 1], &str[i + num], strlen(str) - i - 1);
+}
+
+//replace current string with another string
+void schRepl(char* str, const char* schr, uint8_t repl)
+{
+    int32_t pos = strPos(str, schr);
+    const uint32_t length = uint32_t(strlen(schr));
+
+    while (pos >= 0)
+    {
+        strDelete(str, pos, length);
+        insertChar(str, repl, pos);
+        pos = strPos(str, schr);
+    }
+}
+
+//character to string conversion
+void chr2Str(uint8_t chr, uint8_t num, char* str)
+{
+    str[0] = chr;
+    str[1] = num;
+    str[2] = '\0';
+}
+
+//encode string to VNI string (format type VNI)
+void makeFont(char* str)
+{
+    char buff[4] = { 0 };
+    schRepl(str, "a8", 128);
+    chr2Str(128, '1', buff);
+    schRepl(str, buff, 129);
+    chr2Str(128, '2', buff);
+    schRepl(str, buff, 130);
+    chr2Str(128, '3', buff);
+    schRepl(str, buff, 131);
+    chr2Str(128, '4', buff);
+    schRepl(str, buff, 132);
+    chr2Str(128, '5', buff);
+    schRepl(str, buff, 133);
+    schRepl(str, "a6", 134);
+    chr2Str(134, '1', buff);
+    schRepl(str, buff, 135);
+    chr2Str(134, '2', buff);
+    schRepl(str, buff, 136);
+    chr2Str(134, '3', buff);
+    schRepl(str, buff, 137);
+    chr2Str(134, '4', buff);
+    schRepl(str, buff, 138);
+    chr2Str(134, '5', buff);
+    schRepl(str, buff, 139);
+    schRepl(str, "e6", 140);
+    chr2Str(140, '1', buff);
+    schRepl(str, buff, 141);
+    chr2Str(140, '2', buff);
+    schRepl(str, buff, 142);
+    chr2Str(140, '3', buff);
+    schRepl(str, buff, 143);
+    chr2Str(140, '4', buff);
+    schRepl(str, buff, 144);
+    chr2Str(140, '5', buff);
+    schRepl(str, buff, 145);
+    schRepl(str, "o7", 146);
+    chr2Str(146, '1', buff);
+    schRepl(str, buff, 147);
+    chr2Str(146, '2', buff);
+    schRepl(str, buff, 148);
+    chr2Str(146, '3', buff);
+    schRepl(str, buff, 149);
+    chr2Str(146, '4', buff);
+    schRepl(str, buff, 150);
+    chr2Str(146, '5', buff);
+    schRepl(str, buff, 151);
+    schRepl(str, "o6", 152);
+    chr2Str(152, '1', buff);
+    schRepl(str, buff, 153);
+    chr2Str(152, '2', buff);
+    schRepl(str, buff, 154);
+    chr2Str(152, '3', buff);
+    schRepl(str, buff, 155);
+    chr2Str(152, '4', buff);
+    schRepl(str, buff, 156);
+    chr2Str(152, '5', buff);
+    schRepl(str, buff, 157);
+    schRepl(str, "u7", 158);
+    chr2Str(158, '1', buff);
+    schRepl(str, buff, 159);
+    chr2Str(158, '2', buff);
+    schRepl(str, buff, 160);
+    chr2Str(158, '3', buff);
+    schRepl(str, buff, 161);
+    chr2Str(158, '4', buff);
+    schRepl(str, buff, 162);
+    chr2Str(158, '5', buff);
+    schRepl(str, buff, 163);
+    schRepl(str, "a1", 164);
+    schRepl(str, "a2", 165);
+    schRepl(str, "a3", 166);
+    schRepl(str, "a4", 167);
+    schRepl(str, "a5", 168);
+    schRepl(str, "e1", 169);
+    schRepl(str, "e2", 170);
+    schRepl(str, "e3", 171);
+    schRepl(str, "e4", 172);
+    schRepl(str, "e5", 173);
+    schRepl(str, "i1", 174);
+    schRepl(str, "i2", 175);
+    schRepl(str, "i3", 181);
+    schRepl(str, "i4", 182);
+    schRepl(str, "i5", 183);
+    schRepl(str, "o1", 184);
+    schRepl(str, "o2", 190);
+    schRepl(str, "o3", 198);
+    schRepl(str, "o4", 199);
+    schRepl(str, "o5", 208);
+    schRepl(str, "u1", 210);
+    schRepl(str, "u2", 211);
+    schRepl(str, "u3", 212);
+    schRepl(str, "u4", 213);
+    schRepl(str, "u5", 214);
+    schRepl(str, "y1", 215);
+    schRepl(str, "y2", 216);
+    schRepl(str, "y3", 221);
+    schRepl(str, "y4", 222);
+    schRepl(str, "y5", 248);
+    schRepl(str, "d9", 249);
+    schRepl(str, "D9", 250);
+}
+
+//generate random word array
+void randomBuffer(void* buff, int32_t count, int32_t range)
+{
+#ifdef _USE_ASM
+    __asm {
+        mov     edi, buff
+        mov     ecx, count
+        mov     ebx, randSeed
+    next:
+        mov     eax, ebx
+        mul     factor
+        inc     eax
+        mov     ebx, eax
+        shr     eax, 16
+        mul     range
+        shr     eax, 16
+        stosw
+        dec     ecx
+        jnz     next
+        mov     randSeed, ebx
+    }
+#else
+    //check range
+    uint16_t* ptrBuff = (uint16_t*)buff;
+    if (!count || !randSeed || !range || !ptrBuff) return;
+
+    const uint32_t val = (((randSeed * factor + 1) >> 16) * range) >> 16;
+    for (int32_t i = 0; i < count; i++) *ptrBuff++ = val;
+
+    randSeed = val;
+#endif
+}
+
+//get current loaded GFX font
+GFX_FONT* getFont(int32_t type /* = 0 */)
+{
+    if (type >= GFX_MAX_FONT) type = GFX_MAX_FONT - 1;
+    if (type < 0) type = 0;
+    return gfxFonts[type ? type : fontType].dataPtr ? &gfxFonts[type ? type : fontType] : NULL;
+}
+
+//get current loaded font type
+int32_t getFontType()
+{
+    return fontType;
+}
+
+//selected loaded GFX font
+void setFontType(int32_t type)
+{
+    //check current range
+    if (type >= GFX_MAX_FONT) type = GFX_MAX_FONT - 1;
+    if (type < 0) type = 0;
+    fontType = type;
+}
+
+//set current font size
+void setFontSize(uint32_t size)
+{
+    GFX_FONT* font = getFont(fontType);
+    if (!font) return;
+
+    //have sub-fonts
+    if (font->hdr.subFonts > 0)
+    {
+        //correct sub-fonts number
+        if (size > font->hdr.subFonts) size = font->hdr.subFonts;
+        //copy sub-fonts hdr
+        memcpy(&font->hdr.subData, &font->dataPtr[4 * (font->hdr.subData.endChar - font->hdr.subData.startChar + 1) * (font->hdr.subFonts + 1) + size * sizeof(GFX_CHAR_HEADER)], sizeof(GFX_CHAR_HEADER));
+    }
+    subFonts = size;
+}
+
+//get height of string with current font in pixel
+int32_t getFontHeight(const char* str)
+{
+    uint32_t i = 0;
+    uint32_t height = 0;
+    uint32_t mempos = 0;
+    uint32_t size = 0;
+    const uint32_t len = uint32_t(strlen(str));
+    const GFX_FONT* font = getFont(fontType);
+
+    //check for font is loaded
+    if (!font) return 0;
+    if (!str || !len) return 0;
+
+    //fixed font, all characters have a same height
+    if (font->hdr.flags & GFX_FONT_FIXED) height = font->hdr.subData.height;
+    else
+    {
+        //vector font
+        if (font->hdr.flags & GFX_FONT_VECTOR)
+        {
+            for (i = 0; i < len; i++)
+            {
+                //skip invalid character
+                if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) continue;
+
+                //position of raw data of current character
+                mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
+                size = font->dataPtr[mempos + 1];
+                if (size > height) height = size;
+            }
+            height *= subFonts;
+        }
+        else
+        {
+            //BMP1 font
+            if (font->hdr.subData.bitsPerPixel == 1)
+            {
+                for (i = 0; i < len; i++)
+                {
+                    //skip invalid character
+                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) continue;
+
+                    //position of raw data of current character
+                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
+                    size = font->dataPtr[mempos + 1];
+                    if (size > height) height = size;
+                }
+            }
+            else if (font->hdr.subData.bitsPerPixel >= 2 && font->hdr.subData.bitsPerPixel <= 32)
+            {
+                //BMP8 and RGB font
+                for (i = 0; i < len; i++)
+                {
+                    //skip invalid character
+                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) continue;
+
+                    //position of raw data of current character
+                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
+                    size = *(uint32_t*)&font->dataPtr[mempos + 4] + *(uint32_t*)&font->dataPtr[mempos + 12];
+                    if (size > height) height = size;
+                }
+            }
+        }
+    }
+
+    //animation font
+    if (font->hdr.flags & GFX_FONT_ANIPOS) height += font->hdr.subData.randomY;
+    return height;
+}
+
+//get width of string with current font in pixel
+int32_t getFontWidth(const char* str)
+{
+    GFX_STROKE_DATA* data = NULL;
+    uint32_t i = 0;
+    uint32_t mempos = 0;
+    uint32_t width = 0;
+    uint32_t size = 0;
+    const uint32_t len = uint32_t(strlen(str));
+    const GFX_FONT* font = getFont(fontType);
+
+    //check for font is loaded
+    if (!font) return 0;
+    if (!str || !len) return 0;
+
+    //fixed font, all characters have a same width
+    if (font->hdr.flags & GFX_FONT_FIXED) width = (font->hdr.subData.width + font->hdr.subData.distance) * len;
+    else
+    {
+        //vector font
+        if (font->hdr.flags & GFX_FONT_VECTOR)
+        {
+            for (i = 0; i < len; i++)
+            {
+                //skip invalid character
+                if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar) size = font->hdr.subData.spacer;
+                else
+                {
+                    //position of raw data of current character
+                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
+                    data = (GFX_STROKE_DATA*)&font->dataPtr[mempos];
+                    size = data->width * subFonts;
+                }
+                width += size + font->hdr.subData.distance;
+            }
+        }
+        else
+        {
+            //BMP1 font
+            if (font->hdr.subData.bitsPerPixel == 1)
+            {
+                for (i = 0; i < len; i++)
+                {
+                    //skip invalid character
+                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar)
+                    {
+                        width += font->hdr.subData.spacer + font->hdr.subData.distance;
+                        continue;
+                    }
+
+                    //position of raw data of current character
+                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
+                    width += *(uint8_t*)&font->dataPtr[mempos] + font->hdr.subData.distance;
+                }
+            }
+            else if (font->hdr.subData.bitsPerPixel >= 2 && font->hdr.subData.bitsPerPixel <= 32)
+            {
+                //BMP8 and RGB font
+                for (i = 0; i < len; i++)
+                {
+                    //skip invalid character
+                    if (str[i] < font->hdr.subData.startChar || str[i] > font->hdr.subData.endChar)
+                    {
+                        width += font->hdr.subData.spacer + font->hdr.subData.distance;
+                        continue;
+                    }
+
+                    //position of raw data of current character
+                    mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((str[i] - font->hdr.subData.startChar) << 2)];
+                    width += *(uint32_t*)&font->dataPtr[mempos] + *(uint32_t*)&font->dataPtr[mempos + 8] + font->hdr.subData.distance;
+                }
+            }
+        }
+    }
+
+    //animation font
+    if (font->hdr.flags & GFX_FONT_ANIPOS) width += font->hdr.subData.randomX;
+    return width - font->hdr.subData.distance;
+}
+
+//load font name to memory
+int32_t loadFont(const char* fname, int32_t type)
+{
+    //check for type range
+    if (type >= GFX_MAX_FONT)
+    {
+        messageBox(GFX_WARNING, "Error load font: %s! unknown font type!", fname);
+        return 0;
+    }
+
+    //check for already loaded
+    if (gfxFonts[type].dataPtr)
+    {
+        messageBox(GFX_WARNING, "Error load font: %s! font type: %d already loaded!", fname, type);
+        return 0;
+    }
+
+    //open font file
+    FILE* fp = fopen(fname, "rb");
+    if (!fp)
+    {
+        messageBox(GFX_WARNING, "Error load font: %s! file not found!", fname);
+        return 0;
+    }
+
+    //read font hdr
+    fread(&gfxFonts[type].hdr, sizeof(GFX_FONT_HEADER), 1, fp);
+
+    //check font signature, version number and memory size
+    if (memcmp(gfxFonts[type].hdr.signature, "Fnt2", 4) || gfxFonts[type].hdr.version != 0x0101 || !gfxFonts[type].hdr.memSize)
+    {
+        fclose(fp);
+        messageBox(GFX_WARNING, "Error load font: %s! wrong GFX font!", fname);
+        return 0;
+    }
+
+    //allocate raw data buffer
+    gfxFonts[type].dataPtr = (uint8_t*)calloc(gfxFonts[type].hdr.memSize, 1);
+    if (!gfxFonts[type].dataPtr)
+    {
+        fclose(fp);
+        messageBox(GFX_WARNING, "Error load font: %s! not enough memory!", fname);
+        return 0;
+    }
+
+    //read raw font data
+    fread(gfxFonts[type].dataPtr, gfxFonts[type].hdr.memSize, 1, fp);
+    fclose(fp);
+
+    //reset font header for old font
+    if (gfxFonts[type].hdr.flags & GFX_FONT_MULTI) setFontSize(0);
+
+    //default sub-fonts
+    if (gfxFonts[type].hdr.flags & GFX_FONT_VECTOR) subFonts = 1;
+    else subFonts = 0;
+
+    //BMP8 font palette
+    if (gfxFonts[type].hdr.subData.usedColors > 1)
+    {
+        //BMP8 use up to 128 colors (128 * 4)
+        fontPalette[type] = (uint8_t*)calloc(512, 1);
+        if (!fontPalette[type])
+        {
+            free(gfxFonts[type].dataPtr);
+            messageBox(GFX_WARNING, "Error load font: %s! wrong font palette!", fname);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+//release current loaded font
+void freeFont(int32_t type)
+{
+    //check for type range
+    if (type < 0) return;
+    if (type >= GFX_MAX_FONT) return;
+
+    //free font raw data buffer
+    if (gfxFonts[type].dataPtr)
+    {
+        free(gfxFonts[type].dataPtr);
+        gfxFonts[type].dataPtr = NULL;
+    }
+
+    //free font palette
+    if (fontPalette[type])
+    {
+        free(fontPalette[type]);
+        fontPalette[type] = NULL;
+    }
+
+    //reset header
+    memset(&gfxFonts[type].hdr, 0, sizeof(GFX_FONT_HEADER));
+}
+
+//draw a stroke of BGI font (YES we also support BGI font)
+int32_t outStroke(int32_t x, int32_t y, char chr, uint32_t col, uint32_t mode)
+{
+    const GFX_FONT* font = getFont(fontType);
+
+    //check for font is loaded
+    if (!font) return 0;
+
+    //check for non-drawable character
+    if (font->hdr.subData.startChar > chr || font->hdr.subData.endChar < chr) return font->hdr.subData.spacer;
+
+    //memory position of character
+    uint32_t mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((chr - font->hdr.subData.startChar) << 2)];
+    const GFX_STROKE_DATA* data = (GFX_STROKE_DATA*)&font->dataPtr[mempos];
+    GFX_STROKE_INFO* stroke = (GFX_STROKE_INFO*)&font->dataPtr[mempos + sizeof(GFX_STROKE_DATA)];
+
+    //scan for all lines
+    for (int32_t i = 0; i < data->numOfLines; i++)
+    {
+        const uint32_t mx = x + stroke->x * subFonts;
+        const uint32_t my = y + stroke->y * subFonts;
+
+        //check for drawable
+        if (stroke->code == 1) moveTo(mx, my);
+        else
+        {
+            if (mode == 2) lineTo(mx, my, col, BLEND_MODE_ADD);
+            else if (mode == 3) lineTo(mx, my, col, BLEND_MODE_SUB);
+            else lineTo(mx, my, col);
+        }
+        stroke++;
+    }
+
+    return data->width * subFonts;
+}
+
+//draw string with current loaded font
+void writeString(int32_t x, int32_t y, uint32_t col, uint32_t mode, const char* str)
+{
+    uint32_t i = 0, cx = 0, cy = 0;
+    uint32_t data = 0, datapos = 0, mempos = 0;
+    uint32_t width = 0, height = 0, addx = 0, addy = 0;
+    const GFX_FONT* font = getFont(fontType);
+
+    //check for font is loaded
+    if (!font) return;
+
+    const uint32_t len = uint32_t(strlen(str));
+
+    //check for vector font
+    if (font->hdr.flags & GFX_FONT_VECTOR)
+    {
+        for (i = 0; i < len; i++)
+        {
+            x += outStroke(x, y, str[i], col, mode) + font->hdr.subData.distance;
+            if (mode == 1) col++;
+        }
+        return;
+    }
+
+    //BMP1 font format
+    if (font->hdr.subData.bitsPerPixel == 1)
+    {
+        for (i = 0; i < len; i++)
+        {
+            //invalid character, update position
+            if (uint8_t(str[i]) < font->hdr.subData.startChar || uint8_t(str[i]) > font->hdr.subData.endChar)
+            {
+                if (!(font->hdr.flags & GFX_FONT_FIXED)) x += font->hdr.subData.spacer + font->hdr.subData.distance;
+                else x += font->hdr.subData.width + font->hdr.subData.distance;
+                continue;
+            }
+
+            //memory position for each character
+            mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((uint8_t(str[i]) - font->hdr.subData.startChar) << 2)];
+            width = font->dataPtr[mempos];
+            height = font->dataPtr[mempos + 1];
+            mempos += 2;
+
+            //scans for font width and height
+            for (cy = 0; cy < height; cy++)
+            {
+                datapos = 0;
+                data = *(uint32_t*)&font->dataPtr[mempos];
+                for (cx = 0; cx < width; cx++)
+                {
+                    if ((cx > 31) && !(cx & 31))
+                    {
+                        datapos += 4;
+                        data = *(uint32_t*)&font->dataPtr[mempos + datapos];
+                    }
+                    if (data & (1 << (cx & 31)))
+                    {
+                        if (mode == 2) putPixel(x + cx, y + cy, col, BLEND_MODE_ADD);
+                        else if (mode == 3) putPixel(x + cx, y + cy, col, BLEND_MODE_SUB);
+                        else putPixel(x + cx, y + cy, col);
+                    }
+                }
+                mempos += font->hdr.subData.bytesPerLine;
+            }
+            x += width + font->hdr.subData.distance;
+            if (mode == 1) col++;
+        }
+    }
+    //BMP8 font format
+    else if (font->hdr.subData.bitsPerPixel > 1 && font->hdr.subData.bitsPerPixel < 8)
+    {
+        //calculate font palette, use for hi-color and true-color
+        if (gfxContext.bitsPerPixel > 8)
+        {
+            const ARGB* pcol = (const ARGB*)&col;
+            for (i = 0; i < font->hdr.subData.usedColors; i++)
+            {
+                ARGB* pixels = (ARGB*)&fontPalette[fontType][i << 2];
+                pixels->r = pcol->r * (i + 1) / font->hdr.subData.usedColors;
+                pixels->g = pcol->g * (i + 1) / font->hdr.subData.usedColors;
+                pixels->b = pcol->b * (i + 1) / font->hdr.subData.usedColors;
+            }
+        }
+
+        //generate random position for animation font
+        if (font->hdr.flags & GFX_FONT_ANIPOS)
+        {
+            randomBuffer(gfxBuff, len + 1, font->hdr.subData.randomX);
+            randomBuffer(&gfxBuff[512], len + 1, font->hdr.subData.randomY);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            //invalid character, update character position
+            if (uint8_t(str[i]) < font->hdr.subData.startChar || uint8_t(str[i]) > font->hdr.subData.endChar)
+            {
+                if (!(font->hdr.flags & GFX_FONT_FIXED)) x += font->hdr.subData.spacer + font->hdr.subData.distance;
+                else x += font->hdr.subData.width + font->hdr.subData.distance;
+                continue;
+            }
+
+            //lookup character position
+            mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((uint8_t(str[i]) - font->hdr.subData.startChar) << 2)];
+            addx = *(uint32_t*)&font->dataPtr[mempos];
+            addy = *(uint32_t*)&font->dataPtr[mempos + 4];
+
+            //update position for animation font
+            if (font->hdr.flags & GFX_FONT_ANIPOS)
+            {
+                addx += gfxBuff[i << 1];
+                addy += gfxBuff[(i << 1) + 512];
+            }
+
+            //get font width and height
+            width = *(uint32_t*)&font->dataPtr[mempos + 8];
+            height = *(uint32_t*)&font->dataPtr[mempos + 12];
+            mempos += 16;
+            x += addx;
+
+            //scans font raw data
+            for (cy = 0; cy < height; cy++)
+            {
+                for (cx = 0; cx < width; cx++)
+                {
+                    data = font->dataPtr[mempos++];
+                    if (!(data & 0x80))
+                    {
+                        if (gfxContext.bitsPerPixel == 8) putPixel(x + cx, y + cy + addy, data);
+                        else if (mode == 2) putPixel(x + cx, y + cy + addy, *(uint32_t*)&fontPalette[fontType][data << 2], BLEND_MODE_ADD);
+                        else if (mode == 3) putPixel(x + cx, y + cy + addy, *(uint32_t*)&fontPalette[fontType][data << 2], BLEND_MODE_SUB);
+                        else putPixel(x + cx, y + cy + addy, *(uint32_t*)&fontPalette[fontType][data << 2]);
+                    }
+                }
+            }
+
+            //update next position
+            if (font->hdr.flags & GFX_FONT_ANIPOS) x -= gfxBuff[i << 1];
+            if (font->hdr.flags & GFX_FONT_FIXED) x += font->hdr.subData.width + font->hdr.subData.distance;
+            else x += width + font->hdr.subData.distance;
+        }
+    }
+    //alpha channel font
+    else if (font->hdr.subData.bitsPerPixel == 32)
+    {
+        //generate random position for animation font
+        if (font->hdr.flags & GFX_FONT_ANIPOS)
+        {
+            randomBuffer(gfxBuff, len + 1, font->hdr.subData.randomX);
+            randomBuffer(&gfxBuff[512], len + 1, font->hdr.subData.randomY);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            //invalid character, update character position
+            if (uint8_t(str[i]) < font->hdr.subData.startChar || uint8_t(str[i]) > font->hdr.subData.endChar)
+            {
+                if (!(font->hdr.flags & GFX_FONT_FIXED)) x += font->hdr.subData.spacer + font->hdr.subData.distance;
+                else x += font->hdr.subData.width + font->hdr.subData.distance;
+                continue;
+            }
+
+            //lookup character position
+            mempos = *(uint32_t*)&font->dataPtr[font->hdr.subData.startOffset + ((uint8_t(str[i]) - font->hdr.subData.startChar) << 2)];
+            addx = *(uint32_t*)&font->dataPtr[mempos];
+            addy = *(uint32_t*)&font->dataPtr[mempos + 4];
+
+            //update position for animation font
+            if (font->hdr.flags & GFX_FONT_ANIPOS)
+            {
+                addx += gfxBuff[i << 1];
+                addy += gfxBuff[(i << 1) + 512];
+            }
+
+            //get font width and height
+            width = *(uint32_t*)&font->dataPtr[mempos + 8];
+            height = *(uint32_t*)&font->dataPtr[mempos + 12];
+            mempos += 16;
+            x += addx;
+
+            //scans raw font data
+            for (cy = 0; cy < height; cy++)
+            {
+                for (cx = 0; cx < width; cx++)
+                {
+                    data = *(uint32_t*)&font->dataPtr[mempos];
+                    putPixel(x + cx, y + addy + cy, rgba(data, 255), BLEND_MODE_ALPHA);
+                    mempos += 4;
+                }
+            }
+
+            //update next position
+            if (font->hdr.flags & GFX_FONT_ANIPOS) x -= gfxBuff[i << 1];
+            if (font->hdr.flags & GFX_FONT_FIXED) x += font->hdr.subData.width + font->hdr.subData.distance;
+            else x += width + font->hdr.subData.distance;
+        }
+    }
+}
+
+//print text with format to display screen
+void writeText(int32_t x, int32_t y, uint32_t color, uint32_t mode, const char* format, ...)
+{
+    char buffer[1024] = { 0 };
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    writeString(x, y, color, mode, buffer);
+}
+
+//draw multi-line string font
+int32_t drawText(const char* const str[], uint32_t count, int32_t ypos)
+{
+    //check for font loaded
+    if (!gfxFonts[fontType].dataPtr) return 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (ypos > -30) writeString(gfxContext.centerX - (getFontWidth(str[i]) >> 1), ypos, 62, 0, str[i]);
+        ypos += getFontHeight(str[i]);
+        if (ypos > gfxContext.cmaxY) break;
+    }
+
+    return ypos;
+}
+
+//fast show BMP image to screen (demo version)
+void showBMP(const char* fname)
+{
+    GFX_IMAGE bmp;
+    loadImage(fname, &bmp);
+    putImage(0, 0, &bmp);
+    render();
+    freeImage(&bmp);
+}
+
+//fast show 32 bits PNG image to screen (demo version)
+void showPNG(const char* fname)
+{
+    GFX_IMAGE png;
+    loadImage(fname, &png);
+
+    //background color
+    const uint32_t cols[2] = { RGB_GREY191, RGB_WHITE };
+
+    //make background
+    for (int32_t y = 0; y < gfxContext.texHeight; y++)
+    {
+        for (int32_t x = 0; x < gfxContext.texWidth; x++) fillRect(alignedSize(x), y, 8, 8, cols[((x ^ y) >> 3) & 1]);
+    }
+
+    //render image
+    putImage(0, 0, &png, BLEND_MODE_ALPHA);
+    render();
+    freeImage(&png);
+}
+
+//fast show JPG image to screen (demo version)
+void showJPG(const char* fname)
+{
+    //load jpeg image with SIMD support
+    GFX_IMAGE jpg;
+    loadImage(fname, &jpg);
+
+    //render image
+    putImage(0, 0, &jpg, BLEND_MODE_NORMAL);
+    render();
+    freeImage(&jpg);
+}
+
+//load image as 8bits texture to output buffer
+int32_t loadPNG(uint8_t* raw, RGBA* pal, const char* fname)
+{
+    //simple image loader for all supported types
+    SDL_Surface* image = IMG_Load(fname);
+    if (!image)
+    {
+        messageBox(GFX_ERROR, "Load image error: %s", IMG_GetError());
+        return 0;
+    }
+
+    //check image format type (must 256 palette colors)
+    if (image->format != SDL_PIXELFORMAT_INDEX8)
+    {
+        messageBox(GFX_ERROR, "Only 8 bits image format is supported! %s", fname);
+        return 0;
+    }
+
+    //copy raw data and palette
+    if (raw) memcpy(raw, image->pixels, image->pitch * image->h);
+    
+    //copy palette color
+    if (pal)
+    {
+        const SDL_Palette* palette = SDL_GetSurfacePalette(image);
+        if (palette) memcpy(pal, palette->colors, palette->ncolors * sizeof(RGBA));
+    }
+
+    SDL_DestroySurface(image);
+    return 1;
+}
+
+//load image as GFXLIB texture format
+int32_t loadImage(const char* fname, GFX_IMAGE* im)
+{
+    //simple image loader for all supported types
+    SDL_Surface* image = IMG_Load(fname);
+    if (!image)
+    {
+        messageBox(GFX_ERROR, "Load image error: %s", IMG_GetError());
+        return 0;
+    }
+
+    //create 32bits texture to convert image format (support alpha channel image)
+    SDL_Surface* texture = SDL_CreateSurface(image->w, image->h, SDL_PIXELFORMAT_ARGB8888);
+    if (!texture)
+    {
+        SDL_DestroySurface(image);
+        messageBox(GFX_ERROR, "Error create surface: %s!", SDL_GetError());
+        return 0;
+    }
+
+    //convert to target pixel format
+    if (SDL_BlitSurface(image, NULL, texture, NULL))
+    {
+        SDL_DestroySurface(image);
+        SDL_DestroySurface(texture);
+        messageBox(GFX_ERROR, "Error convert texture: %s!", SDL_GetError());
+        return 0;
+    }
+
+    //build GFX texture
+    if (!newImage(texture->w, texture->h, im))
+    {
+        messageBox(GFX_ERROR, "Error create new image!");
+        SDL_DestroySurface(image);
+        SDL_DestroySurface(texture);
+        return 0;
+    }
+
+    //copy data to image buffer
+    memcpy(im->mData, texture->pixels, im->mSize);
+    SDL_DestroySurface(image);
+    SDL_DestroySurface(texture);
+    return 1;
+}
+
+//load image as 32bits texture to output buffer
+int32_t loadTexture(uint32_t** txout, int32_t* txw, int32_t* txh, const char* fname)
+{
+    //simple load image from file
+    SDL_Surface* image = IMG_Load(fname);
+    if (!image)
+    {
+        messageBox(GFX_ERROR, "Error load texture: %s", IMG_GetError());
+        return 0;
+    }
+
+    //create 32bits texture
+    SDL_Surface* texture = SDL_CreateSurface(image->w, image->h, SDL_PIXELFORMAT_ARGB8888);
+    if (!texture)
+    {
+        SDL_DestroySurface(image);
+        messageBox(GFX_ERROR, "Error create surface: %s!", SDL_GetError());
+        return 0;
+    }
+
+    //convert raw data to texture format
+    if (SDL_BlitSurface(image, NULL, texture, NULL))
+    {
+        SDL_DestroySurface(image);
+        SDL_DestroySurface(texture);
+        messageBox(GFX_ERROR, "Error convert texture: %s!", SDL_GetError());
+        return 0;
+    }
+
+    //create output data buffer
+    const uint32_t size = texture->pitch * texture->h;
+    txout[0] = (uint32_t*)calloc(size, 1);
+    if (!txout[0])
+    {
+        SDL_DestroySurface(image);
+        SDL_DestroySurface(texture);
+        messageBox(GFX_ERROR, "Error alloc memory!");
+        return 0;
+    }
+
+    //copy raw data after converted
+    memcpy(txout[0], texture->pixels, size);
+    if (txw) *txw = texture->w;
+    if (txh) *txh = texture->h;
+    SDL_DestroySurface(image);
+    SDL_DestroySurface(texture);
+    return 1;
+}
+
+//initialize mouse driver and bitmap mouse image
+int32_t initMouseButton(GFX_MOUSE* mi)
+{
+    //initialize mouse image value
+    mi->msPosX   = gfxContext.centerX;
+    mi->msPosY   = gfxContext.centerY;
+    mi->msWidth  = 0;
+    mi->msHeight = 0;
+    mi->msUnder  = NULL;
+    mi->msBitmap = NULL;
+    return 1;
+}
+
+//copy cursor pixels to 32 bits span, skip black pixels (rgb = 0)
+void cursorSpan(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (src[i] & 0x00ffffff) dst[i] = src[i];
+    }
+}
+
+//copy cursor pixels to 32 bits span, skip black pixels (SSE2 version, 4 pixels per loop)
+void cursorSpanSSE2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_set1_epi32(0x00ffffff);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i col = _mm_loadu_si128((const __m128i*)&src[i]);
+        const __m128i mask = _mm_cmpeq_epi32(_mm_and_si128(col, rgb), zero);
+        const __m128i bkg = _mm_and_si128(_mm_loadu_si128((const __m128i*)&dst[i]), mask);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_or_si128(bkg, _mm_andnot_si128(mask, col)));
+    }
+
+    //remainder pixels
+    cursorSpan(&dst[i], &src[i], count - i);
+}
+
+//copy cursor pixels to 32 bits span, skip black pixels (AVX2 version, 8 pixels per loop)
+target_avx2 void cursorSpanAVX2(uint32_t* dst, const uint32_t* src, int32_t count)
+{
+    int32_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i rgb = _mm256_set1_epi32(0x00ffffff);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i col = _mm256_loadu_si256((const __m256i*)&src[i]);
+        const __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(col, rgb), zero);
+        _mm256_maskstore_epi32((int32_t*)&dst[i], _mm256_xor_si256(mask, _mm256_cmpeq_epi32(zero, zero)), col);
+    }
+
+    //remainder pixels
+    cursorSpan(&dst[i], &src[i], count - i);
+}
+
+//draw mouse cursor
+void drawMouseCursor(GFX_MOUSE* mi)
+{
+    //only rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    int32_t mx = mi->msPosX - mi->msBitmap->mbHotX;
+    int32_t my = mi->msPosY - mi->msBitmap->mbHotY;
+
+    //check clip boundary
+    if (mx < gfxContext.cminX) mx = gfxContext.cminX;
+    if (mx > gfxContext.cmaxX) mx = gfxContext.cmaxX;
+    if (my < gfxContext.cminY) my = gfxContext.cminY;
+    if (my > gfxContext.cmaxY) my = gfxContext.cmaxY;
+    damageRect(&gfxContext, mx, my, mi->msWidth, mi->msHeight);
+
+    const int32_t msWidth   = mi->msWidth;
+    const int32_t msHeight  = mi->msHeight;
+    uint32_t* msUnder = (uint32_t*)mi->msUnder;
+    uint32_t* msImage = (uint32_t*)mi->msBitmap->mbData;
+
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, my
+        mul     gfxContext.texWidth
+        add     eax, mx
+        shl     eax, 2
+        mov     esi, gfxContext.drawBuff
+        add     esi, eax
+        mov     edi, msUnder
+        mov     eax, gfxContext.texWidth
+        sub     eax, msWidth
+        shl     eax, 2
+        push    eax
+        xor     edx, edx
+    next:
+        xor     ecx, ecx
+    step:
+        //check mouse boundary
+        mov     ebx, mx
+        add     ebx, ecx
+        cmp     ebx, gfxContext.cminX
+        jb      skip
+        cmp     ebx, gfxContext.cmaxX
+        ja      skip
+        mov     ebx, my
+        add     ebx, edx
+        cmp     ebx, gfxContext.cminY
+        jb      skip
+        cmp     ebx, gfxContext.cmaxY
+        ja      skip
+        //copy screen background to mouse under
+        movsd
+        push    esi
+        push    edi
+        //render mouse cursor to screen
+        mov     eax, edi
+        sub     eax, msUnder
+        mov     edi, esi
+        sub     edi, 4
+        mov     esi, msImage  
+        add     esi, eax
+        sub     esi, 4
+        //don't render color key
+        lodsd
+        and     eax, 00ffffffh
+        test    eax, eax
+        jz      done
+        stosd
+        jmp     done
+    skip:
+        add     esi, 4
+        add     edi, 4
+        jmp     cycle
+    done:
+        pop     edi
+        pop     esi
+    cycle:
+        inc     ecx
+        cmp     ecx, msWidth
+        jb      step
+        add     esi, [esp]
+        inc     edx
+        cmp     edx, msHeight
+        jb      next
+        pop     ebx
+    }
+#else
+    //calculate starting address
+    const GFX_SPRITE* msSprite = &mi->msBitmap->mbSprite;
+    const int32_t addOffs = gfxContext.texWidth - msWidth;
+    const int32_t pitch = msWidth + max(addOffs, 0);
+    uint32_t* srcPixels = (uint32_t*)gfxContext.drawBuff + (gfxContext.texWidth * my + mx);
+
+    //visible columns of cursor
+    const int32_t lx = max(gfxContext.cminX - mx, 0);
+    const int32_t rx = min(gfxContext.cmaxX - mx + 1, msWidth);
+
+    //scan bitmap data
+    for (int32_t i = 0; i < msHeight; i++)
+    {
+        //check for mouse boundary
+        if (lx < rx && my + i >= gfxContext.cminY && my + i <= gfxContext.cmaxY)
+        {
+            //copy current background under cursor and render cursor pixels (compiled cursor skip black runs)
+            gfxKernels.copySpan(&msUnder[lx], &srcPixels[lx], rx - lx);
+            if (msSprite->mRows) putSpriteRuns(srcPixels, msSprite, i, lx, rx, gfxKernels.copySpan, gfxKernels.copySpan);
+            else if (kernelLevel >= KERNEL_LEVEL_AVX2) cursorSpanAVX2(&srcPixels[lx], &msImage[lx], rx - lx);
+            else if (kernelLevel >= KERNEL_LEVEL_SSE2) cursorSpanSSE2(&srcPixels[lx], &msImage[lx], rx - lx);
+            else cursorSpan(&srcPixels[lx], &msImage[lx], rx - lx);
+        }
+
+        //goto next line
+        msUnder += msWidth;
+        msImage += msWidth;
+        srcPixels += pitch;
+    }
+#endif
+}
+
+//hide the mouse cursor
+void clearMouseCursor(GFX_MOUSE* mi)
+{
+    int32_t mx = mi->msPosX - mi->msBitmap->mbHotX;
+    int32_t my = mi->msPosY - mi->msBitmap->mbHotY;
+
+    //only rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //check clip boundary
+    if (mx < gfxContext.cminX) mx = gfxContext.cminX;
+    if (mx > gfxContext.cmaxX) mx = gfxContext.cmaxX;
+    if (my < gfxContext.cminY) my = gfxContext.cminY;
+    if (my > gfxContext.cmaxY) my = gfxContext.cmaxY;
+    damageRect(&gfxContext, mx, my, mi->msWidth, mi->msHeight);
+
+    const int32_t msWidth = mi->msWidth;
+    const int32_t msHeight = mi->msHeight;
+    uint32_t* msUnder = (uint32_t*)mi->msUnder;
+
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, my
+        mul     gfxContext.texWidth
+        add     eax, mx
+        shl     eax, 2
+        mov     edi, gfxContext.drawBuff
+        add     edi, eax
+        mov     esi, msUnder
+        mov     ebx, gfxContext.texWidth
+        sub     ebx, msWidth
+        shl     ebx, 2
+        xor     edx, edx
+    next:
+        xor     ecx, ecx
+    step:
+        //check mouse boundary
+        mov     eax, mx
+        add     eax, ecx
+        cmp     eax, gfxContext.cminX
+        jb      skip
+        cmp     eax, gfxContext.cmaxX
+        ja      skip
+        mov     eax, my
+        add     eax, edx
+        cmp     eax, gfxContext.cminY
+        jb      skip
+        cmp     eax, gfxContext.cmaxY
+        ja      skip
+        movsd
+        jmp     done
+    skip:
+        add     edi, 4
+        add     esi, 4
+    done:
+        inc     ecx
+        cmp     ecx, msWidth
+        jb      step
+        add     edi, ebx
+        inc     edx
+        cmp     edx, msHeight
+        jb      next
+    }
+#else
+    //calculate starting address
+    const int32_t addOffs = gfxContext.texWidth - msWidth;
+    const int32_t pitch = msWidth + max(addOffs, 0);
+    uint32_t* pdata = (uint32_t*)gfxContext.drawBuff;
+    uint32_t* dstPixels = &pdata[gfxContext.texWidth * my + mx];
+
+    //visible columns of cursor
+    const int32_t lx = max(gfxContext.cminX - mx, 0);
+    const int32_t rx = min(gfxContext.cmaxX - mx + 1, msWidth);
+
+    //scan bitmap data
+    for (int32_t i = 0; i < msHeight; i++)
+    {
+        //check for mouse boundary
+        if (lx < rx && my + i >= gfxContext.cminY && my + i <= gfxContext.cmaxY) gfxKernels.copySpan(&dstPixels[lx], &msUnder[lx], rx - lx);
+        dstPixels += pitch;
+        msUnder += msWidth;
+    }
+#endif
+ }
+
+//draw bitmap button
+void drawButton(GFX_BUTTON* btn)
+{
+    //only rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //calculate coordinator
+    const int32_t x1 = btn->btPosX;
+    const int32_t y1 = btn->btPosY;
+    const int32_t x2 = (x1 + btn->btWidth) - 1;
+    const int32_t y2 = (y1 + btn->btHeight) - 1;
+
+    //clip button image to context boundaries
+    const int32_t lx1 = (x1 > gfxContext.cminX) ? x1 : gfxContext.cminX;
+    const int32_t ly1 = (y1 > gfxContext.cminY) ? y1 : gfxContext.cminY;
+    const int32_t lx2 = (x2 < gfxContext.cmaxX) ? x2 : gfxContext.cmaxX;
+    const int32_t ly2 = (y2 < gfxContext.cmaxY) ? y2 : gfxContext.cmaxY;
+
+    //validate boundaries
+    if (lx1 >= lx2) return;
+    if (ly1 >= ly2) return;
+
+    //initialize loop variables
+    const int32_t lbWidth = (lx2 - lx1) + 1;
+    const int32_t lbHeight = (ly2 - ly1) + 1;
+
+    //check for loop
+    if (!lbWidth || !lbHeight) return;
+    damageRect(&gfxContext, lx1, ly1, lbWidth, lbHeight);
+
+    const int32_t btnWidth = btn->btWidth;
+    void* btnData = btn->btData[btn->btState % BUTTON_STATE_COUNT];
+
+#ifdef _USE_ASM
+    __asm {
+        mov     edi, gfxContext.drawBuff
+        mov     eax, ly1
+        mul     gfxContext.texWidth
+        add     eax, lx1
+        shl     eax, 2
+        add     edi, eax
+        mov     esi, btnData
+        mov     eax, ly1
+        sub     eax, y1
+        mul     btnWidth
+        mov     ebx, lx1
+        sub     ebx, x1
+        add     eax, ebx
+        shl     eax, 2
+        add     esi, eax
+        mov     ebx, gfxContext.texWidth
+        sub     ebx, lbWidth
+        shl     ebx, 2
+        mov     edx, btnWidth
+        sub     edx, lbWidth
+        shl     edx, 2
+    next:
+        mov     ecx, lbWidth
+    plot:
+        lodsd
+        and     eax, 00ffffffh
+        test    eax, eax
+        jz      skip
+        stosd
+        jmp     done
+    skip:
+        add     edi, 4
+    done:
+        dec     ecx
+        jnz     plot
+        add     edi, ebx
+        add     esi, edx
+        dec     lbHeight
+        jnz     next
+    }
+#else
+    //compiled button: skip black runs, copy visible runs
+    const GFX_SPRITE* btnSprite = &btn->btSprite[btn->btState % BUTTON_STATE_COUNT];
+    if (btnSprite->mRows)
+    {
+        uint32_t* dstPixels = (uint32_t*)gfxContext.drawBuff + (gfxContext.texWidth * ly1 + x1);
+        for (int32_t i = ly1 - y1; i <= ly2 - y1; i++)
+        {
+            putSpriteRuns(dstPixels, btnSprite, i, lx1 - x1, lx2 - x1 + 1, gfxKernels.copySpan, gfxKernels.copySpan);
+            dstPixels += gfxContext.texWidth;
+        }
+        return;
+    }
+
+    //calculate starting address
+    const int32_t addDstOffs = gfxContext.texWidth - lbWidth;
+    const int32_t addImgOffs = btnWidth - lbWidth;
+
+    uint32_t* dstData = (uint32_t*)gfxContext.drawBuff;
+    uint32_t* srcData = (uint32_t*)btnData;
+    uint32_t* dstPixels = &dstData[gfxContext.texWidth * ly1 + lx1];
+    uint32_t* srcPixels = &srcData[btnWidth * (ly1 - y1) + (lx1 - x1)];
+
+    //scan button image
+    for (int32_t i = 0; i < lbHeight; i++)
+    {
+        for (int32_t j = 0; j < lbWidth; j++)
+        {
+            if (*srcPixels & 0x00ffffff) *dstPixels = *srcPixels;
+            dstPixels++;
+            srcPixels++;
+        }
+        if (addDstOffs > 0) dstPixels += addDstOffs;
+        if (addImgOffs > 0) srcPixels += addImgOffs;
+    }
+#endif
+}
+
+//load mouse sprite pointer
+void loadMouse(const char* fname, GFX_MOUSE* mi, GFX_BITMAP* mbm)
+{
+    //load mouse pointers
+    GFX_IMAGE msPointer = { 0 };
+    if (!loadImage(fname, &msPointer))
+    {
+        messageBox(GFX_ERROR, "Cannot load mouse image:%s", fname);
+        return;
+    }
+
+    const int32_t msHeight = msPointer.mHeight;
+    const int32_t msWidth = msPointer.mWidth / 9;
+    const uint32_t msize = msWidth * msHeight;
+    const uint32_t bytesLine = msWidth * gfxContext.bytesPerPixel;
+
+    //allocate memory for mouse under background
+    mi->msUnder = (uint8_t*)calloc(msize, gfxContext.bytesPerPixel);
+    if (!mi->msUnder)
+    {
+        messageBox(GFX_ERROR, "Error alloc memory!");
+        return;
+    }
+
+    //init mouse image width and height
+    mi->msWidth = msWidth;
+    mi->msHeight = msHeight;
+
+    //copy mouse cursors
+    for (int32_t i = 0; i < MOUSE_SPRITE_COUNT; i++)
+    {
+        mbm[i].mbData = (uint8_t*)calloc(msize, gfxContext.bytesPerPixel);
+        if (!mbm[i].mbData)
+        {
+            messageBox(GFX_ERROR, "Error create mouse sprite:%d!", i);
+            return;
+        }
+
+        //initialize mouse state
+        mbm[i].mbHotX = 12;
+        mbm[i].mbHotY = 12;
+        mbm[i].mbNext = &mbm[i + 1];
+
+        //copy data from mouse image to gfx mouse struct
+        const int32_t mwidth = i * msWidth;
+        for (int32_t y = 0; y < msHeight; y++)
+        {
+            uint8_t* dst = &mbm[i].mbData[y * bytesLine];
+            const uint8_t* psrc = (const uint8_t*)msPointer.mData;
+            const uint8_t* src = &psrc[(mwidth + y * msPointer.mWidth) * gfxContext.bytesPerPixel];
+            memcpy(dst, src, bytesLine);
+        }
+
+        //compile cursor (black is transparent)
+        const GFX_IMAGE bitmap = { msWidth, msHeight, msize * gfxContext.bytesPerPixel, bytesLine, mbm[i].mbData };
+        compileSprite(&bitmap, 0, &mbm[i].mbSprite);
+    }
+
+    //init current and next mouse animated
+    mbm[0].mbHotX = 7;
+    mbm[0].mbHotY = 2;
+    mbm[0].mbNext = &mbm[0];
+    mbm[8].mbNext = &mbm[1];
+    freeImage(&msPointer);
+}
+
+//load GFX button
+void loadButton(const char* fname, GFX_BUTTON* btn)
+{
+    //load button
+    GFX_IMAGE img = { 0 };
+    if (!loadImage(fname, &img))
+    {
+        messageBox(GFX_ERROR, "Cannot load image button:%s", fname);
+        return;
+    }
+
+    const int32_t btnHeight = img.mHeight;
+    const int32_t btnWidth = img.mWidth / BUTTON_STATE_COUNT;
+    const uint32_t msize = btnWidth * btnHeight;
+    const uint32_t bytesLine = btnWidth * gfxContext.bytesPerPixel;
+
+    btn->btWidth = btnWidth;
+    btn->btHeight = btnHeight;
+
+    //create button
+    for (int32_t i = 0; i < BUTTON_STATE_COUNT; i++)
+    {
+        btn->btData[i] = (uint8_t*)calloc(msize, gfxContext.bytesPerPixel);
+        if (!btn->btData[i])
+        {
+            messageBox(GFX_ERROR, "Error create button:%d!", i);
+            return;
+        }
+
+        //copy button data
+        const int32_t bwidth = i * btnWidth;
+        for (int32_t y = 0; y < btnHeight; y++)
+        {
+            uint8_t* dst = &btn->btData[i][y * bytesLine];
+            const uint8_t* psrc = (const uint8_t*)img.mData;
+            const uint8_t* src = &psrc[(bwidth + y * img.mWidth) * gfxContext.bytesPerPixel];
+            memcpy(dst, src, bytesLine);
+        }
+
+        //compile button state (black is transparent)
+        const GFX_IMAGE bitmap = { btnWidth, btnHeight, msize * gfxContext.bytesPerPixel, bytesLine, btn->btData[i] };
+        compileSprite(&bitmap, 0, &btn->btSprite[i]);
+    }
+
+    freeImage(&img);
+}
+
+//release mouse sprite
+void freeMouse(GFX_MOUSE* mi, GFX_BITMAP* mbm)
+{
+    //cleanup mouse bitmap
+    for (int32_t i = 0; i < MOUSE_SPRITE_COUNT; i++)
+    {
+        if (mbm[i].mbData)
+        {
+            free(mbm[i].mbData);
+            mbm[i].mbData = NULL;
+        }
+        freeSprite(&mbm[i].mbSprite);
+    }
+
+    //cleanup mouse underground
+    clearMouseCursor(mi);
+    if (mi->msUnder)
+    {
+        free(mi->msUnder);
+        mi->msUnder = NULL;
+    }
+}
+
+//free button
+void freeButton(GFX_BUTTON* btn)
+{
+    for (int32_t i = 0; i < BUTTON_STATE_COUNT; i++)
+    {
+        if (btn->btData[i])
+        {
+            free(btn->btData[i]);
+            btn->btData[i] = NULL;
+        }
+        freeSprite(&btn->btSprite[i]);
+    }
+}
+
+//simulation mouse event handler
+void handleMouseButton()
+{
+    const char* const bkg[] = { "assets/1lan8.bmp", "assets/1lan16.bmp", "assets/1lan24.bmp", "assets/1lan32.bmp" };
+
+    //init and setup bitmap mouse and button
+    GFX_MOUSE mi = { 0 };
+    if (!initMouseButton(&mi))
+    {
+        messageBox(GFX_ERROR, "Error initialize mouse button!");
+        return;
+    }
+    
+    GFX_BITMAP mbm[MOUSE_SPRITE_COUNT] = { 0 };
+    loadMouse("assets/mpointer24.png", &mi, mbm);
+
+    GFX_BUTTON btn[BUTTON_HANDLE_COUNT] = { 0 };
+    loadButton("assets/clickbtn24.png", &btn[0]);
+    loadButton("assets/exitbtn24.png", &btn[1]);
+
+    //init button 'click me'
+    btn[0].btPosX = gfxContext.centerX - btn[0].btWidth - 20;
+    btn[0].btPosY = gfxContext.centerY - (btn[0].btHeight >> 1);
+    btn[0].btState = BUTTON_STATE_NORMAL;
+
+    //init button 'exit'
+    btn[1].btPosX = gfxContext.centerX + btn[1].btWidth + 10;
+    btn[1].btPosY = gfxContext.centerY - (btn[1].btHeight >> 1);
+    btn[1].btState = BUTTON_STATE_NORMAL;
+
+    //hide mouse pointer
+    hideMouseCursor();
+
+    //install user-define mouse handler
+    setMousePosition(gfxContext.centerX, gfxContext.centerY);
+
+    //init mouse normal and wait cursor bitmap
+    GFX_BITMAP* msNormal = &mbm[0];
+    GFX_BITMAP* msWait = &mbm[1];
+
+    mi.msBitmap = msNormal;
+
+    //setup screen background
+    showBMP(bkg[gfxContext.bytesPerPixel - 1]);
+    drawMouseCursor(&mi);
+
+    //update last mouse pos
+    int32_t lastx = gfxContext.centerX;
+    int32_t lasty = gfxContext.centerY;
+    uint64_t lastTime = getTime();
+    
+    //current mouse pointer
+    GFX_BITMAP* msNew = NULL;
+
+    int32_t i = 0, done = 0;
+    int32_t mcx = 0, mdx = 0, mbx = 0;
+    uint32_t needDraw = 0xffff;
+
+    do
+    {
+        //get current mouse coordinate
+        getMouseState(&mcx, &mdx, &mbx, NULL);
+
+        //limit pointer range
+        if (mcx < gfxContext.centerX - 100) mcx = gfxContext.centerX - 100;
+        if (mcx > gfxContext.centerX + 110) mcx = gfxContext.centerX + 110;
+        if (mdx < gfxContext.centerY - 100) mdx = gfxContext.centerY - 100;
+        if (mdx > gfxContext.centerY + 110) mdx = gfxContext.centerY + 110;
+
+        //only draw if needed
+        if (needDraw)
+        {
+            //clear old mouse position
+            clearMouseCursor(&mi);
+
+            //draw buttons
+            if (needDraw > 1)
+            {
+                for (i = 0; i < BUTTON_HANDLE_COUNT; i++)
+                {
+                    if (needDraw & (2 << i)) drawButton(&btn[i]);
+                }
+            }
+
+            //update new button bitmap
+            if (msNew) mi.msBitmap = msNew;
+
+            //update mouse position and draw new mouse position
+            mi.msPosX = mcx;
+            mi.msPosY = mdx;
+            drawMouseCursor(&mi);
+
+            //update last ticks count and turn off drawable
+            lastTime = getTime();
+            needDraw = 0;
+            msNew = NULL;
+        }
+
+        //check for draw new state button
+        if (getTime() != lastTime)
+        {
+            if (mi.msBitmap != mi.msBitmap->mbNext)
+            {
+                needDraw = 1;
+                mi.msBitmap = mi.msBitmap->mbNext;
+            }
+            else
+            {
+                lastTime = getTime();
+            }
+        }
+
+        //update drawable when position changing
+        if (lastx != mcx || lasty != mdx)
+        {
+            lastx = mcx;
+            lasty = mdx;
+            needDraw = 1;
+        }
+
+        //check for new button state
+        for (i = 0; i < BUTTON_HANDLE_COUNT; i++)
+        {
+            //check if mouse inside the button region
+            if (mcx >= btn[i].btPosX && mcx <= btn[i].btPosX + btn[i].btWidth && mdx >= btn[i].btPosY && mdx <= btn[i].btPosY + btn[i].btHeight)
+            {
+                if (mbx == 0 && btn[i].btState == BUTTON_STATE_PRESSED)
+                {
+                    btn[i].btState = BUTTON_STATE_ACTIVE;
+                    needDraw |= (2 << i);
+                    if (i == 0)
+                    {
+                        if (mi.msBitmap == msNormal) msNew = msWait;
+                        else msNew = msNormal;
+                    }
+                    else if (i == 1) done = 1;
+                }
+                else if (mbx == 1)
+                {
+                    btn[i].btState = BUTTON_STATE_PRESSED;
+                    needDraw |= (2 << i);
+                }
+                else if (btn[i].btState == BUTTON_STATE_NORMAL && mbx == 0)
+                {
+                    btn[i].btState = BUTTON_STATE_ACTIVE;
+                    needDraw |= (2 << i);
+                }
+                else if (btn[i].btState == BUTTON_STATE_WAITING)
+                {
+                    if (mbx == 1)
+                    {
+                        btn[i].btState = BUTTON_STATE_PRESSED;
+                    }
+                    else
+                    {
+                        btn[i].btState = BUTTON_STATE_ACTIVE;
+                    }
+                    needDraw |= (2 << i);
+                }
+            }
+            else if (btn[i].btState == BUTTON_STATE_ACTIVE)
+            {
+                btn[i].btState = BUTTON_STATE_NORMAL;
+                needDraw |= (2 << i);
+            }
+            else if (btn[i].btState == BUTTON_STATE_PRESSED && mbx == 1)
+            {
+                btn[i].btState = BUTTON_STATE_WAITING;
+                needDraw |= (2 << i);
+            }
+            else if (btn[i].btState == BUTTON_STATE_WAITING && mbx == 0)
+            {
+                btn[i].btState = BUTTON_STATE_NORMAL;
+                needDraw |= (2 << i);
+            }
+        }
+
+        render();
+        delay(FPS_60);
+    } while (!finished(SDL_SCANCODE_RETURN) && !done);
+
+    //release mouse bitmap and callback handler
+    freeMouse(&mi, mbm);
+    freeButton(&btn[0]);
+    freeButton(&btn[1]);
+    showMouseCursor();
+}
+
+//calculate plasma value of pixel sx (table index cl + sx, wrap at 255)
+static must_inline uint16_t plasmaValue(const uint8_t* sint, const uint8_t cl, const uint8_t cs, const uint16_t sx)
+{
+    uint16_t val = cl + sx;
+    if (val > 255) val -= 255;
+    val = (sint[val] + cs) & 0xff;
+    val = (val >> 1) + 128;
+    return (val << 8) | (val & 0xff);
+}
+
+//plasma span, render to 2 lines (dst1, dst2) from pixel sx (SSE2 version, 16 pixels per loop)
+void plasmaSpanSSE2(uint16_t* dst1, uint16_t* dst2, const uint8_t* sint, const uint8_t cl, const uint8_t cs, uint16_t sx, const uint16_t count)
+{
+    const __m128i cosv = _mm_set1_epi8(cs);
+    const __m128i mask = _mm_set1_epi8(0x7f);
+    const __m128i bias = _mm_set1_epi8(char(0x80));
+
+    while (sx + 16 <= count)
+    {
+        //table index is wrapped inside of 16 pixels, use scalar
+        uint16_t idx = cl + sx;
+        if (idx > 255) idx -= 255;
+        if (idx + 15 > 255)
+        {
+            dst1[sx] = dst2[sx] = plasmaValue(sint, cl, cs, sx);
+            sx++;
+            continue;
+        }
+
+        //val = (((sint + cos) & 0xff) >> 1) + 128
+        __m128i val = _mm_add_epi8(_mm_loadu_si128((const __m128i*)&sint[idx]), cosv);
+        val = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(val, 1), mask), bias);
+
+        //duplicate byte to word (val << 8) | val
+        const __m128i lo = _mm_unpacklo_epi8(val, val);
+        const __m128i hi = _mm_unpackhi_epi8(val, val);
+        _mm_storeu_si128((__m128i*)&dst1[sx], lo);
+        _mm_storeu_si128((__m128i*)&dst1[sx + 8], hi);
+        _mm_storeu_si128((__m128i*)&dst2[sx], lo);
+        _mm_storeu_si128((__m128i*)&dst2[sx + 8], hi);
+        sx += 16;
+    }
+
+    //remainder pixels
+    for (; sx < count; sx++) dst1[sx] = dst2[sx] = plasmaValue(sint, cl, cs, sx);
+}
+
+//plasma span, render to 2 lines (dst1, dst2) (AVX2 version, 32 pixels per loop)
+target_avx2 void plasmaSpanAVX2(uint16_t* dst1, uint16_t* dst2, const uint8_t* sint, const uint8_t cl, const uint8_t cs, const uint16_t count)
+{
+    uint16_t sx = 0;
+    const __m256i cosv = _mm256_set1_epi8(cs);
+    const __m256i mask = _mm256_set1_epi8(0x7f);
+    const __m256i bias = _mm256_set1_epi8(char(0x80));
+
+    while (sx + 32 <= count)
+    {
+        //table index is wrapped inside of 32 pixels, use scalar
+        uint16_t idx = cl + sx;
+        if (idx > 255) idx -= 255;
+        if (idx + 31 > 255)
+        {
+            dst1[sx] = dst2[sx] = plasmaValue(sint, cl, cs, sx);
+            sx++;
+            continue;
+        }
+
+        //val = (((sint + cos) & 0xff) >> 1) + 128
+        __m256i val = _mm256_add_epi8(_mm256_loadu_si256((const __m256i*)&sint[idx]), cosv);
+        val = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(val, 1), mask), bias);
+
+        //unpack works in 128 bits lanes, reorder quad words first
+        val = _mm256_permute4x64_epi64(val, 0xd8);
+        const __m256i lo = _mm256_unpacklo_epi8(val, val);
+        const __m256i hi = _mm256_unpackhi_epi8(val, val);
+        _mm256_storeu_si256((__m256i*)&dst1[sx], lo);
+        _mm256_storeu_si256((__m256i*)&dst1[sx + 16], hi);
+        _mm256_storeu_si256((__m256i*)&dst2[sx], lo);
+        _mm256_storeu_si256((__m256i*)&dst2[sx + 16], hi);
+        sx += 32;
+    }
+
+    //remainder pixels
+    plasmaSpanSSE2(dst1, dst2, sint, cl, cs, sx, count);
+}
+
+//create texture plasma
+void createPlasma(uint8_t* dx, uint8_t* dy, const uint8_t* sint, const uint8_t* cost, GFX_IMAGE* img)
+{
+#ifdef _USE_ASM
+    const uint8_t lx = (*dx) += 2;
+    const uint8_t ly = (*dy)--;
+    
+    void* data = img->mData;
+    const uint32_t ofs = img->mWidth;
+    const uint8_t sx = img->mWidth >> 1;
+    const uint8_t sy = img->mHeight >> 1;
+
+    __asm {
+        mov     edi, data
+        xor     eax, eax
+        xor     dh, dh
+    next0:
+        xor     bh, bh
+        mov     al, dh
+        mov     bl, ly
+        add     ax, bx
+        cmp     ax, 255
+        jbe     skip0
+        sub     ax, 255
+    skip0:
+        mov     esi, sint
+        add     esi, eax
+        mov     cl, [esi]
+        mov     al, lx
+        mov     esi, sint
+        add     esi, eax
+        mov     ch, [esi]
+        xor     dl, dl
+    next1:
+        xor     bh, bh
+        mov     al, dl
+        mov     bl, cl
+        add     ax, bx
+        cmp     ax, 255
+        jbe     skip1
+        sub     ax, 255
+    skip1:
+        mov     esi, sint
+        add     esi, eax
+        mov     bl, [esi]
+        mov     al, dh
+        add     al, ch
+        mov     esi, cost
+        add     esi, eax
+        add     bl, [esi]
+        shr     bl, 1
+        add     bl, 128
+        mov     bh, bl
+        mov     esi, ofs
+        mov     [edi], bx
+        mov     [edi + esi], bx
+        add     edi, 2
+        inc     dl
+        cmp     dl, sx
+        jb      next1
+        add     edi, esi
+        inc     dh
+        cmp     dh, sy
+        jb      next0
+    }
+#else
+    const uint8_t lx = (*dx) += 2;
+    const uint8_t ly = (*dy)--;
+    const uint16_t cwidth = img->mWidth >> 1;
+    const uint16_t cheight = img->mHeight >> 1;
+
+    uint16_t ofs = 0;
+    uint16_t* data = (uint16_t*)img->mData;
+
+    for (uint16_t sy = 0; sy < cheight; sy++)
+    {
+        uint16_t val = sy + ly;
+        if (val > 255) val -= 255;
+
+        const uint8_t cl = sint[val];
+        const uint8_t ch = sint[lx];
+
+        //SIMD versions only render the lines that don't wrap the offset
+        if (kernelLevel >= KERNEL_LEVEL_SSE2 && uint32_t(ofs) + (cwidth << 1) <= 0x10000)
+        {
+            if (kernelLevel >= KERNEL_LEVEL_AVX2) plasmaSpanAVX2(&data[ofs], &data[ofs + cwidth], sint, cl, cost[(ch + sy) & 0xff], cwidth);
+            else plasmaSpanSSE2(&data[ofs], &data[ofs + cwidth], sint, cl, cost[(ch + sy) & 0xff], 0, cwidth);
+            ofs += cwidth << 1;
+            continue;
+        }
+
+        for (uint16_t sx = 0; sx < cwidth; sx++)
+        {
+            data[ofs] = plasmaValue(sint, cl, cost[(ch + sy) & 0xff], sx);
+            data[ofs + cwidth] = data[ofs];
+            ofs++;
+        }
+        ofs += cwidth;
+    }
+#endif
+}
+
+//initialize texture plasma
+void initPlasma(uint8_t* sint, uint8_t* cost)
+{
+    int32_t i = 0;
+    RGBA pal[256] = { 0 };
+    memset(pal, 0, sizeof(pal));
+
+    for (i = 0; i < 256; i++)
+    {
+        sint[i] = uint8_t(sin(2 * M_PI * i / 255) * 128 + 128);
+        cost[i] = uint8_t(cos(2 * M_PI * i / 255) * 128 + 128);
+    }
+
+    for (i = 0; i < 64; i++)
+    {
+        pal[i      ].r = i;
+        pal[i      ].g = 0;
+        pal[i      ].b = i << 2;
+        pal[127 - i].r = i;
+        pal[127 - i].g = 0;
+        pal[127 - i].b = i << 2;
+        pal[127 + i].r = i << 2;
+        pal[127 + i].g = i << 1;
+        pal[127 + i].b = 0;
+        pal[254 - i].r = i << 2;
+        pal[254 - i].g = i << 1;
+        pal[254 - i].b = 0;
+    }
+
+    for (i = 127; i >= 0; i--)
+    {
+        pal[i + 128].r = pal[i << 1].r;
+        pal[i + 128].g = pal[i << 1].g;
+        pal[i + 128].b = pal[i << 1].b;
+    }
+
+    setPalette(pal);
+}
+
+//FX-effect: calculate tunnel buffer
+void prepareTunnel(const GFX_IMAGE* dimg, uint8_t* buff1, uint8_t* buff2)
+{
+    const int32_t maxAng = 2048;
+    const double angDec = 0.85;
+    const double dstInc = 0.02;
+    const double preCalc = M_PI / (maxAng >> 2);
+
+    const int32_t dcx = dimg->mWidth >> 1;
+    const int32_t dcy = dimg->mHeight >> 1;
+
+    double tz = 250.0;
+    double dst = 1.0;
+    double ang = maxAng - 1.0;
+    
+    do {
+        const int32_t tx = fround(tz * sin(ang * preCalc)) + dcx;
+        const int32_t ty = fround(tz * cos(ang * preCalc)) + dcy;
+
+        ang -= angDec;
+        if (ang < 0)
+        {
+            ang += maxAng;
+            dst += dst * dstInc;
+            tz -= angDec;
+        }
+
+        if (tx >= 0 && tx < dimg->mWidth && ty >= 0 && ty < dimg->mHeight)
+        {
+            const int32_t ofs = ty * dimg->mWidth + tx;
+            buff1[ofs] = fround(dst);
+            buff2[ofs] = fround(dst - ang / 4);
+        }
+    } while (tz >= 0);
+}
+
+//tunnel pixels (SSE2 version, no gather instruction, calculate 8 indices per loop), return number of drawn pixels
+static uint32_t tunnelSpanSSE2(uint32_t* pdst, const uint32_t* psrc, const uint8_t* buff1, const uint8_t* buff2, const uint8_t ang, const uint32_t nsize)
+{
+    uint32_t i = 0;
+    const __m128i angv = _mm_set1_epi8(ang);
+    for (; i + 8 <= nsize; i += 8)
+    {
+        const __m128i lo = _mm_loadl_epi64((const __m128i*)&buff2[i]);
+        const __m128i hi = _mm_add_epi8(_mm_loadl_epi64((const __m128i*)&buff1[i]), angv);
+        const __m128i idx = _mm_unpacklo_epi8(lo, hi);
+        pdst[i    ] = psrc[_mm_extract_epi16(idx, 0)];
+        pdst[i + 1] = psrc[_mm_extract_epi16(idx, 1)];
+        pdst[i + 2] = psrc[_mm_extract_epi16(idx, 2)];
+        pdst[i + 3] = psrc[_mm_extract_epi16(idx, 3)];
+        pdst[i + 4] = psrc[_mm_extract_epi16(idx, 4)];
+        pdst[i + 5] = psrc[_mm_extract_epi16(idx, 5)];
+        pdst[i + 6] = psrc[_mm_extract_epi16(idx, 6)];
+        pdst[i + 7] = psrc[_mm_extract_epi16(idx, 7)];
+    }
+    return i;
+}
+
+//tunnel pixels (AVX2 version, 8 pixels per loop), return number of drawn pixels
+//index = (uint8_t(buff1 + ang) << 8) | buff2
+static target_avx2 uint32_t tunnelSpanAVX2(uint32_t* pdst, const uint32_t* psrc, const uint8_t* buff1, const uint8_t* buff2, const uint8_t ang, const uint32_t nsize)
+{
+    uint32_t i = 0;
+    const __m128i angv = _mm_set1_epi8(ang);
+    for (; i + 8 <= nsize; i += 8)
+    {
+        const __m128i lo = _mm_loadl_epi64((const __m128i*)&buff2[i]);
+        const __m128i hi = _mm_add_epi8(_mm_loadl_epi64((const __m128i*)&buff1[i]), angv);
+        const __m256i idx = _mm256_cvtepu16_epi32(_mm_unpacklo_epi8(lo, hi));
+        _mm256_storeu_si256((__m256i*)&pdst[i], _mm256_i32gather_epi32((const int32_t*)psrc, idx, 4));
+    }
+    return i;
+}
+
+//FX-effect: draw tunnel
+void drawTunnel(GFX_IMAGE* dimg, const GFX_IMAGE* simg, uint8_t* buff1, uint8_t* buff2, uint8_t* ang, uint8_t step)
+{
+    uint32_t nsize = dimg->mSize >> 2;
+    uint32_t* pdst = (uint32_t*)dimg->mData;
+    const uint32_t* psrc = (const uint32_t*)simg->mData;
+    
+    //only rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    *ang += step;
+
+#ifdef _USE_ASM
+    uint8_t tmp = *ang;
+    __asm {
+        mov     ecx, ang
+        mov     edi, pdst
+        mov     esi, psrc
+        mov     ebx, buff1
+        mov     edx, buff2
+        xor     ecx, ecx
+    again:
+        mov     cl, [edx]
+        mov     ch, [ebx]
+        add     ch, tmp
+        mov     eax, [esi + ecx * 4]
+        stosd
+        inc     edx
+        inc     ebx
+        dec     nsize
+        jnz     again
+    }
+#else
+    uint32_t i = 0;
+    if (kernelLevel >= KERNEL_LEVEL_AVX2) i = tunnelSpanAVX2(pdst, psrc, buff1, buff2, *ang, nsize);
+    else if (kernelLevel >= KERNEL_LEVEL_SSE2) i = tunnelSpanSSE2(pdst, psrc, buff1, buff2, *ang, nsize);
+
+    //remainder pixels
+    for (; i < nsize; i++)
+    {
+        const uint8_t val = buff1[i] + *ang;
+        pdst[i] = psrc[(val << 8) + buff2[i]];
+    }
+#endif
+}
+
+//blur one byte (channel) with the same channel of blur pixels at left and right side
+static must_inline uint8_t blurValue(const uint8_t* src, const int32_t blur)
+{
+    int32_t sum = src[0] + blur;
+    for (int32_t k = blur; k > 0; k--) sum += src[k << 2] + src[-(k << 2)];
+    return uint8_t(sum / ((blur << 1) + 1));
+}
+
+//blur span of bytes (SSE2 version, 16 bytes per loop)
+//window sum of (2 * blur + 1) bytes is less than 65536 (blur <= 127), so the running sums are kept in 16 bits words
+//quotient of float division is correctly rounded, truncation give the same result as integer division
+void blurSpanSSE2(uint8_t* dst, const uint8_t* src, const int32_t blur, const int32_t count)
+{
+    int32_t i = 0;
+    if (count < 16)
+    {
+        for (; i < count; i++) dst[i] = blurValue(&src[i], blur);
+        return;
+    }
+
+    const int32_t side = blur << 2;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bias = _mm_set1_epi16(blur);
+    const __m128 scale = _mm_set1_ps(float((blur << 1) + 1));
+
+    //initialize window sums of first 16 bytes
+    __m128i sumlo = bias;
+    __m128i sumhi = bias;
+    for (int32_t k = -side; k <= side; k += 4)
+    {
+        const __m128i col = _mm_loadu_si128((const __m128i*)&src[k]);
+        sumlo = _mm_add_epi16(sumlo, _mm_unpacklo_epi8(col, zero));
+        sumhi = _mm_add_epi16(sumhi, _mm_unpackhi_epi8(col, zero));
+    }
+
+    while (true)
+    {
+        //divide sums by window size
+        const __m128i q0 = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(sumlo, zero)), scale));
+        const __m128i q1 = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(sumlo, zero)), scale));
+        const __m128i q2 = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(sumhi, zero)), scale));
+        const __m128i q3 = _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(sumhi, zero)), scale));
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(_mm_packs_epi32(q0, q1), _mm_packs_epi32(q2, q3)));
+
+        i += 16;
+        if (i + 16 > count) break;
+
+        //slide window by 4 pixels: add 4 right pixels, remove 4 left pixels
+        for (int32_t k = 4; k <= 16; k += 4)
+        {
+            const __m128i add = _mm_loadu_si128((const __m128i*)&src[i - 16 + side + k]);
+            const __m128i sub = _mm_loadu_si128((const __m128i*)&src[i - 20 - side + k]);
+            sumlo = _mm_sub_epi16(_mm_add_epi16(sumlo, _mm_unpacklo_epi8(add, zero)), _mm_unpacklo_epi8(sub, zero));
+            sumhi = _mm_sub_epi16(_mm_add_epi16(sumhi, _mm_unpackhi_epi8(add, zero)), _mm_unpackhi_epi8(sub, zero));
+        }
+    }
+
+    //remainder bytes
+    for (; i < count; i++) dst[i] = blurValue(&src[i], blur);
+}
+
+//blur span of bytes (AVX2 version, 32 bytes per loop)
+target_avx2 void blurSpanAVX2(uint8_t* dst, const uint8_t* src, const int32_t blur, const int32_t count)
+{
+    int32_t i = 0;
+    if (count < 32)
+    {
+        blurSpanSSE2(dst, src, blur, count);
+        return;
+    }
+
+    const int32_t side = blur << 2;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i bias = _mm256_set1_epi16(blur);
+    const __m256 scale = _mm256_set1_ps(float((blur << 1) + 1));
+
+    //initialize window sums of first 32 bytes
+    __m256i sumlo = bias;
+    __m256i sumhi = bias;
+    for (int32_t k = -side; k <= side; k += 4)
+    {
+        const __m256i col = _mm256_loadu_si256((const __m256i*)&src[k]);
+        sumlo = _mm256_add_epi16(sumlo, _mm256_unpacklo_epi8(col, zero));
+        sumhi = _mm256_add_epi16(sumhi, _mm256_unpackhi_epi8(col, zero));
+    }
+
+    while (true)
+    {
+        //divide sums by window size (unpack/pack are in 128 bits lanes, so the order is restored)
+        const __m256i q0 = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_unpacklo_epi16(sumlo, zero)), scale));
+        const __m256i q1 = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_unpackhi_epi16(sumlo, zero)), scale));
+        const __m256i q2 = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_unpacklo_epi16(sumhi, zero)), scale));
+        const __m256i q3 = _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_unpackhi_epi16(sumhi, zero)), scale));
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_packus_epi16(_mm256_packs_epi32(q0, q1), _mm256_packs_epi32(q2, q3)));
+
+        i += 32;
+        if (i + 32 > count) break;
+
+        //slide window by 8 pixels: add 8 right pixels, remove 8 left pixels
+        for (int32_t k = 4; k <= 32; k += 4)
+        {
+            const __m256i add = _mm256_loadu_si256((const __m256i*)&src[i - 32 + side + k]);
+            const __m256i sub = _mm256_loadu_si256((const __m256i*)&src[i - 36 - side + k]);
+            sumlo = _mm256_sub_epi16(_mm256_add_epi16(sumlo, _mm256_unpacklo_epi8(add, zero)), _mm256_unpacklo_epi8(sub, zero));
+            sumhi = _mm256_sub_epi16(_mm256_add_epi16(sumhi, _mm256_unpackhi_epi8(add, zero)), _mm256_unpackhi_epi8(sub, zero));
+        }
+    }
+
+    //remainder bytes
+    blurSpanSSE2(&dst[i], &src[i], blur, count - i);
+}
+
+//FX-effect: blur image buffer
+void blurImageEx(GFX_IMAGE* dst, const GFX_IMAGE* src, int32_t blur)
+{
+    uint8_t* pdst = (uint8_t*)dst->mData;
+    const uint8_t* psrc = (const uint8_t*)src->mData;
+    const uint32_t nsize = src->mSize >> 2;
+
+    //only support for rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //check for small source size
+    if (blur <= 0 || nsize <= uint32_t(2 * blur)) return;
+
+    //check for MAX blur
+    if (blur > 127) blur = 127;
+
+#ifdef _USE_ASM
+    __asm {
+        mov     esi, psrc
+        mov     edi, pdst
+        mov     eax, blur
+        shl     eax, 1
+        mov     ecx, nsize
+        sub     ecx, eax
+        push    ecx
+        mov     eax, 4
+        xor     ebx, ebx
+    nr1bx:
+        xor     ecx, ecx
+        push    esi
+        push    edi
+        push    eax
+    lp1xb:
+        xor     eax, eax
+        mov     al, [esi]
+        push    edi
+        mov     edx, blur
+        add     eax, edx
+        mov     edi, 1
+    lpi1xb:
+        mov     bl, [esi + edi * 4]
+        add     eax, ebx
+        cmp     edi, ecx
+        ja      nb1xb
+        neg     edi
+        mov     bl, [esi + edi * 4]
+        neg     edi
+        add     eax, ebx
+        inc     edx
+    nb1xb:
+        inc     edi
+        cmp     edi, blur
+        jnae    lpi1xb
+        pop     edi
+        mov     ebx, edx
+        xor     edx, edx
+        div     ebx
+        mov     edx, ebx
+        mov     [edi], al
+        add     esi, 4
+        add     edi, 4
+        inc     ecx
+        cmp     ecx, blur
+        jne     lp1xb
+        pop     eax
+        pop     edi
+        pop     esi
+        inc     edi
+        inc     esi
+        dec     eax
+        jnz     nr1bx
+        dec     ecx
+        shl     ecx, 2
+        add     esi, ecx
+        add     edi, ecx
+        pop     ecx
+        mov     edx, blur
+        add     edx, edx
+        inc     edx
+        mov     eax, 4
+    nrxb:
+        push    ecx
+        push    esi
+        push    edi
+        push    eax
+    lpxb:
+        xor     eax, eax
+        mov     al, [esi]
+        push    ecx
+        mov     ecx, blur
+        add     eax, ecx
+    lpixb:
+        mov     bl, [esi + ecx * 4]
+        neg     ecx
+        add     eax, ebx
+        mov     bl, [esi + ecx * 4]
+        neg     ecx
+        add     eax, ebx
+        dec     ecx
+        jnz     lpixb
+        pop     ecx
+        mov     ebx, edx
+        xor     edx, edx
+        div     ebx
+        mov     edx, ebx
+        mov     [edi], al
+        add     esi, 4
+        add     edi, 4
+        dec     ecx
+        jnz     lpxb
+        pop     eax
+        pop     edi
+        pop     esi
+        pop     ecx
+        inc     edi
+        inc     esi
+        dec     eax
+        jnz     nrxb
+        dec     ecx
+        shl     ecx, 2
+        add     esi, ecx
+        add     edi, ecx
+        mov     eax, 4
+    nr2xb:
+        mov     ecx, blur
+        push    esi
+        push    edi
+        push    eax
+    lp2xb:
+        xor     eax, eax
+        mov     al, [esi]
+        push    edi
+        mov     edx, blur
+        add     eax, edx
+        mov     edi, 1
+    lpi2xb:
+        cmp     edi, ecx
+        jae     nb2xb
+        mov     bl, [esi + edi * 4]
+        add     eax, ebx
+        inc     edx
+    nb2xb:
+        neg     edi
+        mov     bl, [esi + edi * 4]
+        neg     edi
+        add     eax, ebx
+        inc     edi
+        cmp     edi, blur
+        jnae    lpi2xb
+        pop     edi
+        mov     ebx, edx
+        xor     edx, edx
+        div     ebx
+        mov     edx, ebx
+        mov     [edi], al
+        add     esi, 4
+        add     edi, 4
+        dec     ecx
+        jnz     lp2xb
+        pop     eax
+        pop     edi
+        pop     esi
+        inc     edi
+        inc     esi
+        dec     eax
+        jnz     nr2xb
+    }
+#else
+    int32_t i = 0, j = 0, k = 0;
+    int32_t ofs = 0, idx = 0;
+    int32_t col1 = 0, col2 = 0;
+    int32_t tsize = nsize - (blur << 1);
+
+    //compute each a,r,g,b channel
+    for (i = 0; i < 4; i++)
+    {
+        ofs = idx;
+        for (j = 0; j < blur; j++)
+        {
+            col1 = blur;
+            col2 = psrc[ofs] + col1;
+            for (k = 1; k < blur; k++)
+            {
+                col2 += psrc[ofs + (k << 2)];
+                if (k <= j)
+                {
+                    col2 += psrc[ofs - (k << 2)];
+                    col1++;
+                }
+            }
+            pdst[ofs] = (col2 / col1) & 0xff;
+            ofs += 4;
+        }
+        idx++;
+    }
+    
+    idx += (blur - 1) << 2;
+    col1 = (blur << 1) + 1;
+
+    //all channels of the middle pixels have the same window, process them as continuous bytes
+    if (kernelLevel >= KERNEL_LEVEL_SSE2)
+    {
+        if (kernelLevel >= KERNEL_LEVEL_AVX2) blurSpanAVX2(&pdst[idx], &psrc[idx], blur, tsize << 2);
+        else blurSpanSSE2(&pdst[idx], &psrc[idx], blur, tsize << 2);
+        idx += 4;
+    }
+    else
+    {
+        //compute each a,r,g,b channel
+        for (i = 0; i < 4; i++)
+        {
+            ofs = idx;
+            for (j = 0; j < tsize; j++)
+            {
+                col2 = psrc[ofs] + blur;
+                for (k = blur; k > 0; k--)
+                {
+                    col2 += psrc[ofs + (k << 2)];
+                    col2 += psrc[ofs - (k << 2)];
+                }
+                pdst[ofs] = (col2 / col1) & 0xff;
+                ofs += 4;
+            }
+            idx++;
+        }
+    }
+    
+    tsize--;
+    tsize <<= 2;
+    idx += tsize;
+
+    //compute each a,r,g,b channel
+    for (i = 0; i < 4; i++)
+    {
+        ofs = idx;
+        for (j = blur; j > 0; j--)
+        {
+            col1 = blur;
+            col2 = psrc[ofs] + col1;
+            for (k = 1; k < blur; k++)
+            {
+                if (k < j)
+                {
+                    col2 += psrc[ofs + (k << 2)];
+                    col1++;
+                }
+                col2 += psrc[ofs - (k << 2)];
+            }
+            pdst[ofs] = (col2 / col1) & 0xff;
+            ofs += 4;
+        }
+        idx++;
+    }
+#endif
+}
+
+//scale pixel channels (C * F) >> 8, rgb channels by rgbFactor and alpha by alphaFactor (factor 256 keep channel)
+void scaleChannels(uint32_t* dst, const uint32_t* src, const uint32_t rgbFactor, const uint32_t alphaFactor, const uint32_t count)
+{
+    const ARGB* psrc = (const ARGB*)src;
+    ARGB* pdst = (ARGB*)dst;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        pdst->a = (psrc->a * alphaFactor) >> 8;
+        pdst->r = (psrc->r * rgbFactor) >> 8;
+        pdst->g = (psrc->g * rgbFactor) >> 8;
+        pdst->b = (psrc->b * rgbFactor) >> 8;
+        pdst++;
+        psrc++;
+    }
+}
+
+//scale pixel channels (SSE2 version, 4 pixels per loop)
+void scaleChannelsSSE2(uint32_t* dst, const uint32_t* src, const uint32_t rgbFactor, const uint32_t alphaFactor, const uint32_t count)
+{
+    uint32_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i factor = _mm_set_epi16(alphaFactor, rgbFactor, rgbFactor, rgbFactor, alphaFactor, rgbFactor, rgbFactor, rgbFactor);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i col = _mm_loadu_si128((const __m128i*)&src[i]);
+        const __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(col, zero), factor), 8);
+        const __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(col, zero), factor), 8);
+        _mm_storeu_si128((__m128i*)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    scaleChannels(&dst[i], &src[i], rgbFactor, alphaFactor, count - i);
+}
+
+//scale pixel channels (AVX2 version, 8 pixels per loop)
+target_avx2 void scaleChannelsAVX2(uint32_t* dst, const uint32_t* src, const uint32_t rgbFactor, const uint32_t alphaFactor, const uint32_t count)
+{
+    uint32_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i factor = _mm256_set1_epi64x((uint64_t(alphaFactor) << 48) | (uint64_t(rgbFactor) << 32) | (rgbFactor << 16) | rgbFactor);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i col = _mm256_loadu_si256((const __m256i*)&src[i]);
+        const __m256i lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(col, zero), factor), 8);
+        const __m256i hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(col, zero), factor), 8);
+        _mm256_storeu_si256((__m256i*)&dst[i], _mm256_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    scaleChannels(&dst[i], &src[i], rgbFactor, alphaFactor, count - i);
+}
+
+//FX-effect: brightness image buffer
+void brightnessImage(GFX_IMAGE* dst, GFX_IMAGE* src, uint8_t bright)
+{
+    ARGB* psrc = (ARGB*)src->mData;
+    const uint32_t nsize = src->mSize >> 2;
+
+    //only support fro rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //check light range
+    if (bright == 0 || bright == 255) return;
+
+#ifdef _USE_ASM
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    __asm {
+        mov     ecx, nsize
+        mov     edi, pdst
+        mov     esi, psrc
+        xor     edx, edx
+        mov     dl, bright
+    next:
+        mov     ebx, [esi]
+        mov     al, bh
+        and     ebx, 00ff00ffh
+        imul    ebx, edx
+        shr     ebx, 8
+        mul     dl
+        mov     bh, ah
+        mov     eax, ebx
+        stosd
+        add     esi, 4
+        dec     ecx
+        jnz     next
+    }
+#else
+    //alpha channel is kept
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    if (kernelLevel >= KERNEL_LEVEL_AVX2) scaleChannelsAVX2(pdst, (const uint32_t*)psrc, bright, 256, nsize);
+    else if (kernelLevel >= KERNEL_LEVEL_SSE2) scaleChannelsSSE2(pdst, (const uint32_t*)psrc, bright, 256, nsize);
+    else scaleChannels(pdst, (const uint32_t*)psrc, bright, 256, nsize);
+#endif
+}
+
+//FX-effect: block-out image buffer
+void blockOutMid(uint32_t* dst, uint32_t* src, int32_t count, int32_t val)
+{
+#ifdef _USE_ASM
+    __asm {
+        mov     edx, count
+        mov     ebx, val
+        mov     edi, dst
+        mov     esi, src
+        mov     ecx, ebx
+        shr     ecx, 17
+        lea     esi, [esi + ecx * 4 + 4]
+        mov     ecx, ebx
+        shr     ecx, 16
+        and     ebx, 00FFFFh
+    next:
+        mov     eax, [esi]
+        sub     edx, ecx
+        cmp     edx, 0
+        jg      skip
+        add     ecx, edx
+        rep     stosd
+        jmp     done
+    skip:
+        lea     esi, [esi + ecx * 4]
+        rep     stosd
+        mov     ecx, ebx
+        cmp     edx, 0
+        jg      next
+    done:
+    }
+#else
+    int32_t mid = val >> 16;
+    const int32_t block = val & 0xffff;
+    uint32_t* psrc = &src[(val >> 17) + 1];
+    
+    //each block is filled with its middle pixel by span kernel
+    do {
+        count -= mid;
+        if (count <= 0)
+        {
+            mid += count;
+            gfxKernels.fillSpan(dst, *psrc, mid);
+        }
+        else
+        {
+            gfxKernels.fillSpan(dst, *psrc, mid);
+            dst += mid;
+            psrc += mid;
+            mid = block;
+        }
+    } while (count > 0);
+#endif
+}
+
+//FX-effect: brightness alpha buffer
+void brightnessAlpha(GFX_IMAGE* img, uint8_t bright)
+{
+    ARGB* data = (ARGB*)img->mData;
+    const uint32_t nsize = img->mSize >> 2;
+    
+    //only support 32bit color
+    if (gfxContext.bitsPerPixel != 32) return;
+
+#ifdef _USE_ASM
+    __asm {
+        mov     ecx, nsize
+        mov     edi, data
+        xor     eax, eax
+        mov     bl, bright
+    next:
+        mov     al, [edi + 3]
+        mul     bl
+        mov     [edi + 3], ah
+        add     edi, 4
+        dec     ecx
+        jnz     next
+    }
+#else
+    //rgb channels are kept
+    uint32_t* pixels = (uint32_t*)data;
+    if (kernelLevel >= KERNEL_LEVEL_AVX2) scaleChannelsAVX2(pixels, pixels, 256, bright, nsize);
+    else if (kernelLevel >= KERNEL_LEVEL_SSE2) scaleChannelsSSE2(pixels, pixels, 256, bright, nsize);
+    else scaleChannels(pixels, pixels, 256, bright, nsize);
+#endif
+}
+
+//FX-effect: block-out and middle image buffer
+void blockOutMidImage(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t xb, int32_t yb)
+{
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    uint32_t* psrc = (uint32_t*)src->mData;
+
+    //only support for rgb mode
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    //check minimum blocking
+    if (xb <= 0) xb = 1;
+    if (yb <= 0) yb = 1;
+
+    //nothing to do, make source and destination are the same
+    if (xb == 1 && yb == 1) memcpy(pdst, psrc, src->mSize);
+    else
+    {
+        //calculate delta x, delta y
+        const int32_t cx = (((src->mWidth >> 1) % xb) << 16) | xb;
+        const int32_t cy = (yb - ((src->mHeight >> 1) % yb));
+
+        //process line by line
+        for (int32_t y = 0; y < src->mHeight; y++)
+        {
+            //blocking line by line
+            if ((y + cy) % yb == 0 || y == 0)
+            {
+                int32_t mid = y + (cy >> 1);
+                if (mid >= src->mHeight) mid = (src->mHeight + y) >> 1;
+                blockOutMid(pdst, &psrc[mid * src->mWidth], src->mWidth, cx);
+            }
+            //already blocking, copy it
+            else memcpy(pdst, pdst - dst->mWidth, dst->mRowBytes);
+            pdst += dst->mWidth;
+        }
+    }
+}
+
+//FX-effect: fade circle image buffer
+void fadeOutCircle(double pc, int32_t size, int32_t type, uint32_t col)
+{
+    int32_t val = 0, x = 0, y = 0;
+
+    const int32_t dsize = size << 1;
+    const int32_t smax = int32_t(size * 1.4);
+
+    if (pc < 0.0) pc = 0.0;
+    if (pc > 100.0) pc = 100.0;
+
+    switch (type)
+    {
+    case 0:
+        for (y = 0; y < gfxContext.texHeight / dsize; y++)
+        {
+            val = int32_t(smax * pc / 100.0);
+            for (x = 0; x < gfxContext.texWidth / dsize; x++) fillCircle(x * dsize + size, y * dsize + size, val, col);
+        }
+        break;
+
+    case 1:
+        for (y = 0; y < gfxContext.texHeight / dsize; y++)
+        {
+            for (x = 0; x < gfxContext.texWidth / dsize; x++)
+            {
+                val = int32_t((smax + (double(gfxContext.texHeight) / dsize - y) * 2.0) * pc / 100.0);
+                if (val > smax) val = smax;
+                fillCircle(x * dsize + size, y * dsize + size, val, col);
+            }
+        }
+        break;
+
+    case 2:
+        for (y = 0; y < gfxContext.texHeight / dsize; y++)
+        {
+            for (x = 0; x < gfxContext.texWidth / dsize; x++)
+            {
+                val = int32_t((smax + (double(gfxContext.texWidth) / dsize - x) * 2.0) * pc / 100.0);
+                if (val > smax) val = smax;
+                fillCircle(x * dsize + size, y * dsize + size, val, col);
+            }
+        }
+        break;
+
+    case 3:
+        for (y = 0; y < gfxContext.texHeight / dsize; y++)
+        {
+            for (x = 0; x < gfxContext.texWidth / dsize; x++)
+            {
+                val = int32_t((smax + (double(gfxContext.texWidth) / size - (double(x) + y))) * pc / 100.0);
+                if (val > smax) val = smax;
+                fillCircle(x * dsize + size, y * dsize + size, val, col);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+//scale-up line with lookup table (AVX2 version, 8 pixels per loop, gather source pixels)
+target_avx2 void scaleUpLineAVX2(uint32_t* dst, const uint32_t* src, const int32_t* tables, int32_t count, int32_t yval)
+{
+    int32_t i = 0;
+    const __m256i offset = _mm256_set1_epi32(yval);
+    for (; i + 8 <= count; i += 8) _mm256_storeu_si256((__m256i*)&dst[i], _mm256_i32gather_epi32((const int*)src, _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)&tables[i]), offset), 4));
+    for (; i < count; i++) dst[i] = src[tables[i] + yval];
+}
+
+//FX-effect: scale-up image buffer
+void scaleUpLine(uint32_t* dst, const uint32_t* src, int32_t* tables, int32_t count, int32_t yval)
+{
+#ifdef _USE_ASM
+    yval <<= 2;
+    __asm {
+        mov     ecx, count
+        mov     ebx, src
+        add     ebx, yval
+        mov     esi, tables
+        mov     edi, dst
+    next:
+        lodsd
+        mov     eax, [ebx + eax * 4]
+        stosd
+        dec     ecx
+        jnz     next
+    }
+#else
+    if (kernelLevel >= KERNEL_LEVEL_AVX2) scaleUpLineAVX2(dst, src, tables, count, yval);
+    else for (int32_t i = 0; i < count; i++) *dst++ = src[tables[i] + yval];
+#endif
+}
+
+//FX-effect: scale-up image buffer
+void scaleUpImage(GFX_IMAGE* dst, const GFX_IMAGE* src, int32_t* tables, int32_t xfact, int32_t yfact)
+{
+    int32_t i = 0, y = 0;
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    const uint32_t* psrc = (const uint32_t*)src->mData;
+
+    //check color mode
+    if (gfxContext.bitsPerPixel <= 8)
+    {
+        messageBox(GFX_ERROR, "Wrong pixel format!");
+        return;
+    }
+
+    //init lookup table
+    for (i = 0; i < src->mWidth; i++) tables[i] = fround(double(i) / (intmax_t(src->mWidth) - 1) * ((intmax_t(src->mWidth) - 1) - (intmax_t(xfact) << 1))) + xfact;
+
+    //scale up line by line
+    for (i = 0; i < src->mHeight; i++)
+    {
+        y = fround(double(i) / (intmax_t(src->mHeight) - 1) * ((intmax_t(src->mHeight) - 1) - (intmax_t(yfact) << 1)) + yfact);
+        scaleUpLine(pdst, psrc, tables, src->mWidth, y * src->mWidth);
+        pdst += dst->mWidth;
+    }
+}
+
+//blur pixels from start to end in place (4 neighbour pixels, left and top pixels are already blurred)
+void blurPixels(uint32_t* data, const uint32_t width, const uint32_t start, const uint32_t end)
+{
+    for (uint32_t i = start; i < end; i++)
+    {
+        ARGB* col0 = (ARGB*)&data[i];
+        const ARGB* col1 = (const ARGB*)&data[i - 1];
+        const ARGB* col2 = (const ARGB*)&data[i + 1];
+        const ARGB* col3 = (const ARGB*)&data[i - width];
+        const ARGB* col4 = (const ARGB*)&data[i + width];
+        col0->r = (col1->r + col2->r + col3->r + col4->r) >> 2;
+        col0->g = (col1->g + col2->g + col3->g + col4->g) >> 2;
+        col0->b = (col1->b + col2->b + col3->b + col4->b) >> 2;
+    }
+}
+
+//blur pixels in place (SSE2 version, 2 pixels per loop)
+//each pixel depends on the left pixel just blurred, so only the right, top and bottom sums are calculated in parallel
+//there is no gain for AVX2 with this serial dependency
+void blurPixelsSSE2(uint32_t* data, const uint32_t width, const uint32_t start, const uint32_t end)
+{
+    uint32_t i = start;
+    if (i >= end) return;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i rgb = _mm_set1_epi32(0x00ffffff);
+    __m128i prev = _mm_unpacklo_epi8(_mm_cvtsi32_si128(data[i - 1]), zero);
+
+    for (; i + 2 <= end; i += 2)
+    {
+        //sum of right, top and bottom pixels, 2 pixels x 4 channels
+        const __m128i right = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)&data[i + 1]), zero);
+        const __m128i top = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)&data[i - width]), zero);
+        const __m128i bottom = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)&data[i + width]), zero);
+        const __m128i sum = _mm_add_epi16(_mm_add_epi16(right, top), bottom);
+
+        //first pixel with left pixel, second pixel with first pixel
+        const __m128i col0 = _mm_srli_epi16(_mm_add_epi16(prev, sum), 2);
+        const __m128i col1 = _mm_srli_epi16(_mm_add_epi16(_mm_slli_si128(col0, 8), sum), 2);
+        const __m128i cols = _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(col1), _mm_castsi128_pd(col0)));
+
+        //keep alpha channel
+        const __m128i src = _mm_loadl_epi64((const __m128i*)&data[i]);
+        const __m128i res = _mm_or_si128(_mm_and_si128(_mm_packus_epi16(cols, zero), rgb), _mm_andnot_si128(rgb, src));
+        _mm_storel_epi64((__m128i*)&data[i], res);
+        prev = _mm_srli_si128(col1, 8);
+    }
+
+    //remainder pixel
+    blurPixels(data, width, i, end);
+}
+
+//FX-effect: blur image buffer
+void blurImage(const GFX_IMAGE* img)
+{
+    if (gfxContext.bitsPerPixel <= 8)
+    {
+        messageBox(GFX_ERROR, "Wrong pixel format!");
+        return;
+    }
+
+    const uint32_t width = img->mWidth;
+    const uint32_t* data = (const uint32_t*)img->mData;
+
+#ifdef _USE_ASM
+    uint32_t height = img->mHeight;
+    __asm {
+        mov     edi, data
+    step:
+        mov     edx, width
+        sub     edx, 2
+        push    edx
+        mov     edx, width
+        shl     edx, 2
+        mov     ebx, [edi]
+        mov     esi, [edi + 4]
+        and     ebx, 00ff00ffh
+        and     esi, 00ff00ffh
+        add     ebx, ebx
+        mov     ecx, [edi + edx]
+        add     esi, ebx
+        and     ecx, 00ff00ffh
+        add     esi, ecx
+        mov     al, [edi + 5]
+        mov     bl, [edi + 1]
+        add     ebx, ebx
+        mov     cl, [edi + edx + 1]
+        add     eax, ebx
+        xor     ebx, ebx
+        shr     esi, 2
+        add     eax, ecx
+        and     esi, 00ff00ffh
+        shl     eax, 6
+        and     eax, 0000ff00h
+        or      eax, esi
+        stosd
+    next:
+        mov     esi, [edi - 4]
+        mov     ecx, [edi + 4]
+        and     esi, 00ff00ffh
+        and     ecx, 00ff00ffh
+        mov     ebx, [edi]
+        add     esi, ecx
+        and     ebx, 00ff00ffh
+        mov     ecx, [edi + edx]
+        add     esi, ebx
+        and     ecx, 00ff00ffh
+        xor     eax, eax
+        mov     al, [edi - 3]
+        add     esi, ecx
+        mov     cl, [edi + 5]
+        mov     bl, [edi + 1]
+        add     eax, ecx
+        mov     cl, [edi + edx + 1]
+        add     eax, ebx
+        shr     esi, 2
+        add     eax, ecx
+        and     esi, 00ff00ffh
+        shl     eax, 6
+        and     eax, 0000ff00h
+        or      eax, esi
+        stosd
+        dec     dword ptr[esp]
+        jnz     next
+        mov     ebx, [edi]
+        mov     esi, [edi - 4]
+        and     ebx, 00ff00ffh
+        and     esi, 00ff00ffh
+        add     ebx, ebx
+        mov     ecx, [edi + edx]
+        add     esi, ebx
+        and     ecx, 00ff00ffh
+        add     esi, ecx
+        mov     al, [edi - 3]
+        mov     bl, [edi - 4]
+        add     ebx, ebx
+        mov     cl, [edi + edx + 1]
+        add     eax, ebx
+        xor     ebx, ebx
+        shr     esi, 2
+        add     eax, ecx
+        and     esi, 00ff00ffh
+        shl     eax, 6
+        and     eax, 0000ff00h
+        or      eax, esi
+        stosd
+        pop     edx
+        dec     height
+        jnz     step
+    }
+#else
+    const uint32_t offset = (img->mSize >> 2) - (width << 1);
+    if (kernelLevel >= KERNEL_LEVEL_SSE2) blurPixelsSSE2((uint32_t*)data, width, width, offset);
+    else blurPixels((uint32_t*)data, width, width, offset);
+#endif
+}
+
+//blend 2 pixels buffer (A * SRC1 + (256 - A) * SRC2) >> 8, all channels
+void blendPixels(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t cover, const uint32_t count)
+{
+    const uint32_t rcover = 256 - cover;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const uint32_t rb = (src1[i] & 0x00ff00ff) * cover + (src2[i] & 0x00ff00ff) * rcover;
+        const uint32_t ag = ((src1[i] >> 8) & 0x00ff00ff) * cover + ((src2[i] >> 8) & 0x00ff00ff) * rcover;
+        dst[i] = ((rb >> 8) & 0x00ff00ff) | (ag & 0xff00ff00);
+    }
+}
+
+//blend 2 pixels buffer (SSE2 version, 4 pixels per loop, buffers must be 16-bytes aligned)
+void blendPixelsSSE2(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t cover, const uint32_t count)
+{
+    uint32_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_set1_epi16(cover);
+    const __m128i invert = _mm_set1_epi16(256 - cover);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i s1 = _mm_load_si128((const __m128i*)&src1[i]);
+        const __m128i s2 = _mm_load_si128((const __m128i*)&src2[i]);
+
+        //blending (A * SRC1 + B * SRC2) >> 8
+        const __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(s1, zero), alpha), _mm_mullo_epi16(_mm_unpacklo_epi8(s2, zero), invert)), 8);
+        const __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(s1, zero), alpha), _mm_mullo_epi16(_mm_unpackhi_epi8(s2, zero), invert)), 8);
+        _mm_stream_si128((__m128i*)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    blendPixels(&dst[i], &src1[i], &src2[i], cover, count - i);
+}
+
+//blend 2 pixels buffer (AVX2 version, 8 pixels per loop, buffers must be 32-bytes aligned)
+target_avx2 void blendPixelsAVX2(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t cover, const uint32_t count)
+{
+    uint32_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alpha = _mm256_set1_epi16(cover);
+    const __m256i invert = _mm256_set1_epi16(256 - cover);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i s1 = _mm256_stream_load_si256((const __m256i*)&src1[i]);
+        const __m256i s2 = _mm256_stream_load_si256((const __m256i*)&src2[i]);
+
+        //blending (A * SRC1 + B * SRC2) >> 8
+        const __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(s1, zero), alpha), _mm256_mullo_epi16(_mm256_unpacklo_epi8(s2, zero), invert)), 8);
+        const __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(s1, zero), alpha), _mm256_mullo_epi16(_mm256_unpackhi_epi8(s2, zero), invert)), 8);
+        _mm256_stream_si256((__m256i*)&dst[i], _mm256_packus_epi16(lo, hi));
+    }
+
+    //remainder pixels
+    blendPixels(&dst[i], &src1[i], &src2[i], cover, count - i);
+}
+
+//blend 2 pixels buffer (AVX-512BW version, 16 pixels per loop, masked tail)
+target_avx512 void blendPixelsAVX512(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t cover, const uint32_t count)
+{
+    uint32_t i = 0;
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i alpha = _mm512_set1_epi16(cover);
+    const __m512i invert = _mm512_set1_epi16(256 - cover);
+
+    for (; i < count; i += 16)
+    {
+        const __mmask16 mask = (count - i >= 16) ? __mmask16(0xffff) : __mmask16((1 << (count - i)) - 1);
+        const __m512i s1 = _mm512_maskz_loadu_epi32(mask, &src1[i]);
+        const __m512i s2 = _mm512_maskz_loadu_epi32(mask, &src2[i]);
+
+        //blending (A * SRC1 + B * SRC2) >> 8
+        const __m512i lo = _mm512_srli_epi16(_mm512_add_epi16(_mm512_mullo_epi16(_mm512_unpacklo_epi8(s1, zero), alpha), _mm512_mullo_epi16(_mm512_unpacklo_epi8(s2, zero), invert)), 8);
+        const __m512i hi = _mm512_srli_epi16(_mm512_add_epi16(_mm512_mullo_epi16(_mm512_unpackhi_epi8(s1, zero), alpha), _mm512_mullo_epi16(_mm512_unpackhi_epi8(s2, zero), invert)), 8);
+        _mm512_mask_storeu_epi32(&dst[i], mask, _mm512_packus_epi16(lo, hi));
+    }
+}
+
+//blend 2 pixels buffer in linear light
+void blendPixelsLinear(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t cover, const uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) dst[i] = linearPixel(src2[i], src1[i], cover);
+}
+
+//blend 2 pixels buffer in linear light (AVX2 version, 8 pixels per loop)
+target_avx2 void blendPixelsLinearAVX2(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t cover, const uint32_t count)
+{
+    uint32_t i = 0;
+    const __m256i weights = _mm256_set1_epi32(cover | ((256 - cover) << 16));
+    for (; i + 8 <= count; i += 8) _mm256_storeu_si256((__m256i*)&dst[i], linearLanes(_mm256_loadu_si256((const __m256i*)&src2[i]), _mm256_loadu_si256((const __m256i*)&src1[i]), weights));
+
+    //remainder pixels
+    blendPixelsLinear(&dst[i], &src1[i], &src2[i], cover, count - i);
+}
+
+//FX-effect: alpha-blending image buffer (BLEND_MODE_ALPHA in sRGB space or BLEND_MODE_LINEAR in linear light)
+void blendImage(GFX_IMAGE* dst, GFX_IMAGE* src1, GFX_IMAGE* src2, int32_t cover, int32_t mode /* = BLEND_MODE_ALPHA */)
+{
+    const uint32_t pixels = src1->mSize >> 2;
+    uint32_t* pdst  = (uint32_t*)dst->mData;
+    uint32_t* psrc1 = (uint32_t*)src1->mData;
+    uint32_t* psrc2 = (uint32_t*)src2->mData;
+    
+    if (gfxContext.bitsPerPixel <= 8)
+    {
+        messageBox(GFX_ERROR, "Wrong pixel format!");
+        return;
+    }
+
+    //gamma-correct cross-fade (doesn't darken mid-tones)
+    if (mode == BLEND_MODE_LINEAR)
+    {
+        if (maxKernelLevel < 0) initKernels();
+        if (kernelLevel >= KERNEL_LEVEL_AVX2) blendPixelsLinearAVX2(pdst, psrc1, psrc2, cover, pixels);
+        else blendPixelsLinear(pdst, psrc1, psrc2, cover, pixels);
+        return;
+    }
+
+#ifdef _USE_ASM
+    __asm {
+        mov         ecx, pixels
+        shr         ecx, 1
+        jz          end
+        mov         edi, pdst
+        mov         edx, psrc1
+        mov         esi, psrc2
+        movzx       eax, cover
+        xor         eax, 0FFh
+        movd        mm3, eax
+        punpcklwd   mm3, mm3
+        pxor        mm2, mm2
+        punpckldq   mm3, mm3
+    again:
+        movq        mm0, [edx]
+        movq        mm1, [esi]
+        movq        mm5, mm0
+        punpcklbw   mm0, mm2
+        movq        mm4, mm1
+        punpcklbw   mm1, mm2
+        psubw       mm0, mm1
+        pmullw      mm0, mm3
+        movq        mm6, mm4
+        psrlw       mm0, 8
+        psrlq       mm5, 32
+        psrlq       mm4, 32
+        punpcklbw   mm5, mm2
+        punpcklbw   mm4, mm2
+        psubw       mm5, mm4
+        pmullw      mm5, mm3
+        psrlw       mm5, 8
+        packuswb    mm0, mm5
+        paddb       mm0, mm6
+        movq        [edi], mm0
+        add         edx, 8
+        add         edi, 8
+        add         esi, 8
+        dec         ecx
+        jnz         again
+        emms
+    end:
+    }
+#else
+    if (kernelLevel >= KERNEL_LEVEL_AVX512) blendPixelsAVX512(pdst, psrc1, psrc2, cover, pixels);
+    else if (kernelLevel >= KERNEL_LEVEL_AVX2) blendPixelsAVX2(pdst, psrc1, psrc2, cover, pixels);
+    else if (kernelLevel >= KERNEL_LEVEL_SSE2) blendPixelsSSE2(pdst, psrc1, psrc2, cover, pixels);
+    else blendPixels(pdst, psrc1, psrc2, cover, pixels);
+#endif
+}
+
+//rotate line (AVX2 version, 8 pixels per loop, gather table entries and source pixels of visible lanes)
+target_avx2 void rotateLineAVX2(uint32_t* dst, const uint32_t* src, const int32_t* tables, int32_t width, int32_t siny, int32_t cosy)
+{
+    int32_t idx = 0;
+    const int32_t mx = tables[0];
+    const int32_t my = tables[1];
+    const int32_t pos = (width + 1) << 1;
+    const int32_t count = width - 1;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i maxx = _mm256_set1_epi32(mx);
+    const __m256i maxy = _mm256_set1_epi32(my);
+
+    for (; idx + 8 <= count; idx += 8)
+    {
+        //table offset of pixel idx is (width - idx) * 2, rows of table are read backward
+        const __m256i ofs = _mm256_slli_epi32(_mm256_sub_epi32(_mm256_set1_epi32(width - idx), lanes), 1);
+        const __m256i y = _mm256_srai_epi32(_mm256_add_epi32(_mm256_i32gather_epi32((const int*)tables, ofs, 4), _mm256_set1_epi32(cosy)), 1);
+        const __m256i x = _mm256_srai_epi32(_mm256_sub_epi32(_mm256_i32gather_epi32((const int*)&tables[1], ofs, 4), _mm256_set1_epi32(siny)), 1);
+
+        //pixels outside source are skipped
+        const __m256i mask = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(y, zero), _mm256_cmpgt_epi32(x, zero)), _mm256_and_si256(_mm256_cmpgt_epi32(maxy, y), _mm256_cmpgt_epi32(maxx, x)));
+        if (_mm256_testz_si256(mask, mask)) continue;
+
+        const __m256i t = _mm256_mask_i32gather_epi32(zero, (const int*)&tables[pos], y, mask, 4);
+        const __m256i col = _mm256_mask_i32gather_epi32(zero, (const int*)src, _mm256_add_epi32(x, _mm256_srai_epi32(t, 2)), mask, 4);
+        _mm256_maskstore_epi32((int*)&dst[idx], mask, col);
+    }
+
+    //remainder pixels
+    for (; idx < count; idx++)
+    {
+        const int32_t ofs = (width - idx) << 1;
+        const int32_t y = (tables[ofs    ] + cosy) >> 1;
+        const int32_t x = (tables[ofs + 1] - siny) >> 1;
+        if (y > 0 && x > 0 && y < my && x < mx)
+        {
+            const int32_t t = tables[y + pos];
+            dst[idx] = src[x + (t >> 2)];
+        }
+    }
+}
+
+//FX-effect: rotate image buffer, line by line
+void rotateLine(uint32_t* dst, const uint32_t* src, const int32_t* tables, int32_t width, int32_t siny, int32_t cosy)
+{
+#ifdef _USE_ASM
+    const int32_t pos = (width + 1) << 3;
+    __asm {
+        mov     ecx, width
+        dec     ecx
+        mov     esi, src
+        mov     edi, dst
+        mov     ebx, tables
+    next:
+        mov     eax, [ebx + ecx * 8 + 8]
+        mov     edx, [ebx + ecx * 8 + 12]
+        add     eax, cosy
+        sub     edx, siny
+        sar     eax, 1
+        js      skip
+        sar     edx, 1
+        js      skip
+        cmp     eax, [ebx + 4]
+        jnl     skip
+        cmp     edx, [ebx]
+        jnl     skip
+        shl     eax, 2
+        add     eax, pos
+        mov     eax, [ebx + eax]
+        shl     edx, 2
+        add     eax, edx
+        mov     eax, [esi + eax]
+        mov     [edi], eax
+    skip:
+        add     edi, 4
+        dec     ecx
+        jns     next
+    }
+#else
+    if (kernelLevel >= KERNEL_LEVEL_AVX2)
+    {
+        rotateLineAVX2(dst, src, tables, width, siny, cosy);
+        return;
+    }
+
+    int32_t idx = 0;
+    const int32_t mx = tables[0];
+    const int32_t my = tables[1];
+    const int32_t pos = (width + 1) << 1;
+
+    for (int32_t i = width - 1; i > 0; i--)
+    {
+        const int32_t ofs = (i + 1) << 1;
+        const int32_t y = (tables[ofs    ] + cosy) >> 1;
+        const int32_t x = (tables[ofs + 1] - siny) >> 1;
+        if (y > 0 && x > 0 && y < my && x < mx)
+        {
+            const int32_t t = tables[y + pos];
+            dst[idx] = src[x + (t >> 2)];
+        }
+        idx++;
+    }
+#endif
+}
+
+//FX-effect: rotate image buffer
+void rotateImage(GFX_IMAGE* dst, GFX_IMAGE* src, int32_t* tables, int32_t axisx, int32_t axisy, double angle, double scale)
+{
+    int32_t x = 0, y = 0, lineWidth = 0;
+    uint32_t* pdst = (uint32_t*)dst->mData;
+    const uint32_t* psrc = (const uint32_t*)src->mData;
+
+    if (gfxContext.bitsPerPixel <= 8)
+    {
+        messageBox(GFX_ERROR, "Wrong pixel format!");
+        return;
+    }
+
+    //recalculate axisx, axisy
+    axisx = dst->mWidth - axisx;
+    axisy = dst->mHeight - axisy;
+
+    //store source image width, height
+    tables[0] = src->mWidth;
+    tables[1] = src->mHeight;
+
+    //calculate rotation data
+    const double th = M_PI * (180 - angle) / 180.0;
+    double sint = sin(th) / scale;
+    double cost = cos(th) / scale;
+
+    const double primex = -(2.0 * axisx + 1);
+    double sinx = primex * sint - 1;
+    double cosx = primex * cost - 1 + src->mWidth;
+
+    sint *= 2;
+    cost *= 2;
+
+    //init lookup tables
+    for (x = 0; x < dst->mWidth; x++)
+    {
+        tables[(x << 1) + 2] = int32_t(sinx);
+        tables[(x << 1) + 3] = int32_t(cosx);
+        sinx += sint;
+        cosx += cost;
+    }
+
+    sint /= 2;
+    cost /= 2;
+
+    for (y = 0; y < src->mHeight; y++)
+    {
+        tables[y + ((src->mWidth + 1) << 1)] = lineWidth;
+        lineWidth += src->mRowBytes;
+    }
+
+    const double primey = ((intmax_t(dst->mHeight) - 1 - axisy) * 2.0) + 1;
+    double siny = primey * sint;
+    double cosy = primey * cost + src->mHeight;
+
+    sint *= 2;
+    cost *= 2;
+
+    //process rotate line by line
+    for (y = 0; y < dst->mHeight; y++)
+    {
+        rotateLine(pdst, psrc, tables, dst->mWidth, int32_t(siny), int32_t(cosy));
+        pdst += dst->mWidth;
+        siny -= sint;
+        cosy -= cost;
+    }
+}
+
+//bump pixels of a line (vlx: distance from light to first pixel, vly: distance from light to line)
+void bumpPixels(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t src1len, const int32_t bmax, int32_t vlx, const int32_t vly, const int32_t count)
+{
+    for (int32_t i = 0; i < count; i++, vlx++)
+    {
+        //range checking
+        if (vlx > -bmax && vlx < bmax && vly > -bmax && vly < bmax)
+        {
+            const int32_t nx = (src1[i + 1] & 0xff) - (src1[i - 1] & 0xff);
+            const int32_t ny = (src1[i + src1len] & 0xff) - (src1[i - src1len] & 0xff);
+            uint8_t difx = 127 - min(abs(vlx - nx) >> 1, 127);
+            if (difx <= 0) difx = 1;
+            uint8_t dify = 127 - min(abs(vly - ny) >> 1, 127);
+            if (dify <= 0) dify = 1;
+            uint8_t col = difx + dify;
+            if (col > 128)
+            {
+                col -= 128;
+                ARGB* pdst = (ARGB*)&dst[i];
+                const ARGB* psrc = (const ARGB*)&src2[i];
+                pdst->r = min((col * psrc->r) >> 5, 255);
+                pdst->g = min((col * psrc->g) >> 5, 255);
+                pdst->b = min((col * psrc->b) >> 5, 255);
+            }
+        }
+    }
+}
+
+//select a or b by mask (SSE2 has no blend instruction)
+static must_inline __m128i selectSSE2(const __m128i mask, const __m128i a, const __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+//bump pixels of a line (SSE2 version, 4 pixels per loop)
+void bumpPixelsSSE2(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t src1len, const int32_t bmax, int32_t vlx, const int32_t vly, const int32_t count)
+{
+    int32_t i = 0;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i lmax = _mm_set1_epi32(127);
+    const __m128i cmax = _mm_set1_epi32(255);
+    const __m128i half = _mm_set1_epi32(128);
+    const __m128i low = _mm_set1_epi32(0xff);
+    const __m128i rgb = _mm_set1_epi32(0x00ffffff);
+    const __m128i hmin = _mm_set1_epi32(-bmax);
+    const __m128i hmax = _mm_set1_epi32(bmax);
+    const __m128i vy = _mm_set1_epi32(vly);
+    __m128i vx = _mm_add_epi32(_mm_set1_epi32(vlx), _mm_set_epi32(3, 2, 1, 0));
+
+    for (; i + 4 <= count; i += 4, vlx += 4)
+    {
+        //normal vector from bump map (blue channel)
+        const __m128i nx = _mm_sub_epi32(_mm_and_si128(_mm_loadu_si128((const __m128i*)&src1[i + 1]), low), _mm_and_si128(_mm_loadu_si128((const __m128i*)&src1[i - 1]), low));
+        const __m128i ny = _mm_sub_epi32(_mm_and_si128(_mm_loadu_si128((const __m128i*)&src1[i + src1len]), low), _mm_and_si128(_mm_loadu_si128((const __m128i*)&src1[i - src1len]), low));
+
+        //difx = 127 - min(abs(vlx - nx) >> 1, 127), at least 1
+        __m128i dx = _mm_sub_epi32(vx, nx);
+        __m128i sign = _mm_srai_epi32(dx, 31);
+        dx = _mm_srli_epi32(_mm_sub_epi32(_mm_xor_si128(dx, sign), sign), 1);
+        dx = _mm_sub_epi32(lmax, selectSSE2(_mm_cmpgt_epi32(dx, lmax), lmax, dx));
+        dx = selectSSE2(_mm_cmpeq_epi32(dx, zero), one, dx);
+
+        //dify = 127 - min(abs(vly - ny) >> 1, 127), at least 1
+        __m128i dy = _mm_sub_epi32(vy, ny);
+        sign = _mm_srai_epi32(dy, 31);
+        dy = _mm_srli_epi32(_mm_sub_epi32(_mm_xor_si128(dy, sign), sign), 1);
+        dy = _mm_sub_epi32(lmax, selectSSE2(_mm_cmpgt_epi32(dy, lmax), lmax, dy));
+        dy = selectSSE2(_mm_cmpeq_epi32(dy, zero), one, dy);
+
+        //only pixels in range and col > 128 are changed
+        const __m128i col = _mm_add_epi32(dx, dy);
+        const __m128i mask = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(vx, hmin), _mm_cmplt_epi32(vx, hmax)), _mm_cmpgt_epi32(col, half));
+        vx = _mm_add_epi32(vx, _mm_set1_epi32(4));
+        if (!_mm_movemask_epi8(mask)) continue;
+
+        //min((col * channel) >> 5, 255), products are less than 16 bits
+        const __m128i cs = _mm_sub_epi32(col, half);
+        const __m128i pix = _mm_loadu_si128((const __m128i*)&src2[i]);
+        __m128i r = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pix, 16), low), cs), 5);
+        __m128i g = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(pix, 8), low), cs), 5);
+        __m128i b = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(pix, low), cs), 5);
+        r = selectSSE2(_mm_cmpgt_epi32(r, cmax), cmax, r);
+        g = selectSSE2(_mm_cmpgt_epi32(g, cmax), cmax, g);
+        b = selectSSE2(_mm_cmpgt_epi32(b, cmax), cmax, b);
+
+        //keep alpha channel of destination
+        const __m128i old = _mm_loadu_si128((const __m128i*)&dst[i]);
+        const __m128i res = _mm_or_si128(_mm_andnot_si128(rgb, old), _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 16), _mm_slli_epi32(g, 8)), b));
+        _mm_storeu_si128((__m128i*)&dst[i], selectSSE2(mask, res, old));
+    }
+
+    //remainder pixels
+    bumpPixels(&dst[i], &src1[i], &src2[i], src1len, bmax, vlx, vly, count - i);
+}
+
+//bump pixels of a line (AVX2 version, 8 pixels per loop)
+target_avx2 void bumpPixelsAVX2(uint32_t* dst, const uint32_t* src1, const uint32_t* src2, const int32_t src1len, const int32_t bmax, int32_t vlx, const int32_t vly, const int32_t count)
+{
+    int32_t i = 0;
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i lmax = _mm256_set1_epi32(127);
+    const __m256i cmax = _mm256_set1_epi32(255);
+    const __m256i half = _mm256_set1_epi32(128);
+    const __m256i low = _mm256_set1_epi32(0xff);
+    const __m256i rgb = _mm256_set1_epi32(0x00ffffff);
+    const __m256i hmin = _mm256_set1_epi32(-bmax);
+    const __m256i hmax = _mm256_set1_epi32(bmax);
+    const __m256i vy = _mm256_set1_epi32(vly);
+    __m256i vx = _mm256_add_epi32(_mm256_set1_epi32(vlx), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+    for (; i + 8 <= count; i += 8, vlx += 8)
+    {
+        //normal vector from bump map (blue channel)
+        const __m256i nx = _mm256_sub_epi32(_mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src1[i + 1]), low), _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src1[i - 1]), low));
+        const __m256i ny = _mm256_sub_epi32(_mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src1[i + src1len]), low), _mm256_and_si256(_mm256_loadu_si256((const __m256i*)&src1[i - src1len]), low));
+
+        //difx, dify = 127 - min(abs(d) >> 1, 127), at least 1
+        const __m256i dx = _mm256_max_epi32(_mm256_sub_epi32(lmax, _mm256_min_epi32(_mm256_srli_epi32(_mm256_abs_epi32(_mm256_sub_epi32(vx, nx)), 1), lmax)), one);
+        const __m256i dy = _mm256_max_epi32(_mm256_sub_epi32(lmax, _mm256_min_epi32(_mm256_srli_epi32(_mm256_abs_epi32(_mm256_sub_epi32(vy, ny)), 1), lmax)), one);
+
+        //only pixels in range and col > 128 are changed
+        const __m256i col = _mm256_add_epi32(dx, dy);
+        const __m256i mask = _mm256_and_si256(_mm256_and_si256(_mm256_cmpgt_epi32(vx, hmin), _mm256_cmpgt_epi32(hmax, vx)), _mm256_cmpgt_epi32(col, half));
+        vx = _mm256_add_epi32(vx, _mm256_set1_epi32(8));
+        if (_mm256_testz_si256(mask, mask)) continue;
+
+        //min((col * channel) >> 5, 255)
+        const __m256i cs = _mm256_sub_epi32(col, half);
+        const __m256i pix = _mm256_loadu_si256((const __m256i*)&src2[i]);
+        const __m256i r = _mm256_min_epi32(_mm256_srli_epi32(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi32(pix, 16), low), cs), 5), cmax);
+        const __m256i g = _mm256_min_epi32(_mm256_srli_epi32(_mm256_mullo_epi16(_mm256_and_si256(_mm256_srli_epi32(pix, 8), low), cs), 5), cmax);
+        const __m256i b = _mm256_min_epi32(_mm256_srli_epi32(_mm256_mullo_epi16(_mm256_and_si256(pix, low), cs), 5), cmax);
+
+        //keep alpha channel of destination
+        const __m256i old = _mm256_loadu_si256((const __m256i*)&dst[i]);
+        const __m256i res = _mm256_or_si256(_mm256_andnot_si256(rgb, old), _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r, 16), _mm256_slli_epi32(g, 8)), b));
+        _mm256_maskstore_epi32((int32_t*)&dst[i], mask, res);
+    }
+
+    //remainder pixels
+    bumpPixels(&dst[i], &src1[i], &src2[i], src1len, bmax, vlx, vly, count - i);
+}
+
+//FX-effect: 2d bumping
+void bumpImage(const GFX_IMAGE* dst, const GFX_IMAGE* src1, const GFX_IMAGE* src2, int32_t lx, int32_t ly)
+{
+    const uint32_t* dstdata = (const uint32_t*)dst->mData;
+    const uint32_t* src1data = (const uint32_t*)src1->mData;
+    const uint32_t* src2data = (const uint32_t*)src2->mData;
+
+    const int32_t src1width = src1->mWidth;
+    const int32_t src2width = src2->mWidth;
+    const int32_t dstwidth = dst->mWidth;
+    const int32_t src1len = src1->mRowBytes - 1;
+
+    const int32_t bmax = 400;
+    const int32_t xstart = 100, ystart = 100;
+    const int32_t endx = getDrawBufferWidth() - xstart;
+    const int32_t endy = getDrawBufferHeight() - ystart;
+
+#ifdef _USE_ASM
+    int32_t nx = 0, ny = 0, vlx = 0, vly = 0;
+    int32_t x = 0, y = 0, osrc2 = 0, osrc1 = 0, odst = 0;
+    __asm {
+        mov     eax, ystart
+        mov     y, eax
+    starty:
+        mov     ebx, y
+        mov     eax, src1width
+        mul     ebx
+        add     eax, 99
+        shl     eax, 2
+        mov     osrc1, eax
+        mov     eax, src2width
+        mul     ebx
+        add     eax, 99
+        shl     eax, 2
+        mov     osrc2, eax
+        mov     eax, dstwidth
+        mul     ebx
+        add     eax, 99
+        shl     eax, 2
+        mov     odst, eax
+        mov     eax, xstart
+        mov     x, eax
+    startx:
+        mov     eax, x
+        sub     eax, lx
+        mov     vlx, eax
+        mov     eax, y
+        sub     eax, ly
+        mov     vly, eax
+        mov     ecx, vlx
+        mov     eax, vly
+        mov     ebx, bmax
+        neg     ebx
+        cmp     ecx, bmax
+        jnl     stop
+        cmp     eax, bmax
+        jnl     stop
+        cmp     ecx, ebx
+        jng     stop
+        cmp     eax, ebx
+        jng     stop
+        xor     eax, eax
+        xor     ebx, ebx
+        mov     edi, src1data
+        add     edi, osrc1
+        mov     al, [edi + 1]
+        or      al, al
+        jz      stop
+        mov     bl, [edi - 1]
+        sub     eax, ebx
+        mov     nx, eax
+        mov     ecx, src1len
+        mov     al, [edi + ecx]
+        sub     edi, ecx
+        mov     bl, [edi]
+        sub     eax, ebx
+        mov     ny, eax
+        mov     eax, vlx
+        sub     eax, nx
+        jns     nsx
+        neg     eax
+    nsx:
+        shr     eax, 1
+        cmp     eax, 127
+        jna     nax
+        mov     eax, 127
+    nax:
+        mov     ebx, 127
+        sub     ebx, eax
+        jns     nsx2
+        mov     ebx, 1
+    nsx2:
+        mov     eax, vly
+        sub     eax, ny
+        jns     nsy
+        neg     eax
+    nsy:
+        shr     eax, 1
+        cmp     eax, 127
+        jna     nay
+        mov     eax, 127
+    nay:
+        mov     ecx, 127
+        sub     ecx, eax
+        jns     nsy2
+        mov     ecx, 1
+    nsy2:
+        add     ebx, ecx
+        cmp     ebx, 128
+        jna     stop
+        sub     ebx, 128
+        mov     edi, src2data
+        add     edi, osrc2
+        mov     ecx, [edi]
+        mov     edi, dstdata
+        add     edi, odst
+        xor     eax, eax
+        mov     al, cl
+        mul     ebx
+        shr     eax, 5
+        cmp     eax, 255
+        jna     nextb
+        mov     eax, 255
+    nextb:
+        mov     [edi], al
+        mov     al, ch
+        mul     ebx
+        shr     eax, 5
+        cmp     eax, 255
+        jna     nextg
+        mov     eax, 255
+    nextg:
+        mov     [edi + 1], al
+        shr     ecx, 16
+        mov     al, cl
+        mul     ebx
+        shr     eax, 5
+        cmp     eax, 255
+        jna     nextr
+        mov     eax, 255
+    nextr:
+        mov     [edi + 2], al
+    stop:
+        add     osrc2, 4
+        add     osrc1, 4
+        add     odst, 4
+        inc     x
+        mov     eax, endx
+        cmp     x, eax
+        jna     startx
+        inc     y
+        mov     eax, endy
+        cmp     y, eax
+        jna     starty
+    }
+#else
+    //scan for image height
+    for (int32_t y = ystart; y <= endy; y++)
+    {
+        //calculate starting offset
+        const int32_t odst = dstwidth * y + 99;
+        const int32_t osrc1 = src1width * y + 99;
+        const int32_t osrc2 = src2width * y + 99;
+
+        //range checking of line
+        const int32_t vly = y - ly;
+        if (vly <= -bmax || vly >= bmax || endx < xstart) continue;
+
+        if (kernelLevel >= KERNEL_LEVEL_AVX2) bumpPixelsAVX2((uint32_t*)&dstdata[odst], &src1data[osrc1], &src2data[osrc2], src1len, bmax, xstart - lx, vly, endx - xstart + 1);
+        else if (kernelLevel >= KERNEL_LEVEL_SSE2) bumpPixelsSSE2((uint32_t*)&dstdata[odst], &src1data[osrc1], &src2data[osrc2], src1len, bmax, xstart - lx, vly, endx - xstart + 1);
+        else bumpPixels((uint32_t*)&dstdata[odst], &src1data[osrc1], &src2data[osrc2], src1len, bmax, xstart - lx, vly, endx - xstart + 1);
+    }
+#endif
+}
+
+//FX-effect: fade-out image buffer
+void fadeOutImage(GFX_IMAGE* img, uint8_t step)
+{
+    if (gfxContext.bitsPerPixel <= 8) return;
+
+    ARGB* pixels = (ARGB*)img->mData;
+    const uint32_t msize = img->mSize >> 2;
+
+#ifdef _USE_ASM
+    __asm {
+        mov         edi, pixels
+        xor         eax, eax
+        mov         al, step
+        movd        mm1, eax
+        punpcklbw   mm1, mm1
+        punpcklwd   mm1, mm1
+        mov         ecx, msize
+        shr         ecx, 1
+        jz          once
+        punpckldq   mm1, mm1
+    plot:
+        movq        mm0, [edi]
+        psubusb     mm0, mm1
+        movq        [edi], mm0
+        add         edi, 8
+        dec         ecx
+        jnz         plot
+    once:
+        test        msize, 1
+        jz          end
+        movd        mm0, [edi]
+        psubusb     mm0, mm1
+        movd        [edi], mm0
+    end:
+        emms
+    }
+#else
+    //saturating sub of rgb channels, alpha channel is kept
+    getBlendKernels(BLEND_MODE_SUB)->colorSpan((uint32_t*)pixels, rgb(step, step, step), msize);
+#endif
+}
+
+//get total system momory in MB
+void initMemoryInfo()
+{
+#ifdef SDL_PLATFORM_APPLE
+    size_t len = 0;
+    uint64_t physMem = 0, memSize = 0;
+    len = sizeof(memSize);
+    if (!sysctlbyname("hw.memsize", &memSize, &len, NULL, 0)) totalMemory = uint32_t(memSize >> 20);
+    len = sizeof(physMem);
+    if (!sysctlbyname("hw.physmem", &physMem, &len, NULL, 0)) availableMemory = uint32_t(physMem >> 20);
+#else
+    MEMORYSTATUSEX statex = { 0 };
+    statex.dwLength = sizeof(statex);
+    if (GlobalMemoryStatusEx(&statex))
+    {
+        totalMemory = uint32_t(statex.ullTotalPhys >> 20);
+        availableMemory = uint32_t(statex.ullAvailPhys >> 20);
+    }
+#endif
+}
+
+//CPUID instruction wrapper
+void CPUID(int32_t* cpuinfo, uint32_t funcid)
+{
+#ifdef _USE_ASM
+    __asm {
+        mov     eax, funcid
+        mov     edi, cpuinfo
+        cpuid
+        mov     [edi     ], eax
+        mov     [edi +  4], ebx
+        mov     [edi +  8], ecx
+        mov     [edi + 12], edx
+    }
+#elif defined(SDL_PLATFORM_APPLE)
+    __cpuid(funcid, cpuinfo[0], cpuinfo[1], cpuinfo[2], cpuinfo[3]);
+#else
+    __cpuid(cpuinfo, funcid);
+#endif
+}
+
+//get RDTSC count
+uint64_t getCyclesCount()
+{
+#ifdef _USE_ASM
+    __asm {
+        cpuid
+        rdtsc
+    }
+#else
+    return __rdtsc();
+#endif
+}
+
+//get current CPU clock rate in MHz
+void calcCpuSpeed()
+{
+    const uint64_t start = getCyclesCount();
+    SDL_Delay(200);
+    const uint64_t stop = getCyclesCount();
+    const uint64_t speed = (stop - start) / 200000;
+    cpuSpeed = uint32_t(speed);
+}
+
+//return CPU type (INTEL, AMD, ...)
+void calcCpuType()
+{
+    int32_t i = 0;
+    int32_t cpuInfo[4] = { 0 };
+
+    memset(cpuType, 0, sizeof(cpuType));
+    CPUID(cpuInfo, 0x00000000);
+
+    cpuType[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+    cpuType[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+    cpuType[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+    cpuType[i++] = cpuInfo[1] & 0xff;
+    cpuType[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+    cpuType[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+    cpuType[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+    cpuType[i++] = cpuInfo[3] & 0xff;
+    cpuType[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+    cpuType[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+    cpuType[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+    cpuType[i++] = cpuInfo[2] & 0xff;
+    if (!cpuType[0]) strncpy(cpuType, "<unknown>", sizeof(cpuType));
+}
+
+//return full CPU description string (i.e: Intel(R) Core(TM) i7-4770K CPU @ 3.50GHz)
+void calcCpuName()
+{
+    int32_t i = 0;
+    int32_t cpuInfo[4] = { 0 };
+    
+    memset(cpuName, 0, sizeof(cpuName));
+    CPUID(cpuInfo, 0x80000000);
+
+    if (cpuInfo[0] >= 0x80000004)
+    {
+        CPUID(cpuInfo, 0x80000002);
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        CPUID(cpuInfo, 0x80000003);
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        CPUID(cpuInfo, 0x80000004);
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[0] & 0xff; cpuInfo[0] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[1] & 0xff; cpuInfo[1] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[2] & 0xff; cpuInfo[2] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+        cpuName[i++] = cpuInfo[3] & 0xff; cpuInfo[3] >>= 8;
+    }
+    if (!cpuName[0]) strncpy(cpuName, "<unknown>", sizeof(cpuName));
+}
+
+//AMD 3DNow! detected
+bool have3DNow()
+{
+    int32_t cpuInfo[4] = { 0 };
+    CPUID(cpuInfo, 0x80000000);
+    if (cpuInfo[0] >= 0x80000001)
+    {
+        CPUID(cpuInfo, 0x80000001);
+        return cpuInfo[3] & 0x80000000;
+    }
+    return false;
+}
+
+//calculate some CPU features...
+void calcCpuFeatures()
+{
+    int32_t cpuInfo[4] = { 0 };
+    CPUID(cpuInfo, 0);
+    if (cpuInfo[0] >= 1) CPUID(cpuInfo, 1);
+
+    memset(cpuFeatures, 0, sizeof(cpuFeatures));
+
+    if (have3DNow()) strncat(cpuFeatures, "3DNow!,", sizeof(cpuFeatures) - 1);
+    if (cpuInfo[3] & 0x00800000) strncat(cpuFeatures, "MMX,", sizeof(cpuFeatures) - 1);
+    if (cpuInfo[3] & 0x02000000) strncat(cpuFeatures, "SSE,", sizeof(cpuFeatures) - 1);
+    if (cpuInfo[3] & 0x04000000) strncat(cpuFeatures, "SSE2,", sizeof(cpuFeatures) - 1);
+    if (cpuInfo[2] & 0x10000000) strncat(cpuFeatures, "AVX,", sizeof(cpuFeatures) - 1);
+
+#ifdef SDL_PLATFORM_APPLE
+    __cpuid_count(7, 0, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
+#else
+    __cpuidex(cpuInfo, 7, 0);
+#endif
+
+    if (cpuInfo[1] & 0x00000020) strncat(cpuFeatures, "AVX2,", sizeof(cpuFeatures) - 1);
+    if (cpuInfo[1] & 0x00010000) strncat(cpuFeatures, "AVX512,", sizeof(cpuFeatures) - 1);
+
+    size_t len = strlen(cpuFeatures);
+    if (len > 1) cpuFeatures[len - 1] = '\0';
+    else strncpy(cpuFeatures, "<none>", sizeof(cpuFeatures));
+}
+
+//initialize CPU info
+void initCpuInfo()
+{
+    calcCpuSpeed();
+    calcCpuType();
+    calcCpuName();
+    calcCpuFeatures();
+}
+
+//initialize video info
+void initVideoInfo()
+{
+    videoMemory = 0;
+    strncpy(videoName, "<unknown>", sizeof(videoName));
+    strncpy(modeInfo, "<unknown>", sizeof(modeInfo));
+    strncpy(driverVersion, "0.0.0.0", sizeof(driverVersion));
+    strncpy(renderVersion, "0.0.0.0", sizeof(renderVersion));
+    strncpy(imageVersion, "0.0.0.0", sizeof(imageVersion));
+    
+    //retrive SDL and SDL_image version string
+    const int32_t sdlver = SDL_GetVersion();
+    const int32_t imgver = IMG_Version();
+
+    snprintf(renderVersion, sizeof(renderVersion), "SDL %d.%d.%d", SDL_VERSIONNUM_MAJOR(sdlver), SDL_VERSIONNUM_MINOR(sdlver), SDL_VERSIONNUM_MICRO(sdlver));
+    snprintf(imageVersion, sizeof(imageVersion), "SDL_image %d.%d.%d", SDL_VERSIONNUM_MAJOR(imgver), SDL_VERSIONNUM_MINOR(imgver), SDL_VERSIONNUM_MICRO(imgver));
+    
+    //retrive current video mode info string
+    int width = gfxContext.texWidth, height = gfxContext.texHeight;
+    if (sdlRenderer) SDL_GetCurrentRenderOutputSize(sdlRenderer, &width, &height);
+    const SDL_DisplayMode* mode = (const SDL_DisplayMode*)SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(sdlWindow));
+    if (mode) snprintf(modeInfo, sizeof(modeInfo), "%dx%dx%db @ %.2fHz", width, height, SDL_BYTESPERPIXEL(mode->format) << 3, mode->refresh_rate);
+
+#ifdef SDL_PLATFORM_APPLE
+    io_iterator_t iterator;
+    CFMutableDictionaryRef matchDict;
+
+    //get dictionary of all the PCI Devices
+    matchDict = IOServiceMatching("IOPCIDevice");
+    
+    //get IOService descriptor
+    if (IOServiceGetMatchingServices(kIOMasterPortDefault, matchDict, &iterator) == kIOReturnSuccess)
+    {
+        //iterator for devices found
+        io_registry_entry_t regEntry;
+        
+        while ((regEntry = IOIteratorNext(iterator)))
+        {
+            //put this services object into a dictionary object.
+            CFMutableDictionaryRef serviceDictionary;
+            if (IORegistryEntryCreateCFProperties(regEntry, &serviceDictionary, kCFAllocatorDefault, kNilOptions) != kIOReturnSuccess)
+            {
+                //service dictionary creation failed.
+                IOObjectRelease(regEntry);
+                continue;
+            }
+            
+            //get graphic card model
+            CFDataRef GPUModel = (CFDataRef)CFDictionaryGetValue(serviceDictionary, CFSTR("model"));
+            if (GPUModel == NULL) continue;
+
+            //get graphic card name
+            CFIndex length = CFDataGetLength(GPUModel);
+            memcpy(videoName, CFDataGetBytePtr(GPUModel), length);
+            
+            //retrived driver version???
+            CFDataRef devNum = (CFDataRef)CFDictionaryGetValue(serviceDictionary, CFSTR("device-id"));
+            CFDataRef revNum = (CFDataRef)CFDictionaryGetValue(serviceDictionary, CFSTR("revision-id"));
+            if (revNum != NULL && devNum != NULL)
+            {
+                uint32_t deviceId = 0, revisionId = 0;
+                length = CFDataGetLength(devNum);
+                memcpy(&deviceId, CFDataGetBytePtr(devNum), length);
+                length = CFDataGetLength(revNum);
+                memcpy(&revisionId, CFDataGetBytePtr(revNum), length);
+                snprintf(driverVersion, sizeof(driverVersion), "%u.%u.%u.%u", HIWORD(deviceId), LOWORD(deviceId), HIWORD(revisionId), LOWORD(revisionId));
+            }
+            
+            // Release the dictionary
+            CFRelease(serviceDictionary);
+            
+            // Release the serviceObject
+            IOObjectRelease(regEntry);
+        }
+        
+        // Release the iterator
+        IOObjectRelease(iterator);
+    }
+    
+    //get graphic card memory
+    matchDict = IOServiceMatching(kIOAcceleratorClassName);
+    if (IOServiceGetMatchingServices(kIOMasterPortDefault, matchDict, &iterator) == kIOReturnSuccess)
+    {
+        //iterator for devices found
+        io_registry_entry_t regEntry;
+        
+        while ((regEntry = IOIteratorNext(iterator)))
+        {
+            //put this services object into a dictionary object.
+            CFMutableDictionaryRef serviceDictionary;
+            if (IORegistryEntryCreateCFProperties(regEntry, &serviceDictionary, kCFAllocatorDefault, kNilOptions) != kIOReturnSuccess)
+            {
+                //service dictionary creation failed.
+                IOObjectRelease(regEntry);
+                continue;
+            }
+            
+            //catch video memory key
+            CFNumberRef vram = (CFNumberRef)CFDictionaryGetValue(serviceDictionary, CFSTR("VRAM,totalMB"));
+            if (vram == NULL) continue;
+            
+            //get total video memory
+            CFNumberGetValue(vram, kCFNumberSInt32Type, &videoMemory);
+            
+            //release the dictionary
+            CFRelease(serviceDictionary);
+            
+            //release the serviceObject
+            IOObjectRelease(regEntry);
+        }
+        
+        //release the iterator
+        IOObjectRelease(iterator);
+    }
+#else
+    //retrive video memory of graphic card name
+    LUID luid = { 0 };
+    IDXGIFactory* factory = NULL;
+    if (SUCCEEDED(CreateDXGIFactory(IID_PPV_ARGS(&factory))))
+    {
+        IDXGIAdapter* adapter = NULL;
+        if (SUCCEEDED(factory->EnumAdapters(0, &adapter)))
+        {
+            DXGI_ADAPTER_DESC desc;
+            adapter->GetDesc(&desc);
+            adapter->Release();
+            luid = desc.AdapterLuid;
+            videoMemory = uint32_t(desc.DedicatedVideoMemory >> 20);
+            wcstombs(videoName, desc.Description, 128);
+        }
+        factory->Release();
+    }
+
+    //retrive graphic card driver version by fetch registry data
+    HKEY dxKeyHandle = NULL;
+    if (RegOpenKeyEx(HKEY_LOCAL_MACHINE, _T("SOFTWARE\\Microsoft\\DirectX"), 0, KEY_READ | KEY_WOW64_64KEY, &dxKeyHandle) != ERROR_SUCCESS) return;
+
+    //find all subkeys
+    DWORD numOfAdapters = 0;
+    DWORD subKeyMaxLength = 0;
+    if (RegQueryInfoKey(dxKeyHandle, NULL, NULL, NULL, &numOfAdapters, &subKeyMaxLength, NULL, NULL, NULL, NULL, NULL, NULL) != ERROR_SUCCESS)
+    {
+        RegCloseKey(dxKeyHandle);
+        return;
+    }
+
+    //must include the null character
+    subKeyMaxLength += 1;
+
+    bool foundVersion = false;
+    LARGE_INTEGER driverVersionRaw = { 0 };
+    TCHAR* subKeyName = (TCHAR*)calloc(subKeyMaxLength, sizeof(TCHAR));
+
+    for (DWORD i = 0; i < numOfAdapters; ++i)
+    {
+        DWORD subKeyLength = subKeyMaxLength;
+        if (RegEnumKeyEx(dxKeyHandle, i, subKeyName, &subKeyLength, NULL, NULL, NULL, NULL) == ERROR_SUCCESS)
+        {
+            LUID adapterLUID = {};
+            DWORD qwordSize = sizeof(uint64_t);
+
+            //find match the vendor ID and device ID
+            if (RegGetValue(dxKeyHandle, subKeyName, _T("AdapterLuid"), RRF_RT_QWORD, NULL, &adapterLUID, &qwordSize) == ERROR_SUCCESS && adapterLUID.HighPart == luid.HighPart && adapterLUID.LowPart == luid.LowPart)
+            {
+                //let's get the driver version num now
+                if (RegGetValue(dxKeyHandle, subKeyName, _T("DriverVersion"), RRF_RT_QWORD, NULL, &driverVersionRaw, &qwordSize) == ERROR_SUCCESS)
+                {
+                    foundVersion = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    //print driver version string
+    if (foundVersion) snprintf(driverVersion, sizeof(driverVersion), "%u.%u.%u.%u", HIWORD(driverVersionRaw.HighPart), LOWORD(driverVersionRaw.HighPart), HIWORD(driverVersionRaw.LowPart), LOWORD(driverVersionRaw.LowPart));
+    
+    //cleanup...
+    RegCloseKey(dxKeyHandle);
+    free(subKeyName);
+#endif
+}
+
+//initialize some system info
+bool initSystemInfo()
+{
+    initCpuInfo();
+    initVideoInfo();
+    initMemoryInfo();
+
+    //check CPU extension
+    if (!strstr(cpuFeatures, "AVX2") && !strstr(cpuFeatures, "3DNow!"))
+    {
+        messageBox(GFX_ERROR, "GFXLIB require modern CPU with support 3DNow!, MMX, SSE2, AVX2 features!");
+        return false;
+    }
+
+    //check CPU speed
+    if (cpuSpeed < 2000)
+    {
+        messageBox(GFX_ERROR, "GFXLIB require CPU speed more than 2000 MHz!");
+        return false;
+    }
+
+    //check free memory
+    if (availableMemory < 500)
+    {
+        messageBox(GFX_ERROR, "GFXLIB require system RAM more than 500 MB!");
+        return false;
+    }
+
+    //check for video RAM
+    if (videoMemory < 64)
+    {
+        messageBox(GFX_ERROR, "GFXLIB require video RAM more than 64 MB!");
+        return false;
+    }
+
+    return true;
+}
+
+//set windows title text
+void setWindowTitle(const char* title)
+{
+    //simulation mode, new title start new segment
+    if (simFrames)
+    {
+        endSegment();
+        SDL_strlcpy(simTitle, title, sizeof(simTitle));
+    }
+
+    if (!sdlWindow) return;
+    SDL_SetWindowTitle(sdlWindow, title);
+}
+
+//return current video memory in GB
+uint32_t getVideoMemory()
+{
+    return videoMemory;
+}
+
+//return total system memory in GB
+uint32_t getTotalMemory()
+{
+    return totalMemory;
+}
+
+//return free memory in GB
+uint32_t getAvailableMemory()
+{
+    return availableMemory;
+}
+
+//return name of graphic card
+const char* getVideoName()
+{
+    return videoName;
+}
+
+//return current CPU speed in MHZ
+uint32_t getCpuSpeed()
+{
+    return cpuSpeed;
+}
+
+//return current CPU type (INTEL, AMD)
+const char* getCpuType()
+{
+    return cpuType;
+}
+
+//return full string of CPU name
+const char* getCpuName()
+{
+    return cpuName;
+}
+
+//return CPU features (MMX, 3DNow!, SSE, SSE2, SSE3, ...)
+const char* getCpuFeatures()
+{
+    return cpuFeatures;
+}
+
+//return version of render system
+const char* getRenderVersion()
+{
+    return renderVersion;
+}
+
+//return version of image file loading
+const char* getImageVersion()
+{
+    return imageVersion;
+}
+
+//return render driver version
+const char* getDriverVersion()
+{
+    return driverVersion;
+}
+
+//return current video mode info (resolution-bitsperpixels-refreshrate)
+const char* getVideoModeInfo()
+{
+    return modeInfo;
+}
+
+/*============================ END OF GFXLIB.CPP ========================*/